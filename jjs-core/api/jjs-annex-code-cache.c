@@ -0,0 +1,1109 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-annex.h"
+#include "jjs-api-snapshot.h"
+#include "jjs-core.h"
+#include "jjs-platform.h"
+#include "jjs-util.h"
+#include "jjs.h"
+
+#include "ecma-builtins.h"
+#include "ecma-function-object.h"
+#include "ecma-gc.h"
+#include "ecma-helpers.h"
+#include "ecma-lex-env.h"
+#include "ecma-module.h"
+
+#include "annex.h"
+#include "debugger.h"
+#include "jcontext.h"
+#include "lit-strings.h"
+
+#if JJS_ANNEX_CODE_CACHE
+
+/**
+ * Magic number of code cache entries ("JJSC").
+ */
+#define CODE_CACHE_MAGIC (0x43534A4Au)
+
+/**
+ * Version of the code cache entry layout.
+ */
+#define CODE_CACHE_VERSION (1u)
+
+/**
+ * Version of the engine that wrote the entry.
+ */
+#define CODE_CACHE_ENGINE_VERSION \
+  ((uint32_t) ((JJS_API_MAJOR_VERSION << 16) | (JJS_API_MINOR_VERSION << 8) | JJS_API_PATCH_VERSION))
+
+/**
+ * Build configuration that affects the layout of the cached byte code.
+ */
+#define CODE_CACHE_BUILD_FLAGS                                                                     \
+  ((uint32_t) (sizeof (ecma_number_t) | (sizeof (void *) << 4) | (JJS_CPOINTER_32_BIT << 8)       \
+               | (JJS_FUNCTION_TO_STRING << 9) | (JJS_BUILTIN_BIGINT << 10) | (JJS_SOURCE_NAME << 11) \
+               | (JJS_BUILTIN_REALMS << 12)))
+
+/**
+ * Extension of code cache entry files.
+ */
+#define CODE_CACHE_FILE_EXTENSION ".jjsc"
+
+/**
+ * Initial snapshot buffer size is this many times the size of the source.
+ */
+#define CODE_CACHE_SNAPSHOT_SIZE_FACTOR 2
+
+/**
+ * Extra snapshot buffer space for small sources.
+ */
+#define CODE_CACHE_SNAPSHOT_SIZE_EXTRA 4096
+
+/**
+ * Modules with larger snapshots than this are not cached.
+ */
+#define CODE_CACHE_SNAPSHOT_SIZE_LIMIT (16u * 1024u * 1024u)
+
+/**
+ * FNV-1a 64 bit offset basis.
+ */
+#define CODE_CACHE_FNV_OFFSET_BASIS (0xCBF29CE484222325ull)
+
+/**
+ * FNV-1a 64 bit prime.
+ */
+#define CODE_CACHE_FNV_PRIME (0x100000001B3ull)
+
+/**
+ * Code cache entry flags.
+ */
+typedef enum
+{
+  CODE_CACHE_FLAGS_MODULE = (1u << 0), /**< entry contains an ES module */
+  CODE_CACHE_FLAGS_UNCACHEABLE = (1u << 1), /**< the source cannot be stored in a snapshot */
+} code_cache_flags_t;
+
+/**
+ * Header of a code cache entry.
+ *
+ * The header is followed by the source path, the module records (ES modules only) and
+ * the snapshot of the compiled code. Each part starts at a JMEM_ALIGNMENT aligned offset.
+ */
+typedef struct
+{
+  uint32_t magic; /**< CODE_CACHE_MAGIC */
+  uint32_t version; /**< CODE_CACHE_VERSION */
+  uint32_t snapshot_version; /**< JJS_SNAPSHOT_VERSION */
+  uint32_t engine_version; /**< CODE_CACHE_ENGINE_VERSION */
+  uint32_t build_flags; /**< CODE_CACHE_BUILD_FLAGS */
+  uint32_t flags; /**< code_cache_flags_t */
+  uint32_t script_flags; /**< CBC_SCRIPT_* flags of the compiled script */
+  uint32_t source_size; /**< size of the source code in bytes */
+  uint32_t source_hash[2]; /**< hash of the source code */
+  uint32_t path_size; /**< size of the source path in bytes */
+  uint32_t records_size; /**< size of the module records in bytes */
+  uint32_t snapshot_size; /**< size of the snapshot in bytes */
+  uint32_t reserved; /**< reserved, must be zero */
+} code_cache_header_t;
+
+/**
+ * Identity of the source code of a module.
+ */
+typedef struct
+{
+  uint64_t hash; /**< hash of the source code */
+  lit_utf8_size_t size; /**< size of the source code */
+} code_cache_key_t;
+
+#if JJS_ANNEX_ESM
+
+/**
+ * Module records writer.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< output buffer, NULL when only the size is computed */
+  size_t size; /**< number of bytes written */
+} code_cache_writer_t;
+
+/**
+ * Module records reader.
+ */
+typedef struct
+{
+  const uint8_t *current_p; /**< current position */
+  const uint8_t *end_p; /**< end of the records */
+} code_cache_reader_t;
+
+#endif /* JJS_ANNEX_ESM */
+
+/**
+ * Compute the FNV-1a hash of a byte sequence.
+ *
+ * @return hash
+ */
+static uint64_t
+code_cache_hash (const lit_utf8_byte_t *data_p, /**< data */
+                 lit_utf8_size_t size) /**< size of the data */
+{
+  uint64_t hash = CODE_CACHE_FNV_OFFSET_BASIS;
+
+  for (lit_utf8_size_t i = 0; i < size; i++)
+  {
+    hash ^= data_p[i];
+    hash *= CODE_CACHE_FNV_PRIME;
+  }
+
+  return hash;
+} /* code_cache_hash */
+
+/**
+ * Compute the identity of a source code string.
+ */
+static void
+code_cache_key (jjs_context_t *context_p, /**< JJS context */
+                ecma_value_t source, /**< source code string */
+                code_cache_key_t *key_p) /**< [out] source identity */
+{
+  ECMA_STRING_TO_UTF8_STRING (context_p, ecma_get_string_from_value (context_p, source), source_bytes_p, source_size);
+
+  key_p->hash = code_cache_hash (source_bytes_p, source_size);
+  key_p->size = source_size;
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, source_bytes_p, source_size);
+} /* code_cache_key */
+
+/**
+ * Create the filename of the code cache entry of a source path.
+ *
+ * @return filename string
+ */
+static ecma_value_t
+code_cache_entry_path (jjs_context_t *context_p, /**< JJS context */
+                       ecma_value_t path) /**< resolved source path */
+{
+  static const char hex_digits[] = "0123456789abcdef";
+  char name[2 * sizeof (uint64_t) + sizeof (CODE_CACHE_FILE_EXTENSION)];
+  uint64_t hash;
+
+  ECMA_STRING_TO_UTF8_STRING (context_p, ecma_get_string_from_value (context_p, path), path_bytes_p, path_size);
+  hash = code_cache_hash (path_bytes_p, path_size);
+  ECMA_FINALIZE_UTF8_STRING (context_p, path_bytes_p, path_size);
+
+  for (size_t i = 2 * sizeof (uint64_t); i > 0; i--)
+  {
+    name[i - 1] = hex_digits[hash & 0xf];
+    hash >>= 4;
+  }
+
+  memcpy (name + 2 * sizeof (uint64_t), CODE_CACHE_FILE_EXTENSION, sizeof (CODE_CACHE_FILE_EXTENSION));
+
+  ecma_value_t name_value = ecma_string_ascii_sz (context_p, name);
+  ecma_value_t result = annex_path_join (context_p, context_p->code_cache_dir, name_value, false);
+
+  ecma_free_value (context_p, name_value);
+
+  return result;
+} /* code_cache_entry_path */
+
+/**
+ * Check whether a parse request can be served from the code cache.
+ *
+ * @return true - if the code cache can be used, false - otherwise
+ */
+static bool
+code_cache_is_applicable (jjs_context_t *context_p, /**< JJS context */
+                          jjs_value_t source, /**< source code */
+                          const jjs_parse_options_t *options_p) /**< parsing options */
+{
+  if (!ecma_is_value_string (context_p->code_cache_dir) || !ecma_is_value_string (source) || options_p == NULL)
+  {
+    return false;
+  }
+
+#if JJS_DEBUGGER
+  if (context_p->debugger_flags & JJS_DEBUGGER_CONNECTED)
+  {
+    return false;
+  }
+#endif /* JJS_DEBUGGER */
+
+  if (!options_p->source_name.has_value || !ecma_is_value_string (options_p->source_name.value)
+      || options_p->source_name_o != JJS_KEEP || options_p->user_value_o != JJS_KEEP
+      || options_p->argument_list_o != JJS_KEEP || options_p->is_strict_mode || options_p->start_line.has_value
+      || options_p->start_column.has_value)
+  {
+    return false;
+  }
+
+  if (options_p->parse_module)
+  {
+#if JJS_ANNEX_ESM
+    return !options_p->argument_list.has_value;
+#else /* !JJS_ANNEX_ESM */
+    return false;
+#endif /* JJS_ANNEX_ESM */
+  }
+
+  return options_p->argument_list.has_value && ecma_is_value_string (options_p->argument_list.value);
+} /* code_cache_is_applicable */
+
+#if JJS_ANNEX_ESM
+
+/**
+ * Append bytes to the module records.
+ */
+static void
+code_cache_write (code_cache_writer_t *writer_p, /**< writer */
+                  const void *data_p, /**< data */
+                  size_t size) /**< size of the data */
+{
+  if (writer_p->buffer_p != NULL && size > 0)
+  {
+    memcpy (writer_p->buffer_p + writer_p->size, data_p, size);
+  }
+
+  writer_p->size += size;
+} /* code_cache_write */
+
+/**
+ * Append a 32 bit integer to the module records.
+ */
+static void
+code_cache_write_u32 (code_cache_writer_t *writer_p, /**< writer */
+                      uint32_t value) /**< value */
+{
+  code_cache_write (writer_p, &value, sizeof (uint32_t));
+} /* code_cache_write_u32 */
+
+/**
+ * Append a string to the module records.
+ */
+static void
+code_cache_write_string (jjs_context_t *context_p, /**< JJS context */
+                         code_cache_writer_t *writer_p, /**< writer */
+                         ecma_string_t *string_p) /**< string */
+{
+  static const uint8_t padding[sizeof (uint32_t)] = { 0 };
+
+  ECMA_STRING_TO_UTF8_STRING (context_p, string_p, string_bytes_p, string_size);
+
+  code_cache_write_u32 (writer_p, string_size);
+  code_cache_write (writer_p, string_bytes_p, string_size);
+  code_cache_write (writer_p, padding, JJS_ALIGNUP (string_size, sizeof (uint32_t)) - string_size);
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, string_bytes_p, string_size);
+} /* code_cache_write_string */
+
+/**
+ * Append a list of import / export names to the module records.
+ */
+static void
+code_cache_write_names (jjs_context_t *context_p, /**< JJS context */
+                        code_cache_writer_t *writer_p, /**< writer */
+                        const ecma_module_names_t *names_p) /**< first name */
+{
+  uint32_t count = 0;
+
+  for (const ecma_module_names_t *name_p = names_p; name_p != NULL; name_p = name_p->next_p)
+  {
+    count++;
+  }
+
+  code_cache_write_u32 (writer_p, count);
+
+  for (const ecma_module_names_t *name_p = names_p; name_p != NULL; name_p = name_p->next_p)
+  {
+    code_cache_write_string (context_p, writer_p, name_p->imex_name_p);
+    code_cache_write_string (context_p, writer_p, name_p->local_name_p);
+  }
+} /* code_cache_write_names */
+
+/**
+ * Append a list of module nodes to the module records.
+ *
+ * Import nodes store their module specifier, while export nodes store the index
+ * of the import node they refer to.
+ */
+static void
+code_cache_write_nodes (jjs_context_t *context_p, /**< JJS context */
+                        code_cache_writer_t *writer_p, /**< writer */
+                        const ecma_module_t *module_p, /**< module */
+                        const ecma_module_node_t *nodes_p, /**< first node */
+                        bool is_import) /**< nodes are import nodes */
+{
+  uint32_t count = 0;
+
+  for (const ecma_module_node_t *node_p = nodes_p; node_p != NULL; node_p = node_p->next_p)
+  {
+    count++;
+  }
+
+  code_cache_write_u32 (writer_p, count);
+
+  for (const ecma_module_node_t *node_p = nodes_p; node_p != NULL; node_p = node_p->next_p)
+  {
+    if (is_import)
+    {
+      JJS_ASSERT (ecma_is_value_string (node_p->u.path_or_module));
+      code_cache_write_string (context_p, writer_p, ecma_get_string_from_value (context_p, node_p->u.path_or_module));
+    }
+    else
+    {
+      uint32_t index = 0;
+      const ecma_module_node_t *import_node_p = module_p->imports_p;
+
+      while (&import_node_p->u.path_or_module != node_p->u.module_object_p)
+      {
+        import_node_p = import_node_p->next_p;
+        index++;
+      }
+
+      code_cache_write_u32 (writer_p, index);
+    }
+
+    code_cache_write_names (context_p, writer_p, node_p->module_names_p);
+  }
+} /* code_cache_write_nodes */
+
+/**
+ * Write the import and export records of a module.
+ */
+static void
+code_cache_write_module_records (jjs_context_t *context_p, /**< JJS context */
+                                 code_cache_writer_t *writer_p, /**< writer */
+                                 const ecma_module_t *module_p) /**< module */
+{
+  code_cache_write_nodes (context_p, writer_p, module_p, module_p->imports_p, true);
+  code_cache_write_names (context_p, writer_p, module_p->local_exports_p);
+  code_cache_write_nodes (context_p, writer_p, module_p, module_p->indirect_exports_p, false);
+  code_cache_write_nodes (context_p, writer_p, module_p, module_p->star_exports_p, false);
+} /* code_cache_write_module_records */
+
+/**
+ * Read a 32 bit integer from the module records.
+ *
+ * @return true - if successful, false - otherwise
+ */
+static bool
+code_cache_read_u32 (code_cache_reader_t *reader_p, /**< reader */
+                     uint32_t *value_p) /**< [out] value */
+{
+  if ((size_t) (reader_p->end_p - reader_p->current_p) < sizeof (uint32_t))
+  {
+    return false;
+  }
+
+  memcpy (value_p, reader_p->current_p, sizeof (uint32_t));
+  reader_p->current_p += sizeof (uint32_t);
+  return true;
+} /* code_cache_read_u32 */
+
+/**
+ * Read a string from the module records.
+ *
+ * @return string - if successful, NULL - otherwise
+ */
+static ecma_string_t *
+code_cache_read_string (jjs_context_t *context_p, /**< JJS context */
+                        code_cache_reader_t *reader_p) /**< reader */
+{
+  uint32_t string_size;
+
+  if (!code_cache_read_u32 (reader_p, &string_size))
+  {
+    return NULL;
+  }
+
+  size_t aligned_size = JJS_ALIGNUP ((size_t) string_size, sizeof (uint32_t));
+  const lit_utf8_byte_t *string_bytes_p = reader_p->current_p;
+
+  if (aligned_size > (size_t) (reader_p->end_p - reader_p->current_p)
+      || !lit_is_valid_cesu8_string (string_bytes_p, string_size))
+  {
+    return NULL;
+  }
+
+  reader_p->current_p += aligned_size;
+  return ecma_new_ecma_string_from_utf8 (context_p, string_bytes_p, string_size);
+} /* code_cache_read_string */
+
+/**
+ * Read a list of import / export names from the module records.
+ *
+ * @return true - if successful, false - otherwise
+ */
+static bool
+code_cache_read_names (jjs_context_t *context_p, /**< JJS context */
+                       code_cache_reader_t *reader_p, /**< reader */
+                       ecma_module_names_t **names_p) /**< [out] list of names */
+{
+  uint32_t count;
+
+  if (!code_cache_read_u32 (reader_p, &count))
+  {
+    return false;
+  }
+
+  while (count-- > 0)
+  {
+    ecma_string_t *imex_name_p = code_cache_read_string (context_p, reader_p);
+
+    if (imex_name_p == NULL)
+    {
+      return false;
+    }
+
+    ecma_string_t *local_name_p = code_cache_read_string (context_p, reader_p);
+
+    if (local_name_p == NULL)
+    {
+      ecma_deref_ecma_string (context_p, imex_name_p);
+      return false;
+    }
+
+    ecma_module_names_t *name_p = (ecma_module_names_t *) jmem_heap_alloc_block (context_p, sizeof (ecma_module_names_t));
+
+    name_p->next_p = NULL;
+    name_p->imex_name_p = imex_name_p;
+    name_p->local_name_p = local_name_p;
+
+    *names_p = name_p;
+    names_p = &name_p->next_p;
+  }
+
+  return true;
+} /* code_cache_read_names */
+
+/**
+ * Read a list of module nodes from the module records.
+ *
+ * @return true - if successful, false - otherwise
+ */
+static bool
+code_cache_read_nodes (jjs_context_t *context_p, /**< JJS context */
+                       code_cache_reader_t *reader_p, /**< reader */
+                       ecma_module_t *module_p, /**< module */
+                       ecma_module_node_t **nodes_p, /**< [out] list of nodes */
+                       bool is_import) /**< nodes are import nodes */
+{
+  uint32_t count;
+
+  if (!code_cache_read_u32 (reader_p, &count))
+  {
+    return false;
+  }
+
+  while (count-- > 0)
+  {
+    ecma_value_t path_or_module = ECMA_VALUE_EMPTY;
+    ecma_module_node_t *import_node_p = NULL;
+
+    if (is_import)
+    {
+      ecma_string_t *path_p = code_cache_read_string (context_p, reader_p);
+
+      if (path_p == NULL)
+      {
+        return false;
+      }
+
+      path_or_module = ecma_make_string_value (context_p, path_p);
+    }
+    else
+    {
+      uint32_t index;
+
+      if (!code_cache_read_u32 (reader_p, &index))
+      {
+        return false;
+      }
+
+      import_node_p = module_p->imports_p;
+
+      while (import_node_p != NULL && index-- > 0)
+      {
+        import_node_p = import_node_p->next_p;
+      }
+
+      if (import_node_p == NULL)
+      {
+        return false;
+      }
+    }
+
+    ecma_module_node_t *node_p = (ecma_module_node_t *) jmem_heap_alloc_block (context_p, sizeof (ecma_module_node_t));
+
+    node_p->next_p = NULL;
+    node_p->module_names_p = NULL;
+
+    if (is_import)
+    {
+      node_p->u.path_or_module = path_or_module;
+    }
+    else
+    {
+      node_p->u.module_object_p = &import_node_p->u.path_or_module;
+    }
+
+    *nodes_p = node_p;
+    nodes_p = &node_p->next_p;
+
+    if (!code_cache_read_names (context_p, reader_p, &node_p->module_names_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* code_cache_read_nodes */
+
+/**
+ * Read the import and export records of a module.
+ *
+ * Note:
+ *      on failure, the partially restored records are released with the module
+ *
+ * @return true - if successful, false - otherwise
+ */
+static bool
+code_cache_read_module_records (jjs_context_t *context_p, /**< JJS context */
+                                code_cache_reader_t *reader_p, /**< reader */
+                                ecma_module_t *module_p) /**< module */
+{
+  return (code_cache_read_nodes (context_p, reader_p, module_p, &module_p->imports_p, true)
+          && code_cache_read_names (context_p, reader_p, &module_p->local_exports_p)
+          && code_cache_read_nodes (context_p, reader_p, module_p, &module_p->indirect_exports_p, false)
+          && code_cache_read_nodes (context_p, reader_p, module_p, &module_p->star_exports_p, false)
+          && reader_p->current_p == reader_p->end_p);
+} /* code_cache_read_module_records */
+
+#endif /* JJS_ANNEX_ESM */
+
+/**
+ * Create a module or a function from the contents of a code cache entry.
+ *
+ * @return compiled module or function - if the entry matches the source,
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+code_cache_load_entry (jjs_context_t *context_p, /**< JJS context */
+                       uint8_t *data_p, /**< entry contents */
+                       size_t data_size, /**< size of the entry */
+                       ecma_value_t source, /**< source code */
+                       const jjs_parse_options_t *options_p, /**< parsing options */
+                       const code_cache_key_t *key_p, /**< source identity */
+                       bool *is_uncacheable_p) /**< [out] the source cannot be cached */
+{
+  const code_cache_header_t *header_p = (const code_cache_header_t *) data_p;
+  const uint32_t module_flag = options_p->parse_module ? CODE_CACHE_FLAGS_MODULE : 0;
+
+  if (data_size < sizeof (code_cache_header_t) || ((uintptr_t) data_p & (JMEM_ALIGNMENT - 1)) != 0
+      || header_p->magic != CODE_CACHE_MAGIC || header_p->version != CODE_CACHE_VERSION
+      || header_p->snapshot_version != JJS_SNAPSHOT_VERSION || header_p->engine_version != CODE_CACHE_ENGINE_VERSION
+      || header_p->build_flags != CODE_CACHE_BUILD_FLAGS || (header_p->flags & CODE_CACHE_FLAGS_MODULE) != module_flag
+      || header_p->source_size != key_p->size || header_p->source_hash[0] != (uint32_t) key_p->hash
+      || header_p->source_hash[1] != (uint32_t) (key_p->hash >> 32))
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  /* The path is compared to detect collisions of the entry filenames. */
+  size_t offset = JJS_ALIGNUP (sizeof (code_cache_header_t), JMEM_ALIGNMENT);
+  bool is_same_path;
+
+  if (header_p->path_size > data_size - offset)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (context_p,
+                              ecma_get_string_from_value (context_p, options_p->source_name.value),
+                              path_bytes_p,
+                              path_size);
+  is_same_path = (path_size == header_p->path_size && memcmp (data_p + offset, path_bytes_p, path_size) == 0);
+  ECMA_FINALIZE_UTF8_STRING (context_p, path_bytes_p, path_size);
+
+  if (!is_same_path)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  if (header_p->flags & CODE_CACHE_FLAGS_UNCACHEABLE)
+  {
+    *is_uncacheable_p = true;
+    return ECMA_VALUE_EMPTY;
+  }
+
+  offset = JJS_ALIGNUP (offset + header_p->path_size, JMEM_ALIGNMENT);
+
+  if (offset > data_size || header_p->records_size > data_size - offset)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  size_t records_offset = offset;
+  offset = JJS_ALIGNUP (offset + header_p->records_size, JMEM_ALIGNMENT);
+
+  if (offset > data_size || header_p->snapshot_size > data_size - offset
+      || !snapshot_is_loadable ((const uint32_t *) (data_p + offset), header_p->snapshot_size))
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+#if JJS_ANNEX_ESM
+  ecma_module_t *module_p = NULL;
+
+  if (options_p->parse_module)
+  {
+    code_cache_reader_t reader = {
+      .current_p = data_p + records_offset,
+      .end_p = data_p + records_offset + header_p->records_size,
+    };
+
+    module_p = ecma_module_create (context_p);
+
+    if (!code_cache_read_module_records (context_p, &reader, module_p))
+    {
+      ecma_deref_object ((ecma_object_t *) module_p);
+      return ECMA_VALUE_EMPTY;
+    }
+  }
+#endif /* JJS_ANNEX_ESM */
+
+  /* The script is created the same way as the parser creates it. */
+  ecma_value_t user_value = options_p->user_value.has_value ? options_p->user_value.value : ECMA_VALUE_EMPTY;
+  size_t script_size = sizeof (cbc_script_t);
+
+  if (user_value != ECMA_VALUE_EMPTY)
+  {
+    script_size += sizeof (ecma_value_t);
+  }
+
+#if JJS_ANNEX_ESM
+  if (module_p != NULL && (header_p->script_flags & CBC_SCRIPT_HAS_IMPORT_META))
+  {
+    script_size += sizeof (ecma_value_t);
+  }
+#endif /* JJS_ANNEX_ESM */
+
+#if JJS_FUNCTION_TO_STRING
+  if (!options_p->parse_module)
+  {
+    script_size += sizeof (ecma_value_t);
+  }
+#endif /* JJS_FUNCTION_TO_STRING */
+
+  cbc_script_t *script_p = (cbc_script_t *) jmem_heap_alloc_block (context_p, script_size);
+
+  CBC_SCRIPT_SET_TYPE (script_p, user_value, CBC_SCRIPT_REF_ONE);
+
+  if (!options_p->parse_module)
+  {
+    script_p->refs_and_type |= CBC_SCRIPT_IS_EVAL_CODE;
+  }
+
+#if JJS_BUILTIN_REALMS
+  script_p->realm_p = (ecma_object_t *) context_p->global_object_p;
+#endif /* JJS_BUILTIN_REALMS */
+
+#if JJS_SOURCE_NAME
+  ecma_ref_ecma_string (ecma_get_string_from_value (context_p, options_p->source_name.value));
+  script_p->source_name = options_p->source_name.value;
+#endif /* JJS_SOURCE_NAME */
+
+#if JJS_FUNCTION_TO_STRING
+  ecma_ref_ecma_string (ecma_get_string_from_value (context_p, source));
+  script_p->source_code = source;
+#else /* !JJS_FUNCTION_TO_STRING */
+  JJS_UNUSED (source);
+#endif /* JJS_FUNCTION_TO_STRING */
+
+  ecma_compiled_code_t *bytecode_p =
+    snapshot_load_primary_code (context_p, (const uint32_t *) (data_p + offset), script_p);
+
+  script_p->refs_and_type -= CBC_SCRIPT_REF_ONE;
+
+  if (user_value != ECMA_VALUE_EMPTY)
+  {
+    CBC_SCRIPT_GET_USER_VALUE (script_p) = ecma_copy_value_if_not_object (context_p, user_value);
+  }
+
+#if JJS_ANNEX_ESM
+  if (module_p != NULL)
+  {
+    if (header_p->script_flags & CBC_SCRIPT_HAS_IMPORT_META)
+    {
+      int idx = (user_value != ECMA_VALUE_EMPTY) ? 1 : 0;
+
+      CBC_SCRIPT_GET_OPTIONAL_VALUES (script_p)[idx] = ecma_make_object_value (context_p, (ecma_object_t *) module_p);
+      script_p->refs_and_type |= CBC_SCRIPT_HAS_IMPORT_META;
+    }
+
+    module_p->u.compiled_code_p = bytecode_p;
+    return ecma_make_object_value (context_p, (ecma_object_t *) module_p);
+  }
+#endif /* JJS_ANNEX_ESM */
+
+#if JJS_FUNCTION_TO_STRING
+  int idx = (user_value != ECMA_VALUE_EMPTY) ? 1 : 0;
+
+  CBC_SCRIPT_GET_OPTIONAL_VALUES (script_p)[idx] = options_p->argument_list.value;
+  ecma_ref_ecma_string (ecma_get_string_from_value (context_p, options_p->argument_list.value));
+  script_p->refs_and_type |= CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS;
+#endif /* JJS_FUNCTION_TO_STRING */
+
+  ecma_object_t *global_object_p = ecma_builtin_get_global (context_p);
+  ecma_object_t *lex_env_p = ecma_get_global_environment (context_p, global_object_p);
+  ecma_object_t *func_obj_p = ecma_op_create_simple_function_object (context_p, lex_env_p, bytecode_p);
+  ecma_bytecode_deref (context_p, bytecode_p);
+
+  return ecma_make_object_value (context_p, func_obj_p);
+} /* code_cache_load_entry */
+
+/**
+ * Load a module or a function from the code cache.
+ *
+ * @return compiled module or function - if a matching entry is found,
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+code_cache_load (jjs_context_t *context_p, /**< JJS context */
+                 ecma_value_t entry_path, /**< filename of the entry */
+                 ecma_value_t source, /**< source code */
+                 const jjs_parse_options_t *options_p, /**< parsing options */
+                 const code_cache_key_t *key_p, /**< source identity */
+                 bool *is_uncacheable_p) /**< [out] the source cannot be cached */
+{
+  jjs_allocator_t *allocator_p = jmem_scratch_allocator_acquire (context_p);
+  jjs_platform_buffer_t buffer = jjs_platform_buffer (NULL, 0, allocator_p);
+  ecma_value_t result = jjsp_read_file_buffer (context_p, entry_path, allocator_p, allocator_p, &buffer);
+
+  if (jjs_value_is_exception (context_p, result))
+  {
+    jjs_value_free (context_p, result);
+    result = ECMA_VALUE_EMPTY;
+  }
+  else
+  {
+    result = code_cache_load_entry (context_p,
+                                    (uint8_t *) buffer.data_p,
+                                    buffer.data_size,
+                                    source,
+                                    options_p,
+                                    key_p,
+                                    is_uncacheable_p);
+    buffer.free (&buffer);
+  }
+
+  jmem_scratch_allocator_release (context_p);
+
+  return result;
+} /* code_cache_load */
+
+/**
+ * Store a compiled module or function in the code cache.
+ *
+ * Sources that cannot be stored in a snapshot (e.g. they contain tagged template
+ * literals) are recorded as uncacheable, so they are not compiled twice next time.
+ */
+static void
+code_cache_store (jjs_context_t *context_p, /**< JJS context */
+                  ecma_value_t entry_path, /**< filename of the entry */
+                  ecma_value_t compiled, /**< compiled module or function */
+                  const jjs_parse_options_t *options_p, /**< parsing options */
+                  const code_cache_key_t *key_p) /**< source identity */
+{
+  ecma_object_t *object_p = ecma_get_object_from_value (context_p, compiled);
+  const ecma_compiled_code_t *bytecode_p;
+
+#if JJS_ANNEX_ESM
+  const ecma_module_t *module_p = NULL;
+  code_cache_writer_t records = { .buffer_p = NULL, .size = 0 };
+
+  if (options_p->parse_module)
+  {
+    module_p = (const ecma_module_t *) object_p;
+    bytecode_p = module_p->u.compiled_code_p;
+    code_cache_write_module_records (context_p, &records, module_p);
+  }
+  else
+#endif /* JJS_ANNEX_ESM */
+  {
+    bytecode_p = ecma_op_function_get_compiled_code (context_p, (ecma_extended_object_t *) object_p);
+  }
+
+  ecma_value_t script_value = ((const cbc_uint8_arguments_t *) bytecode_p)->script_value;
+  const cbc_script_t *script_p = ECMA_GET_INTERNAL_VALUE_POINTER (context_p, cbc_script_t, script_value);
+
+  code_cache_header_t header = {
+    .magic = CODE_CACHE_MAGIC,
+    .version = CODE_CACHE_VERSION,
+    .snapshot_version = JJS_SNAPSHOT_VERSION,
+    .engine_version = CODE_CACHE_ENGINE_VERSION,
+    .build_flags = CODE_CACHE_BUILD_FLAGS,
+    .flags = options_p->parse_module ? CODE_CACHE_FLAGS_MODULE : 0,
+    .script_flags = script_p->refs_and_type & CBC_SCRIPT_HAS_IMPORT_META,
+    .source_size = key_p->size,
+    .source_hash = { (uint32_t) key_p->hash, (uint32_t) (key_p->hash >> 32) },
+  };
+
+  ECMA_STRING_TO_UTF8_STRING (context_p,
+                              ecma_get_string_from_value (context_p, options_p->source_name.value),
+                              path_bytes_p,
+                              path_size);
+
+  header.path_size = path_size;
+#if JJS_ANNEX_ESM
+  header.records_size = (uint32_t) records.size;
+#endif /* JJS_ANNEX_ESM */
+
+  size_t records_offset = JJS_ALIGNUP (JJS_ALIGNUP (sizeof (code_cache_header_t), JMEM_ALIGNMENT) + path_size,
+                                       JMEM_ALIGNMENT);
+  size_t snapshot_offset = JJS_ALIGNUP (records_offset + header.records_size, JMEM_ALIGNMENT);
+  size_t snapshot_capacity =
+    JJS_ALIGNUP ((size_t) key_p->size * CODE_CACHE_SNAPSHOT_SIZE_FACTOR + CODE_CACHE_SNAPSHOT_SIZE_EXTRA,
+                 JMEM_ALIGNMENT);
+  jjs_allocator_t *allocator_p = jmem_scratch_allocator_acquire (context_p);
+  uint8_t *buffer_p = NULL;
+
+  while (snapshot_capacity <= CODE_CACHE_SNAPSHOT_SIZE_LIMIT)
+  {
+    buffer_p = jjs_allocator_alloc (allocator_p, (jjs_size_t) (snapshot_offset + snapshot_capacity));
+
+    if (buffer_p == NULL)
+    {
+      break;
+    }
+
+    bool is_buffer_too_small = false;
+    ecma_value_t snapshot_result = snapshot_generate (context_p,
+                                                      bytecode_p,
+                                                      0,
+                                                      (uint32_t *) (buffer_p + snapshot_offset),
+                                                      snapshot_capacity,
+                                                      &is_buffer_too_small);
+
+    if (!jjs_value_is_exception (context_p, snapshot_result))
+    {
+      header.snapshot_size = (uint32_t) ecma_get_number_from_value (context_p, snapshot_result);
+      ecma_free_value (context_p, snapshot_result);
+      break;
+    }
+
+    jjs_value_free (context_p, snapshot_result);
+    jjs_allocator_free (allocator_p, buffer_p, (jjs_size_t) (snapshot_offset + snapshot_capacity));
+    buffer_p = NULL;
+
+    if (!is_buffer_too_small)
+    {
+      /* Only the header and the path are stored for uncacheable sources. */
+      header.flags |= CODE_CACHE_FLAGS_UNCACHEABLE;
+      header.records_size = 0;
+      snapshot_offset = records_offset;
+      buffer_p = jjs_allocator_alloc (allocator_p, (jjs_size_t) snapshot_offset);
+      break;
+    }
+
+    snapshot_capacity *= 2;
+  }
+
+  if (buffer_p != NULL)
+  {
+    memset (buffer_p, 0, snapshot_offset);
+    memcpy (buffer_p, &header, sizeof (code_cache_header_t));
+    memcpy (buffer_p + JJS_ALIGNUP (sizeof (code_cache_header_t), JMEM_ALIGNMENT), path_bytes_p, path_size);
+
+#if JJS_ANNEX_ESM
+    if (header.records_size > 0)
+    {
+      records.buffer_p = buffer_p + records_offset;
+      records.size = 0;
+      code_cache_write_module_records (context_p, &records, module_p);
+      JJS_ASSERT (records.size == header.records_size);
+    }
+#endif /* JJS_ANNEX_ESM */
+
+    jjs_size_t entry_size = (jjs_size_t) (snapshot_offset + header.snapshot_size);
+
+    if (jjsp_write_file_buffer (context_p, entry_path, allocator_p, buffer_p, entry_size) == JJS_STATUS_OK)
+    {
+      context_p->code_cache_writes++;
+    }
+  }
+
+  jmem_scratch_allocator_release (context_p);
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, path_bytes_p, path_size);
+} /* code_cache_store */
+
+#endif /* JJS_ANNEX_CODE_CACHE */
+
+/**
+ * Parse the source of an ES module or a CommonJS module, using the code cache if
+ * it is enabled.
+ *
+ * The compiled code of a module is stored in the code cache directory, keyed by the
+ * module path. An entry is only used if it was written by the same engine build from
+ * the same source. Otherwise, the module is parsed and the entry is rewritten.
+ *
+ * Note: options_p values must be passed with JJS_KEEP ownership to use the cache.
+ *
+ * @return compiled module or function - if successful,
+ *         thrown error - otherwise
+ */
+jjs_value_t
+jjs_annex_code_cache_parse (jjs_context_t *context_p, /**< JJS context */
+                            jjs_value_t source, /**< source code */
+                            const jjs_parse_options_t *options_p) /**< parsing options */
+{
+#if JJS_ANNEX_CODE_CACHE
+  if (!code_cache_is_applicable (context_p, source, options_p))
+  {
+    return jjs_parse_value (context_p, source, JJS_KEEP, options_p);
+  }
+
+  code_cache_key_t key;
+  bool is_uncacheable = false;
+
+  code_cache_key (context_p, source, &key);
+
+  ecma_value_t entry_path = code_cache_entry_path (context_p, options_p->source_name.value);
+  jjs_value_t result = code_cache_load (context_p, entry_path, source, options_p, &key, &is_uncacheable);
+
+  if (result != ECMA_VALUE_EMPTY)
+  {
+    context_p->code_cache_hits++;
+    ecma_free_value (context_p, entry_path);
+    return result;
+  }
+
+  result = jjs_parse_value (context_p, source, JJS_KEEP, options_p);
+
+  if (!is_uncacheable)
+  {
+    context_p->code_cache_misses++;
+
+    if (!jjs_value_is_exception (context_p, result))
+    {
+      code_cache_store (context_p, entry_path, result, options_p, &key);
+    }
+  }
+
+  ecma_free_value (context_p, entry_path);
+  return result;
+#else /* !JJS_ANNEX_CODE_CACHE */
+  return jjs_parse_value (context_p, source, JJS_KEEP, options_p);
+#endif /* JJS_ANNEX_CODE_CACHE */
+} /* jjs_annex_code_cache_parse */
+
+/**
+ * Set the module code cache directory.
+ *
+ * When set, the compiled code of ES modules and CommonJS modules loaded from the
+ * filesystem is stored in the directory and reused on the next load of the same,
+ * unchanged source. Cache entries are only valid for the engine build that wrote them;
+ * stale or foreign entries are ignored and rewritten.
+ *
+ * Note: functions loaded from the cache do not have line information.
+ *
+ * @param context_p JJS context
+ * @param dir existing directory to store the cache entries in, or undefined to disable the cache
+ * @param dir_o dir reference ownership
+ * @return on success, undefined is returned. on failure, an exception is thrown. return
+ * value must be freed with jjs_value_free.
+ */
+jjs_value_t
+jjs_code_cache (jjs_context_t *context_p, jjs_value_t dir, jjs_own_t dir_o)
+{
+  jjs_assert_api_enabled (context_p);
+#if JJS_ANNEX_CODE_CACHE
+  jjs_value_t resolved_dir;
+
+  if (jjs_value_is_undefined (context_p, dir))
+  {
+    resolved_dir = ECMA_VALUE_UNDEFINED;
+  }
+  else if (jjs_value_is_string (context_p, dir))
+  {
+    resolved_dir = jjs_platform_realpath (context_p, dir, dir_o);
+    dir_o = JJS_KEEP;
+
+    if (jjs_value_is_exception (context_p, resolved_dir))
+    {
+      return resolved_dir;
+    }
+  }
+  else
+  {
+    jjs_disown_value (context_p, dir, dir_o);
+    return jjs_throw_sz (context_p, JJS_ERROR_TYPE, "code cache dir must be a string or undefined");
+  }
+
+  jjs_disown_value (context_p, dir, dir_o);
+
+  jjs_value_free (context_p, context_p->code_cache_dir);
+  context_p->code_cache_dir = resolved_dir;
+
+  return jjs_undefined (context_p);
+#else /* !JJS_ANNEX_CODE_CACHE */
+  jjs_disown_value (context_p, dir, dir_o);
+  return jjs_throw_sz (context_p, JJS_ERROR_TYPE, ecma_get_error_msg (ECMA_ERR_CODE_CACHE_NOT_SUPPORTED));
+#endif /* JJS_ANNEX_CODE_CACHE */
+} /* jjs_code_cache */
+
+/**
+ * Version of jjs_code_cache that takes a null-terminated string for the directory.
+ *
+ * @see jjs_code_cache
+ */
+jjs_value_t
+jjs_code_cache_sz (jjs_context_t *context_p, const char *dir_p)
+{
+  jjs_assert_api_enabled (context_p);
+  return jjs_code_cache (context_p, annex_util_create_string_utf8_sz (context_p, dir_p), JJS_MOVE);
+} /* jjs_code_cache_sz */
+
+/**
+ * Get the statistics of the module code cache.
+ *
+ * @param context_p JJS context
+ * @param out_stats_p [out] code cache stats
+ * @return true - if the stats were written, false - if the code cache is not supported
+ */
+bool
+jjs_code_cache_stats (jjs_context_t *context_p, jjs_code_cache_stats_t *out_stats_p)
+{
+  jjs_assert_api_enabled (context_p);
+
+#if JJS_ANNEX_CODE_CACHE
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  *out_stats_p = (jjs_code_cache_stats_t){ .version = 1,
+                                           .hits = context_p->code_cache_hits,
+                                           .misses = context_p->code_cache_misses,
+                                           .writes = context_p->code_cache_writes };
+
+  return true;
+#else /* !JJS_ANNEX_CODE_CACHE */
+  JJS_UNUSED (out_stats_p);
+  return false;
+#endif /* JJS_ANNEX_CODE_CACHE */
+} /* jjs_code_cache_stats */
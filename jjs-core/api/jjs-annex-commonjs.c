@@ -415,7 +415,7 @@ static ecma_value_t load_module_exports_from_source (jjs_context_t* context_p, e
     .source_name = jjs_optional_value (filename),
   };
 
-  jjs_value_t fn = jjs_parse_value (context_p, source, JJS_KEEP, &parse_opts);
+  jjs_value_t fn = jjs_annex_code_cache_parse (context_p, source, &parse_opts);
 
   if (jjs_value_is_exception (context_p, fn))
   {
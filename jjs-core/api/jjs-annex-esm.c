@@ -948,7 +948,7 @@ esm_read (jjs_context_t* context_p, jjs_value_t specifier, jjs_value_t referrer_
       .source_name = jjs_optional_value (resolved.path),
     };
 
-    module = jjs_parse_value (context_p, loaded.source, JJS_KEEP, &opts);
+    module = jjs_annex_code_cache_parse (context_p, loaded.source, &opts);
 
     if (!jjs_value_is_exception (context_p, module))
     {
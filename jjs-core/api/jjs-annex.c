@@ -79,6 +79,13 @@ void jjs_annex_init (jjs_context_t* context_p)
   context_p->pmap_root = ECMA_VALUE_UNDEFINED;
 #endif /* JJS_ANNEX_PMAP */
 
+#if JJS_ANNEX_CODE_CACHE
+  context_p->code_cache_dir = ECMA_VALUE_UNDEFINED;
+  context_p->code_cache_hits = 0;
+  context_p->code_cache_misses = 0;
+  context_p->code_cache_writes = 0;
+#endif /* JJS_ANNEX_CODE_CACHE */
+
 #if JJS_ANNEX_COMMONJS
   context_p->commonjs_args = ecma_string_ascii_sz (context_p, "module,exports,require,__filename,__dirname");
 #endif /* JJS_ANNEX_COMMONJS */
@@ -172,6 +179,10 @@ void jjs_annex_finalize (jjs_context_t* context_p)
   jjs_value_free (context_p, context_p->pmap_root);
 #endif /* JJS_ANNEX_PMAP */
 
+#if JJS_ANNEX_CODE_CACHE
+  jjs_value_free (context_p, context_p->code_cache_dir);
+#endif /* JJS_ANNEX_CODE_CACHE */
+
 #if JJS_ANNEX_COMMONJS
   jjs_value_free (context_p, context_p->commonjs_args);
 #endif /* JJS_ANNEX_COMMONJS */
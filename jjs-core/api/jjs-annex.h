@@ -30,6 +30,8 @@ jjs_value_t jjs_annex_create_require (jjs_context_t* context_p, jjs_value_t refe
 ecma_value_t jjs_annex_pmap_create_api (jjs_context_t* context_p);
 jjs_value_t jjs_annex_pmap_resolve (jjs_context_t* context_p, jjs_value_t specifier, jjs_module_type_t module_type);
 
+jjs_value_t jjs_annex_code_cache_parse (jjs_context_t* context_p, jjs_value_t source, const jjs_parse_options_t* options_p);
+
 JJS_HANDLER(queue_microtask_handler);
 
 #endif // JJS_ANNEX_H
@@ -15,7 +15,10 @@
 
 #include "jjs-api-snapshot.h"
 #include "jjs.h"
+#include "jjs-platform.h"
+#include "jjs-util.h"
 
+#include "annex.h"
 #include "ecma-conversion.h"
 #include "ecma-errors.h"
 #include "ecma-exceptions.h"
@@ -85,6 +88,7 @@ typedef struct
   ecma_value_t snapshot_error;
   bool regex_found;
   bool class_found;
+  bool buffer_too_small;
 } snapshot_globals_t;
 
 /** \addtogroup jjssnapshot JJS snapshot operations
@@ -181,6 +185,7 @@ snapshot_add_compiled_code (jjs_context_t* context_p, /**< JJS context */
     if (globals_p->snapshot_buffer_write_offset + sizeof (ecma_compiled_code_t) > snapshot_buffer_size)
     {
       globals_p->snapshot_error = jjs_throw_sz (context_p, JJS_ERROR_RANGE, error_buffer_too_small_p);
+      globals_p->buffer_too_small = true;
       return 0;
     }
 
@@ -202,6 +207,7 @@ snapshot_add_compiled_code (jjs_context_t* context_p, /**< JJS context */
                                              buffer_size))
     {
       globals_p->snapshot_error = jjs_throw_sz (context_p, JJS_ERROR_RANGE, error_buffer_too_small_p);
+      globals_p->buffer_too_small = true;
       /* cannot return inside ECMA_FINALIZE_UTF8_STRING */
     }
 
@@ -236,6 +242,7 @@ snapshot_add_compiled_code (jjs_context_t* context_p, /**< JJS context */
                                            ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG))
   {
     globals_p->snapshot_error = jjs_throw_sz (context_p, JJS_ERROR_RANGE, error_buffer_too_small_p);
+    globals_p->buffer_too_small = true;
     return 0;
   }
 
@@ -523,6 +530,104 @@ jjs_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
   } while (size > 0);
 } /* jjs_snapshot_set_offsets */
 
+/**
+ * Generate a snapshot from a compiled code.
+ *
+ * Note:
+ *      if buffer_too_small_p is not NULL, it is set to true when the generation
+ *      failed only because the buffer is not large enough
+ *
+ * @return size of snapshot (a number value), if it was generated succesfully,
+ *         error object otherwise
+ */
+ecma_value_t
+snapshot_generate (jjs_context_t *context_p, /**< JJS context */
+                   const ecma_compiled_code_t *bytecode_data_p, /**< compiled code */
+                   uint32_t generate_snapshot_opts, /**< jjs_generate_snapshot_opts_t option bits */
+                   uint32_t *buffer_p, /**< buffer to save snapshot to */
+                   size_t buffer_size, /**< the buffer's size */
+                   bool *buffer_too_small_p) /**< [out] buffer size was not sufficient, can be NULL */
+{
+  snapshot_globals_t globals;
+  const uint32_t aligned_header_size = JJS_ALIGNUP (sizeof (jjs_snapshot_header_t), JMEM_ALIGNMENT);
+
+  globals.snapshot_buffer_write_offset = aligned_header_size;
+  globals.snapshot_error = ECMA_VALUE_EMPTY;
+  globals.regex_found = false;
+  globals.class_found = false;
+  globals.buffer_too_small = false;
+
+  if (generate_snapshot_opts & JJS_SNAPSHOT_SAVE_STATIC)
+  {
+    static_snapshot_add_compiled_code (context_p, bytecode_data_p, (uint8_t *) buffer_p, buffer_size, &globals);
+  }
+  else
+  {
+    snapshot_add_compiled_code (context_p, bytecode_data_p, (uint8_t *) buffer_p, buffer_size, &globals);
+  }
+
+  if (!ecma_is_value_empty (globals.snapshot_error))
+  {
+    if (buffer_too_small_p != NULL)
+    {
+      *buffer_too_small_p = globals.buffer_too_small;
+    }
+
+    return globals.snapshot_error;
+  }
+
+  jjs_snapshot_header_t header;
+  header.magic = JJS_SNAPSHOT_MAGIC;
+  header.version = JJS_SNAPSHOT_VERSION;
+  header.global_flags = snapshot_get_global_flags (globals.regex_found, globals.class_found);
+  header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
+  header.number_of_funcs = 1;
+  header.func_offsets[0] = aligned_header_size;
+
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  uint32_t literals_num = 0;
+
+  if (!(generate_snapshot_opts & JJS_SNAPSHOT_SAVE_STATIC))
+  {
+    ecma_collection_t *lit_pool_p = ecma_new_collection (context_p);
+
+    ecma_save_literals_add_compiled_code (context_p, bytecode_data_p, lit_pool_p);
+
+    if (!ecma_save_literals_for_snapshot (context_p,
+                                          lit_pool_p,
+                                          buffer_p,
+                                          buffer_size,
+                                          &globals.snapshot_buffer_write_offset,
+                                          &lit_map_p,
+                                          &literals_num))
+    {
+      JJS_ASSERT (lit_map_p == NULL);
+
+      if (buffer_too_small_p != NULL)
+      {
+        *buffer_too_small_p = true;
+      }
+
+      return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CANNOT_ALLOCATE_MEMORY_LITERALS));
+    }
+
+    jjs_snapshot_set_offsets (buffer_p + (aligned_header_size / sizeof (uint32_t)),
+                                (uint32_t) (header.lit_table_offset - aligned_header_size),
+                                lit_map_p);
+  }
+
+  size_t header_offset = 0;
+
+  snapshot_write_to_buffer_by_offset ((uint8_t *) buffer_p, buffer_size, &header_offset, &header, sizeof (header));
+
+  if (lit_map_p != NULL)
+  {
+    jmem_heap_free_block (context_p, lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
+  }
+
+  return ecma_make_number_value (context_p, (ecma_number_t) globals.snapshot_buffer_write_offset);
+} /* snapshot_generate */
+
 #endif /* JJS_SNAPSHOT_SAVE */
 
 #if JJS_SNAPSHOT_EXEC
@@ -582,27 +687,21 @@ snapshot_load_compiled_code (jjs_context_t* context_p, /**< JJS context */
 
   if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
-    uint8_t *byte_p = (uint8_t *) bytecode_p;
-    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) byte_p;
+    const cbc_uint16_arguments_t *args_p = (const cbc_uint16_arguments_t *) bytecode_p;
 
     argument_end = args_p->argument_end;
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint16_arguments_t);
-
-    ECMA_SET_INTERNAL_VALUE_POINTER (context_p, args_p->script_value, script_p);
   }
   else
   {
-    uint8_t *byte_p = (uint8_t *) bytecode_p;
-    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) byte_p;
+    const cbc_uint8_arguments_t *args_p = (const cbc_uint8_arguments_t *) bytecode_p;
 
     argument_end = args_p->argument_end;
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint8_arguments_t);
-
-    ECMA_SET_INTERNAL_VALUE_POINTER (context_p, args_p->script_value, script_p);
   }
 
   if (copy_bytecode || (header_size + (literal_end * sizeof (uint16_t)) + BYTECODE_NO_COPY_THRESHOLD > code_size))
@@ -643,6 +742,8 @@ snapshot_load_compiled_code (jjs_context_t* context_p, /**< JJS context */
     /* adjust for line info block */
     extra_bytes += (uint32_t) sizeof (ecma_value_t);
 
+    extra_bytes += ecma_compiled_code_get_slot_table_size (bytecode_p);
+
 #if JJS_SOURCE_NAME
     /* TODO: what is this? i don't see where this is being set in parser. */
     /* source name */
@@ -679,6 +780,16 @@ snapshot_load_compiled_code (jjs_context_t* context_p, /**< JJS context */
 
   JJS_ASSERT (bytecode_p->refs == 1);
 
+  /* The snapshot buffer is never written, so it can be a read-only mapping shared by several contexts. */
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    ECMA_SET_INTERNAL_VALUE_POINTER (context_p, ((cbc_uint16_arguments_t *) bytecode_p)->script_value, script_p);
+  }
+  else
+  {
+    ECMA_SET_INTERNAL_VALUE_POINTER (context_p, ((cbc_uint8_arguments_t *) bytecode_p)->script_value, script_p);
+  }
+
 #if JJS_DEBUGGER
   bytecode_p->status_flags = (uint16_t) (bytecode_p->status_flags | CBC_CODE_FLAGS_DEBUGGER_IGNORE);
 #endif /* JJS_DEBUGGER */
@@ -728,6 +839,58 @@ snapshot_load_compiled_code (jjs_context_t* context_p, /**< JJS context */
   return bytecode_p;
 } /* snapshot_load_compiled_code */
 
+/**
+ * Check whether the first primary function of a snapshot can be loaded by snapshot_load_primary_code.
+ *
+ * Note:
+ *      static snapshots are not accepted
+ *
+ * @return true - if the snapshot is valid,
+ *         false - otherwise
+ */
+bool
+snapshot_is_loadable (const uint32_t *snapshot_p, /**< snapshot */
+                      size_t snapshot_size) /**< size of snapshot */
+{
+  const jjs_snapshot_header_t *header_p = (const jjs_snapshot_header_t *) snapshot_p;
+
+  if (snapshot_size <= sizeof (jjs_snapshot_header_t) || header_p->magic != JJS_SNAPSHOT_MAGIC
+      || header_p->version != JJS_SNAPSHOT_VERSION || !snapshot_check_global_flags (header_p->global_flags)
+      || header_p->lit_table_offset > snapshot_size || header_p->number_of_funcs == 0
+      || header_p->func_offsets[0] + sizeof (ecma_compiled_code_t) > header_p->lit_table_offset)
+  {
+    return false;
+  }
+
+  const ecma_compiled_code_t *bytecode_p =
+    (const ecma_compiled_code_t *) (((const uint8_t *) snapshot_p) + header_p->func_offsets[0]);
+
+  return CBC_IS_FUNCTION (bytecode_p->status_flags) && !(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION);
+} /* snapshot_is_loadable */
+
+/**
+ * Copy the first primary function of a snapshot into the memory.
+ *
+ * Note:
+ *      the snapshot must be checked by snapshot_is_loadable before
+ *
+ * @return byte code
+ */
+ecma_compiled_code_t *
+snapshot_load_primary_code (jjs_context_t *context_p, /**< JJS context */
+                            const uint32_t *snapshot_p, /**< snapshot */
+                            cbc_script_t *script_p) /**< script */
+{
+  const uint8_t *snapshot_data_p = (const uint8_t *) snapshot_p;
+  const jjs_snapshot_header_t *header_p = (const jjs_snapshot_header_t *) snapshot_p;
+
+  return snapshot_load_compiled_code (context_p,
+                                      snapshot_data_p + header_p->func_offsets[0],
+                                      snapshot_data_p + header_p->lit_table_offset,
+                                      script_p,
+                                      true);
+} /* snapshot_load_primary_code */
+
 #endif /* JJS_SNAPSHOT_EXEC */
 
 /**
@@ -785,97 +948,32 @@ jjs_generate_snapshot (jjs_context_t* context_p, /**< JJS context */
     return jjs_throw_sz (context_p, JJS_ERROR_RANGE, ecma_get_error_msg (ECMA_ERR_SNAPSHOT_UNSUPPORTED_COMPILED_CODE));
   }
 
-  snapshot_globals_t globals;
-  const uint32_t aligned_header_size = JJS_ALIGNUP (sizeof (jjs_snapshot_header_t), JMEM_ALIGNMENT);
-
-  globals.snapshot_buffer_write_offset = aligned_header_size;
-  globals.snapshot_error = ECMA_VALUE_EMPTY;
-  globals.regex_found = false;
-  globals.class_found = false;
-
-  if (generate_snapshot_opts & JJS_SNAPSHOT_SAVE_STATIC)
-  {
-    static_snapshot_add_compiled_code (context_p, bytecode_data_p, (uint8_t *) buffer_p, buffer_size, &globals);
-  }
-  else
-  {
-    snapshot_add_compiled_code (context_p, bytecode_data_p, (uint8_t *) buffer_p, buffer_size, &globals);
-  }
-
-  if (!ecma_is_value_empty (globals.snapshot_error))
-  {
-    return globals.snapshot_error;
-  }
-
-  jjs_snapshot_header_t header;
-  header.magic = JJS_SNAPSHOT_MAGIC;
-  header.version = JJS_SNAPSHOT_VERSION;
-  header.global_flags = snapshot_get_global_flags (globals.regex_found, globals.class_found);
-  header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
-  header.number_of_funcs = 1;
-  header.func_offsets[0] = aligned_header_size;
-
-  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
-  uint32_t literals_num = 0;
-
-  if (!(generate_snapshot_opts & JJS_SNAPSHOT_SAVE_STATIC))
-  {
-    ecma_collection_t *lit_pool_p = ecma_new_collection (context_p);
-
-    ecma_save_literals_add_compiled_code (context_p, bytecode_data_p, lit_pool_p);
-
-    if (!ecma_save_literals_for_snapshot (context_p,
-                                          lit_pool_p,
-                                          buffer_p,
-                                          buffer_size,
-                                          &globals.snapshot_buffer_write_offset,
-                                          &lit_map_p,
-                                          &literals_num))
-    {
-      JJS_ASSERT (lit_map_p == NULL);
-      return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CANNOT_ALLOCATE_MEMORY_LITERALS));
-    }
-
-    jjs_snapshot_set_offsets (buffer_p + (aligned_header_size / sizeof (uint32_t)),
-                                (uint32_t) (header.lit_table_offset - aligned_header_size),
-                                lit_map_p);
-  }
-
-  size_t header_offset = 0;
-
-  snapshot_write_to_buffer_by_offset ((uint8_t *) buffer_p, buffer_size, &header_offset, &header, sizeof (header));
-
-  if (lit_map_p != NULL)
-  {
-    jmem_heap_free_block (context_p, lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
-  }
-
-  return ecma_make_number_value (context_p, (ecma_number_t) globals.snapshot_buffer_write_offset);
+  return snapshot_generate (context_p, bytecode_data_p, generate_snapshot_opts, buffer_p, buffer_size, NULL);
 #else /* !JJS_SNAPSHOT_SAVE */
   JJS_UNUSED_ALL (compiled_code, generate_snapshot_opts, buffer_p, buffer_size);
   return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_SNAPSHOT_SAVE_DISABLED));
 #endif /* JJS_SNAPSHOT_SAVE */
 } /* jjs_generate_snapshot */
 
+#if JJS_SNAPSHOT_EXEC
+
 /**
- * Execute/load snapshot from specified buffer
- *
- * Note:
- *      returned value must be freed with jjs_value_free, when it is no longer needed.
+ * Execute/load snapshot from specified buffer.
  *
  * @return result of bytecode - if run was successful
  *         thrown error - otherwise
  */
-jjs_value_t
-jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
-                   const uint32_t *snapshot_p, /**< snapshot */
-                   size_t snapshot_size, /**< size of snapshot */
-                   size_t func_index, /**< index of primary function */
-                   uint32_t exec_snapshot_opts, /**< jjs_exec_snapshot_opts_t option bits */
-                   const jjs_exec_snapshot_option_values_t *option_values_p) /**< additional option values,
-                                                                                  *   can be NULL if not used */
+static jjs_value_t
+snapshot_exec (jjs_context_t* context_p, /**< JJS context */
+               const uint32_t *snapshot_p, /**< snapshot */
+               size_t snapshot_size, /**< size of snapshot */
+               size_t func_index, /**< index of primary function */
+               uint32_t exec_snapshot_opts, /**< jjs_exec_snapshot_opts_t option bits */
+               const jjs_exec_snapshot_option_values_t *option_values_p, /**< additional option values,
+                                                                           *   can be NULL if not used */
+               cbc_snapshot_mapping_t *mapping_p) /**< mapping which owns the snapshot data,
+                                                   *   NULL if the snapshot is owned by the caller */
 {
-#if JJS_SNAPSHOT_EXEC
   JJS_ASSERT (snapshot_p != NULL);
 
   uint32_t allowed_opts =
@@ -930,6 +1028,12 @@ jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
       return jjs_throw_sz (context_p, JJS_ERROR_COMMON,
                              ecma_get_error_msg (ECMA_ERR_STATIC_SNAPSHOTS_CANNOT_BE_COPIED_INTO_MEMORY));
     }
+
+    if (mapping_p != NULL)
+    {
+      /* static functions and their strings are never freed, so the mapping is kept until the context is freed */
+      mapping_p->refs++;
+    }
   }
   else
   {
@@ -947,6 +1051,13 @@ jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
       script_size += sizeof (ecma_value_t);
     }
 
+    bool copy_bytecode = (exec_snapshot_opts & JJS_SNAPSHOT_EXEC_COPY_DATA) != 0;
+
+    if (mapping_p != NULL && !copy_bytecode)
+    {
+      script_size += sizeof (ecma_value_t);
+    }
+
     cbc_script_t *script_p = jmem_heap_alloc_block (context_p, script_size);
 
     CBC_SCRIPT_SET_TYPE (script_p, user_value, CBC_SCRIPT_REF_ONE);
@@ -978,7 +1089,7 @@ jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
                                               (const uint8_t *) bytecode_p,
                                               literal_base_p,
                                               script_p,
-                                              (exec_snapshot_opts & JJS_SNAPSHOT_EXEC_COPY_DATA) != 0);
+                                              copy_bytecode);
 
     if (bytecode_p == NULL)
     {
@@ -987,6 +1098,16 @@ jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
       return ecma_raise_type_error (context_p, ECMA_ERR_INVALID_SNAPSHOT_FORMAT);
     }
 
+    if (mapping_p != NULL && !copy_bytecode)
+    {
+      /* byte code which is not copied points into the mapping */
+      ECMA_SET_INTERNAL_VALUE_POINTER (context_p,
+                                       CBC_SCRIPT_GET_SNAPSHOT_MAPPING (script_p, script_p->refs_and_type),
+                                       mapping_p);
+      script_p->refs_and_type |= CBC_SCRIPT_HAS_SNAPSHOT_MAPPING;
+      mapping_p->refs++;
+    }
+
     script_p->refs_and_type -= CBC_SCRIPT_REF_ONE;
 
     if (user_value != ECMA_VALUE_EMPTY)
@@ -1041,12 +1162,124 @@ jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
   }
 
   return ret_val;
+} /* snapshot_exec */
+
+#endif /* JJS_SNAPSHOT_EXEC */
+
+/**
+ * Execute/load snapshot from specified buffer
+ *
+ * Note:
+ *      returned value must be freed with jjs_value_free, when it is no longer needed.
+ *
+ * @return result of bytecode - if run was successful
+ *         thrown error - otherwise
+ */
+jjs_value_t
+jjs_exec_snapshot (jjs_context_t* context_p, /**< JJS context */
+                   const uint32_t *snapshot_p, /**< snapshot */
+                   size_t snapshot_size, /**< size of snapshot */
+                   size_t func_index, /**< index of primary function */
+                   uint32_t exec_snapshot_opts, /**< jjs_exec_snapshot_opts_t option bits */
+                   const jjs_exec_snapshot_option_values_t *option_values_p) /**< additional option values,
+                                                                                  *   can be NULL if not used */
+{
+#if JJS_SNAPSHOT_EXEC
+  return snapshot_exec (context_p, snapshot_p, snapshot_size, func_index, exec_snapshot_opts, option_values_p, NULL);
 #else /* !JJS_SNAPSHOT_EXEC */
   JJS_UNUSED_ALL (snapshot_p, snapshot_size, func_index, exec_snapshot_opts, option_values_p);
   return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_SNAPSHOT_EXEC_DISABLED));
 #endif /* JJS_SNAPSHOT_EXEC */
 } /* jjs_exec_snapshot */
 
+/**
+ * Execute/load a snapshot file without reading it into the heap.
+ *
+ * The file is mapped read-only, so the pages of the snapshot are shared by every context and
+ * process executing the same file. Unless JJS_SNAPSHOT_EXEC_COPY_DATA is set, the loaded functions
+ * execute their byte code directly from the mapping, which is unmapped when the last of them is freed.
+ * Static snapshots keep the mapping until the context is freed.
+ *
+ * If the platform cannot map files, the file is read into memory owned by the loaded functions.
+ *
+ * Note:
+ *      returned value must be freed with jjs_value_free, when it is no longer needed.
+ *
+ * @return result of bytecode - if run was successful
+ *         thrown error - otherwise
+ */
+jjs_value_t
+jjs_exec_snapshot_file (jjs_context_t* context_p, /**< JJS context */
+                        jjs_value_t path, /**< snapshot file path */
+                        jjs_own_t path_o, /**< path reference ownership */
+                        size_t func_index, /**< index of primary function */
+                        uint32_t exec_snapshot_opts, /**< jjs_exec_snapshot_opts_t option bits */
+                        const jjs_exec_snapshot_option_values_t *option_values_p) /**< additional option values,
+                                                                                       *   can be NULL if not used */
+{
+  jjs_assert_api_enabled (context_p);
+
+#if JJS_SNAPSHOT_EXEC
+  jjs_platform_buffer_t buffer;
+  jjs_allocator_t *path_allocator_p = jmem_scratch_allocator_acquire (context_p);
+  jjs_status_t status = jjsp_map_file_buffer (context_p, path, path_allocator_p, &buffer);
+
+  jmem_scratch_allocator_release (context_p);
+  jjs_disown_value (context_p, path, path_o);
+
+  if (status != JJS_STATUS_OK)
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_FAILED_TO_MAP_SNAPSHOT_FILE));
+  }
+
+  cbc_snapshot_mapping_t *mapping_p = jmem_heap_alloc_block (context_p, sizeof (cbc_snapshot_mapping_t));
+
+  mapping_p->next_p = context_p->snapshot_mappings_p;
+  mapping_p->buffer = buffer;
+  /* the reference of this call, released below */
+  mapping_p->refs = 1;
+  context_p->snapshot_mappings_p = mapping_p;
+
+  jjs_value_t result = snapshot_exec (context_p,
+                                      (const uint32_t *) buffer.data_p,
+                                      buffer.data_size,
+                                      func_index,
+                                      exec_snapshot_opts,
+                                      option_values_p,
+                                      mapping_p);
+
+  ecma_snapshot_mapping_deref (context_p, mapping_p);
+
+  return result;
+#else /* !JJS_SNAPSHOT_EXEC */
+  jjs_disown_value (context_p, path, path_o);
+  JJS_UNUSED_ALL (func_index, exec_snapshot_opts, option_values_p);
+  return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_SNAPSHOT_EXEC_DISABLED));
+#endif /* JJS_SNAPSHOT_EXEC */
+} /* jjs_exec_snapshot_file */
+
+/**
+ * Version of jjs_exec_snapshot_file that takes a null-terminated string for the path.
+ *
+ * @see jjs_exec_snapshot_file
+ */
+jjs_value_t
+jjs_exec_snapshot_file_sz (jjs_context_t* context_p, /**< JJS context */
+                           const char *path_p, /**< snapshot file path */
+                           size_t func_index, /**< index of primary function */
+                           uint32_t exec_snapshot_opts, /**< jjs_exec_snapshot_opts_t option bits */
+                           const jjs_exec_snapshot_option_values_t *option_values_p) /**< additional option values,
+                                                                                          *   can be NULL if not used */
+{
+  jjs_assert_api_enabled (context_p);
+  return jjs_exec_snapshot_file (context_p,
+                                 annex_util_create_string_utf8_sz (context_p, path_p),
+                                 JJS_MOVE,
+                                 func_index,
+                                 exec_snapshot_opts,
+                                 option_values_p);
+} /* jjs_exec_snapshot_file_sz */
+
 /**
  * @}
  */
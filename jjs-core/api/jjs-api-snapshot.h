@@ -18,6 +18,8 @@
 
 #include "ecma-globals.h"
 
+#include "byte-code.h"
+
 /**
  * Snapshot header
  */
@@ -50,4 +52,20 @@ typedef enum
   JJS_SNAPSHOT_FOUR_BYTE_CPOINTER = (1u << 8) /**< deprecated, an unused placeholder now */
 } jjs_snapshot_global_flags_t;
 
+#if JJS_SNAPSHOT_SAVE
+ecma_value_t snapshot_generate (jjs_context_t *context_p,
+                                const ecma_compiled_code_t *bytecode_data_p,
+                                uint32_t generate_snapshot_opts,
+                                uint32_t *buffer_p,
+                                size_t buffer_size,
+                                bool *buffer_too_small_p);
+#endif /* JJS_SNAPSHOT_SAVE */
+
+#if JJS_SNAPSHOT_EXEC
+bool snapshot_is_loadable (const uint32_t *snapshot_p, size_t snapshot_size);
+ecma_compiled_code_t *snapshot_load_primary_code (jjs_context_t *context_p,
+                                                  const uint32_t *snapshot_p,
+                                                  cbc_script_t *script_p);
+#endif /* JJS_SNAPSHOT_EXEC */
+
 #endif /* !JJS_API_SNAPSHOT_H */
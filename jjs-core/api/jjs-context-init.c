@@ -100,9 +100,17 @@ jjs_context_init (const jjs_context_options_t* options_p, const jjs_allocator_t
   }
 #endif /* !JJS_VM_STACK_LIMIT */
 
+#if !JJS_VM_HEAP_GROWABLE
+  if (options_p->vm_heap_max_size_kb.has_value || options_p->vm_heap_step_size_kb.has_value)
+  {
+    return JJS_STATUS_CONTEXT_VM_HEAP_GROWABLE_DISABLED;
+  }
+#endif /* !JJS_VM_HEAP_GROWABLE */
+
   jjs_size_t context_aligned_size_b = JJS_ALIGNUP (sizeof (jjs_context_t), JMEM_ALIGNMENT);
   jjs_size_t vm_heap_size_b = get_context_option_u32 (&options_p->vm_heap_size_kb, JJS_DEFAULT_VM_HEAP_SIZE_KB) * 1024;
   jjs_size_t scratch_size_b = get_context_option_u32 (&options_p->scratch_size_kb, JJS_DEFAULT_SCRATCH_SIZE_KB) * 1024;
+  jjs_size_t segment_tables_size_b = 0;
   uint8_t* block_p;
   jjs_size_t block_size;
   uint8_t *scratch_block_p;
@@ -118,6 +126,16 @@ jjs_context_init (const jjs_context_options_t* options_p, const jjs_allocator_t
     block_size = context_aligned_size_b + vm_heap_size_b + scratch_size_b;
   }
 
+#if JJS_VM_HEAP_GROWABLE
+  jjs_size_t vm_heap_max_size_b =
+    get_context_option_u32 (&options_p->vm_heap_max_size_kb, JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB) * 1024;
+  uint32_t segment_chunk_count = jmem_heap_segment_chunk_count (vm_heap_size_b, vm_heap_max_size_b);
+
+  /* the tables that map segments into the vm heap are kept after the scratch buffer */
+  segment_tables_size_b = (jjs_size_t) jmem_heap_segment_tables_size (segment_chunk_count);
+  block_size += segment_tables_size_b;
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   block_p = jjs_allocator_alloc (allocator_p, block_size);
 
   if (!block_p)
@@ -128,14 +146,31 @@ jjs_context_init (const jjs_context_options_t* options_p, const jjs_allocator_t
   context_p = (jjs_context_t *) block_p;
   memset (context_p, 0, sizeof (*context_p));
 
-  context_p->context_block_size_b = context_aligned_size_b + vm_heap_size_b + scratch_size_b;
+  context_p->context_block_size_b = context_aligned_size_b + vm_heap_size_b + scratch_size_b + segment_tables_size_b;
 
   context_p->vm_heap_size = vm_heap_size_b;
   context_p->vm_stack_limit = get_context_option_u32 (&options_p->vm_stack_limit_kb, JJS_DEFAULT_VM_STACK_LIMIT) * 1024;
   context_p->vm_cell_count = get_context_option_u32 (&options_p->vm_cell_count, JJS_DEFAULT_VM_CELL_COUNT);
+#if JJS_VM_HEAP_GROWABLE
+  context_p->vm_heap_max_size = vm_heap_max_size_b;
+  context_p->vm_heap_step_size =
+    get_context_option_u32 (&options_p->vm_heap_step_size_kb, JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB) * 1024;
+  context_p->jmem_heap_chunk_count = segment_chunk_count;
+
+  if (segment_chunk_count > 0)
+  {
+    context_p->jmem_heap_chunks_p = (uint8_t **) (block_p + (context_aligned_size_b + vm_heap_size_b + scratch_size_b));
+  }
+#endif /* JJS_VM_HEAP_GROWABLE */
   context_p->gc_mark_limit = get_context_option_u32 (&options_p->gc_mark_limit, JJS_DEFAULT_GC_MARK_LIMIT);
   context_p->gc_new_objects_fraction = get_context_option_u32 (&options_p->gc_new_objects_fraction, JJS_DEFAULT_GC_NEW_OBJECTS_FRACTION);
+  context_p->gc_sweep_limit = get_context_option_u32 (&options_p->gc_sweep_limit, JJS_DEFAULT_GC_SWEEP_LIMIT);
   context_p->gc_limit = get_context_option_u32 (&options_p->gc_limit_kb, JJS_DEFAULT_MAX_GC_LIMIT);
+#if JJS_BUILTIN_REGEXP
+  /* 0 is a valid cache size, it disables the cache */
+  context_p->re_cache_size =
+    options_p->regexp_cache_size.has_value ? options_p->regexp_cache_size.value : JJS_DEFAULT_REGEXP_CACHE_SIZE;
+#endif /* JJS_BUILTIN_REGEXP */
 
   if (context_p->gc_limit == 0)
   {
@@ -123,3 +123,28 @@ jjsp_fs_read_file_impl (jjs_context_t *context_p,
 }
 
 #endif /* JJS_PLATFORM_API_FS_READ_FILE */
+
+#if JJS_PLATFORM_API_FS_WRITE_FILE == 2
+
+jjs_status_t
+jjs_platform_fs_write_file_impl (jjs_context_t *context_p,
+                                 jjs_platform_path_t* path_p,
+                                 const uint8_t* data_p,
+                                 jjs_size_t data_size)
+{
+  (void) context_p, (void) path_p, (void) data_p, (void) data_size;
+  return JJS_STATUS_NOT_IMPLEMENTED;
+}
+
+#endif /* JJS_PLATFORM_API_FS_WRITE_FILE */
+
+#if JJS_PLATFORM_API_FS_MAP_FILE == 2
+
+jjs_status_t
+jjs_platform_fs_map_file_impl (jjs_context_t *context_p, jjs_platform_path_t* path_p, jjs_platform_buffer_t* out_p)
+{
+  (void) context_p, (void) path_p, (void) out_p;
+  return JJS_STATUS_NOT_IMPLEMENTED;
+}
+
+#endif /* JJS_PLATFORM_API_FS_MAP_FILE */
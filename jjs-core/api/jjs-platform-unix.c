@@ -344,6 +344,138 @@ done:
 
 #endif /* JJS_PLATFORM_API_FS_READ_FILE */
 
+#if JJS_PLATFORM_API_FS_WRITE_FILE == 1
+
+#include <stdio.h>
+#include <string.h>
+
+jjs_status_t
+jjs_platform_fs_write_file_impl (jjs_context_t *context_p,
+                                 jjs_platform_path_t* path_p,
+                                 const uint8_t* data_p,
+                                 jjs_size_t data_size)
+{
+  JJS_UNUSED (context_p);
+  jjs_status_t status;
+  jjs_platform_buffer_view_t path_view_p;
+
+  status = path_p->convert (path_p, JJS_ENCODING_UTF8, JJS_PATH_FLAG_NULL_TERMINATE, &path_view_p);
+
+  if (status != JJS_STATUS_OK)
+  {
+    return status;
+  }
+
+  // write to a temporary file and rename it, so readers never see a partially written file
+  const char* path_sz = (const char*) path_view_p.data_p;
+  size_t path_size = strlen (path_sz);
+  char temp_path[FILENAME_MAX];
+
+  if (path_size + 5 > sizeof (temp_path))
+  {
+    path_view_p.free (&path_view_p);
+    return JJS_STATUS_INVALID_ARGUMENT;
+  }
+
+  memcpy (temp_path, path_sz, path_size);
+  memcpy (temp_path + path_size, ".tmp", 5);
+
+  FILE* file_p = fopen (temp_path, "wb");
+
+  if (!file_p)
+  {
+    path_view_p.free (&path_view_p);
+    return JJS_STATUS_PLATFORM_FILE_OPEN_ERR;
+  }
+
+  bool written = data_size == 0 || fwrite (data_p, data_size, 1, file_p) == 1;
+
+  if (fclose (file_p) != 0 || !written || rename (temp_path, path_sz) != 0)
+  {
+    remove (temp_path);
+    status = JJS_STATUS_PLATFORM_FILE_WRITE_ERR;
+  }
+
+  path_view_p.free (&path_view_p);
+
+  return status;
+}
+
+#endif /* JJS_PLATFORM_API_FS_WRITE_FILE */
+
+#if JJS_PLATFORM_API_FS_MAP_FILE == 1
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static void
+munmap_free (jjs_platform_buffer_t* self_p)
+{
+  if (self_p->data_p)
+  {
+    munmap (self_p->data_p, self_p->data_size);
+    self_p->data_p = NULL;
+    self_p->data_size = 0;
+  }
+}
+
+jjs_status_t
+jjs_platform_fs_map_file_impl (jjs_context_t *context_p, jjs_platform_path_t* path_p, jjs_platform_buffer_t* out_p)
+{
+  JJS_UNUSED (context_p);
+  jjs_status_t status;
+  jjs_platform_buffer_view_t path_view_p;
+
+  status = path_p->convert (path_p, JJS_ENCODING_UTF8, JJS_PATH_FLAG_NULL_TERMINATE, &path_view_p);
+
+  if (status != JJS_STATUS_OK)
+  {
+    return status;
+  }
+
+  int fd = open ((const char*) path_view_p.data_p, O_RDONLY | O_CLOEXEC);
+  path_view_p.free (&path_view_p);
+
+  if (fd < 0)
+  {
+    return JJS_STATUS_PLATFORM_FILE_OPEN_ERR;
+  }
+
+  struct stat file_stat;
+
+  if (fstat (fd, &file_stat) != 0)
+  {
+    close (fd);
+    return JJS_STATUS_PLATFORM_FILE_SEEK_ERR;
+  }
+
+  if (file_stat.st_size <= 0 || file_stat.st_size > INT32_MAX)
+  {
+    close (fd);
+    return JJS_STATUS_PLATFORM_FILE_SIZE_TOO_BIG;
+  }
+
+  /* shared read-only pages are backed by the page cache, so every process mapping the file uses the same memory */
+  void* data_p = mmap (NULL, (size_t) file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+  /* the mapping keeps its own reference to the file */
+  close (fd);
+
+  if (data_p == MAP_FAILED)
+  {
+    return JJS_STATUS_PLATFORM_FILE_READ_ERR;
+  }
+
+  *out_p = jjs_platform_buffer (data_p, (jjs_size_t) file_stat.st_size, NULL);
+  out_p->free = munmap_free;
+
+  return JJS_STATUS_OK;
+}
+
+#endif /* JJS_PLATFORM_API_FS_MAP_FILE */
+
 bool
 jjsp_path_is_relative (const lit_utf8_byte_t* path_p, lit_utf8_size_t size)
 {
@@ -315,6 +315,147 @@ jjs_platform_fs_read_file_impl (jjs_context_t *context_p,
 
 #endif /* JJS_PLATFORM_API_FS_READ_FILE */
 
+#if JJS_PLATFORM_API_FS_WRITE_FILE == 1
+
+#include <windows.h>
+
+jjs_status_t
+jjs_platform_fs_write_file_impl (jjs_context_t *context_p,
+                                 jjs_platform_path_t* path_p,
+                                 const uint8_t* data_p,
+                                 jjs_size_t data_size)
+{
+  JJS_UNUSED (context_p);
+  jjs_status_t status;
+  jjs_platform_buffer_view_t path_view;
+
+  status = path_p->convert (path_p, JJS_ENCODING_UTF16, JJS_PATH_FLAG_NULL_TERMINATE, &path_view);
+
+  if (status != JJS_STATUS_OK)
+  {
+    return status;
+  }
+
+  // write to a temporary file and rename it, so readers never see a partially written file
+  ecma_char_t* wpath_p = (ecma_char_t*) path_view.data_p;
+  size_t wpath_length = wcslen (wpath_p);
+  wchar_t temp_path[MAX_PATH];
+
+  if (wpath_length + 5 > MAX_PATH)
+  {
+    path_view.free (&path_view);
+    return JJS_STATUS_INVALID_ARGUMENT;
+  }
+
+  memcpy (temp_path, wpath_p, wpath_length * sizeof (wchar_t));
+  memcpy (temp_path + wpath_length, L".tmp", 5 * sizeof (wchar_t));
+
+  HANDLE file = CreateFileW (temp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    path_view.free (&path_view);
+    return JJS_STATUS_PLATFORM_FILE_OPEN_ERR;
+  }
+
+  DWORD written = 0;
+  BOOL ok = data_size == 0 || (WriteFile (file, data_p, (DWORD) data_size, &written, NULL) == TRUE && written == data_size);
+
+  CloseHandle (file);
+
+  if (!ok || MoveFileExW (temp_path, wpath_p, MOVEFILE_REPLACE_EXISTING) != TRUE)
+  {
+    DeleteFileW (temp_path);
+    status = JJS_STATUS_PLATFORM_FILE_WRITE_ERR;
+  }
+
+  path_view.free (&path_view);
+
+  return status;
+}
+
+#endif /* JJS_PLATFORM_API_FS_WRITE_FILE */
+
+#if JJS_PLATFORM_API_FS_MAP_FILE == 1
+
+#include <windows.h>
+
+static void
+unmap_view_free (jjs_platform_buffer_t* self_p)
+{
+  if (self_p->data_p)
+  {
+    UnmapViewOfFile (self_p->data_p);
+    self_p->data_p = NULL;
+    self_p->data_size = 0;
+  }
+}
+
+jjs_status_t
+jjs_platform_fs_map_file_impl (jjs_context_t *context_p, jjs_platform_path_t* path_p, jjs_platform_buffer_t* out_p)
+{
+  JJS_UNUSED (context_p);
+  jjs_status_t status;
+  jjs_platform_buffer_view_t path_view;
+
+  status = path_p->convert (path_p, JJS_ENCODING_UTF16, JJS_PATH_FLAG_NULL_TERMINATE, &path_view);
+
+  if (status != JJS_STATUS_OK)
+  {
+    return status;
+  }
+
+  HANDLE file = CreateFileW ((ecma_char_t*) path_view.data_p,
+                             GENERIC_READ,
+                             FILE_SHARE_READ | FILE_SHARE_DELETE,
+                             NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+
+  path_view.free (&path_view);
+
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return JJS_STATUS_PLATFORM_FILE_OPEN_ERR;
+  }
+
+  LARGE_INTEGER file_size_result;
+
+  if (GetFileSizeEx (file, &file_size_result) != TRUE || file_size_result.QuadPart <= 0
+      || file_size_result.QuadPart > INT_MAX)
+  {
+    CloseHandle (file);
+    return JJS_STATUS_PLATFORM_FILE_SIZE_TOO_BIG;
+  }
+
+  HANDLE mapping = CreateFileMappingW (file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+  CloseHandle (file);
+
+  if (mapping == NULL)
+  {
+    return JJS_STATUS_PLATFORM_FILE_READ_ERR;
+  }
+
+  /* the view keeps the mapping object alive after its handle is closed */
+  void* data_p = MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0);
+
+  CloseHandle (mapping);
+
+  if (data_p == NULL)
+  {
+    return JJS_STATUS_PLATFORM_FILE_READ_ERR;
+  }
+
+  *out_p = jjs_platform_buffer (data_p, (jjs_size_t) file_size_result.QuadPart, NULL);
+  out_p->free = unmap_view_free;
+
+  return JJS_STATUS_OK;
+}
+
+#endif /* JJS_PLATFORM_API_FS_MAP_FILE */
+
 bool
 jjsp_path_is_relative (const lit_utf8_byte_t* path_p, lit_utf8_size_t size)
 {
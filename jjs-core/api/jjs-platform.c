@@ -24,11 +24,6 @@
 #include "annex.h"
 #include "jcontext.h"
 
-static jjs_value_t jjsp_read_file_buffer (jjs_context_t* context_p,
-                                          jjs_value_t path,
-                                          jjs_allocator_t* path_allocator,
-                                          jjs_allocator_t* buffer_allocator,
-                                          jjs_platform_buffer_t* buffer_p);
 static jjs_value_t jjsp_read_file (jjs_context_t* context_p, jjs_value_t path, jjs_encoding_t encoding);
 static jjs_platform_path_t
 jjs_platform_create_path (jjs_allocator_t* allocator, const uint8_t* path_p, jjs_size_t size, jjs_encoding_t encoding);
@@ -561,7 +556,7 @@ jjs_platform_buffer (void* data_p, jjs_size_t data_size, const jjs_allocator_t*
   };
 }
 
-static jjs_value_t
+jjs_value_t
 jjsp_read_file_buffer (jjs_context_t* context_p,
                        jjs_value_t path,
                        jjs_allocator_t* path_allocator,
@@ -594,6 +589,67 @@ jjsp_read_file_buffer (jjs_context_t* context_p,
   return ECMA_VALUE_UNDEFINED;
 }
 
+jjs_status_t
+jjsp_write_file_buffer (jjs_context_t* context_p,
+                        jjs_value_t path,
+                        jjs_allocator_t* path_allocator,
+                        const uint8_t* data_p,
+                        jjs_size_t data_size)
+{
+  if (!ecma_is_value_string (path))
+  {
+    return JJS_STATUS_INVALID_ARGUMENT;
+  }
+
+  ecma_string_t* path_p = ecma_get_string_from_value (context_p, path);
+  ECMA_STRING_TO_UTF8_STRING (context_p, path_p, path_bytes_p, path_len);
+
+  jjs_platform_path_t platform_path =
+    jjs_platform_create_path (path_allocator,
+                              path_bytes_p,
+                              path_len,
+                              ecma_string_get_length (context_p, path_p) == path_len ? JJS_ENCODING_ASCII : JJS_ENCODING_CESU8);
+
+  jjs_status_t status = jjs_platform_fs_write_file_impl (context_p, &platform_path, data_p, data_size);
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, path_bytes_p, path_len);
+
+  return status;
+}
+
+jjs_status_t
+jjsp_map_file_buffer (jjs_context_t* context_p,
+                      jjs_value_t path,
+                      jjs_allocator_t* path_allocator,
+                      jjs_platform_buffer_t* buffer_p)
+{
+  if (!ecma_is_value_string (path))
+  {
+    return JJS_STATUS_INVALID_ARGUMENT;
+  }
+
+  ecma_string_t* path_p = ecma_get_string_from_value (context_p, path);
+  ECMA_STRING_TO_UTF8_STRING (context_p, path_p, path_bytes_p, path_len);
+
+  jjs_platform_path_t platform_path =
+    jjs_platform_create_path (path_allocator,
+                              path_bytes_p,
+                              path_len,
+                              ecma_string_get_length (context_p, path_p) == path_len ? JJS_ENCODING_ASCII : JJS_ENCODING_CESU8);
+
+  jjs_status_t status = jjs_platform_fs_map_file_impl (context_p, &platform_path, buffer_p);
+
+  if (status == JJS_STATUS_NOT_IMPLEMENTED)
+  {
+    /* no mmap on this platform: fall back to a private copy owned by the buffer */
+    status = jjs_platform_fs_read_file_impl (context_p, jjs_util_system_allocator_ptr (), &platform_path, buffer_p);
+  }
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, path_bytes_p, path_len);
+
+  return status;
+}
+
 static jjs_value_t
 jjsp_read_file (jjs_context_t* context_p, jjs_value_t path, jjs_encoding_t encoding)
 {
@@ -33,6 +33,10 @@ jjs_platform_buffer (void* data_p, jjs_size_t data_size, const jjs_allocator_t*
 void jjs_platform_buffer_view_from_buffer (jjs_platform_buffer_view_t* self_p, jjs_platform_buffer_t* source_p, jjs_encoding_t encoding);
 jjs_status_t jjs_platform_buffer_view_new (jjs_platform_buffer_view_t* self_p, const jjs_allocator_t* allocator, jjs_size_t size, jjs_encoding_t encoding);
 
+jjs_value_t jjsp_read_file_buffer (jjs_context_t* context_p, jjs_value_t path, jjs_allocator_t* path_allocator, jjs_allocator_t* buffer_allocator, jjs_platform_buffer_t* buffer_p);
+jjs_status_t jjsp_write_file_buffer (jjs_context_t* context_p, jjs_value_t path, jjs_allocator_t* path_allocator, const uint8_t* data_p, jjs_size_t data_size);
+jjs_status_t jjsp_map_file_buffer (jjs_context_t* context_p, jjs_value_t path, jjs_allocator_t* path_allocator, jjs_platform_buffer_t* buffer_p);
+
 /* platform api implementations */
 
 void JJS_ATTR_NORETURN jjsp_fatal_impl (jjs_fatal_code_t code);
@@ -48,5 +52,7 @@ jjs_status_t jjs_platform_path_cwd_impl (jjs_context_t *context_p, const jjs_all
 jjs_status_t jjs_platform_path_realpath_impl (jjs_context_t *context_p, const jjs_allocator_t* allocator, jjs_platform_path_t* path_p, jjs_platform_buffer_view_t* buffer_view_p);
 
 jjs_status_t jjs_platform_fs_read_file_impl (jjs_context_t *context_p, const jjs_allocator_t* allocator, jjs_platform_path_t* path_p, jjs_platform_buffer_t* out_p);
+jjs_status_t jjs_platform_fs_write_file_impl (jjs_context_t *context_p, jjs_platform_path_t* path_p, const uint8_t* data_p, jjs_size_t data_size);
+jjs_status_t jjs_platform_fs_map_file_impl (jjs_context_t *context_p, jjs_platform_path_t* path_p, jjs_platform_buffer_t* out_p);
 
 #endif /* JJS_PLATFORM_H */
@@ -43,6 +43,7 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
+#include "ecma-heap-snapshot.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-iterator-object.h"
@@ -439,6 +440,22 @@ jjs_register_magic_strings (jjs_context_t* context_p, /**< JJS context */
                             (const lit_utf8_size_t *) str_lengths_p);
 } /* jjs_register_magic_strings */
 
+/**
+ * Notify the engine that the local time zone of the system has changed.
+ *
+ * Date objects cache the local time zone adjustments queried from the platform. This function
+ * drops the cached values, so later local time conversions use the new time zone rules.
+ */
+void
+jjs_time_zone_changed (jjs_context_t* context_p) /**< JJS context */
+{
+  jjs_assert_api_enabled (context_p);
+
+#if JJS_BUILTIN_DATE
+  ecma_date_clear_tza_cache (context_p);
+#endif /* JJS_BUILTIN_DATE */
+} /* jjs_time_zone_changed */
+
 /**
  * Run garbage collection
  */
@@ -458,6 +475,61 @@ jjs_heap_gc (jjs_context_t* context_p, /**< JJS context */
   ecma_free_unused_memory (context_p, JMEM_PRESSURE_HIGH);
 } /* jjs_heap_gc */
 
+/**
+ * Run a step of a garbage collection with an incremental sweep.
+ *
+ * If unreachable objects of a previous step are waiting to be freed, at most sweep_limit of
+ * them are freed. Otherwise a new collection is started, which marks all reachable objects
+ * in a single step and frees at most sweep_limit of the unreachable ones. Only freeing the
+ * unreachable objects is spread over several steps; marking is not incremental, so the
+ * first step of a collection still pauses for the whole mark phase.
+ *
+ * @return true - if unreachable objects are still waiting to be freed
+ *         false - otherwise
+ */
+bool
+jjs_heap_gc_step (jjs_context_t* context_p, /**< JJS context */
+                  uint32_t sweep_limit) /**< maximum number of objects to free, 0 frees all of them */
+{
+  jjs_assert_api_enabled (context_p);
+
+  return ecma_gc_step (context_p, sweep_limit);
+} /* jjs_heap_gc_step */
+
+/**
+ * Write a snapshot of the JavaScript heap to a stream.
+ *
+ * A full garbage collection is run first. The snapshot is a JSON document in the
+ * .heapsnapshot format of Chrome DevTools, which shows the retainers of each object.
+ * It is written as ASCII text with a series of write calls.
+ *
+ * @return undefined - if the snapshot is written
+ *         exception - if the heap snapshot is disabled, wstream_p is NULL or the
+ *                     snapshot cannot be allocated (nothing is written)
+ */
+jjs_value_t
+jjs_heap_snapshot (jjs_context_t *context_p, /**< JJS context */
+                   const jjs_wstream_t *wstream_p) /**< target stream of the snapshot */
+{
+  jjs_assert_api_enabled (context_p);
+#if JJS_HEAP_SNAPSHOT
+  if (wstream_p == NULL)
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_TYPE, ecma_get_error_msg (ECMA_ERR_WRONG_ARGS_MSG));
+  }
+
+  if (!ecma_heap_snapshot_write (context_p, wstream_p))
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_RANGE, ecma_get_error_msg (ECMA_ERR_ALLOCATE_HEAP_SNAPSHOT));
+  }
+
+  return ECMA_VALUE_UNDEFINED;
+#else /* !JJS_HEAP_SNAPSHOT */
+  JJS_UNUSED (wstream_p);
+  return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_HEAP_SNAPSHOT_DISABLED));
+#endif /* JJS_HEAP_SNAPSHOT */
+} /* jjs_heap_snapshot */
+
 /**
  * Get heap memory stats.
  *
@@ -491,6 +563,37 @@ jjs_heap_stats (jjs_context_t* context_p, /**< JJS context */
 #endif /* JJS_MEM_STATS */
 } /* jjs_heap_stats */
 
+/**
+ * Get RegExp cache stats.
+ *
+ * @return true - get the RegExp cache stats successful
+ *         false - otherwise. Usually it is because the RegExp builtin is not enabled.
+ */
+bool
+jjs_regexp_cache_stats (jjs_context_t* context_p, /**< JJS context */
+                        jjs_regexp_cache_stats_t *out_stats_p) /**< [out] RegExp cache stats */
+{
+  jjs_assert_api_enabled (context_p);
+
+#if JJS_BUILTIN_REGEXP
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  *out_stats_p = (jjs_regexp_cache_stats_t){ .version = 1,
+                                             .size = context_p->re_cache_size,
+                                             .count = context_p->re_cache_count,
+                                             .hits = context_p->re_cache_hits,
+                                             .misses = context_p->re_cache_misses };
+
+  return true;
+#else /* !JJS_BUILTIN_REGEXP */
+  JJS_UNUSED (out_stats_p);
+  return false;
+#endif /* JJS_BUILTIN_REGEXP */
+} /* jjs_regexp_cache_stats */
+
 #if JJS_PARSER
 /**
  * Common code for parsing a script, module, or function.
@@ -1597,6 +1700,14 @@ jjs_feature_enabled (const jjs_feature_t feature) /**< feature to check */
       return IS_FEATURE_ENABLED (JJS_ANNEX_VMOD);
     case JJS_FEATURE_VM_STACK_LIMIT:
       return IS_FEATURE_ENABLED (JJS_VM_STACK_LIMIT);
+    case JJS_FEATURE_VM_HEAP_GROWABLE:
+      return IS_FEATURE_ENABLED (JJS_VM_HEAP_GROWABLE);
+    case JJS_FEATURE_CODE_CACHE:
+      return IS_FEATURE_ENABLED (JJS_ANNEX_CODE_CACHE);
+    case JJS_FEATURE_CPU_PROFILER:
+      return IS_FEATURE_ENABLED (JJS_CPU_PROFILER);
+    case JJS_FEATURE_HEAP_SNAPSHOT:
+      return IS_FEATURE_ENABLED (JJS_HEAP_SNAPSHOT);
     default:
       JJS_ASSERT (false);
       return false;
@@ -5989,6 +6100,69 @@ jjs_halt_handler (jjs_context_t* context_p,
 #endif /* JJS_VM_HALT */
 } /* jjs_halt_handler */
 
+/**
+ * Start the sampling cpu profiler.
+ *
+ * While the profiler is running, the JavaScript call stack is recorded about
+ * every interval_us microseconds. Samples are taken at function entries and
+ * loop back edges, so the time spent in a long native call is attributed to
+ * the next sample.
+ *
+ * @return undefined - if the profiler is started
+ *         exception - if the profiler is disabled, already running or cannot be allocated
+ */
+jjs_value_t
+jjs_cpu_profiler_start (jjs_context_t *context_p, /**< JJS context */
+                        uint32_t interval_us) /**< sampling interval in microseconds (0 selects 1000) */
+{
+  jjs_assert_api_enabled (context_p);
+#if JJS_CPU_PROFILER
+  if (context_p->vm_profiler_p != NULL)
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CPU_PROFILER_IS_RUNNING));
+  }
+
+  if (!vm_profiler_start (context_p, interval_us))
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_RANGE, ecma_get_error_msg (ECMA_ERR_ALLOCATE_CPU_PROFILER));
+  }
+
+  return ECMA_VALUE_UNDEFINED;
+#else /* !JJS_CPU_PROFILER */
+  JJS_UNUSED (interval_us);
+  return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CPU_PROFILER_DISABLED));
+#endif /* JJS_CPU_PROFILER */
+} /* jjs_cpu_profiler_start */
+
+/**
+ * Stop the sampling cpu profiler and write the recorded profile to a stream.
+ *
+ * The profile is a JSON document in the .cpuprofile format of Chrome DevTools.
+ * It is written as ASCII text with a series of write calls. The profile is
+ * discarded when wstream_p is NULL.
+ *
+ * @return undefined - if the profiler is stopped
+ *         exception - if the profiler is disabled or not running
+ */
+jjs_value_t
+jjs_cpu_profiler_stop (jjs_context_t *context_p, /**< JJS context */
+                       const jjs_wstream_t *wstream_p) /**< target stream of the profile (can be NULL) */
+{
+  jjs_assert_api_enabled (context_p);
+#if JJS_CPU_PROFILER
+  if (context_p->vm_profiler_p == NULL)
+  {
+    return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CPU_PROFILER_NOT_RUNNING));
+  }
+
+  vm_profiler_stop (context_p, wstream_p);
+  return ECMA_VALUE_UNDEFINED;
+#else /* !JJS_CPU_PROFILER */
+  JJS_UNUSED (wstream_p);
+  return jjs_throw_sz (context_p, JJS_ERROR_COMMON, ecma_get_error_msg (ECMA_ERR_CPU_PROFILER_DISABLED));
+#endif /* JJS_CPU_PROFILER */
+} /* jjs_cpu_profiler_stop */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
@@ -7923,6 +8097,9 @@ jjs_container_to_array (jjs_context_t* context_p, /**< JJS context */
 
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
 
+  /* Weak containers must not expose unreachable keys still waiting for an incremental sweep. */
+  ecma_gc_finish_sweep (context_p);
+
   uint32_t entry_count;
   uint8_t entry_size;
 
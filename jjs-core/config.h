@@ -229,6 +229,46 @@
 #define JJS_DEFAULT_VM_STACK_LIMIT_KB (0)
 #endif /* JJS_DEFAULT_VM_STACK_LIMIT_KB */
 
+/**
+ * Enable a growable vm heap.
+ *
+ * When enabled, the vm heap starts with the configured vm heap size and grows by adding
+ * segments, allocated with the context allocator, when an allocation cannot be satisfied
+ * after a garbage collection. Segments that become empty are returned to the context
+ * allocator. The maximum size and the minimum segment size can be set in
+ * jjs_context_options_t. Compressed pointers are translated through a segment table, so
+ * this option requires JJS_CPOINTER_32_BIT.
+ *
+ * When disabled, the vm heap is a single block of the configured vm heap size. If the
+ * maximum or step size is set in jjs_context_options_t, jjs_context_new will return an
+ * error status.
+ *
+ * Default value: 0
+ */
+#ifndef JJS_VM_HEAP_GROWABLE
+#define JJS_VM_HEAP_GROWABLE 0
+#endif /* JJS_VM_HEAP_GROWABLE */
+
+/**
+ * Default maximum size of a growable vm heap in kilobytes.
+ *
+ * If 0, the vm heap does not grow beyond its initial size.
+ *
+ * Default value: 0
+ */
+#ifndef JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB
+#define JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB (0)
+#endif /* JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB */
+
+/**
+ * Default minimum size of a segment added to a growable vm heap in kilobytes.
+ *
+ * Default value: 256
+ */
+#ifndef JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB
+#define JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB (256)
+#endif /* JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -242,6 +282,19 @@
 #define JJS_LCACHE 1
 #endif /* !defined (JJS_LCACHE) */
 
+/**
+ * Enable/Disable inline caches of property access sites.
+ *
+ * Allowed values:
+ *  0: Disable inline caches.
+ *  1: Enable inline caches.
+ *
+ * Default value: 1
+ */
+#ifndef JJS_VM_INLINE_CACHE
+#define JJS_VM_INLINE_CACHE 1
+#endif /* !defined (JJS_VM_INLINE_CACHE) */
+
 /**
  * Enable/Disable function toString operation.
  *
@@ -454,6 +507,28 @@
 #define JJS_VM_HALT 0
 #endif /* !defined (JJS_VM_HALT) */
 
+/**
+ * Enable/Disable the sampling cpu profiler.
+ *
+ * Allowed values:
+ *  0: Disable cpu profiler support.
+ *  1: Enable cpu profiler support (see jjs_cpu_profiler_start).
+ */
+#ifndef JJS_CPU_PROFILER
+#define JJS_CPU_PROFILER 1
+#endif /* !defined (JJS_CPU_PROFILER) */
+
+/**
+ * Enable/Disable heap snapshot export.
+ *
+ * Allowed values:
+ *  0: Disable heap snapshot support.
+ *  1: Enable heap snapshot support (see jjs_heap_snapshot).
+ */
+#ifndef JJS_HEAP_SNAPSHOT
+#define JJS_HEAP_SNAPSHOT 1
+#endif /* !defined (JJS_HEAP_SNAPSHOT) */
+
 /**
  * Enable/Disable the vm throw callback function.
  *
@@ -465,6 +540,19 @@
 #define JJS_VM_THROW 0
 #endif /* !defined (JJS_VM_THROW) */
 
+/**
+ * Enable/Disable computed goto dispatch of the opcode groups in the vm loop.
+ *
+ * Allowed values:
+ *  0: Dispatch the opcode groups with a switch statement.
+ *  1: Dispatch the opcode groups with computed gotos (requires the labels as values GNU C extension).
+ *
+ * Default value: 0
+ */
+#ifndef JJS_VM_COMPUTED_GOTO
+#define JJS_VM_COMPUTED_GOTO 0
+#endif /* !defined (JJS_VM_COMPUTED_GOTO) */
+
 /**
  * Default settings for VM initialization (see jjs_init).
  *
@@ -534,6 +622,24 @@
 #define JJS_DEFAULT_GC_MARK_LIMIT (8)
 #endif /* !defined (JJS_DEFAULT_GC_MARK_LIMIT) */
 
+/**
+ * Maximum number of unreachable objects freed by a single GC step (incremental sweep)
+ *
+ * Default value: 0, unlimited
+ */
+#ifndef JJS_DEFAULT_GC_SWEEP_LIMIT
+#define JJS_DEFAULT_GC_SWEEP_LIMIT (0)
+#endif /* !defined (JJS_DEFAULT_GC_SWEEP_LIMIT) */
+
+/**
+ * Maximum number of compiled RegExp patterns kept in the RegExp cache
+ *
+ * Default value: 64
+ */
+#ifndef JJS_DEFAULT_REGEXP_CACHE_SIZE
+#define JJS_DEFAULT_REGEXP_CACHE_SIZE (64)
+#endif /* !defined (JJS_DEFAULT_REGEXP_CACHE_SIZE) */
+
 /**
  * Amount of newly allocated objects since the last GC run, represented as a
  * fraction of all allocated objects, which when reached will trigger garbage
@@ -647,6 +753,26 @@
 #define JJS_PLATFORM_API_FS_READ_FILE 1
 #endif /* JJS_PLATFORM_API_FS_READ_FILE */
 
+/**
+ * platform.fs.write_file
+ *
+ * Default: 1
+ */
+#ifndef JJS_PLATFORM_API_FS_WRITE_FILE
+#define JJS_PLATFORM_API_FS_WRITE_FILE 1
+#endif /* JJS_PLATFORM_API_FS_WRITE_FILE */
+
+/**
+ * platform.fs.map_file
+ *
+ * Maps a file read-only into memory. Used by jjs_exec_snapshot_file.
+ *
+ * Default: 1
+ */
+#ifndef JJS_PLATFORM_API_FS_MAP_FILE
+#define JJS_PLATFORM_API_FS_MAP_FILE 1
+#endif /* JJS_PLATFORM_API_FS_MAP_FILE */
+
 /**
  * platform.path.realpath
  *
@@ -803,6 +929,18 @@
 #if JJS_DEFAULT_VM_HEAP_SIZE_KB <= 0
 #error "Invalid value for 'JJS_DEFAULT_VM_HEAP_SIZE_KB' macro."
 #endif /* JJS_DEFAULT_VM_HEAP_SIZE_KB <= 0 */
+#if (JJS_VM_HEAP_GROWABLE != 0) && (JJS_VM_HEAP_GROWABLE != 1)
+#error "Invalid value for 'JJS_VM_HEAP_GROWABLE' macro."
+#endif /* (JJS_VM_HEAP_GROWABLE != 0) && (JJS_VM_HEAP_GROWABLE != 1) */
+#if JJS_VM_HEAP_GROWABLE && !JJS_CPOINTER_32_BIT
+#error "JJS_VM_HEAP_GROWABLE requires JJS_CPOINTER_32_BIT."
+#endif /* JJS_VM_HEAP_GROWABLE && !JJS_CPOINTER_32_BIT */
+#if JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB < 0
+#error "Invalid value for 'JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB' macro."
+#endif /* JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB < 0 */
+#if JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB <= 0
+#error "Invalid value for 'JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB' macro."
+#endif /* JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB <= 0 */
 #if JJS_DEFAULT_GC_LIMIT < 0
 #error "Invalid value for 'JJS_DEFAULT_GC_LIMIT' macro."
 #endif /* JJS_DEFAULT_GC_LIMIT < 0 */
@@ -815,9 +953,18 @@
 #if JJS_DEFAULT_GC_MARK_LIMIT < 0
 #error "Invalid value for 'JJS_DEFAULT_GC_MARK_LIMIT' macro."
 #endif /* JJS_DEFAULT_GC_MARK_LIMIT < 0 */
+#if JJS_DEFAULT_GC_SWEEP_LIMIT < 0
+#error "Invalid value for 'JJS_DEFAULT_GC_SWEEP_LIMIT' macro."
+#endif /* JJS_DEFAULT_GC_SWEEP_LIMIT < 0 */
+#if JJS_DEFAULT_REGEXP_CACHE_SIZE < 0
+#error "Invalid value for 'JJS_DEFAULT_REGEXP_CACHE_SIZE' macro."
+#endif /* JJS_DEFAULT_REGEXP_CACHE_SIZE < 0 */
 #if (JJS_LCACHE != 0) && (JJS_LCACHE != 1)
 #error "Invalid value for 'JJS_LCACHE' macro."
 #endif /* (JJS_LCACHE != 0) && (JJS_LCACHE != 1) */
+#if (JJS_VM_INLINE_CACHE != 0) && (JJS_VM_INLINE_CACHE != 1)
+#error "Invalid value for 'JJS_VM_INLINE_CACHE' macro."
+#endif /* (JJS_VM_INLINE_CACHE != 0) && (JJS_VM_INLINE_CACHE != 1) */
 #if (JJS_FUNCTION_TO_STRING != 0) && (JJS_FUNCTION_TO_STRING != 1)
 #error "Invalid value for 'JJS_FUNCTION_TO_STRING' macro."
 #endif /* (JJS_FUNCTION_TO_STRING != 0) && (JJS_FUNCTION_TO_STRING != 1) */
@@ -869,9 +1016,21 @@
 #if (JJS_VM_HALT != 0) && (JJS_VM_HALT != 1)
 #error "Invalid value for 'JJS_VM_HALT' macro."
 #endif /* (JJS_VM_HALT != 0) && (JJS_VM_HALT != 1) */
+#if (JJS_CPU_PROFILER != 0) && (JJS_CPU_PROFILER != 1)
+#error "Invalid value for 'JJS_CPU_PROFILER' macro."
+#endif /* (JJS_CPU_PROFILER != 0) && (JJS_CPU_PROFILER != 1) */
+#if (JJS_HEAP_SNAPSHOT != 0) && (JJS_HEAP_SNAPSHOT != 1)
+#error "Invalid value for 'JJS_HEAP_SNAPSHOT' macro."
+#endif /* (JJS_HEAP_SNAPSHOT != 0) && (JJS_HEAP_SNAPSHOT != 1) */
 #if (JJS_VM_THROW != 0) && (JJS_VM_THROW != 1)
 #error "Invalid value for 'JJS_VM_THROW' macro."
 #endif /* (JJS_VM_THROW != 0) && (JJS_VM_THROW != 1) */
+#if (JJS_VM_COMPUTED_GOTO != 0) && (JJS_VM_COMPUTED_GOTO != 1)
+#error "Invalid value for 'JJS_VM_COMPUTED_GOTO' macro."
+#endif /* (JJS_VM_COMPUTED_GOTO != 0) && (JJS_VM_COMPUTED_GOTO != 1) */
+#if JJS_VM_COMPUTED_GOTO && !defined(__GNUC__)
+#error "Computed goto dispatch ('JJS_VM_COMPUTED_GOTO') requires a compiler with labels as values support."
+#endif /* JJS_VM_COMPUTED_GOTO && !defined(__GNUC__) */
 #if (JJS_VM_STACK_LIMIT != 0) && (JJS_VM_STACK_LIMIT != 1)
 #error "Invalid value for 'JJS_VM_STACK_LIMIT' macro."
 #endif /* (JJS_VM_STACK_LIMIT != 0) && (JJS_VM_STACK_LIMIT != 1) */
@@ -909,6 +1068,12 @@
 #if (JJS_PLATFORM_API_FS_READ_FILE != 0) && (JJS_PLATFORM_API_FS_READ_FILE != 1) && (JJS_PLATFORM_API_FS_READ_FILE != 2)
 #error "Invalid value for 'JJS_PLATFORM_API_FS_READ_FILE' macro."
 #endif /* (JJS_PLATFORM_API_FS_READ_FILE != 0) && (JJS_PLATFORM_API_FS_READ_FILE != 1) && (JJS_PLATFORM_API_FS_READ_FILE != 2) */
+#if (JJS_PLATFORM_API_FS_WRITE_FILE != 0) && (JJS_PLATFORM_API_FS_WRITE_FILE != 1) && (JJS_PLATFORM_API_FS_WRITE_FILE != 2)
+#error "Invalid value for 'JJS_PLATFORM_API_FS_WRITE_FILE' macro."
+#endif /* (JJS_PLATFORM_API_FS_WRITE_FILE != 0) && (JJS_PLATFORM_API_FS_WRITE_FILE != 1) && (JJS_PLATFORM_API_FS_WRITE_FILE != 2) */
+#if (JJS_PLATFORM_API_FS_MAP_FILE != 0) && (JJS_PLATFORM_API_FS_MAP_FILE != 1) && (JJS_PLATFORM_API_FS_MAP_FILE != 2)
+#error "Invalid value for 'JJS_PLATFORM_API_FS_MAP_FILE' macro."
+#endif /* (JJS_PLATFORM_API_FS_MAP_FILE != 0) && (JJS_PLATFORM_API_FS_MAP_FILE != 1) && (JJS_PLATFORM_API_FS_MAP_FILE != 2) */
 
 /**
  * Cross component requirements check.
@@ -934,4 +1099,28 @@
 #error "JJS_ANNEX_ESM depends on JJS_MODULE_SYSTEM"
 #endif /* JJS_ANNEX_ESM && !JJS_MODULE_SYSTEM */
 
+/**
+ * Enable/Disable the on-disk code cache of CommonJS and ES modules.
+ *
+ * The cache stores module byte code as snapshots, so it is only available
+ * when both snapshot saving and snapshot execution are enabled.
+ *
+ * Default value: JJS_ANNEX, if snapshot save and exec are enabled; otherwise, 0
+ */
+#ifndef JJS_ANNEX_CODE_CACHE
+#if JJS_SNAPSHOT_SAVE && JJS_SNAPSHOT_EXEC && (JJS_ANNEX_COMMONJS || JJS_ANNEX_ESM)
+#define JJS_ANNEX_CODE_CACHE JJS_ANNEX
+#else /* !(JJS_SNAPSHOT_SAVE && JJS_SNAPSHOT_EXEC && (JJS_ANNEX_COMMONJS || JJS_ANNEX_ESM)) */
+#define JJS_ANNEX_CODE_CACHE 0
+#endif /* JJS_SNAPSHOT_SAVE && JJS_SNAPSHOT_EXEC && (JJS_ANNEX_COMMONJS || JJS_ANNEX_ESM) */
+#endif /* !defined (JJS_ANNEX_CODE_CACHE) */
+
+#if (JJS_ANNEX_CODE_CACHE != 0) && (JJS_ANNEX_CODE_CACHE != 1)
+#error "Invalid value for 'JJS_ANNEX_CODE_CACHE' macro."
+#endif /* (JJS_ANNEX_CODE_CACHE != 0) && (JJS_ANNEX_CODE_CACHE != 1) */
+
+#if JJS_ANNEX_CODE_CACHE && !(JJS_SNAPSHOT_SAVE && JJS_SNAPSHOT_EXEC)
+#error "JJS_ANNEX_CODE_CACHE depends on JJS_SNAPSHOT_SAVE and JJS_SNAPSHOT_EXEC"
+#endif /* JJS_ANNEX_CODE_CACHE && !(JJS_SNAPSHOT_SAVE && JJS_SNAPSHOT_EXEC) */
+
 #endif /* !JJS_CONFIG_H */
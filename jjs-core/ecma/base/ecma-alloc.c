@@ -57,6 +57,12 @@ JJS_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= s
 extern inline ecma_number_t *JJS_ATTR_ALWAYS_INLINE
 ecma_alloc_number (ecma_context_t *context_p) /**< JJS context */
 {
+  /* Arithmetic produces and drops float numbers at a high rate, reuse recently freed ones. */
+  if (context_p->ecma_number_cache_count > 0)
+  {
+    return context_p->ecma_number_cache[--context_p->ecma_number_cache_count];
+  }
+
   return (ecma_number_t *) jmem_heap_alloc_block (context_p, sizeof (ecma_number_t));
 } /* ecma_alloc_number */
 
@@ -67,9 +73,28 @@ extern inline void JJS_ATTR_ALWAYS_INLINE
 ecma_dealloc_number (ecma_context_t *context_p, /**< JJS context */
                      ecma_number_t *number_p) /**< number to be freed */
 {
+  if (context_p->ecma_number_cache_count < ECMA_NUMBER_CACHE_SIZE)
+  {
+    context_p->ecma_number_cache[context_p->ecma_number_cache_count++] = number_p;
+    return;
+  }
+
   jmem_heap_free_block (context_p, (uint8_t *) number_p, sizeof (ecma_number_t));
 } /* ecma_dealloc_number */
 
+/**
+ * Return the float number boxes kept for reuse to the heap.
+ */
+void
+ecma_free_number_cache (ecma_context_t *context_p) /**< JJS context */
+{
+  while (context_p->ecma_number_cache_count > 0)
+  {
+    ecma_number_t *number_p = context_p->ecma_number_cache[--context_p->ecma_number_cache_count];
+    jmem_heap_free_block (context_p, (uint8_t *) number_p, sizeof (ecma_number_t));
+  }
+} /* ecma_free_number_cache */
+
 /**
  * Allocate memory for ecma-object
  *
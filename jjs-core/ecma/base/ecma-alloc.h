@@ -61,6 +61,11 @@ ecma_number_t *ecma_alloc_number (ecma_context_t *context_p);
  */
 void ecma_dealloc_number (ecma_context_t *context_p, ecma_number_t *number_p);
 
+/**
+ * Return the float number boxes kept for reuse to the heap
+ */
+void ecma_free_number_cache (ecma_context_t *context_p);
+
 /**
  * Allocate memory for ecma-string descriptor
  *
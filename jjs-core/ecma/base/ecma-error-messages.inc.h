@@ -157,6 +157,9 @@ ECMA_ERROR_DEF (ECMA_ERR_UNMATCHED_CLOSE_BRACKET, "Unmatched close bracket")
 #if JJS_MODULE_SYSTEM
 ECMA_ERROR_DEF (ECMA_ERR_NOT_MODULE, "Argument is not a module")
 #endif /* JJS_MODULE_SYSTEM */
+#if !(JJS_CPU_PROFILER)
+ECMA_ERROR_DEF (ECMA_ERR_CPU_PROFILER_DISABLED, "CPU profiler is disabled")
+#endif /* !(JJS_CPU_PROFILER) */
 ECMA_ERROR_DEF (ECMA_ERR_SET_PROTOTYPE, "Cannot set [[Prototype]]")
 #if JJS_BUILTIN_ARRAY
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_NEW_ARRAY_LENGTH, "Invalid new Array length")
@@ -179,6 +182,9 @@ ECMA_ERROR_DEF (ECMA_ERR_ARGUMENT_NOT_SUPPORTED, "Argument is not supported")
 #if JJS_BUILTIN_STRING
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_CODE_POINT_ERROR, "Error: Invalid code point")
 #endif /* JJS_BUILTIN_STRING */
+#if !(JJS_HEAP_SNAPSHOT)
+ECMA_ERROR_DEF (ECMA_ERR_HEAP_SNAPSHOT_DISABLED, "Heap snapshot is disabled")
+#endif /* !(JJS_HEAP_SNAPSHOT) */
 #if JJS_BUILTIN_TYPEDARRAY
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_TYPEDARRAY_LENGTH, "Invalid TypedArray length")
 #endif /* JJS_BUILTIN_TYPEDARRAY */
@@ -217,9 +223,15 @@ ECMA_ERROR_DEF (ECMA_ERR_RECEIVER_MUST_BE_AN_OBJECT, "Receiver must be an object
 #if JJS_BUILTIN_BIGINT && JJS_BUILTIN_JSON
 ECMA_ERROR_DEF (ECMA_ERR_BIGINT_SERIALIZED, "BigInt cannot be serialized")
 #endif /* JJS_BUILTIN_BIGINT && JJS_BUILTIN_JSON */
+#if JJS_CPU_PROFILER
+ECMA_ERROR_DEF (ECMA_ERR_CPU_PROFILER_NOT_RUNNING, "CPU profiler is not running")
+#endif /* JJS_CPU_PROFILER */
 #if JJS_BUILTIN_CONTAINER
 ECMA_ERROR_DEF (ECMA_ERR_CONTAINER_IS_NOT_AN_OBJECT, "Container is not an object.")
 #endif /* JJS_BUILTIN_CONTAINER */
+#if JJS_SNAPSHOT_EXEC
+ECMA_ERROR_DEF (ECMA_ERR_FAILED_TO_MAP_SNAPSHOT_FILE, "Failed to map snapshot file")
+#endif /* JJS_SNAPSHOT_EXEC */
 #if JJS_BUILTIN_REGEXP
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_HEX_ESCAPE_SEQUENCE, "Invalid hex escape sequence")
 #endif /* JJS_BUILTIN_REGEXP */
@@ -232,6 +244,9 @@ ECMA_ERROR_DEF (ECMA_ERR_SYMBOL_IS_NOT_A_CONSTRUCTOR, "Symbol is not a construct
 #if JJS_BUILTIN_REFLECT
 ECMA_ERROR_DEF (ECMA_ERR_TARGET_IS_NOT_A_CONSTRUCTOR, "Target is not a constructor")
 #endif /* JJS_BUILTIN_REFLECT */
+#if !(JJS_ANNEX_CODE_CACHE)
+ECMA_ERROR_DEF (ECMA_ERR_CODE_CACHE_NOT_SUPPORTED, "code cache is not supported")
+#endif /* !(JJS_ANNEX_CODE_CACHE) */
 ECMA_ERROR_DEF (ECMA_ERR_ACCESSOR_WRITABLE, "Accessors cannot be writable")
 #if !(JJS_ANNEX_COMMONJS)
 ECMA_ERROR_DEF (ECMA_ERR_COMMONJS_NOT_SUPPORTED, "CommonJS support is disabled")
@@ -298,6 +313,9 @@ ECMA_ERROR_DEF (ECMA_ERR_SNAPSHOT_EXEC_DISABLED, "Snapshot execution is disabled
 ECMA_ERROR_DEF (ECMA_ERR_TYPED_ARRAY_NOT_SUPPORTED, "TypedArray support is disabled")
 #endif /* !(JJS_BUILTIN_TYPEDARRAY) */
 ECMA_ERROR_DEF (ECMA_ERR_UNICODE_SURROGATE_PAIR_MISSING, "Unicode surrogate pair missing")
+#if JJS_CPU_PROFILER
+ECMA_ERROR_DEF (ECMA_ERR_CPU_PROFILER_IS_RUNNING, "CPU profiler is already running")
+#endif /* JJS_CPU_PROFILER */
 #if JJS_BUILTIN_REGEXP
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_CONTROL_ESCAPE_SEQUENCE, "Invalid control escape sequence")
 ECMA_ERROR_DEF (ECMA_ERR_INVALID_UNICODE_ESCAPE_SEQUENCE, "Invalid unicode escape sequence")
@@ -568,6 +586,9 @@ ECMA_ERROR_DEF (ECMA_ERR_PROPERTY_NAME_IS_NEITHER_SYMBOL_NOR_STRING, "Property n
 #if JJS_BUILTIN_BIGINT
 ECMA_ERROR_DEF (ECMA_ERR_STRING_CANNOT_BE_CONVERTED_TO_BIGINT_VALUE, "String cannot be converted to BigInt value")
 #endif /* JJS_BUILTIN_BIGINT */
+#if JJS_CPU_PROFILER
+ECMA_ERROR_DEF (ECMA_ERR_ALLOCATE_CPU_PROFILER, "Cannot allocate memory for the CPU profiler")
+#endif /* JJS_CPU_PROFILER */
 #if JJS_BUILTIN_CONTAINER
 ECMA_ERROR_DEF (ECMA_ERR_INCORRECT_TYPE_CALL, "Operator called on incorrect container type")
 #endif /* JJS_BUILTIN_CONTAINER */
@@ -584,6 +605,9 @@ ECMA_ERROR_DEF (ECMA_ERR_ARGUMENT_THIS_NOT_ARRAY_BUFFER_OBJECT, "Argument 'this'
 ECMA_ERROR_DEF (ECMA_ERR_ARROW_FUNCTIONS_INVOKE_WITH_NEW, "Arrow functions cannot be invoked with 'new'")
 ECMA_ERROR_DEF (ECMA_ERR_ASYNC_FUNCTIONS_INVOKE_WITH_NEW, "Async functions cannot be invoked with 'new'")
 #endif /* JJS_ERROR_MESSAGES */
+#if JJS_HEAP_SNAPSHOT
+ECMA_ERROR_DEF (ECMA_ERR_ALLOCATE_HEAP_SNAPSHOT, "Cannot allocate memory for the heap snapshot")
+#endif /* JJS_HEAP_SNAPSHOT */
 #if JJS_BUILTIN_PROXY
 ECMA_ERROR_DEF (ECMA_ERR_SET_EXTENSIBLE_PROPERTY, "Cannot set [[Extensible]] property of object")
 #endif /* JJS_BUILTIN_PROXY */
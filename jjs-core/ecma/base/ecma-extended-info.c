@@ -129,9 +129,11 @@ ecma_compiled_code_resolve_extended_info (const ecma_compiled_code_t *bytecode_h
   /* adjust for line info block */
   base_p--;
 
-  JJS_ASSERT (((uint8_t *) base_p)[-1] != 0);
+  uint8_t *extended_info_p = ((uint8_t *) base_p) - ecma_compiled_code_get_slot_table_size (bytecode_header_p);
 
-  return ((uint8_t *) base_p) - 1;
+  JJS_ASSERT (extended_info_p[-1] != 0);
+
+  return extended_info_p - 1;
 } /* ecma_compiled_code_resolve_extended_info */
 
 /**
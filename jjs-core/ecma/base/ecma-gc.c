@@ -80,6 +80,62 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
  */
 static void ecma_gc_mark (ecma_context_t *context_p, ecma_object_t *object_p);
 
+/**
+ * Initial capacity of the gray object stack.
+ */
+#define ECMA_GC_MARK_STACK_INITIAL_CAPACITY (64)
+
+/**
+ * Push a gray object, whose references are not marked yet, onto the mark stack.
+ *
+ * @return true - if the object is pushed
+ *         false - if the mark stack cannot be grown
+ */
+static bool
+ecma_gc_push_gray_object (ecma_context_t *context_p, /**< JJS context */
+                          ecma_object_t *object_p) /**< object */
+{
+  if (context_p->ecma_gc_mark_stack_size == context_p->ecma_gc_mark_stack_capacity)
+  {
+    uint32_t capacity = context_p->ecma_gc_mark_stack_capacity;
+    uint32_t new_capacity = (capacity == 0) ? ECMA_GC_MARK_STACK_INITIAL_CAPACITY : capacity * 2;
+    ecma_object_t **stack_p = jjs_allocator_alloc (&context_p->context_allocator,
+                                                   new_capacity * sizeof (ecma_object_t *));
+
+    if (stack_p == NULL)
+    {
+      return false;
+    }
+
+    if (capacity != 0)
+    {
+      memcpy (stack_p, context_p->ecma_gc_mark_stack_p, capacity * sizeof (ecma_object_t *));
+      jjs_allocator_free (&context_p->context_allocator,
+                          context_p->ecma_gc_mark_stack_p,
+                          capacity * sizeof (ecma_object_t *));
+    }
+
+    context_p->ecma_gc_mark_stack_p = stack_p;
+    context_p->ecma_gc_mark_stack_capacity = new_capacity;
+  }
+
+  context_p->ecma_gc_mark_stack_p[context_p->ecma_gc_mark_stack_size++] = object_p;
+  return true;
+} /* ecma_gc_push_gray_object */
+
+/**
+ * Mark the references of the gray objects pushed onto the mark stack.
+ */
+static void
+ecma_gc_mark_gray_objects (ecma_context_t *context_p) /**< JJS context */
+{
+  while (context_p->ecma_gc_mark_stack_size > 0)
+  {
+    ecma_object_t *object_p = context_p->ecma_gc_mark_stack_p[--context_p->ecma_gc_mark_stack_size];
+    ecma_gc_mark (context_p, object_p);
+  }
+} /* ecma_gc_mark_gray_objects */
+
 /**
  * Set visited flag of the object.
  */
@@ -87,6 +143,14 @@ static void
 ecma_gc_set_object_visited (ecma_context_t *context_p, /**< JJS context */
                             ecma_object_t *object_p) /**< object */
 {
+#if JJS_HEAP_SNAPSHOT
+  if (JJS_UNLIKELY (context_p->ecma_gc_visitor_cb != NULL))
+  {
+    context_p->ecma_gc_visitor_cb (context_p, object_p, context_p->ecma_gc_visitor_user_p);
+    return;
+  }
+#endif /* JJS_HEAP_SNAPSHOT */
+
   if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
   {
     if (context_p->gc_mark_limit != 0)
@@ -99,6 +163,11 @@ ecma_gc_set_object_visited (ecma_context_t *context_p, /**< JJS context */
         ecma_gc_mark (context_p, object_p);
         context_p->ecma_gc_mark_recursion_limit++;
       }
+      else if (ecma_gc_push_gray_object (context_p, object_p))
+      {
+        /* Set the reference count of gray object to 0, its references are marked from the mark stack */
+        object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+      }
       else
       {
         /* Set the reference count of the non-marked gray object to 1 */
@@ -1121,7 +1190,7 @@ ecma_gc_mark (ecma_context_t *context_p, /**< JJS context */
 
         if (ecma_op_array_is_fast_array (ext_object_p))
         {
-          if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+          if (object_p->u1.property_list_cp != JMEM_CP_NULL && !ecma_fast_array_has_double_elements (object_p))
           {
             ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
@@ -1409,7 +1478,12 @@ ecma_free_fast_access_array (ecma_context_t *context_p, /**< JJS context */
   ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
   const uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (ext_object_p->u.array.length);
 
-  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL && ecma_fast_array_has_double_elements (object_p))
+  {
+    ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+    jmem_heap_free_block (context_p, numbers_p, aligned_length * sizeof (ecma_number_t));
+  }
+  else if (object_p->u1.property_list_cp != JMEM_CP_NULL)
   {
     ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
@@ -1756,6 +1830,13 @@ ecma_gc_free_object (ecma_context_t *context_p, /**< JJS context */
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
     {
       ecma_gc_free_properties (context_p, object_p, ECMA_GC_FREE_NO_OPTIONS);
+
+      if (ECMA_LEX_ENV_HAS_SLOTS (object_p))
+      {
+        uint32_t slot_count = ((ecma_lexical_environment_slots_t *) object_p)->slot_count;
+        ecma_dealloc_extended_object (context_p, object_p, ECMA_LEX_ENV_SLOTS_SIZE (slot_count));
+        return;
+      }
     }
 
     ecma_dealloc_object (context_p, object_p);
@@ -2146,11 +2227,70 @@ ecma_gc_free_object (ecma_context_t *context_p, /**< JJS context */
 } /* ecma_gc_free_object */
 
 /**
- * Run garbage collection, freeing objects that are no longer referenced.
+ * Free the unreachable objects found by the last mark phase.
+ *
+ * @return true - if unreachable objects are still waiting to be freed
+ *         false - otherwise
+ */
+static bool
+ecma_gc_sweep (ecma_context_t *context_p, /**< JJS context */
+               uint32_t sweep_limit) /**< maximum number of objects to free, 0 frees all of them */
+{
+  jmem_cpointer_t obj_iter_cp = context_p->ecma_gc_sweep_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JJS_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+
+    ecma_gc_free_object (context_p, obj_iter_p);
+    obj_iter_cp = obj_next_cp;
+
+    if (sweep_limit != 0 && --sweep_limit == 0)
+    {
+      break;
+    }
+  }
+
+  context_p->ecma_gc_sweep_cp = obj_iter_cp;
+
+  /* Return the cell pages emptied by the sweep to the heap. */
+  jmem_cellocator_release_empty_pages (context_p, &context_p->jmem_cellocator_32);
+
+#if JJS_VM_HEAP_GROWABLE
+  /* Return the heap segments emptied by the sweep to the context allocator. */
+  jmem_heap_release_empty_segments (context_p);
+#endif /* JJS_VM_HEAP_GROWABLE */
+
+  return obj_iter_cp != JMEM_CP_NULL;
+} /* ecma_gc_sweep */
+
+/**
+ * Free all unreachable objects which are left over by an incremental garbage collection.
  */
 void
-ecma_gc_run (ecma_context_t *context_p) /**< JJS context */
+ecma_gc_finish_sweep (ecma_context_t *context_p) /**< JJS context */
 {
+  if (context_p->ecma_gc_sweep_cp != JMEM_CP_NULL)
+  {
+    ecma_gc_sweep (context_p, 0);
+  }
+} /* ecma_gc_finish_sweep */
+
+/**
+ * Mark the reachable objects and free at most sweep_limit of the unreachable ones.
+ *
+ * The remaining unreachable objects are freed by later ecma_gc_sweep calls.
+ */
+static void
+ecma_gc_collect (ecma_context_t *context_p, /**< JJS context */
+                 uint32_t sweep_limit) /**< maximum number of objects to free, 0 frees all of them */
+{
+  /* Objects of the previous collection must be freed before the visited flags are reset. */
+  ecma_gc_finish_sweep (context_p);
+
   uint32_t gc_mark_limit = context_p->gc_mark_limit;
 
   if (gc_mark_limit != 0)
@@ -2205,6 +2345,7 @@ ecma_gc_run (ecma_context_t *context_p) /**< JJS context */
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_object_t, obj_iter_cp);
     ecma_gc_mark (context_p, obj_iter_p);
+    ecma_gc_mark_gray_objects (context_p);
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
@@ -2246,6 +2387,7 @@ ecma_gc_run (ecma_context_t *context_p) /**< JJS context */
             /* Set the reference count of non-marked gray object to 0 */
             obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
             ecma_gc_mark (context_p, obj_iter_p);
+            ecma_gc_mark_gray_objects (context_p);
             marked_anything_during_current_iteration = true;
           }
         } else
@@ -2266,24 +2408,89 @@ ecma_gc_run (ecma_context_t *context_p) /**< JJS context */
   context_p->ecma_gc_objects_cp = black_list_head.gc_next_cp;
 
   /* Sweep objects that are currently unmarked. */
-  obj_iter_cp = white_gray_list_head.gc_next_cp;
+  context_p->ecma_gc_sweep_cp = white_gray_list_head.gc_next_cp;
+  ecma_gc_sweep (context_p, sweep_limit);
+} /* ecma_gc_collect */
 
-  while (obj_iter_cp != JMEM_CP_NULL)
+/**
+ * Run garbage collection, freeing objects that are no longer referenced.
+ */
+void
+ecma_gc_run (ecma_context_t *context_p) /**< JJS context */
+{
+  ecma_gc_collect (context_p, 0);
+} /* ecma_gc_run */
+
+/**
+ * Run a step of a garbage collection with an incremental sweep.
+ *
+ * If unreachable objects of the previous step are still waiting to be freed, at most sweep_limit
+ * of them are freed. Otherwise a new collection is started, which marks all reachable objects
+ * at once and frees at most sweep_limit of the unreachable ones.
+ *
+ * @return true - if unreachable objects are still waiting to be freed
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (ecma_context_t *context_p, /**< JJS context */
+              uint32_t sweep_limit) /**< maximum number of objects to free, 0 frees all of them */
+{
+  if (context_p->ecma_gc_sweep_cp != JMEM_CP_NULL)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_object_t, obj_iter_cp);
-    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+    return ecma_gc_sweep (context_p, sweep_limit);
+  }
 
-    JJS_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+  ecma_gc_collect (context_p, sweep_limit);
+  return context_p->ecma_gc_sweep_cp != JMEM_CP_NULL;
+} /* ecma_gc_step */
 
-    ecma_gc_free_object (context_p, obj_iter_p);
-    obj_iter_cp = obj_next_cp;
-  }
+#if JJS_HEAP_SNAPSHOT
 
-#if JJS_BUILTIN_REGEXP
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc (context_p);
-#endif /* JJS_BUILTIN_REGEXP */
-} /* ecma_gc_run */
+/**
+ * Call a visitor for each object referenced by an object.
+ *
+ * The references are reported by the same routines which mark the objects during
+ * garbage collection, so an object may be reported more than once. The visited
+ * flags are not changed, and the function must not be called during a collection.
+ */
+void
+ecma_gc_visit_references (ecma_context_t *context_p, /**< JJS context */
+                          ecma_object_t *object_p, /**< object */
+                          ecma_gc_visitor_cb_t visitor_cb, /**< visitor */
+                          void *user_p) /**< user pointer passed to the visitor */
+{
+  JJS_ASSERT (context_p->ecma_gc_visitor_cb == NULL && visitor_cb != NULL);
+  JJS_ASSERT (context_p->ecma_gc_sweep_cp == JMEM_CP_NULL);
+
+  context_p->ecma_gc_visitor_cb = visitor_cb;
+  context_p->ecma_gc_visitor_user_p = user_p;
+
+  ecma_gc_mark (context_p, object_p);
+
+  context_p->ecma_gc_visitor_cb = NULL;
+  context_p->ecma_gc_visitor_user_p = NULL;
+} /* ecma_gc_visit_references */
+
+#endif /* JJS_HEAP_SNAPSHOT */
+
+/**
+ * Free the resources of the garbage collector.
+ */
+void
+ecma_gc_finalize (ecma_context_t *context_p) /**< JJS context */
+{
+  JJS_ASSERT (context_p->ecma_gc_sweep_cp == JMEM_CP_NULL);
+  JJS_ASSERT (context_p->ecma_gc_mark_stack_size == 0);
+
+  if (context_p->ecma_gc_mark_stack_capacity != 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        context_p->ecma_gc_mark_stack_p,
+                        context_p->ecma_gc_mark_stack_capacity * sizeof (ecma_object_t *));
+    context_p->ecma_gc_mark_stack_p = NULL;
+    context_p->ecma_gc_mark_stack_capacity = 0;
+  }
+} /* ecma_gc_finalize */
 
 /**
  * Try to free some memory (depending on memory pressure).
@@ -2316,9 +2523,14 @@ ecma_free_unused_memory (ecma_context_t *context_p, /**< JJS context */
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
      */
-    if (context_p->ecma_gc_new_objects * context_p->gc_new_objects_fraction > context_p->ecma_gc_objects_number)
+    if (context_p->ecma_gc_sweep_cp != JMEM_CP_NULL)
+    {
+      /* Continue freeing the unreachable objects of the last collection before starting a new one. */
+      ecma_gc_sweep (context_p, context_p->gc_sweep_limit);
+    }
+    else if (context_p->ecma_gc_new_objects * context_p->gc_new_objects_fraction > context_p->ecma_gc_objects_number)
     {
-      ecma_gc_run (context_p);
+      ecma_gc_collect (context_p, context_p->gc_sweep_limit);
     }
 
     return;
@@ -2339,6 +2551,12 @@ ecma_free_unused_memory (ecma_context_t *context_p, /**< JJS context */
 #endif /* JJS_PROPERTY_HASHMAP */
 
     ecma_gc_run (context_p);
+    ecma_free_number_cache (context_p);
+
+#if JJS_BUILTIN_REGEXP
+    /* Free RegExp bytecodes stored in cache */
+    re_cache_gc (context_p);
+#endif /* JJS_BUILTIN_REGEXP */
 
 #if JJS_PROPERTY_HASHMAP
     /* Free hashmaps of remaining objects. */
@@ -2374,7 +2592,6 @@ ecma_free_unused_memory (ecma_context_t *context_p, /**< JJS context */
     }
 #endif /* JJS_PROPERTY_HASHMAP */
 
-    /* TODO: clear empty cellocator pages? */
     return;
   }
   else if (JJS_UNLIKELY (pressure == JMEM_PRESSURE_FULL))
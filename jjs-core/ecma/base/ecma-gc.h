@@ -44,8 +44,18 @@ void ecma_deref_object (ecma_object_t *object_p);
 void ecma_gc_free_property (ecma_context_t *context_p, ecma_object_t *object_p, ecma_property_pair_t *prop_pair_p, uint32_t options);
 void ecma_gc_free_properties (ecma_context_t *context_p, ecma_object_t *object_p, uint32_t options);
 void ecma_gc_run (ecma_context_t *context_p);
+bool ecma_gc_step (ecma_context_t *context_p, uint32_t sweep_limit);
+void ecma_gc_finish_sweep (ecma_context_t *context_p);
+void ecma_gc_finalize (ecma_context_t *context_p);
 void ecma_free_unused_memory (ecma_context_t *context_p, jmem_pressure_t pressure);
 
+#if JJS_HEAP_SNAPSHOT
+void ecma_gc_visit_references (ecma_context_t *context_p,
+                               ecma_object_t *object_p,
+                               ecma_gc_visitor_cb_t visitor_cb,
+                               void *user_p);
+#endif /* JJS_HEAP_SNAPSHOT */
+
 /**
  * @}
  * @}
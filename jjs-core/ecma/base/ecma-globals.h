@@ -280,6 +280,11 @@ enum
 #define ECMA_INTEGER_MULTIPLY_MAX 0x2d41
 #endif /* !JJS_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Maximum number of freed float number boxes kept for reuse by ecma_alloc_number.
+ */
+#define ECMA_NUMBER_CACHE_SIZE 16
+
 /**
  * Checks whether the error flag is set.
  */
@@ -380,7 +385,9 @@ typedef enum
 typedef enum
 {
   ECMA_PROPERTY_FLAG_CONFIGURABLE = (1u << 0), /**< property is configurable */
+  ECMA_FAST_ARRAY_DOUBLE_ELEMENTS = (1u << 0), /**< fast array stores unboxed ecma_number_t elements */
   ECMA_PROPERTY_FLAG_ENUMERABLE = (1u << 1), /**< property is enumerable */
+  ECMA_FAST_ARRAY_GENERIC_ELEMENTS = (1u << 1), /**< fast array must keep ecma_value_t elements */
   ECMA_PROPERTY_FLAG_WRITABLE = (1u << 2), /**< property is writable */
   ECMA_PROPERTY_FLAG_SINGLE_EXTERNAL = (1u << 2), /**< only one external pointer is assigned to this object */
   ECMA_PROPERTY_FLAG_DELETED = (1u << 3), /**< property is deleted */
@@ -788,13 +795,16 @@ typedef enum
  */
 typedef enum
 {
-  /* Types between 0 - 12 are ecma_object_type_t. */
+  /* Types between 0 - 11 are ecma_object_type_t. */
+  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS = 12, /**< declarative lexical environment of a function, which
+                                                    *   caches its bindings in slots (reported as
+                                                    *   ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE) */
   ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE = 13, /**< declarative lexical environment */
   ECMA_LEXICAL_ENVIRONMENT_CLASS = 14, /**< lexical environment with class */
   ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND = 15, /**< object-bound lexical environment */
 
-  ECMA_LEXICAL_ENVIRONMENT_TYPE_START = ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE, /**< first lexical
-                                                                               *   environment type */
+  ECMA_LEXICAL_ENVIRONMENT_TYPE_START = ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS, /**< first lexical
+                                                                                     *   environment type */
   ECMA_LEXICAL_ENVIRONMENT_TYPE__MAX = ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND /**< maximum value */
 } ecma_lexical_environment_type_t;
 
@@ -932,6 +942,15 @@ typedef struct
   } u2;
 } ecma_object_t;
 
+#if JJS_HEAP_SNAPSHOT
+
+/**
+ * Callback which receives the objects referenced by an object (see ecma_gc_visit_references).
+ */
+typedef void (*ecma_gc_visitor_cb_t) (ecma_context_t *context_p, ecma_object_t *object_p, void *user_p);
+
+#endif /* JJS_HEAP_SNAPSHOT */
+
 /**
  * Description of built-in properties of an object.
  */
@@ -1165,6 +1184,31 @@ typedef struct
   (((lex_env_p)->type_flags_refs & ECMA_OBJECT_FLAG_LEXICAL_ENV_HAS_DATA) \
    && ((ecma_lexical_environment_class_t *) (lex_env_p))->type == ECMA_LEX_ENV_CLASS_TYPE_MODULE)
 
+/**
+ * Description of a declarative lexical environment with binding slots
+ *
+ * The slots are filled on first use with the bindings of the environment,
+ * which are never deleted, so the property pointers remain valid.
+ */
+typedef struct
+{
+  ecma_object_t lexical_env; /**< lexical environment header */
+  uint32_t slot_count; /**< number of slots */
+  ecma_property_t *slots[]; /**< cached bindings (NULL if not resolved yet) */
+} ecma_lexical_environment_slots_t;
+
+/**
+ * Check whether the given lexical environment has binding slots
+ */
+#define ECMA_LEX_ENV_HAS_SLOTS(lex_env_p) \
+  (((lex_env_p)->type_flags_refs & ECMA_OBJECT_TYPE_MASK) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+
+/**
+ * Size of a lexical environment with binding slots
+ */
+#define ECMA_LEX_ENV_SLOTS_SIZE(slot_count) \
+  (sizeof (ecma_lexical_environment_slots_t) + (slot_count) * sizeof (ecma_property_t *))
+
 /**
  * Description of native functions
  */
@@ -1277,6 +1321,11 @@ typedef struct
  */
 #define ECMA_CONTAINER_PAIR_SIZE 2
 
+/**
+ * Number of header items (size and hash index) of the internal buffer.
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Size of the internal buffer.
  */
@@ -1287,15 +1336,33 @@ typedef struct
  */
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Hash index field of the internal buffer.
+ */
+#define ECMA_CONTAINER_HASH_INDEX(container_p) (container_p->buffer_p[1])
+
 /**
  * Number of entries of the internal buffer.
  */
-#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - 1)
+#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
-#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + 1)
+#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
+
+/**
+ * Hash index of a container object.
+ *
+ * The header is followed by capacity number of uint32_t slots. A slot stores the
+ * (offset + 1) of an entry of the internal buffer, or zero if the slot is unused.
+ * Slots of deleted entries are kept until the next rehash.
+ */
+typedef struct
+{
+  uint32_t capacity; /**< number of slots, always a power of 2 */
+  uint32_t used_count; /**< number of used slots (including the slots of deleted entries) */
+} ecma_container_hash_index_t;
 
 #endif /* JJS_BUILTIN_CONTAINER */
 
@@ -1408,7 +1475,7 @@ typedef struct ecma_hashset_node_s
 } ecma_hashset_node_t;
 
 /**
- * String Hashset.
+ * Literal Hashset of strings, float numbers or BigInts.
  */
 typedef struct
 {
@@ -1543,8 +1610,9 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE, /**< the ecma-string is the lazily flattened concatenation of two strings */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1643,6 +1711,89 @@ typedef struct
   void *user_p; /**< user pointer passed to the callback when the string is freed */
 } ecma_external_string_t;
 
+/**
+ * Rope (concatenation tree) string-value descriptor
+ *
+ * Note:
+ *   The string_p field of the header is NULL until the rope is flattened. After flattening
+ *   the children are released and the rope behaves as a long string.
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header */
+  ecma_string_t *left_p; /**< left operand of the concatenation (flat string or another rope) */
+  ecma_string_t *right_p; /**< right operand of the concatenation (always a flat string),
+                           *   NULL if the right operand is stored in the tail buffer */
+  lit_utf8_size_t tail_size; /**< size of the characters stored in the tail buffer,
+                              *   0 if the rope has no tail buffer */
+} ecma_rope_string_t;
+
+/**
+ * Concatenations whose result is shorter than this size are copied into flat strings.
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
+/**
+ * Capacity of the tail buffer which stores short right operands after the rope descriptor.
+ *
+ * Note:
+ *   ropes with a tail buffer always have the same allocation size, so repeated
+ *   appends of short chunks reuse the freed blocks instead of fragmenting the heap
+ */
+#define ECMA_ROPE_STRING_TAIL_CAPACITY 256
+
+/**
+ * Get the start position of the tail buffer of a rope string
+ */
+#define ECMA_ROPE_STRING_TAIL_BUFFER(rope_p) ((lit_utf8_byte_t *) (rope_p) + sizeof (ecma_rope_string_t))
+
+/**
+ * Get the allocation size of a rope string
+ */
+#define ECMA_ROPE_STRING_ALLOC_SIZE(rope_p) \
+  (sizeof (ecma_rope_string_t) + ((rope_p)->tail_size > 0 ? ECMA_ROPE_STRING_TAIL_CAPACITY : 0))
+
+/**
+ * Number of entries in the string position cache.
+ */
+#define ECMA_STRING_POSITION_CACHE_SIZE 4
+
+/**
+ * Non-ASCII strings shorter than this size are not stored in the string position cache.
+ */
+#define ECMA_STRING_POSITION_CACHE_MIN_SIZE 64
+
+/**
+ * Entry of the string position cache, which maps the last accessed character index
+ * of a non-ASCII string to its byte offset in the cesu-8 representation of the string.
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< cached string, NULL if the entry is unused */
+  lit_utf8_size_t char_index; /**< index of the last accessed character */
+  lit_utf8_size_t byte_offset; /**< byte offset of the last accessed character */
+} ecma_string_position_cache_entry_t;
+
+#if JJS_BUILTIN_DATE
+
+/**
+ * Number of entries in the local time zone adjustment cache.
+ */
+#define ECMA_DATE_TZA_CACHE_SIZE 4
+
+/**
+ * Entry of the local time zone adjustment cache, which stores a range of time values
+ * with the same local time zone adjustment (the time between two DST transitions).
+ */
+typedef struct
+{
+  double start; /**< first time value of the range */
+  double end; /**< last time value of the range */
+  int32_t tza; /**< local time zone adjustment in the range */
+} ecma_date_tza_cache_entry_t;
+
+#endif /* JJS_BUILTIN_DATE */
+
 /**
  * Header size of an ecma ASCII string
  */
@@ -0,0 +1,1683 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-heap-snapshot.h"
+
+#include "ecma-array-object.h"
+#include "ecma-function-object.h"
+#include "ecma-gc.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-property-hashmap.h"
+
+#include "jcontext.h"
+#include "lit-char-helpers.h"
+#include "re-bytecode.h"
+
+#if JJS_HEAP_SNAPSHOT
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapsnapshot Heap snapshot
+ * @{
+ *
+ * The snapshot is written in the .heapsnapshot format of Chrome DevTools. Its nodes
+ * are the objects, strings, symbols, byte codes and native pointers of the heap, and
+ * its edges are the references between them. The named references (properties,
+ * variables, prototypes and scopes) are found by walking the objects. All other
+ * references are reported by the mark routines of the garbage collector (see
+ * ecma_gc_visit_references), so the snapshot has an edge for every reference which
+ * keeps an object alive.
+ *
+ * The heap is walked twice: the first pass discovers the nodes and counts the edges,
+ * and the second pass writes them. Since the edge counts are needed before the edges,
+ * this avoids storing the edges. The buffers of the snapshot use the context allocator,
+ * so the vm heap is not changed while it is walked.
+ */
+
+/**
+ * Number of fields of a node in the nodes array.
+ */
+#define ECMA_HEAP_SNAPSHOT_NODE_FIELD_COUNT 7
+
+/**
+ * Maximum number of characters written from a string.
+ */
+#define ECMA_HEAP_SNAPSHOT_MAX_STRING_LENGTH 1024
+
+/**
+ * Size of the output buffer.
+ */
+#define ECMA_HEAP_SNAPSHOT_BUFFER_SIZE 512
+
+/**
+ * Index of a missing node or string.
+ */
+#define ECMA_HEAP_SNAPSHOT_NONE UINT32_MAX
+
+/**
+ * Node types (same order as ecma_heap_snapshot_node_types).
+ */
+typedef enum
+{
+  ECMA_HEAP_SNAPSHOT_NODE_HIDDEN, /**< internal object */
+  ECMA_HEAP_SNAPSHOT_NODE_ARRAY, /**< internal array */
+  ECMA_HEAP_SNAPSHOT_NODE_STRING, /**< flat string */
+  ECMA_HEAP_SNAPSHOT_NODE_OBJECT, /**< object or scope */
+  ECMA_HEAP_SNAPSHOT_NODE_CODE, /**< byte code */
+  ECMA_HEAP_SNAPSHOT_NODE_CLOSURE, /**< function */
+  ECMA_HEAP_SNAPSHOT_NODE_REGEXP, /**< RegExp object */
+  ECMA_HEAP_SNAPSHOT_NODE_NUMBER, /**< heap number */
+  ECMA_HEAP_SNAPSHOT_NODE_NATIVE, /**< native pointer */
+  ECMA_HEAP_SNAPSHOT_NODE_SYNTHETIC, /**< root node */
+  ECMA_HEAP_SNAPSHOT_NODE_CONCATENATED_STRING, /**< rope string */
+  ECMA_HEAP_SNAPSHOT_NODE_SLICED_STRING, /**< sliced string */
+  ECMA_HEAP_SNAPSHOT_NODE_SYMBOL, /**< symbol */
+  ECMA_HEAP_SNAPSHOT_NODE_BIGINT, /**< BigInt */
+} ecma_heap_snapshot_node_type_t;
+
+/**
+ * Names of the node types.
+ */
+static const char *const ecma_heap_snapshot_node_types[] = {
+  "hidden", "array",  "string",    "object",              "code",          "closure", "regexp",
+  "number", "native", "synthetic", "concatenated string", "sliced string", "symbol",  "bigint",
+};
+
+/**
+ * Edge types (same order as ecma_heap_snapshot_edge_types).
+ */
+typedef enum
+{
+  ECMA_HEAP_SNAPSHOT_EDGE_CONTEXT, /**< variable of a scope */
+  ECMA_HEAP_SNAPSHOT_EDGE_ELEMENT, /**< array element */
+  ECMA_HEAP_SNAPSHOT_EDGE_PROPERTY, /**< named property */
+  ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL, /**< internal reference */
+} ecma_heap_snapshot_edge_type_t;
+
+/**
+ * Names of the edge types.
+ */
+static const char *const ecma_heap_snapshot_edge_types[] = {
+  "context", "element", "property", "internal", "hidden", "shortcut", "weak",
+};
+
+/**
+ * Names which are not ecma strings (same order as ecma_heap_snapshot_names).
+ *
+ * They are the first entries of the strings table.
+ */
+typedef enum
+{
+  ECMA_HEAP_SNAPSHOT_NAME_EMPTY, /**< empty string */
+  ECMA_HEAP_SNAPSHOT_NAME_SYSTEM_CONTEXT, /**< name of scopes */
+  ECMA_HEAP_SNAPSHOT_NAME_PROTO, /**< prototype edge */
+  ECMA_HEAP_SNAPSHOT_NAME_CONTEXT, /**< scope edge of functions */
+  ECMA_HEAP_SNAPSHOT_NAME_PREVIOUS, /**< outer scope edge of scopes */
+  ECMA_HEAP_SNAPSHOT_NAME_CODE, /**< byte code edge */
+  ECMA_HEAP_SNAPSHOT_NAME_NATIVE, /**< native pointer edge */
+  ECMA_HEAP_SNAPSHOT_NAME_INTERNAL, /**< edges reported by the garbage collector */
+  ECMA_HEAP_SNAPSHOT_NAME_FIRST, /**< left operand edge of ropes */
+  ECMA_HEAP_SNAPSHOT_NAME_SECOND, /**< right operand edge of ropes */
+  ECMA_HEAP_SNAPSHOT_NAME_SYMBOL_KEY, /**< name of symbol keyed properties */
+  ECMA_HEAP_SNAPSHOT_NAME_SYMBOL, /**< name of symbols without description */
+  ECMA_HEAP_SNAPSHOT_NAME_CONCATENATED_STRING, /**< name of ropes */
+  ECMA_HEAP_SNAPSHOT_NAME_NATIVE_POINTER, /**< name of native pointers */
+  ECMA_HEAP_SNAPSHOT_NAME__COUNT /**< number of names */
+} ecma_heap_snapshot_name_t;
+
+/**
+ * Names which are not ecma strings.
+ */
+static const char *const ecma_heap_snapshot_names[] = {
+  "",         "system / Context", "__proto__",  "context",  "previous",
+  "code",     "native",           "(internal)", "first",    "second",
+  "<symbol>", "(symbol)",         "(concatenated string)", "(native pointer)",
+};
+
+JJS_STATIC_ASSERT (sizeof (ecma_heap_snapshot_names) / sizeof (ecma_heap_snapshot_names[0])
+                     == ECMA_HEAP_SNAPSHOT_NAME__COUNT,
+                   ecma_heap_snapshot_names_must_match_ecma_heap_snapshot_name_t);
+
+/**
+ * Kinds of heap items.
+ */
+typedef enum
+{
+  ECMA_HEAP_SNAPSHOT_ROOT, /**< root node */
+  ECMA_HEAP_SNAPSHOT_OBJECT, /**< object or lexical environment */
+  ECMA_HEAP_SNAPSHOT_STRING, /**< string or symbol */
+  ECMA_HEAP_SNAPSHOT_BYTECODE, /**< compiled code */
+  ECMA_HEAP_SNAPSHOT_NATIVE_POINTER, /**< native pointer */
+} ecma_heap_snapshot_kind_t;
+
+/**
+ * Node of the snapshot.
+ */
+typedef struct
+{
+  void *pointer_p; /**< heap item of the node (NULL for the root node) */
+  uint32_t name; /**< index of the name in the strings table */
+  uint32_t self_size; /**< size of the heap item */
+  uint32_t edge_count; /**< number of edges */
+  uint32_t edge_stamp; /**< index + 1 of the last node which has an edge to this node */
+  uint8_t kind; /**< ecma_heap_snapshot_kind_t */
+  uint8_t type; /**< ecma_heap_snapshot_node_type_t */
+} ecma_heap_snapshot_node_t;
+
+/**
+ * Entry of a hash map.
+ */
+typedef struct
+{
+  uintptr_t key; /**< key of the entry (0 for unused entries) */
+  uint32_t index; /**< node or string index */
+} ecma_heap_snapshot_map_entry_t;
+
+/**
+ * Open addressing hash map.
+ */
+typedef struct
+{
+  ecma_heap_snapshot_map_entry_t *entries_p; /**< entries */
+  uint32_t capacity; /**< number of entries (power of 2) */
+  uint32_t count; /**< number of used entries */
+} ecma_heap_snapshot_map_t;
+
+/**
+ * State of a heap snapshot.
+ */
+typedef struct
+{
+  ecma_context_t *context_p; /**< JJS context */
+  const jjs_wstream_t *wstream_p; /**< target stream */
+  ecma_heap_snapshot_node_t *nodes_p; /**< nodes */
+  uint32_t node_count; /**< number of nodes */
+  uint32_t node_capacity; /**< size of nodes_p */
+  uint32_t object_count; /**< number of objects, which are the nodes after the root node */
+  ecma_heap_snapshot_map_t node_map; /**< maps heap items to node indices */
+  ecma_value_t *strings_p; /**< strings after the fixed names in the strings table */
+  uint32_t string_count; /**< number of strings */
+  uint32_t string_capacity; /**< size of strings_p */
+  ecma_heap_snapshot_map_t string_map; /**< maps string values to string indices */
+  uint32_t current; /**< index of the node whose edges are enumerated */
+  uint32_t edge_count; /**< number of edges */
+  uint32_t edges_written; /**< number of written edges */
+  bool write_edges; /**< edges are written, not counted */
+  bool out_of_memory; /**< a buffer could not be allocated */
+  uint32_t buffer_size; /**< number of bytes in buffer */
+  uint8_t buffer[ECMA_HEAP_SNAPSHOT_BUFFER_SIZE]; /**< output buffer */
+} ecma_heap_snapshot_t;
+
+/**
+ * Grow a snapshot buffer to twice of its size.
+ *
+ * @return true - if the buffer is grown,
+ *         false - otherwise (the buffer is unchanged)
+ */
+static bool
+ecma_heap_snapshot_grow (ecma_context_t *context_p, /**< JJS context */
+                         void **buffer_p, /**< [in/out] buffer */
+                         uint32_t *capacity_p, /**< [in/out] number of items in the buffer */
+                         size_t item_size) /**< size of an item */
+{
+  uint32_t old_capacity = *capacity_p;
+  uint32_t new_capacity = (old_capacity == 0) ? 256 : old_capacity * 2;
+
+  if (new_capacity <= old_capacity || (size_t) new_capacity * item_size > UINT32_MAX)
+  {
+    return false;
+  }
+
+  void *new_buffer_p = jjs_allocator_alloc (&context_p->context_allocator, (jjs_size_t) (new_capacity * item_size));
+
+  if (new_buffer_p == NULL)
+  {
+    return false;
+  }
+
+  if (old_capacity > 0)
+  {
+    memcpy (new_buffer_p, *buffer_p, old_capacity * item_size);
+    jjs_allocator_free (&context_p->context_allocator, *buffer_p, (jjs_size_t) (old_capacity * item_size));
+  }
+
+  *buffer_p = new_buffer_p;
+  *capacity_p = new_capacity;
+  return true;
+} /* ecma_heap_snapshot_grow */
+
+/**
+ * Compute the first entry of a key in a hash map.
+ *
+ * @return entry index
+ */
+static inline uint32_t JJS_ATTR_ALWAYS_INLINE
+ecma_heap_snapshot_map_slot (const ecma_heap_snapshot_map_t *map_p, /**< hash map */
+                             uintptr_t key) /**< key */
+{
+  /* The low bits of pointers and values are alignment or tag bits. */
+  uint32_t hash = (uint32_t) (key >> JMEM_ALIGNMENT_LOG) * 2654435761u;
+  return (hash ^ (hash >> 16)) & (map_p->capacity - 1);
+} /* ecma_heap_snapshot_map_slot */
+
+/**
+ * Find a key in a hash map.
+ *
+ * @return index stored for the key - if the key is found,
+ *         ECMA_HEAP_SNAPSHOT_NONE - otherwise
+ */
+static uint32_t
+ecma_heap_snapshot_map_find (const ecma_heap_snapshot_map_t *map_p, /**< hash map */
+                             uintptr_t key) /**< key */
+{
+  JJS_ASSERT (key != 0);
+
+  if (map_p->capacity == 0)
+  {
+    return ECMA_HEAP_SNAPSHOT_NONE;
+  }
+
+  uint32_t mask = map_p->capacity - 1;
+  uint32_t slot = ecma_heap_snapshot_map_slot (map_p, key);
+
+  while (map_p->entries_p[slot].key != 0)
+  {
+    if (map_p->entries_p[slot].key == key)
+    {
+      return map_p->entries_p[slot].index;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  return ECMA_HEAP_SNAPSHOT_NONE;
+} /* ecma_heap_snapshot_map_find */
+
+/**
+ * Insert a key, which is not in the hash map, into a hash map.
+ *
+ * @return true - if the key is inserted,
+ *         false - if there is not enough memory
+ */
+static bool
+ecma_heap_snapshot_map_insert (ecma_context_t *context_p, /**< JJS context */
+                               ecma_heap_snapshot_map_t *map_p, /**< hash map */
+                               uintptr_t key, /**< key */
+                               uint32_t index) /**< index stored for the key */
+{
+  JJS_ASSERT (key != 0 && ecma_heap_snapshot_map_find (map_p, key) == ECMA_HEAP_SNAPSHOT_NONE);
+
+  if ((map_p->count + 1) * 2 > map_p->capacity)
+  {
+    /* The map is at most half full. */
+    ecma_heap_snapshot_map_t new_map;
+    new_map.capacity = (map_p->capacity == 0) ? 1024 : map_p->capacity * 2;
+    new_map.count = map_p->count;
+
+    if (new_map.capacity <= map_p->capacity
+        || (size_t) new_map.capacity * sizeof (ecma_heap_snapshot_map_entry_t) > UINT32_MAX)
+    {
+      return false;
+    }
+
+    jjs_size_t size = (jjs_size_t) (new_map.capacity * sizeof (ecma_heap_snapshot_map_entry_t));
+    new_map.entries_p = jjs_allocator_alloc (&context_p->context_allocator, size);
+
+    if (new_map.entries_p == NULL)
+    {
+      return false;
+    }
+
+    memset (new_map.entries_p, 0, size);
+
+    for (uint32_t i = 0; i < map_p->capacity; i++)
+    {
+      if (map_p->entries_p[i].key != 0)
+      {
+        uint32_t slot = ecma_heap_snapshot_map_slot (&new_map, map_p->entries_p[i].key);
+
+        while (new_map.entries_p[slot].key != 0)
+        {
+          slot = (slot + 1) & (new_map.capacity - 1);
+        }
+
+        new_map.entries_p[slot] = map_p->entries_p[i];
+      }
+    }
+
+    if (map_p->capacity > 0)
+    {
+      jjs_allocator_free (&context_p->context_allocator,
+                          map_p->entries_p,
+                          (jjs_size_t) (map_p->capacity * sizeof (ecma_heap_snapshot_map_entry_t)));
+    }
+
+    *map_p = new_map;
+  }
+
+  uint32_t slot = ecma_heap_snapshot_map_slot (map_p, key);
+
+  while (map_p->entries_p[slot].key != 0)
+  {
+    slot = (slot + 1) & (map_p->capacity - 1);
+  }
+
+  map_p->entries_p[slot].key = key;
+  map_p->entries_p[slot].index = index;
+  map_p->count++;
+  return true;
+} /* ecma_heap_snapshot_map_insert */
+
+/**
+ * Free a hash map.
+ */
+static void
+ecma_heap_snapshot_map_free (ecma_context_t *context_p, /**< JJS context */
+                             ecma_heap_snapshot_map_t *map_p) /**< hash map */
+{
+  if (map_p->capacity > 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        map_p->entries_p,
+                        (jjs_size_t) (map_p->capacity * sizeof (ecma_heap_snapshot_map_entry_t)));
+  }
+} /* ecma_heap_snapshot_map_free */
+
+/**
+ * Get the index of a string in the strings table. The string is added to the
+ * table if it is not found.
+ *
+ * @return string index
+ */
+static uint32_t
+ecma_heap_snapshot_intern (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                           ecma_value_t value) /**< string value */
+{
+  JJS_ASSERT (ecma_is_value_string (value));
+
+  uint32_t index = ecma_heap_snapshot_map_find (&snapshot_p->string_map, value);
+
+  if (index != ECMA_HEAP_SNAPSHOT_NONE)
+  {
+    return index;
+  }
+
+  /* All strings are added before the snapshot is written. */
+  JJS_ASSERT (!snapshot_p->write_edges);
+
+  if (snapshot_p->string_count == snapshot_p->string_capacity
+      && !ecma_heap_snapshot_grow (snapshot_p->context_p,
+                                   (void **) &snapshot_p->strings_p,
+                                   &snapshot_p->string_capacity,
+                                   sizeof (ecma_value_t)))
+  {
+    snapshot_p->out_of_memory = true;
+    return ECMA_HEAP_SNAPSHOT_NAME_EMPTY;
+  }
+
+  index = ECMA_HEAP_SNAPSHOT_NAME__COUNT + snapshot_p->string_count;
+
+  if (!ecma_heap_snapshot_map_insert (snapshot_p->context_p, &snapshot_p->string_map, value, index))
+  {
+    snapshot_p->out_of_memory = true;
+    return ECMA_HEAP_SNAPSHOT_NAME_EMPTY;
+  }
+
+  snapshot_p->strings_p[snapshot_p->string_count++] = value;
+  return index;
+} /* ecma_heap_snapshot_intern */
+
+/**
+ * Create a new node.
+ *
+ * @return index of the node - if the node is created,
+ *         ECMA_HEAP_SNAPSHOT_NONE - if there is not enough memory
+ */
+static uint32_t
+ecma_heap_snapshot_add_node (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                             void *pointer_p, /**< heap item (NULL for the root node) */
+                             ecma_heap_snapshot_kind_t kind) /**< kind of the heap item */
+{
+  if (snapshot_p->node_count == snapshot_p->node_capacity
+      && !ecma_heap_snapshot_grow (snapshot_p->context_p,
+                                   (void **) &snapshot_p->nodes_p,
+                                   &snapshot_p->node_capacity,
+                                   sizeof (ecma_heap_snapshot_node_t)))
+  {
+    snapshot_p->out_of_memory = true;
+    return ECMA_HEAP_SNAPSHOT_NONE;
+  }
+
+  uint32_t index = snapshot_p->node_count;
+
+  if (pointer_p != NULL
+      && !ecma_heap_snapshot_map_insert (snapshot_p->context_p, &snapshot_p->node_map, (uintptr_t) pointer_p, index))
+  {
+    snapshot_p->out_of_memory = true;
+    return ECMA_HEAP_SNAPSHOT_NONE;
+  }
+
+  ecma_heap_snapshot_node_t *node_p = snapshot_p->nodes_p + index;
+
+  node_p->pointer_p = pointer_p;
+  node_p->name = ECMA_HEAP_SNAPSHOT_NAME_EMPTY;
+  node_p->self_size = 0;
+  node_p->edge_count = 0;
+  node_p->edge_stamp = 0;
+  node_p->kind = (uint8_t) kind;
+  node_p->type = ECMA_HEAP_SNAPSHOT_NODE_HIDDEN;
+
+  snapshot_p->node_count++;
+  return index;
+} /* ecma_heap_snapshot_add_node */
+
+/**
+ * Write bytes to the output buffer.
+ */
+static void
+ecma_heap_snapshot_write_bytes (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                const uint8_t *data_p, /**< bytes */
+                                uint32_t size) /**< number of bytes */
+{
+  if (snapshot_p->buffer_size + size > ECMA_HEAP_SNAPSHOT_BUFFER_SIZE)
+  {
+    const jjs_wstream_t *wstream_p = snapshot_p->wstream_p;
+
+    if (snapshot_p->buffer_size > 0)
+    {
+      wstream_p->write (snapshot_p->context_p, wstream_p, snapshot_p->buffer, snapshot_p->buffer_size);
+      snapshot_p->buffer_size = 0;
+    }
+
+    if (size > ECMA_HEAP_SNAPSHOT_BUFFER_SIZE)
+    {
+      wstream_p->write (snapshot_p->context_p, wstream_p, data_p, size);
+      return;
+    }
+  }
+
+  memcpy (snapshot_p->buffer + snapshot_p->buffer_size, data_p, size);
+  snapshot_p->buffer_size += size;
+} /* ecma_heap_snapshot_write_bytes */
+
+/**
+ * Write a zero terminated string to the output buffer.
+ */
+static void
+ecma_heap_snapshot_write_sz (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                             const char *str_p) /**< string */
+{
+  ecma_heap_snapshot_write_bytes (snapshot_p, (const uint8_t *) str_p, (uint32_t) strlen (str_p));
+} /* ecma_heap_snapshot_write_sz */
+
+/**
+ * Write an unsigned integer to the output buffer.
+ */
+static void
+ecma_heap_snapshot_write_uint (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                               uint32_t value) /**< value */
+{
+  uint8_t digits[10];
+  uint8_t *digits_p = digits + sizeof (digits);
+
+  do
+  {
+    *(--digits_p) = (uint8_t) (LIT_CHAR_0 + (value % 10));
+    value /= 10;
+  } while (value > 0);
+
+  ecma_heap_snapshot_write_bytes (snapshot_p, digits_p, (uint32_t) (digits + sizeof (digits) - digits_p));
+} /* ecma_heap_snapshot_write_uint */
+
+/**
+ * Write a string value to the output buffer as a JSON string literal.
+ *
+ * Non-ASCII characters are escaped, and the string is truncated
+ * to ECMA_HEAP_SNAPSHOT_MAX_STRING_LENGTH characters.
+ */
+static void
+ecma_heap_snapshot_write_string (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                 ecma_value_t value) /**< string value */
+{
+  static const char hex_digits[] = "0123456789abcdef";
+  ecma_context_t *context_p = snapshot_p->context_p;
+  ecma_string_t *string_p = ecma_get_string_from_value (context_p, value);
+
+  if (!ECMA_IS_DIRECT_STRING (string_p) && ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE
+      && ((ecma_rope_string_t *) string_p)->header.string_p == NULL)
+  {
+    /* Flattening the rope would allocate memory. */
+    ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+    ecma_heap_snapshot_write_sz (snapshot_p, ecma_heap_snapshot_names[ECMA_HEAP_SNAPSHOT_NAME_CONCATENATED_STRING]);
+    ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+    return;
+  }
+
+  ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+
+  ECMA_STRING_TO_UTF8_STRING (context_p, string_p, string_buff, string_buff_size);
+
+  const lit_utf8_byte_t *current_p = string_buff;
+  const lit_utf8_byte_t *end_p = string_buff + string_buff_size;
+  const lit_utf8_byte_t *regular_start_p = current_p;
+  uint32_t length = 0;
+
+  while (current_p < end_p)
+  {
+    if (length++ == ECMA_HEAP_SNAPSHOT_MAX_STRING_LENGTH)
+    {
+      end_p = current_p;
+      break;
+    }
+
+    const lit_utf8_byte_t *char_start_p = current_p;
+    ecma_char_t chr = lit_cesu8_read_next (&current_p);
+
+    if (chr >= LIT_CHAR_SP && chr < 0x7f && chr != LIT_CHAR_DOUBLE_QUOTE && chr != LIT_CHAR_BACKSLASH)
+    {
+      continue;
+    }
+
+    ecma_heap_snapshot_write_bytes (snapshot_p, regular_start_p, (uint32_t) (char_start_p - regular_start_p));
+    regular_start_p = current_p;
+
+    uint8_t escape[6] = { LIT_CHAR_BACKSLASH, LIT_CHAR_LOWERCASE_U };
+
+    for (int i = 5; i >= 2; i--)
+    {
+      escape[i] = (uint8_t) hex_digits[chr & 0xf];
+      chr = (ecma_char_t) (chr >> 4);
+    }
+
+    ecma_heap_snapshot_write_bytes (snapshot_p, escape, sizeof (escape));
+  }
+
+  ecma_heap_snapshot_write_bytes (snapshot_p, regular_start_p, (uint32_t) (end_p - regular_start_p));
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, string_buff, string_buff_size);
+
+  ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+} /* ecma_heap_snapshot_write_string */
+
+/**
+ * Add an edge from the current node to a node.
+ *
+ * The edge is counted during the discovery pass and written during the write pass.
+ */
+static void
+ecma_heap_snapshot_add_edge (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                             ecma_heap_snapshot_edge_type_t type, /**< edge type */
+                             uint32_t name_or_index, /**< string index of the name, or element index */
+                             uint32_t target) /**< index of the target node */
+{
+  snapshot_p->nodes_p[target].edge_stamp = snapshot_p->current + 1;
+
+  if (!snapshot_p->write_edges)
+  {
+    snapshot_p->nodes_p[snapshot_p->current].edge_count++;
+    snapshot_p->edge_count++;
+    return;
+  }
+
+  ecma_heap_snapshot_write_sz (snapshot_p, (snapshot_p->edges_written++ == 0) ? "\n" : ",\n");
+  ecma_heap_snapshot_write_uint (snapshot_p, (uint32_t) type);
+  ecma_heap_snapshot_write_sz (snapshot_p, ",");
+  ecma_heap_snapshot_write_uint (snapshot_p, name_or_index);
+  ecma_heap_snapshot_write_sz (snapshot_p, ",");
+  ecma_heap_snapshot_write_uint (snapshot_p, target * ECMA_HEAP_SNAPSHOT_NODE_FIELD_COUNT);
+} /* ecma_heap_snapshot_add_edge */
+
+/**
+ * Get the node of a heap item. Except for objects, which all have a node, the
+ * node is created during the discovery pass if it does not exist.
+ *
+ * @return index of the node - if found or created,
+ *         ECMA_HEAP_SNAPSHOT_NONE - otherwise
+ */
+static uint32_t
+ecma_heap_snapshot_get_node (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                             void *pointer_p, /**< heap item */
+                             ecma_heap_snapshot_kind_t kind) /**< kind of the heap item */
+{
+  uint32_t index = ecma_heap_snapshot_map_find (&snapshot_p->node_map, (uintptr_t) pointer_p);
+
+  if (index == ECMA_HEAP_SNAPSHOT_NONE && kind != ECMA_HEAP_SNAPSHOT_OBJECT && !snapshot_p->write_edges)
+  {
+    index = ecma_heap_snapshot_add_node (snapshot_p, pointer_p, kind);
+  }
+
+  JJS_ASSERT (index == ECMA_HEAP_SNAPSHOT_NONE || snapshot_p->nodes_p[index].kind == kind);
+  return index;
+} /* ecma_heap_snapshot_get_node */
+
+/**
+ * Add an edge from the current node to a heap item.
+ */
+static void
+ecma_heap_snapshot_pointer_edge (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                 ecma_heap_snapshot_edge_type_t type, /**< edge type */
+                                 uint32_t name_or_index, /**< string index of the name, or element index */
+                                 void *pointer_p, /**< heap item */
+                                 ecma_heap_snapshot_kind_t kind) /**< kind of the heap item */
+{
+  uint32_t target = ecma_heap_snapshot_get_node (snapshot_p, pointer_p, kind);
+
+  if (target != ECMA_HEAP_SNAPSHOT_NONE)
+  {
+    ecma_heap_snapshot_add_edge (snapshot_p, type, name_or_index, target);
+  }
+} /* ecma_heap_snapshot_pointer_edge */
+
+/**
+ * Add an edge from the current node to the heap item of a value.
+ * Values without heap items (numbers, direct strings, etc.) are ignored.
+ */
+static void
+ecma_heap_snapshot_value_edge (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                               ecma_heap_snapshot_edge_type_t type, /**< edge type */
+                               uint32_t name_or_index, /**< string index of the name, or element index */
+                               ecma_value_t value) /**< value */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_object_t *object_p = ecma_get_object_from_value (context_p, value);
+    ecma_heap_snapshot_pointer_edge (snapshot_p, type, name_or_index, object_p, ECMA_HEAP_SNAPSHOT_OBJECT);
+  }
+  else if (ecma_is_value_string (value) || ecma_is_value_symbol (value))
+  {
+    ecma_string_t *string_p = ecma_get_prop_name_from_value (context_p, value);
+
+    if (!ECMA_IS_DIRECT_STRING (string_p))
+    {
+      ecma_heap_snapshot_pointer_edge (snapshot_p, type, name_or_index, string_p, ECMA_HEAP_SNAPSHOT_STRING);
+    }
+  }
+} /* ecma_heap_snapshot_value_edge */
+
+/**
+ * Add an edge from the current node to a byte code or native pointer, and
+ * set the name and size of its node when it is created.
+ */
+static void
+ecma_heap_snapshot_data_edge (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                              uint32_t edge_name, /**< string index of the edge name */
+                              void *pointer_p, /**< heap item */
+                              ecma_heap_snapshot_kind_t kind, /**< kind of the heap item */
+                              uint32_t node_name, /**< string index of the node name */
+                              size_t self_size) /**< size of the heap item */
+{
+  uint32_t node_count = snapshot_p->node_count;
+  uint32_t target = ecma_heap_snapshot_get_node (snapshot_p, pointer_p, kind);
+
+  if (target == ECMA_HEAP_SNAPSHOT_NONE)
+  {
+    return;
+  }
+
+  if (target >= node_count)
+  {
+    snapshot_p->nodes_p[target].name = node_name;
+    snapshot_p->nodes_p[target].self_size = (uint32_t) self_size;
+  }
+
+  ecma_heap_snapshot_add_edge (snapshot_p, ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL, edge_name, target);
+} /* ecma_heap_snapshot_data_edge */
+
+/**
+ * Find the value of an own data property whose name is a magic string without
+ * changing the object (e.g. lazy instantiation or property hashmap creation).
+ *
+ * @return property value - if found,
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+ecma_heap_snapshot_find_own_value (ecma_context_t *context_p, /**< JJS context */
+                                   ecma_object_t *object_p, /**< object */
+                                   lit_magic_string_id_t name_id) /**< property name */
+{
+  if (ecma_op_object_is_fast_array (object_p))
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+
+    if (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p))
+    {
+      ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+      {
+        uint8_t property = property_pair_p->header.types[index];
+
+        if (ECMA_PROPERTY_IS_RAW (property) && (property & ECMA_PROPERTY_FLAG_DATA)
+            && ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+            && property_pair_p->names_cp[index] == name_id)
+        {
+          return property_pair_p->values[index].value;
+        }
+      }
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* ecma_heap_snapshot_find_own_value */
+
+/**
+ * Get the name of a function object.
+ *
+ * @return string index of the name - if the function has a name,
+ *         ECMA_HEAP_SNAPSHOT_NONE - otherwise
+ */
+static uint32_t
+ecma_heap_snapshot_function_name (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                  ecma_object_t *function_p) /**< function object */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+
+  if (ecma_get_object_type (function_p) == ECMA_OBJECT_TYPE_FUNCTION)
+  {
+    const ecma_compiled_code_t *bytecode_p =
+      ecma_op_function_get_compiled_code (context_p, (ecma_extended_object_t *) function_p);
+
+    /* Class constructors have no name in their byte code. */
+    if (CBC_FUNCTION_GET_TYPE (bytecode_p->status_flags) != CBC_FUNCTION_CONSTRUCTOR)
+    {
+      ecma_value_t name = *ecma_compiled_code_resolve_function_name (bytecode_p);
+
+      if (ecma_is_value_string (name))
+      {
+        return ecma_heap_snapshot_intern (snapshot_p, name);
+      }
+    }
+  }
+
+  ecma_value_t name = ecma_heap_snapshot_find_own_value (context_p, function_p, LIT_MAGIC_STRING_NAME);
+
+  if (ecma_is_value_string (name))
+  {
+    return ecma_heap_snapshot_intern (snapshot_p, name);
+  }
+
+  return ECMA_HEAP_SNAPSHOT_NONE;
+} /* ecma_heap_snapshot_function_name */
+
+/**
+ * Checks whether an object is a function.
+ *
+ * @return true - if the object is a function,
+ *         false - otherwise
+ */
+static bool
+ecma_heap_snapshot_is_function (ecma_object_t *object_p) /**< object */
+{
+  switch (ecma_get_object_type (object_p))
+  {
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    case ECMA_OBJECT_TYPE_CONSTRUCTOR_FUNCTION:
+    case ECMA_OBJECT_TYPE_NATIVE_FUNCTION:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* ecma_heap_snapshot_is_function */
+
+/**
+ * Compute the approximate size of an object, including its property list and
+ * fast array storage.
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_heap_snapshot_object_size (ecma_context_t *context_p, /**< JJS context */
+                                ecma_object_t *object_p) /**< object */
+{
+  size_t size = sizeof (ecma_extended_object_t);
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    {
+      /* The property list field of other environments is the binding object. */
+      bool has_data = (object_p->type_flags_refs & ECMA_OBJECT_FLAG_LEXICAL_ENV_HAS_DATA) != 0;
+      return has_data ? sizeof (ecma_lexical_environment_class_t) : sizeof (ecma_object_t);
+    }
+
+    size = sizeof (ecma_object_t);
+
+    if (ECMA_LEX_ENV_HAS_SLOTS (object_p))
+    {
+      size = ECMA_LEX_ENV_SLOTS_SIZE (((ecma_lexical_environment_slots_t *) object_p)->slot_count);
+    }
+  }
+  else
+  {
+    switch (ecma_get_object_type (object_p))
+    {
+      case ECMA_OBJECT_TYPE_GENERAL:
+      {
+        size = sizeof (ecma_object_t);
+        break;
+      }
+      case ECMA_OBJECT_TYPE_ARRAY:
+      case ECMA_OBJECT_TYPE_BUILT_IN_ARRAY:
+      {
+        if (!ecma_op_object_is_fast_array (object_p))
+        {
+          break;
+        }
+
+        if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+        {
+          ecma_extended_object_t *array_p = (ecma_extended_object_t *) object_p;
+          uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (array_p->u.array.length);
+          size_t item_size = (ecma_fast_array_has_double_elements (object_p) ? sizeof (ecma_number_t)
+                                                                             : sizeof (ecma_value_t));
+          size += aligned_length * item_size;
+        }
+
+        /* Fast arrays have no property list. */
+        return size;
+      }
+#if JJS_BUILTIN_PROXY
+      case ECMA_OBJECT_TYPE_PROXY:
+      {
+        size = sizeof (ecma_proxy_object_t);
+        break;
+      }
+#endif /* JJS_BUILTIN_PROXY */
+      case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+      {
+        size = sizeof (ecma_bound_function_t);
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+
+#if JJS_PROPERTY_HASHMAP
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      uint32_t max_property_count = ((ecma_property_hashmap_t *) prop_iter_p)->max_property_count;
+      size += (sizeof (ecma_property_hashmap_t) + (max_property_count * sizeof (jmem_cpointer_t))
+               + (max_property_count >> 3));
+    }
+    else
+#endif /* JJS_PROPERTY_HASHMAP */
+    {
+      size += sizeof (ecma_property_pair_t);
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  return size;
+} /* ecma_heap_snapshot_object_size */
+
+/**
+ * Set the type, name and size of an object node.
+ */
+static void
+ecma_heap_snapshot_describe_object (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                    ecma_heap_snapshot_node_t *node_p) /**< node */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+  ecma_object_t *object_p = (ecma_object_t *) node_p->pointer_p;
+
+  node_p->self_size = (uint32_t) ecma_heap_snapshot_object_size (context_p, object_p);
+  node_p->type = ECMA_HEAP_SNAPSHOT_NODE_OBJECT;
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    node_p->name = ECMA_HEAP_SNAPSHOT_NAME_SYSTEM_CONTEXT;
+    return;
+  }
+
+  uint32_t name = ECMA_HEAP_SNAPSHOT_NONE;
+
+  if (ecma_heap_snapshot_is_function (object_p))
+  {
+    node_p->type = ECMA_HEAP_SNAPSHOT_NODE_CLOSURE;
+    name = ecma_heap_snapshot_function_name (snapshot_p, object_p);
+  }
+#if JJS_BUILTIN_REGEXP
+  else if (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_REGEXP))
+  {
+    ecma_value_t bytecode_cp = ((ecma_extended_object_t *) object_p)->u.cls.u3.value;
+    re_compiled_code_t *bytecode_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (context_p, re_compiled_code_t, bytecode_cp);
+    node_p->type = ECMA_HEAP_SNAPSHOT_NODE_REGEXP;
+
+    if (bytecode_p != NULL && ecma_is_value_string (bytecode_p->source))
+    {
+      name = ecma_heap_snapshot_intern (snapshot_p, bytecode_p->source);
+    }
+  }
+#endif /* JJS_BUILTIN_REGEXP */
+  else if (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_INTERNAL_OBJECT))
+  {
+    node_p->type = ECMA_HEAP_SNAPSHOT_NODE_HIDDEN;
+  }
+  else if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_PROXY && object_p->u2.prototype_cp != JMEM_CP_NULL)
+  {
+    /* Objects are named after the constructor of their prototype, e.g. instances of class Foo are "Foo". */
+    ecma_object_t *proto_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, object_p->u2.prototype_cp);
+    ecma_value_t constructor = ecma_heap_snapshot_find_own_value (context_p, proto_p, LIT_MAGIC_STRING_CONSTRUCTOR);
+
+    if (ecma_is_value_object (constructor)
+        && ecma_heap_snapshot_is_function (ecma_get_object_from_value (context_p, constructor)))
+    {
+      name = ecma_heap_snapshot_function_name (snapshot_p, ecma_get_object_from_value (context_p, constructor));
+    }
+  }
+
+  if (name == ECMA_HEAP_SNAPSHOT_NONE)
+  {
+    lit_magic_string_id_t class_name = LIT_MAGIC_STRING_OBJECT_UL;
+
+    /* The class name of some built-in objects cannot be queried. */
+    if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_BUILT_IN_GENERAL)
+    {
+      class_name = ecma_object_get_class_name (context_p, object_p);
+    }
+
+    name =ecma_heap_snapshot_intern (snapshot_p, ecma_make_magic_string_value (class_name));
+  }
+
+  node_p->name = name;
+} /* ecma_heap_snapshot_describe_object */
+
+/**
+ * Set the type, name and size of a string node.
+ */
+static void
+ecma_heap_snapshot_describe_string (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                    ecma_heap_snapshot_node_t *node_p) /**< node */
+{
+  ecma_string_t *string_p = (ecma_string_t *) node_p->pointer_p;
+  size_t size = sizeof (ecma_string_t);
+
+  node_p->type = ECMA_HEAP_SNAPSHOT_NODE_STRING;
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      size = sizeof (ecma_short_string_t) + ((ecma_short_string_t *) string_p)->size;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    {
+      size = ECMA_ASCII_STRING_HEADER_SIZE + ECMA_ASCII_STRING_GET_SIZE (string_p);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
+    {
+      ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
+
+      if (long_string_p->string_p == ECMA_LONG_STRING_BUFFER_START (long_string_p))
+      {
+        size = sizeof (ecma_long_string_t) + long_string_p->size;
+      }
+      else
+      {
+        /* The characters of external strings are not on the heap. */
+        size = sizeof (ecma_external_string_t);
+      }
+      break;
+    }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+      size = ECMA_ROPE_STRING_ALLOC_SIZE (rope_p);
+
+      if (rope_p->header.string_p == NULL)
+      {
+        node_p->type = ECMA_HEAP_SNAPSHOT_NODE_CONCATENATED_STRING;
+        node_p->name = ECMA_HEAP_SNAPSHOT_NAME_CONCATENATED_STRING;
+        node_p->self_size = (uint32_t) size;
+        return;
+      }
+
+      size += rope_p->header.size;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_SYMBOL:
+    {
+      ecma_value_t description = ((ecma_extended_string_t *) string_p)->u.symbol_descriptor;
+
+      node_p->type = ECMA_HEAP_SNAPSHOT_NODE_SYMBOL;
+      node_p->name = (ecma_is_value_string (description) ? ecma_heap_snapshot_intern (snapshot_p, description)
+                                                         : ECMA_HEAP_SNAPSHOT_NAME_SYMBOL);
+      node_p->self_size = (uint32_t) sizeof (ecma_extended_string_t);
+      return;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  node_p->name = ecma_heap_snapshot_intern (snapshot_p, ecma_make_string_value (snapshot_p->context_p, string_p));
+  node_p->self_size = (uint32_t) size;
+} /* ecma_heap_snapshot_describe_string */
+
+/**
+ * Get the string index of a property name.
+ *
+ * @return string index
+ */
+static uint32_t
+ecma_heap_snapshot_property_name (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                  ecma_property_t property, /**< property */
+                                  jmem_cpointer_t name_cp) /**< property name */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+  ecma_string_t *name_p;
+
+  /* Some raw properties (e.g. intrinsic routines) have names which are not visible to scripts. */
+  if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+      && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT)
+  {
+    return ECMA_HEAP_SNAPSHOT_NAME_INTERNAL;
+  }
+
+  if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+  {
+    /* The string is not referenced, unlike the result of ecma_string_from_property_name. */
+    name_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_string_t, name_cp);
+  }
+  else
+  {
+    name_p = ecma_string_from_property_name (context_p, property, name_cp);
+  }
+
+  if (ecma_prop_name_is_symbol (name_p))
+  {
+    return ECMA_HEAP_SNAPSHOT_NAME_SYMBOL_KEY;
+  }
+
+  return ecma_heap_snapshot_intern (snapshot_p, ecma_make_string_value (context_p, name_p));
+} /* ecma_heap_snapshot_property_name */
+
+/**
+ * Add the edges of the properties of the current object.
+ */
+static void
+ecma_heap_snapshot_property_edges (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                   ecma_object_t *object_p, /**< object */
+                                   ecma_heap_snapshot_edge_type_t type) /**< type of property edges */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+    prop_iter_cp = prop_iter_p->next_property_cp;
+
+    if (!ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p))
+    {
+      continue;
+    }
+
+    ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+    {
+      uint8_t property = property_pair_p->header.types[index];
+
+      if (ECMA_PROPERTY_IS_RAW (property))
+      {
+        uint32_t name = ecma_heap_snapshot_property_name (snapshot_p, property, property_pair_p->names_cp[index]);
+
+        if (property & ECMA_PROPERTY_FLAG_DATA)
+        {
+          ecma_heap_snapshot_value_edge (snapshot_p, type, name, property_pair_p->values[index].value);
+          continue;
+        }
+
+        ecma_getter_setter_pointers_t *get_set_pair_p =
+          ecma_get_named_accessor_property (context_p, property_pair_p->values + index);
+
+        if (get_set_pair_p->getter_cp != JMEM_CP_NULL)
+        {
+          ecma_object_t *getter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, get_set_pair_p->getter_cp);
+          ecma_heap_snapshot_pointer_edge (snapshot_p, type, name, getter_p, ECMA_HEAP_SNAPSHOT_OBJECT);
+        }
+
+        if (get_set_pair_p->setter_cp != JMEM_CP_NULL)
+        {
+          ecma_object_t *setter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, get_set_pair_p->setter_cp);
+          ecma_heap_snapshot_pointer_edge (snapshot_p, type, name, setter_p, ECMA_HEAP_SNAPSHOT_OBJECT);
+        }
+        continue;
+      }
+
+      if (!ECMA_PROPERTY_IS_INTERNAL (property)
+          || (property_pair_p->names_cp[index] != LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER
+              && property_pair_p->names_cp[index] != LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER_WITH_REFERENCES))
+      {
+        continue;
+      }
+
+      ecma_value_t value = property_pair_p->values[index].value;
+
+      if (property & ECMA_PROPERTY_FLAG_SINGLE_EXTERNAL)
+      {
+        ecma_native_pointer_t *native_pointer_p;
+        native_pointer_p = ECMA_GET_INTERNAL_VALUE_POINTER (context_p, ecma_native_pointer_t, value);
+        ecma_heap_snapshot_data_edge (snapshot_p,
+                                      ECMA_HEAP_SNAPSHOT_NAME_NATIVE,
+                                      native_pointer_p,
+                                      ECMA_HEAP_SNAPSHOT_NATIVE_POINTER,
+                                      ECMA_HEAP_SNAPSHOT_NAME_NATIVE_POINTER,
+                                      sizeof (ecma_native_pointer_t));
+        continue;
+      }
+
+      if (value == JMEM_CP_NULL)
+      {
+        continue;
+      }
+
+      ecma_native_pointer_chain_t *item_p;
+      item_p = ECMA_GET_INTERNAL_VALUE_POINTER (context_p, ecma_native_pointer_chain_t, value);
+
+      do
+      {
+        ecma_heap_snapshot_data_edge (snapshot_p,
+                                      ECMA_HEAP_SNAPSHOT_NAME_NATIVE,
+                                      item_p,
+                                      ECMA_HEAP_SNAPSHOT_NATIVE_POINTER,
+                                      ECMA_HEAP_SNAPSHOT_NAME_NATIVE_POINTER,
+                                      sizeof (ecma_native_pointer_chain_t));
+        item_p = item_p->next_p;
+      } while (item_p != NULL);
+    }
+  }
+} /* ecma_heap_snapshot_property_edges */
+
+/**
+ * Add an edge from the current node for a reference reported by the garbage collector,
+ * unless the current node already has an edge to the referenced object.
+ */
+static void
+ecma_heap_snapshot_visit (ecma_context_t *context_p, /**< JJS context */
+                          ecma_object_t *object_p, /**< referenced object */
+                          void *user_p) /**< snapshot */
+{
+  JJS_UNUSED (context_p);
+  ecma_heap_snapshot_t *snapshot_p = (ecma_heap_snapshot_t *) user_p;
+  uint32_t target = ecma_heap_snapshot_map_find (&snapshot_p->node_map, (uintptr_t) object_p);
+
+  if (target != ECMA_HEAP_SNAPSHOT_NONE && snapshot_p->nodes_p[target].edge_stamp != snapshot_p->current + 1)
+  {
+    ecma_heap_snapshot_add_edge (snapshot_p,
+                                 ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL,
+                                 ECMA_HEAP_SNAPSHOT_NAME_INTERNAL,
+                                 target);
+  }
+} /* ecma_heap_snapshot_visit */
+
+/**
+ * Add the edges of the current object.
+ */
+static void
+ecma_heap_snapshot_object_edges (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                 ecma_object_t *object_p) /**< object */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    if (object_p->u2.outer_reference_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *outer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, object_p->u2.outer_reference_cp);
+      ecma_heap_snapshot_pointer_edge (snapshot_p,
+                                       ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL,
+                                       ECMA_HEAP_SNAPSHOT_NAME_PREVIOUS,
+                                       outer_p,
+                                       ECMA_HEAP_SNAPSHOT_OBJECT);
+    }
+
+    if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    {
+      ecma_heap_snapshot_property_edges (snapshot_p, object_p, ECMA_HEAP_SNAPSHOT_EDGE_CONTEXT);
+    }
+  }
+  else
+  {
+    ecma_object_type_t type = ecma_get_object_type (object_p);
+
+    if (type != ECMA_OBJECT_TYPE_PROXY && object_p->u2.prototype_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *proto_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, object_p->u2.prototype_cp);
+      ecma_heap_snapshot_pointer_edge (snapshot_p,
+                                       ECMA_HEAP_SNAPSHOT_EDGE_PROPERTY,
+                                       ECMA_HEAP_SNAPSHOT_NAME_PROTO,
+                                       proto_p,
+                                       ECMA_HEAP_SNAPSHOT_OBJECT);
+    }
+
+    if (type == ECMA_OBJECT_TYPE_FUNCTION)
+    {
+      ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) object_p;
+      ecma_object_t *scope_p =
+        ECMA_GET_NON_NULL_POINTER_FROM_POINTER_TAG (context_p, ecma_object_t, ext_func_p->u.function.scope_cp);
+
+      ecma_heap_snapshot_pointer_edge (snapshot_p,
+                                       ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL,
+                                       ECMA_HEAP_SNAPSHOT_NAME_CONTEXT,
+                                       scope_p,
+                                       ECMA_HEAP_SNAPSHOT_OBJECT);
+
+      const ecma_compiled_code_t *bytecode_p = ecma_op_function_get_compiled_code (context_p, ext_func_p);
+
+      /* Static snapshot functions are not on the heap. */
+      if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+      {
+        ecma_heap_snapshot_data_edge (snapshot_p,
+                                      ECMA_HEAP_SNAPSHOT_NAME_CODE,
+                                      (void *) bytecode_p,
+                                      ECMA_HEAP_SNAPSHOT_BYTECODE,
+                                      snapshot_p->nodes_p[snapshot_p->current].name,
+                                      ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+      }
+    }
+#if JJS_BUILTIN_REGEXP
+    else if (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_REGEXP))
+    {
+      ecma_value_t bytecode_cp = ((ecma_extended_object_t *) object_p)->u.cls.u3.value;
+      ecma_compiled_code_t *bytecode_p;
+      bytecode_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (context_p, ecma_compiled_code_t, bytecode_cp);
+
+      if (bytecode_p != NULL)
+      {
+        ecma_heap_snapshot_data_edge (snapshot_p,
+                                      ECMA_HEAP_SNAPSHOT_NAME_CODE,
+                                      bytecode_p,
+                                      ECMA_HEAP_SNAPSHOT_BYTECODE,
+                                      snapshot_p->nodes_p[snapshot_p->current].name,
+                                      ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+      }
+    }
+#endif /* JJS_BUILTIN_REGEXP */
+
+    if (ecma_op_object_is_fast_array (object_p))
+    {
+      if (object_p->u1.property_list_cp != JMEM_CP_NULL && !ecma_fast_array_has_double_elements (object_p))
+      {
+        ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
+        uint32_t length = ((ecma_extended_object_t *) object_p)->u.array.length;
+
+        for (uint32_t i = 0; i < length; i++)
+        {
+          ecma_heap_snapshot_value_edge (snapshot_p, ECMA_HEAP_SNAPSHOT_EDGE_ELEMENT, i, values_p[i]);
+        }
+      }
+    }
+    else
+    {
+      ecma_heap_snapshot_property_edges (snapshot_p, object_p, ECMA_HEAP_SNAPSHOT_EDGE_PROPERTY);
+    }
+  }
+
+  /* The remaining references (bound arguments, container entries, promise reactions,
+   * generator frames, etc.) are reported by the garbage collector. */
+  ecma_gc_visit_references (context_p, object_p, ecma_heap_snapshot_visit, snapshot_p);
+} /* ecma_heap_snapshot_object_edges */
+
+/**
+ * Add the edges of a node.
+ */
+static void
+ecma_heap_snapshot_node_edges (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                               uint32_t index) /**< node index */
+{
+  ecma_heap_snapshot_node_t *node_p = snapshot_p->nodes_p + index;
+  snapshot_p->current = index;
+
+  switch (node_p->kind)
+  {
+    case ECMA_HEAP_SNAPSHOT_ROOT:
+    {
+      /* The garbage collector roots are the objects referenced from outside of the heap. */
+      uint32_t element_index = 0;
+
+      for (uint32_t i = 1; i <= snapshot_p->object_count; i++)
+      {
+        ecma_object_t *object_p = (ecma_object_t *) snapshot_p->nodes_p[i].pointer_p;
+
+        if (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+        {
+          ecma_heap_snapshot_add_edge (snapshot_p, ECMA_HEAP_SNAPSHOT_EDGE_ELEMENT, element_index++, i);
+        }
+      }
+      break;
+    }
+    case ECMA_HEAP_SNAPSHOT_OBJECT:
+    {
+      ecma_heap_snapshot_object_edges (snapshot_p, (ecma_object_t *) node_p->pointer_p);
+      break;
+    }
+    case ECMA_HEAP_SNAPSHOT_STRING:
+    {
+      ecma_string_t *string_p = (ecma_string_t *) node_p->pointer_p;
+
+      if (ECMA_STRING_GET_CONTAINER (string_p) != ECMA_STRING_CONTAINER_ROPE
+          || ((ecma_rope_string_t *) string_p)->header.string_p != NULL)
+      {
+        break;
+      }
+
+      ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+      if (!ECMA_IS_DIRECT_STRING (rope_p->left_p))
+      {
+        ecma_heap_snapshot_pointer_edge (snapshot_p,
+                                         ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL,
+                                         ECMA_HEAP_SNAPSHOT_NAME_FIRST,
+                                         rope_p->left_p,
+                                         ECMA_HEAP_SNAPSHOT_STRING);
+      }
+
+      if (rope_p->right_p != NULL && !ECMA_IS_DIRECT_STRING (rope_p->right_p))
+      {
+        ecma_heap_snapshot_pointer_edge (snapshot_p,
+                                         ECMA_HEAP_SNAPSHOT_EDGE_INTERNAL,
+                                         ECMA_HEAP_SNAPSHOT_NAME_SECOND,
+                                         rope_p->right_p,
+                                         ECMA_HEAP_SNAPSHOT_STRING);
+      }
+      break;
+    }
+    default:
+    {
+      JJS_ASSERT (node_p->kind == ECMA_HEAP_SNAPSHOT_BYTECODE || node_p->kind == ECMA_HEAP_SNAPSHOT_NATIVE_POINTER);
+      break;
+    }
+  }
+} /* ecma_heap_snapshot_node_edges */
+
+/**
+ * Discover the nodes of the heap and count their edges.
+ *
+ * @return true - if successful,
+ *         false - if there is not enough memory
+ */
+static bool
+ecma_heap_snapshot_discover (ecma_heap_snapshot_t *snapshot_p) /**< snapshot */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+
+  if (ecma_heap_snapshot_add_node (snapshot_p, NULL, ECMA_HEAP_SNAPSHOT_ROOT) == ECMA_HEAP_SNAPSHOT_NONE)
+  {
+    return false;
+  }
+
+  snapshot_p->nodes_p[0].type = ECMA_HEAP_SNAPSHOT_NODE_SYNTHETIC;
+
+  jmem_cpointer_t obj_iter_cp = context_p->ecma_gc_objects_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, obj_iter_cp);
+
+    if (ecma_heap_snapshot_add_node (snapshot_p, obj_iter_p, ECMA_HEAP_SNAPSHOT_OBJECT) == ECMA_HEAP_SNAPSHOT_NONE)
+    {
+      return false;
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  snapshot_p->object_count = snapshot_p->node_count - 1;
+
+  /* The strings, byte codes and native pointers found by node_edges are appended to the nodes. */
+  for (uint32_t i = 0; i < snapshot_p->node_count && !snapshot_p->out_of_memory; i++)
+  {
+    ecma_heap_snapshot_node_t *node_p = snapshot_p->nodes_p + i;
+
+    if (node_p->kind == ECMA_HEAP_SNAPSHOT_OBJECT)
+    {
+      ecma_heap_snapshot_describe_object (snapshot_p, node_p);
+    }
+    else if (node_p->kind == ECMA_HEAP_SNAPSHOT_STRING)
+    {
+      ecma_heap_snapshot_describe_string (snapshot_p, node_p);
+    }
+    else if (node_p->kind == ECMA_HEAP_SNAPSHOT_BYTECODE)
+    {
+      node_p->type = ECMA_HEAP_SNAPSHOT_NODE_CODE;
+    }
+    else if (node_p->kind == ECMA_HEAP_SNAPSHOT_NATIVE_POINTER)
+    {
+      node_p->type = ECMA_HEAP_SNAPSHOT_NODE_NATIVE;
+    }
+
+    ecma_heap_snapshot_node_edges (snapshot_p, i);
+  }
+
+  return !snapshot_p->out_of_memory;
+} /* ecma_heap_snapshot_discover */
+
+/**
+ * Write a list of names as a JSON array.
+ */
+static void
+ecma_heap_snapshot_write_names (ecma_heap_snapshot_t *snapshot_p, /**< snapshot */
+                                const char *const *names_p, /**< names */
+                                uint32_t count) /**< number of names */
+{
+  ecma_heap_snapshot_write_sz (snapshot_p, "[");
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    ecma_heap_snapshot_write_sz (snapshot_p, (i == 0) ? "\"" : ",\"");
+    ecma_heap_snapshot_write_sz (snapshot_p, names_p[i]);
+    ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+  }
+
+  ecma_heap_snapshot_write_sz (snapshot_p, "]");
+} /* ecma_heap_snapshot_write_names */
+
+/**
+ * Write the discovered nodes and their edges.
+ */
+static void
+ecma_heap_snapshot_write_snapshot (ecma_heap_snapshot_t *snapshot_p) /**< snapshot */
+{
+  ecma_context_t *context_p = snapshot_p->context_p;
+
+  ecma_heap_snapshot_write_sz (snapshot_p,
+                            "{\"snapshot\":{\"meta\":{\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\","
+                            "\"edge_count\",\"trace_node_id\",\"detachedness\"],\"node_types\":[");
+  ecma_heap_snapshot_write_names (snapshot_p,
+                                  ecma_heap_snapshot_node_types,
+                                  sizeof (ecma_heap_snapshot_node_types) / sizeof (ecma_heap_snapshot_node_types[0]));
+  ecma_heap_snapshot_write_sz (snapshot_p,
+                            ",\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"
+                            "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],\"edge_types\":[");
+  ecma_heap_snapshot_write_names (snapshot_p,
+                                  ecma_heap_snapshot_edge_types,
+                                  sizeof (ecma_heap_snapshot_edge_types) / sizeof (ecma_heap_snapshot_edge_types[0]));
+  ecma_heap_snapshot_write_sz (snapshot_p,
+                            ",\"string_or_number\",\"node\"],"
+                            "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\","
+                            "\"line\",\"column\"],\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\","
+                            "\"size\",\"children\"],\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+                            "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"
+                            "\"node_count\":");
+  ecma_heap_snapshot_write_uint (snapshot_p, snapshot_p->node_count);
+  ecma_heap_snapshot_write_sz (snapshot_p, ",\"edge_count\":");
+  ecma_heap_snapshot_write_uint (snapshot_p, snapshot_p->edge_count);
+  ecma_heap_snapshot_write_sz (snapshot_p, ",\"trace_function_count\":0},\n\"nodes\":[");
+
+  for (uint32_t i = 0; i < snapshot_p->node_count; i++)
+  {
+    const ecma_heap_snapshot_node_t *node_p = snapshot_p->nodes_p + i;
+
+    ecma_heap_snapshot_write_sz (snapshot_p, (i == 0) ? "\n" : ",\n");
+    ecma_heap_snapshot_write_uint (snapshot_p, node_p->type);
+    ecma_heap_snapshot_write_sz (snapshot_p, ",");
+    ecma_heap_snapshot_write_uint (snapshot_p, node_p->name);
+    ecma_heap_snapshot_write_sz (snapshot_p, ",");
+
+    /* Node ids are derived from the heap addresses, so an object which is not moved has the
+     * same id in consecutive snapshots. Ids of heap items are odd, the root node id is 1. */
+    if (i == 0)
+    {
+      ecma_heap_snapshot_write_sz (snapshot_p, "1");
+    }
+    else
+    {
+      lit_utf8_byte_t id_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+      ecma_number_t id = ((ecma_number_t) jmem_compress_pointer (context_p, node_p->pointer_p) + 1) * 2 + 1;
+      lit_utf8_size_t id_size = ecma_number_to_utf8_string (id, id_buffer, sizeof (id_buffer));
+      ecma_heap_snapshot_write_bytes (snapshot_p, id_buffer, id_size);
+    }
+
+    ecma_heap_snapshot_write_sz (snapshot_p, ",");
+    ecma_heap_snapshot_write_uint (snapshot_p, node_p->self_size);
+    ecma_heap_snapshot_write_sz (snapshot_p, ",");
+    ecma_heap_snapshot_write_uint (snapshot_p, node_p->edge_count);
+    ecma_heap_snapshot_write_sz (snapshot_p, ",0,0");
+  }
+
+  ecma_heap_snapshot_write_sz (snapshot_p, "],\n\"edges\":[");
+
+  /* The edges are enumerated again in the same order, which produces the same targets. */
+  snapshot_p->write_edges = true;
+
+  for (uint32_t i = 0; i < snapshot_p->node_count; i++)
+  {
+    snapshot_p->nodes_p[i].edge_stamp = 0;
+  }
+
+  for (uint32_t i = 0; i < snapshot_p->node_count; i++)
+  {
+    ecma_heap_snapshot_node_edges (snapshot_p, i);
+  }
+
+  JJS_ASSERT (snapshot_p->edges_written == snapshot_p->edge_count);
+
+  ecma_heap_snapshot_write_sz (snapshot_p,
+                            "],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n"
+                            "\"strings\":[");
+
+  for (uint32_t i = 0; i < ECMA_HEAP_SNAPSHOT_NAME__COUNT; i++)
+  {
+    ecma_heap_snapshot_write_sz (snapshot_p, (i == 0) ? "\"" : ",\n\"");
+    ecma_heap_snapshot_write_sz (snapshot_p, ecma_heap_snapshot_names[i]);
+    ecma_heap_snapshot_write_sz (snapshot_p, "\"");
+  }
+
+  for (uint32_t i = 0; i < snapshot_p->string_count; i++)
+  {
+    ecma_heap_snapshot_write_sz (snapshot_p, ",\n");
+    ecma_heap_snapshot_write_string (snapshot_p, snapshot_p->strings_p[i]);
+  }
+
+  ecma_heap_snapshot_write_sz (snapshot_p, "]}\n");
+
+  if (snapshot_p->buffer_size > 0)
+  {
+    snapshot_p->wstream_p->write (context_p, snapshot_p->wstream_p, snapshot_p->buffer, snapshot_p->buffer_size);
+  }
+} /* ecma_heap_snapshot_write_snapshot */
+
+/**
+ * Write a snapshot of the heap to a stream.
+ *
+ * A full garbage collection is run first, so the snapshot contains the reachable items only.
+ *
+ * @return true - if the snapshot is written,
+ *         false - if there is not enough memory (nothing is written)
+ */
+bool
+ecma_heap_snapshot_write (ecma_context_t *context_p, /**< JJS context */
+                          const jjs_wstream_t *wstream_p) /**< target stream */
+{
+  ecma_gc_run (context_p);
+
+  ecma_heap_snapshot_t *snapshot_p = jjs_allocator_alloc (&context_p->context_allocator, sizeof (ecma_heap_snapshot_t));
+
+  if (snapshot_p == NULL)
+  {
+    return false;
+  }
+
+  memset (snapshot_p, 0, sizeof (ecma_heap_snapshot_t));
+  snapshot_p->context_p = context_p;
+  snapshot_p->wstream_p = wstream_p;
+
+  bool result = ecma_heap_snapshot_discover (snapshot_p);
+
+  if (result)
+  {
+    ecma_heap_snapshot_write_snapshot (snapshot_p);
+  }
+
+  if (snapshot_p->node_capacity > 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        snapshot_p->nodes_p,
+                        (jjs_size_t) (snapshot_p->node_capacity * sizeof (ecma_heap_snapshot_node_t)));
+  }
+
+  if (snapshot_p->string_capacity > 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        snapshot_p->strings_p,
+                        (jjs_size_t) (snapshot_p->string_capacity * sizeof (ecma_value_t)));
+  }
+
+  ecma_heap_snapshot_map_free (context_p, &snapshot_p->node_map);
+  ecma_heap_snapshot_map_free (context_p, &snapshot_p->string_map);
+  jjs_allocator_free (&context_p->context_allocator, snapshot_p, sizeof (ecma_heap_snapshot_t));
+  return result;
+} /* ecma_heap_snapshot_write */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JJS_HEAP_SNAPSHOT */
@@ -14,6 +14,7 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-bigint.h"
 #include "ecma-conversion.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -428,6 +429,75 @@ ecma_compact_collection_destroy (ecma_context_t *context_p, /**< JJS context */
  */
 #define ECMA_HASHSET_PROBE_INDEX(HASH, CAPACITY) (1 + (HASH) % ((CAPACITY) - 1))
 
+/**
+ * Compute the hash of a float number literal.
+ *
+ * @return hash of the bits of the number
+ */
+static lit_string_hash_t
+ecma_hashset_hash_number (ecma_number_t number) /**< number */
+{
+  return lit_utf8_string_calc_hash ((const lit_utf8_byte_t *) &number, sizeof (ecma_number_t));
+} /* ecma_hashset_hash_number */
+
+/**
+ * Compute the hash of a string, float number or BigInt literal.
+ *
+ * @return hash of the value
+ */
+static lit_string_hash_t
+ecma_hashset_hash_value (ecma_context_t *context_p, /**< JJS context */
+                         ecma_value_t value) /**< string, float number or BigInt value */
+{
+  if (ecma_is_value_float_number (value))
+  {
+    return ecma_hashset_hash_number (ecma_get_float_from_value (context_p, value));
+  }
+
+#if JJS_BUILTIN_BIGINT
+  if (ecma_is_value_bigint (value))
+  {
+    ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (context_p, value);
+    const lit_utf8_byte_t *digits_p = ((const lit_utf8_byte_t *) bigint_p) + sizeof (ecma_extended_primitive_t);
+
+    return lit_utf8_string_calc_hash (digits_p, ECMA_BIGINT_GET_SIZE (bigint_p)) ^ bigint_p->u.bigint_sign_and_size;
+  }
+#endif /* JJS_BUILTIN_BIGINT */
+
+  return ecma_string_hash (ecma_get_string_from_value (context_p, value));
+} /* ecma_hashset_hash_value */
+
+/**
+ * Compare two literals of the same type.
+ *
+ * @return true - if the values are equal
+ *         false - otherwise
+ */
+static bool
+ecma_hashset_values_equal (ecma_context_t *context_p, /**< JJS context */
+                           ecma_value_t item, /**< value stored in the hashset */
+                           ecma_value_t value) /**< string, float number or BigInt value */
+{
+  if (ecma_is_value_float_number (value))
+  {
+    /* bitwise comparison keeps -0 and +0 apart and lets NaN match itself */
+    ecma_number_t item_number = ecma_get_float_from_value (context_p, item);
+    ecma_number_t number = ecma_get_float_from_value (context_p, value);
+
+    return memcmp (&item_number, &number, sizeof (ecma_number_t)) == 0;
+  }
+
+#if JJS_BUILTIN_BIGINT
+  if (ecma_is_value_bigint (value))
+  {
+    return ecma_bigint_is_equal_to_bigint (context_p, item, value);
+  }
+#endif /* JJS_BUILTIN_BIGINT */
+
+  return ecma_compare_ecma_strings (ecma_get_string_from_value (context_p, item),
+                                    ecma_get_string_from_value (context_p, value));
+} /* ecma_hashset_values_equal */
+
 static void
 ecma_hashset_free_buckets (ecma_hashset_t *self)
 {
@@ -456,9 +526,8 @@ ecma_hashset_insert_internal (ecma_hashset_t *self,
                               ecma_value_t string_value,
                               bool move_on_success)
 {
-  ecma_string_t *string_value_p = ecma_get_string_from_value (self->context_p, string_value);
   /* TODO: this hash is not compatible with the hash calculated in get_raw */
-  const lit_string_hash_t hash = ecma_string_hash (string_value_p);
+  const lit_string_hash_t hash = ecma_hashset_hash_value (self->context_p, string_value);
   const uint64_t capacity = self->capacity;
   jjs_context_t *context_p = self->context_p;
   uint64_t i = hash % capacity;
@@ -529,7 +598,9 @@ ecma_hashset_grow (ecma_hashset_t *self)
 }
 
 /**
- * Specialized string hashset for internal use.
+ * Specialized literal hashset for internal use.
+ *
+ * A hashset holds either strings, float numbers or BigInts.
  */
 bool
 ecma_hashset_init (ecma_hashset_t *self, /**< this hashset */
@@ -562,7 +633,7 @@ ecma_hashset_init (ecma_hashset_t *self, /**< this hashset */
 } /* ecma_hashset_init */
 
 /**
- * Free the hashset and release all held string values.
+ * Free the hashset and release all held values.
  */
 void
 ecma_hashset_free (ecma_hashset_t *self) /**< this hashset */
@@ -670,21 +741,20 @@ ecma_hashset_get_raw (ecma_hashset_t *self, /**< this hashset */
 } /* ecma_hashset_get_raw */
 
 /**
- * Find a string value by ecma string value.
+ * Find a value by an equal string, float number or BigInt value.
  *
  * Note: to avoid copy/free calls in lit storage, the hashset's reference is returned. do not free.
  *
- * @return success: string value, failure: ECMA_VALUE_NOT_FOUND; the returned value should not be
+ * @return success: stored value, failure: ECMA_VALUE_NOT_FOUND; the returned value should not be
  * freed. use ecma_copy_value if you need a reference.
  */
 ecma_value_t
 ecma_hashset_get (ecma_hashset_t *self, /**< this hashset */
-                  ecma_value_t string_value) /**< ecma string key */
+                  ecma_value_t string_value) /**< ecma string, float number or BigInt key */
 {
-  ecma_string_t *string_value_p = ecma_get_string_from_value (self->context_p, string_value);
-  const lit_string_hash_t hash = ecma_string_hash (string_value_p);
-  const uint64_t capacity = self->capacity;
   jjs_context_t *context_p = self->context_p;
+  const lit_string_hash_t hash = ecma_hashset_hash_value (context_p, string_value);
+  const uint64_t capacity = self->capacity;
   uint64_t i = hash % capacity;
   ecma_value_t item = self->buckets[i].item;
 
@@ -693,7 +763,7 @@ ecma_hashset_get (ecma_hashset_t *self, /**< this hashset */
     return ECMA_VALUE_NOT_FOUND;
   }
 
-  if (ecma_compare_ecma_strings (ecma_get_string_from_value (context_p, item), string_value_p))
+  if (ecma_hashset_values_equal (context_p, item, string_value))
   {
     return item;
   }
@@ -704,7 +774,7 @@ ecma_hashset_get (ecma_hashset_t *self, /**< this hashset */
 
   while ((item = self->buckets[i].item) != ECMA_VALUE_EMPTY)
   {
-    if (ecma_compare_ecma_strings (ecma_get_string_from_value (context_p, item), string_value_p))
+    if (ecma_hashset_values_equal (context_p, item, string_value))
     {
       return item;
     }
@@ -716,6 +786,56 @@ ecma_hashset_get (ecma_hashset_t *self, /**< this hashset */
   return ECMA_VALUE_NOT_FOUND;
 } /* ecma_hashset_get */
 
+/**
+ * Find a float number value by its number.
+ *
+ * Note: to avoid copy/free calls in lit storage, the hashset's reference is returned. do not free.
+ *
+ * @return success: float number value, failure: ECMA_VALUE_NOT_FOUND; the returned value should not be
+ * freed. use ecma_copy_value if you need a reference.
+ */
+ecma_value_t
+ecma_hashset_get_number (ecma_hashset_t *self, /**< this hashset */
+                         ecma_number_t number) /**< number key */
+{
+  const lit_string_hash_t hash = ecma_hashset_hash_number (number);
+  const uint64_t capacity = self->capacity;
+  jjs_context_t *context_p = self->context_p;
+  uint64_t i = hash % capacity;
+  ecma_value_t item = self->buckets[i].item;
+
+  if (item == ECMA_VALUE_EMPTY)
+  {
+    return ECMA_VALUE_NOT_FOUND;
+  }
+
+  ecma_number_t item_number = ecma_get_float_from_value (context_p, item);
+
+  if (memcmp (&item_number, &number, sizeof (ecma_number_t)) == 0)
+  {
+    return item;
+  }
+
+  uint64_t probe = ECMA_HASHSET_PROBE_INDEX (hash, capacity);
+
+  i = probe;
+
+  while ((item = self->buckets[i].item) != ECMA_VALUE_EMPTY)
+  {
+    item_number = ecma_get_float_from_value (context_p, item);
+
+    if (memcmp (&item_number, &number, sizeof (ecma_number_t)) == 0)
+    {
+      return item;
+    }
+
+    i += probe++;
+    while (i >= capacity) i -= capacity;
+  }
+
+  return ECMA_VALUE_NOT_FOUND;
+} /* ecma_hashset_get_number */
+
 /**
  * Insert a string into the set.
  *
@@ -117,6 +117,274 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+/**
+ * Remove a string from the string position cache.
+ */
+static void
+ecma_string_position_cache_remove (ecma_context_t *context_p, /**< JJS context */
+                                   const ecma_string_t *string_p) /**< ecma-string */
+{
+  for (uint32_t i = 0; i < ECMA_STRING_POSITION_CACHE_SIZE; i++)
+  {
+    if (context_p->string_position_cache[i].string_p == string_p)
+    {
+      context_p->string_position_cache[i].string_p = NULL;
+    }
+  }
+} /* ecma_string_position_cache_remove */
+
+/**
+ * Get the byte offset of a character in the cesu-8 representation of a non-ASCII string.
+ *
+ * Note:
+ *   The position of the last accessed character of long strings is kept in the string
+ *   position cache. The next lookup starts from the closest of the string start, the
+ *   cached position and the string end, so sequential access is O(1) amortized.
+ *
+ * @return byte offset of the character
+ */
+static lit_utf8_size_t
+ecma_string_get_char_byte_offset (ecma_context_t *context_p, /**< JJS context */
+                                  const ecma_string_t *string_p, /**< ecma-string */
+                                  const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                  lit_utf8_size_t size, /**< size of the string */
+                                  lit_utf8_size_t length, /**< length of the string */
+                                  lit_utf8_size_t index) /**< character index */
+{
+  JJS_ASSERT (index <= length);
+
+  if (size == length)
+  {
+    return index;
+  }
+
+  const lit_utf8_byte_t *current_p = chars_p;
+  lit_utf8_size_t current_index = 0;
+
+  if (size < ECMA_STRING_POSITION_CACHE_MIN_SIZE || ECMA_IS_DIRECT_STRING (string_p))
+  {
+    while (current_index++ < index)
+    {
+      current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+    }
+
+    return (lit_utf8_size_t) (current_p - chars_p);
+  }
+
+  ecma_string_position_cache_entry_t *entry_p = NULL;
+
+  for (uint32_t i = 0; i < ECMA_STRING_POSITION_CACHE_SIZE; i++)
+  {
+    if (context_p->string_position_cache[i].string_p == string_p)
+    {
+      entry_p = context_p->string_position_cache + i;
+      break;
+    }
+  }
+
+  if (entry_p == NULL)
+  {
+    entry_p = context_p->string_position_cache + context_p->string_position_cache_next;
+    context_p->string_position_cache_next = (context_p->string_position_cache_next + 1) % ECMA_STRING_POSITION_CACHE_SIZE;
+
+    entry_p->string_p = string_p;
+    entry_p->char_index = 0;
+    entry_p->byte_offset = 0;
+  }
+
+  if (index >= entry_p->char_index)
+  {
+    if (length - index < index - entry_p->char_index)
+    {
+      current_p = chars_p + size;
+      current_index = length;
+    }
+    else
+    {
+      current_p = chars_p + entry_p->byte_offset;
+      current_index = entry_p->char_index;
+    }
+  }
+  else if (entry_p->char_index - index < index)
+  {
+    current_p = chars_p + entry_p->byte_offset;
+    current_index = entry_p->char_index;
+  }
+
+  while (current_index < index)
+  {
+    current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+    current_index++;
+  }
+
+  while (current_index > index)
+  {
+    lit_utf8_decr (&current_p);
+    current_index--;
+  }
+
+  entry_p->char_index = index;
+  entry_p->byte_offset = (lit_utf8_size_t) (current_p - chars_p);
+
+  return entry_p->byte_offset;
+} /* ecma_string_get_char_byte_offset */
+
+/**
+ * Checks whether the string is a rope which has not been flattened yet.
+ */
+#define ECMA_STRING_IS_UNFLATTENED_ROPE(string_desc_p)                         \
+  (ECMA_STRING_GET_CONTAINER (string_desc_p) == ECMA_STRING_CONTAINER_ROPE \
+   && ((const ecma_rope_string_t *) (string_desc_p))->header.string_p == NULL)
+
+/**
+ * Returns the characters and size of a rope leaf or a flattened rope.
+ *
+ * Note:
+ *   rope leaves always have their character data stored in the string descriptor,
+ *   so no JJS context is needed to access them
+ *
+ * @return byte array start
+ */
+static const lit_utf8_byte_t *
+ecma_rope_string_get_leaf_chars (const ecma_string_t *string_p, /**< ecma-string */
+                                 lit_utf8_size_t *size_p) /**< [out] size of the ecma string */
+{
+  JJS_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      *size_p = ((ecma_short_string_t *) string_p)->size;
+      return ECMA_SHORT_STRING_GET_BUFFER (string_p);
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    {
+      *size_p = ECMA_ASCII_STRING_GET_SIZE (string_p);
+      return ECMA_ASCII_STRING_GET_BUFFER (string_p);
+    }
+    default:
+    {
+      JJS_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+                  || (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE
+                      && !ECMA_STRING_IS_UNFLATTENED_ROPE (string_p)));
+
+      *size_p = ((ecma_long_string_t *) string_p)->size;
+      return ((ecma_long_string_t *) string_p)->string_p;
+    }
+  }
+} /* ecma_rope_string_get_leaf_chars */
+
+/**
+ * Returns the characters and size of the right operand of an unflattened rope.
+ *
+ * @return byte array start
+ */
+static const lit_utf8_byte_t *
+ecma_rope_string_get_right_chars (const ecma_rope_string_t *rope_p, /**< unflattened rope string */
+                                  lit_utf8_size_t *size_p) /**< [out] size of the right operand */
+{
+  JJS_ASSERT (ECMA_STRING_IS_UNFLATTENED_ROPE ((const ecma_string_t *) rope_p));
+
+  if (rope_p->right_p == NULL)
+  {
+    *size_p = rope_p->tail_size;
+    return ECMA_ROPE_STRING_TAIL_BUFFER (rope_p);
+  }
+
+  return ecma_rope_string_get_leaf_chars (rope_p->right_p, size_p);
+} /* ecma_rope_string_get_right_chars */
+
+/**
+ * Copy the characters of a rope into a continuous buffer and release its children.
+ * After flattening the rope behaves as a long string.
+ */
+static void JJS_ATTR_NOINLINE
+ecma_rope_string_flatten (ecma_context_t *context_p, /**< JJS context */
+                          const ecma_string_t *string_p) /**< unflattened rope string */
+{
+  JJS_ASSERT (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p));
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+  lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (context_p, rope_p->header.size);
+  lit_utf8_byte_t *data_end_p = data_p + rope_p->header.size;
+  const lit_utf8_byte_t *chars_p;
+  lit_utf8_size_t size;
+
+  /* Ropes are left-deep: the leaves are copied from the end of the buffer
+   * while walking down the left spine, so no recursion is needed. */
+  while (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+  {
+    const ecma_rope_string_t *node_p = (const ecma_rope_string_t *) string_p;
+
+    chars_p = ecma_rope_string_get_right_chars (node_p, &size);
+    data_end_p -= size;
+    memcpy (data_end_p, chars_p, size);
+    string_p = node_p->left_p;
+  }
+
+  chars_p = ecma_rope_string_get_leaf_chars (string_p, &size);
+  JJS_ASSERT (data_p + size == data_end_p);
+  memcpy (data_p, chars_p, size);
+
+  ecma_string_t *left_p = rope_p->left_p;
+  ecma_string_t *right_p = rope_p->right_p;
+
+  rope_p->header.string_p = data_p;
+  rope_p->left_p = NULL;
+  rope_p->right_p = NULL;
+
+  ecma_deref_ecma_string (context_p, left_p);
+
+  if (right_p != NULL)
+  {
+    ecma_deref_ecma_string (context_p, right_p);
+  }
+} /* ecma_rope_string_flatten */
+
+/**
+ * Deallocate a rope string
+ *
+ * Note:
+ *   the left spine of the rope is released iteratively to avoid deep recursion
+ */
+static void
+ecma_rope_string_destroy (ecma_context_t *context_p, /**< JJS context */
+                          ecma_rope_string_t *rope_p) /**< rope string */
+{
+  while (true)
+  {
+    ecma_string_position_cache_remove (context_p, (ecma_string_t *) rope_p);
+
+    if (rope_p->header.string_p != NULL)
+    {
+      ecma_dealloc_string_buffer (context_p, (ecma_string_t *) rope_p->header.string_p, rope_p->header.size);
+      ecma_dealloc_string_buffer (context_p, (ecma_string_t *) rope_p, ECMA_ROPE_STRING_ALLOC_SIZE (rope_p));
+      return;
+    }
+
+    ecma_string_t *left_p = rope_p->left_p;
+
+    if (rope_p->right_p != NULL)
+    {
+      ecma_deref_ecma_string (context_p, rope_p->right_p);
+    }
+
+    ecma_dealloc_string_buffer (context_p, (ecma_string_t *) rope_p, ECMA_ROPE_STRING_ALLOC_SIZE (rope_p));
+
+    if (ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE || ECMA_STRING_IS_STATIC (left_p)
+        || !ECMA_STRING_IS_REF_EQUALS_TO_ONE (left_p))
+    {
+      ecma_deref_ecma_string (context_p, left_p);
+      return;
+    }
+
+    /* The last reference of the left rope is dropped here, it is freed by the next iteration. */
+    left_p->refs_and_container -= ECMA_STRING_REF_ONE;
+    rope_p = (ecma_rope_string_t *) left_p;
+  }
+} /* ecma_rope_string_destroy */
+
 /**
  * Returns the characters and size of a string.
  *
@@ -159,6 +427,15 @@ ecma_string_get_chars_fast (ecma_context_t *context_p, /**< JJS context */
       *size_p = ((ecma_short_string_t *) string_p)->size;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      if (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+      {
+        ecma_rope_string_flatten (context_p, string_p);
+      }
+
+      /* FALLTHRU */
+    }
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -853,6 +1130,147 @@ ecma_append_chars_to_string (ecma_context_t *context_p, /**< JJS context */
   return (ecma_string_t *) string_desc_p;
 } /* ecma_append_chars_to_string */
 
+/**
+ * Checks whether the concatenation of two strings should be represented as a rope.
+ *
+ * Note:
+ *   short results are always flat, which also keeps magic strings and
+ *   array indices in their canonical representation
+ *
+ * @return true - if a rope should be created
+ *         false - otherwise
+ */
+static bool
+ecma_concat_ecma_strings_can_create_rope (ecma_context_t *context_p, /**< JJS context */
+                                          const ecma_string_t *string1_p, /**< first ecma-string */
+                                          lit_utf8_size_t cesu8_string2_size) /**< byte size of the second string */
+{
+  if (ECMA_IS_DIRECT_STRING (string1_p))
+  {
+    return false;
+  }
+
+  switch (ECMA_STRING_GET_CONTAINER (string1_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  lit_utf8_size_t cesu8_string1_size = ecma_string_get_size (context_p, string1_p);
+  lit_utf8_size_t new_size = cesu8_string1_size + cesu8_string2_size;
+
+  /* The carry flag check is done by ecma_append_chars_to_string. */
+  if (new_size < ECMA_ROPE_STRING_MIN_SIZE || new_size < cesu8_string1_size)
+  {
+    return false;
+  }
+
+  JJS_ASSERT (new_size > lit_get_magic_string_size (LIT_NON_INTERNAL_MAGIC_STRING__COUNT - 1));
+
+  uint32_t magic_string_ex_count = lit_get_magic_string_ex_count (context_p);
+  return magic_string_ex_count == 0 || new_size > lit_get_magic_string_ex_size (context_p, magic_string_ex_count - 1);
+} /* ecma_concat_ecma_strings_can_create_rope */
+
+/**
+ * Concatenate ecma-strings into a rope string
+ *
+ * Note:
+ *   The string1_p argument is freed.
+ *
+ * @return concatenation of two ecma-strings
+ */
+static ecma_string_t *
+ecma_concat_ecma_strings_to_rope (ecma_context_t *context_p, /**< JJS context */
+                                  ecma_string_t *string1_p, /**< first ecma-string */
+                                  ecma_string_t *string2_p, /**< second ecma-string */
+                                  const lit_utf8_byte_t *cesu8_string2_p, /**< characters of string2_p */
+                                  lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                                  lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  ecma_string_t *left_p = string1_p;
+  ecma_string_t *right_p = NULL;
+  const lit_utf8_byte_t *tail_p = NULL;
+  lit_utf8_size_t tail_size = 0;
+
+  if (cesu8_string2_size <= ECMA_ROPE_STRING_TAIL_CAPACITY && ECMA_STRING_IS_UNFLATTENED_ROPE (string1_p))
+  {
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+
+    /* Short chunks are merged into the tail buffer to limit the number of rope nodes. */
+    if (rope1_p->right_p == NULL && rope1_p->tail_size + cesu8_string2_size <= ECMA_ROPE_STRING_TAIL_CAPACITY)
+    {
+      tail_p = ECMA_ROPE_STRING_TAIL_BUFFER (rope1_p);
+      tail_size = rope1_p->tail_size;
+      left_p = rope1_p->left_p;
+    }
+  }
+
+  size_t alloc_size = sizeof (ecma_rope_string_t);
+
+  if (cesu8_string2_size <= ECMA_ROPE_STRING_TAIL_CAPACITY)
+  {
+    alloc_size += ECMA_ROPE_STRING_TAIL_CAPACITY;
+  }
+  else if (!ECMA_IS_DIRECT_STRING (string2_p)
+           && ECMA_STRING_GET_CONTAINER (string2_p) != ECMA_STRING_CONTAINER_MAGIC_STRING_EX)
+  {
+    /* The second string has its own character data, so it can be a leaf of the rope. */
+    JJS_ASSERT (ECMA_STRING_GET_CONTAINER (string2_p) != ECMA_STRING_CONTAINER_UINT32_IN_DESC);
+    JJS_ASSERT (!ECMA_STRING_IS_UNFLATTENED_ROPE (string2_p));
+
+    ecma_ref_ecma_string_non_direct (string2_p);
+    right_p = string2_p;
+  }
+  else
+  {
+    lit_utf8_byte_t *data_p;
+    right_p = ecma_new_ecma_string_from_utf8_buffer (context_p, cesu8_string2_length, cesu8_string2_size, &data_p);
+    right_p->u.hash = lit_utf8_string_calc_hash (cesu8_string2_p, cesu8_string2_size);
+    memcpy (data_p, cesu8_string2_p, cesu8_string2_size);
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (context_p, alloc_size);
+
+  rope_p->header.header.refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  rope_p->header.header.u.hash = lit_utf8_string_hash_combine (string1_p->u.hash, cesu8_string2_p, cesu8_string2_size);
+  rope_p->header.string_p = NULL;
+  rope_p->header.size = ecma_string_get_size (context_p, string1_p) + cesu8_string2_size;
+  rope_p->header.length = ecma_string_get_length (context_p, string1_p) + cesu8_string2_length;
+  rope_p->left_p = left_p;
+  rope_p->right_p = right_p;
+  rope_p->tail_size = 0;
+
+  if (right_p == NULL)
+  {
+    lit_utf8_byte_t *tail_buffer_p = ECMA_ROPE_STRING_TAIL_BUFFER (rope_p);
+
+    if (tail_size > 0)
+    {
+      memcpy (tail_buffer_p, tail_p, tail_size);
+    }
+
+    memcpy (tail_buffer_p + tail_size, cesu8_string2_p, cesu8_string2_size);
+    rope_p->tail_size = tail_size + cesu8_string2_size;
+  }
+
+  if (left_p != string1_p)
+  {
+    ecma_ref_ecma_string_non_direct (left_p);
+    ecma_deref_ecma_string_non_direct (context_p, string1_p);
+  }
+
+  return (ecma_string_t *) rope_p;
+} /* ecma_concat_ecma_strings_to_rope */
+
 /**
  * Concatenate ecma-strings
  *
@@ -888,13 +1306,19 @@ ecma_concat_ecma_strings (ecma_context_t *context_p, /**< JJS context */
     ecma_string_get_chars (context_p, string2_p, &cesu8_string2_size, &cesu8_string2_length, uint32_to_string_buffer, &flags);
 
   JJS_ASSERT (cesu8_string2_p != NULL);
-
-  ecma_string_t *result_p =
-    ecma_append_chars_to_string (context_p, string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
-
   JJS_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
 
-  return result_p;
+  if (ecma_concat_ecma_strings_can_create_rope (context_p, string1_p, cesu8_string2_size))
+  {
+    return ecma_concat_ecma_strings_to_rope (context_p,
+                                             string1_p,
+                                             string2_p,
+                                             cesu8_string2_p,
+                                             cesu8_string2_size,
+                                             cesu8_string2_length);
+  }
+
+  return ecma_append_chars_to_string (context_p, string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
 } /* ecma_concat_ecma_strings */
 
 /**
@@ -1005,13 +1429,22 @@ ecma_destroy_ecma_string (ecma_context_t *context_p, /**< JJS context */
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     {
-      ecma_dealloc_string_buffer (context_p, string_p, ((ecma_short_string_t *) string_p)->size + sizeof (ecma_short_string_t));
+      ecma_short_string_t *short_string_p = (ecma_short_string_t *) string_p;
+
+      if (short_string_p->size >= ECMA_STRING_POSITION_CACHE_MIN_SIZE && short_string_p->size != short_string_p->length)
+      {
+        ecma_string_position_cache_remove (context_p, string_p);
+      }
+
+      ecma_dealloc_string_buffer (context_p, string_p, short_string_p->size + sizeof (ecma_short_string_t));
       return;
     }
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
+      ecma_string_position_cache_remove (context_p, string_p);
+
       if (long_string_p->string_p == ECMA_LONG_STRING_BUFFER_START (long_string_p))
       {
         ecma_dealloc_string_buffer (context_p, string_p, long_string_p->size + sizeof (ecma_long_string_t));
@@ -1037,6 +1470,11 @@ ecma_destroy_ecma_string (ecma_context_t *context_p, /**< JJS context */
       ecma_dealloc_string_buffer (context_p, string_p, ECMA_ASCII_STRING_GET_SIZE (string_p) + ECMA_ASCII_STRING_HEADER_SIZE);
       return;
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_destroy (context_p, (ecma_rope_string_t *) string_p);
+      return;
+    }
     case ECMA_STRING_CONTAINER_SYMBOL:
     {
       ecma_extended_string_t *symbol_p = (ecma_extended_string_t *) string_p;
@@ -1370,6 +1808,15 @@ ecma_string_get_chars (ecma_context_t *context_p, /**< JJS context */
         result_p = ECMA_SHORT_STRING_GET_BUFFER (short_string_p);
         break;
       }
+      case ECMA_STRING_CONTAINER_ROPE:
+      {
+        if (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+        {
+          ecma_rope_string_flatten (context_p, string_p);
+        }
+
+        /* FALLTHRU */
+      }
       case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
       {
         ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_p;
@@ -1629,7 +2076,9 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
+    case ECMA_STRING_CONTAINER_ROPE:
     {
+      /* The string_p field of unflattened ropes is NULL. */
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
       size_and_length_p[0] = long_string_p->size;
       size_and_length_p[1] = long_string_p->length;
@@ -1643,11 +2092,84 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
     }
     default:
     {
+      size_and_length_p[0] = 0;
+      size_and_length_p[1] = 0;
       return NULL;
     }
   }
 } /* ecma_compare_get_string_chars */
 
+/**
+ * Get the last leaf of a string which has not been compared yet.
+ *
+ * @return characters of the leaf
+ */
+static const lit_utf8_byte_t *
+ecma_compare_rope_get_prev_leaf (const ecma_string_t **string_p, /**< [in, out] remaining part of the string,
+                                                                   *   set to NULL after the last leaf */
+                                 lit_utf8_size_t *size_p) /**< [out] size of the leaf */
+{
+  const ecma_string_t *current_p = *string_p;
+
+  if (ECMA_STRING_IS_UNFLATTENED_ROPE (current_p))
+  {
+    const ecma_rope_string_t *rope_p = (const ecma_rope_string_t *) current_p;
+
+    *string_p = rope_p->left_p;
+    return ecma_rope_string_get_right_chars (rope_p, size_p);
+  }
+
+  *string_p = NULL;
+  return ecma_rope_string_get_leaf_chars (current_p, size_p);
+} /* ecma_compare_rope_get_prev_leaf */
+
+/**
+ * Compare two strings with equal sizes where at least one of them is an unflattened rope.
+ * The leaves are compared backwards without flattening the ropes.
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JJS_ATTR_NOINLINE
+ecma_compare_rope_strings (const ecma_string_t *string1_p, /**< ecma-string */
+                           const ecma_string_t *string2_p) /**< ecma-string */
+{
+  const lit_utf8_byte_t *chars1_p = NULL;
+  const lit_utf8_byte_t *chars2_p = NULL;
+  lit_utf8_size_t size1 = 0;
+  lit_utf8_size_t size2 = 0;
+
+  while (true)
+  {
+    if (size1 == 0)
+    {
+      if (string1_p == NULL)
+      {
+        JJS_ASSERT (size2 == 0 && string2_p == NULL);
+        return true;
+      }
+
+      chars1_p = ecma_compare_rope_get_prev_leaf (&string1_p, &size1);
+    }
+
+    if (size2 == 0)
+    {
+      JJS_ASSERT (string2_p != NULL);
+      chars2_p = ecma_compare_rope_get_prev_leaf (&string2_p, &size2);
+    }
+
+    lit_utf8_size_t size = JJS_MIN (size1, size2);
+
+    size1 -= size;
+    size2 -= size;
+
+    if (memcmp (chars1_p + size1, chars2_p + size2, size) != 0)
+    {
+      return false;
+    }
+  }
+} /* ecma_compare_rope_strings */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1667,15 +2189,17 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-st
   utf8_string1_p = ecma_compare_get_string_chars (string1_p, string1_size_and_length);
   utf8_string2_p = ecma_compare_get_string_chars (string2_p, string2_size_and_length);
 
-  if (utf8_string1_p == NULL || utf8_string2_p == NULL)
+  if (string1_size_and_length[0] != string2_size_and_length[0]
+      || string1_size_and_length[1] != string2_size_and_length[1])
   {
     return false;
   }
 
-  if (string1_size_and_length[0] != string2_size_and_length[0]
-      || string1_size_and_length[1] != string2_size_and_length[1])
+  if (utf8_string1_p == NULL || utf8_string2_p == NULL)
   {
-    return false;
+    /* Strings without character data report zero size, while
+     * unflattened ropes are never shorter than ECMA_ROPE_STRING_MIN_SIZE. */
+    return string1_size_and_length[0] != 0 && ecma_compare_rope_strings (string1_p, string2_p);
   }
 
   return *utf8_string1_p == *utf8_string2_p && !memcmp ((char *) utf8_string1_p, (char *) utf8_string2_p, string1_size_and_length[0]);
@@ -1926,7 +2450,8 @@ ecma_string_get_length (ecma_context_t *context_p, /**< JJS context */
     return ((ecma_short_string_t *) string_p)->length;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     return ((ecma_long_string_t *) string_p)->length;
   }
@@ -1975,7 +2500,8 @@ ecma_string_get_utf8_length (ecma_context_t *context_p, /**< JJS context */
     return lit_get_utf8_length_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
     lit_utf8_size_t size = long_string_p->size;
@@ -1985,6 +2511,11 @@ ecma_string_get_utf8_length (ecma_context_t *context_p, /**< JJS context */
       return size;
     }
 
+    if (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+    {
+      ecma_rope_string_flatten (context_p, string_p);
+    }
+
     return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
   }
 
@@ -2024,7 +2555,8 @@ ecma_string_get_size (ecma_context_t *context_p, /**< JJS context */
     return ((ecma_short_string_t *) string_p)->size;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     return ((ecma_long_string_t *) string_p)->size;
   }
@@ -2072,7 +2604,8 @@ ecma_string_get_utf8_size (ecma_context_t *context_p, /**< JJS context */
     return lit_get_utf8_size_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
@@ -2081,6 +2614,11 @@ ecma_string_get_utf8_size (ecma_context_t *context_p, /**< JJS context */
       return long_string_p->size;
     }
 
+    if (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+    {
+      ecma_rope_string_flatten (context_p, string_p);
+    }
+
     return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
   }
 
@@ -2113,6 +2651,20 @@ ecma_external_string_get_char_at_pos (ecma_context_t *context_p, /**< JJS contex
   return lit_utf8_string_code_unit_at (data_p, size, index);
 } /* ecma_external_string_get_char_at_pos */
 
+/**
+ * Read the code unit which starts at the given byte offset of a cesu-8 string.
+ *
+ * @return code unit
+ */
+static inline ecma_char_t JJS_ATTR_ALWAYS_INLINE
+ecma_string_get_code_unit_at_offset (const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                     lit_utf8_size_t byte_offset) /**< byte offset of the code unit */
+{
+  ecma_char_t code_unit;
+  lit_read_code_unit_from_cesu8 (chars_p + byte_offset, &code_unit);
+  return code_unit;
+} /* ecma_string_get_code_unit_at_offset */
+
 /**
  * Get character from specified position in the ecma-string.
  *
@@ -2172,7 +2724,18 @@ ecma_string_get_char_at_pos (ecma_context_t *context_p, /**< JJS context */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      return ecma_string_get_code_unit_at_offset (
+        data_p,
+        ecma_string_get_char_byte_offset (context_p, string_p, data_p, size, short_string_p->length, index));
+    }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      if (ECMA_STRING_IS_UNFLATTENED_ROPE (string_p))
+      {
+        ecma_rope_string_flatten (context_p, string_p);
+      }
+
+      /* FALLTHRU */
     }
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
@@ -2185,7 +2748,9 @@ ecma_string_get_char_at_pos (ecma_context_t *context_p, /**< JJS context */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      return ecma_string_get_code_unit_at_offset (
+        data_p,
+        ecma_string_get_char_byte_offset (context_p, string_p, data_p, size, long_string_p->length, index));
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     {
@@ -2278,18 +2843,12 @@ ecma_string_substr (ecma_context_t *context_p, /**< JJS context */
   }
   else
   {
-    while (start_pos--)
-    {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-    }
-
-    const lit_utf8_byte_t *end_p = start_p;
-    while (end_pos--)
-    {
-      end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-    }
+    lit_utf8_size_t start_offset =
+      ecma_string_get_char_byte_offset (context_p, string_p, start_p, buffer_size, string_length, start_pos);
+    lit_utf8_size_t end_offset =
+      ecma_string_get_char_byte_offset (context_p, string_p, start_p, buffer_size, string_length, start_pos + end_pos);
 
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (context_p, start_p, (lit_utf8_size_t) (end_p - start_p));
+    ecma_string_p = ecma_new_ecma_string_from_utf8 (context_p, start_p + start_offset, end_offset - start_offset);
   }
 
   ECMA_FINALIZE_UTF8_STRING (context_p, start_p, buffer_size);
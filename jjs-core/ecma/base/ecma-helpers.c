@@ -29,6 +29,7 @@
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "re-compiler.h"
+#include "vm.h"
 
 #if JJS_DEBUGGER
 #include "debugger.h"
@@ -47,6 +48,12 @@ JJS_STATIC_ASSERT (ECMA_OBJECT_TYPE_MASK >= ECMA_OBJECT_TYPE__MAX - 1,
 JJS_STATIC_ASSERT (ECMA_OBJECT_TYPE_MASK >= ECMA_LEXICAL_ENVIRONMENT_TYPE__MAX,
                      ecma_lexical_environment_types_must_be_lower_than_the_container_mask);
 
+JJS_STATIC_ASSERT ((int) ECMA_OBJECT_TYPE__MAX <= (int) ECMA_LEXICAL_ENVIRONMENT_TYPE_START,
+                     ecma_object_types_must_be_lower_than_the_lexical_environment_types);
+
+JJS_STATIC_ASSERT (ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS + 1 == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
+                     ecma_declarative_slots_type_must_precede_the_declarative_type);
+
 JJS_STATIC_ASSERT (ECMA_OBJECT_FLAG_EXTENSIBLE == ECMA_OBJECT_TYPE_MASK + 1,
                      ecma_extensible_flag_must_follow_the_object_type);
 
@@ -137,6 +144,38 @@ ecma_create_decl_lex_env (ecma_context_t *context_p, /**< JJS context */
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
 
+/**
+ * Create a declarative lexical environment of a function, whose
+ * bindings are cached in slots (see ecma_op_find_slot_binding).
+ *
+ * Reference counter's value will be set to one.
+ *
+ * @return pointer to the descriptor of lexical environment
+ */
+ecma_object_t *
+ecma_create_slot_lex_env (ecma_context_t *context_p, /**< JJS context */
+                          ecma_object_t *outer_lexical_environment_p, /**< outer lexical environment */
+                          uint32_t slot_count) /**< number of binding slots */
+{
+  ecma_lexical_environment_slots_t *slot_env_p;
+  slot_env_p = (ecma_lexical_environment_slots_t *) ecma_alloc_extended_object (context_p,
+                                                                               ECMA_LEX_ENV_SLOTS_SIZE (slot_count));
+
+  ecma_object_t *new_lexical_environment_p = &slot_env_p->lexical_env;
+  new_lexical_environment_p->type_flags_refs = ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS;
+
+  ecma_init_gc_info (context_p, new_lexical_environment_p);
+
+  new_lexical_environment_p->u1.property_list_cp = JMEM_CP_NULL;
+
+  ECMA_SET_POINTER (context_p, new_lexical_environment_p->u2.outer_reference_cp, outer_lexical_environment_p);
+
+  slot_env_p->slot_count = slot_count;
+  memset (slot_env_p->slots, 0, slot_count * sizeof (ecma_property_t *));
+
+  return new_lexical_environment_p;
+} /* ecma_create_slot_lex_env */
+
 /**
  * Create a object lexical environment with specified outer lexical environment
  * (or NULL if the environment is not nested), and binding object.
@@ -290,7 +329,10 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   JJS_ASSERT (object_p != NULL);
   JJS_ASSERT (ecma_is_lexical_environment (object_p));
 
-  return (ecma_lexical_environment_type_t) (object_p->type_flags_refs & ECMA_OBJECT_TYPE_MASK);
+  uint32_t type = object_p->type_flags_refs & ECMA_OBJECT_TYPE_MASK;
+
+  /* Environments with binding slots are declarative environments. */
+  return (ecma_lexical_environment_type_t) (type + (type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS));
 } /* ecma_get_lex_env_type */
 
 /**
@@ -1475,9 +1517,74 @@ ecma_script_deref (ecma_context_t *context_p, /**< JJS context */
   }
 #endif /* JJS_FUNCTION_TO_STRING */
 
+#if JJS_SNAPSHOT_EXEC
+  if (type & CBC_SCRIPT_HAS_SNAPSHOT_MAPPING)
+  {
+    JJS_ASSERT (!(type & (CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS | CBC_SCRIPT_HAS_IMPORT_META)));
+
+    ecma_value_t mapping_value = CBC_SCRIPT_GET_SNAPSHOT_MAPPING (script_p, type);
+    ecma_snapshot_mapping_deref (context_p,
+                                 ECMA_GET_INTERNAL_VALUE_POINTER (context_p, cbc_snapshot_mapping_t, mapping_value));
+    script_size += sizeof (ecma_value_t);
+  }
+#endif /* JJS_SNAPSHOT_EXEC */
+
   jmem_heap_free_block (context_p, script_p, script_size);
 } /* ecma_script_deref */
 
+#if JJS_SNAPSHOT_EXEC
+
+/**
+ * Decrease the reference counter of a snapshot mapping and unmap the
+ * snapshot when it is no longer referenced.
+ */
+void
+ecma_snapshot_mapping_deref (ecma_context_t *context_p, /**< JJS context */
+                             cbc_snapshot_mapping_t *mapping_p) /**< snapshot mapping */
+{
+  JJS_ASSERT (mapping_p->refs > 0);
+
+  if (--mapping_p->refs > 0)
+  {
+    return;
+  }
+
+  cbc_snapshot_mapping_t **prev_p = &context_p->snapshot_mappings_p;
+
+  while (*prev_p != mapping_p)
+  {
+    JJS_ASSERT (*prev_p != NULL);
+    prev_p = &(*prev_p)->next_p;
+  }
+
+  *prev_p = mapping_p->next_p;
+
+  mapping_p->buffer.free (&mapping_p->buffer);
+  jmem_heap_free_block (context_p, mapping_p, sizeof (cbc_snapshot_mapping_t));
+} /* ecma_snapshot_mapping_deref */
+
+/**
+ * Unmap the snapshots still pinned by static snapshot functions.
+ */
+void
+ecma_snapshot_mapping_finalize (ecma_context_t *context_p) /**< JJS context */
+{
+  cbc_snapshot_mapping_t *mapping_p = context_p->snapshot_mappings_p;
+
+  while (mapping_p != NULL)
+  {
+    cbc_snapshot_mapping_t *next_p = mapping_p->next_p;
+
+    mapping_p->buffer.free (&mapping_p->buffer);
+    jmem_heap_free_block (context_p, mapping_p, sizeof (cbc_snapshot_mapping_t));
+    mapping_p = next_p;
+  }
+
+  context_p->snapshot_mappings_p = NULL;
+} /* ecma_snapshot_mapping_finalize */
+
+#endif /* JJS_SNAPSHOT_EXEC */
+
 /**
  * Increase reference counter of Compact
  * Byte Code or regexp byte code.
@@ -1570,6 +1677,13 @@ ecma_bytecode_deref (ecma_context_t *context_p, /**< JJS context */
     }
 #endif /* JJS_LINE_INFO */
 
+#if JJS_CPU_PROFILER
+    if (context_p->vm_profiler_p != NULL)
+    {
+      vm_profiler_release_bytecode (context_p, bytecode_p);
+    }
+#endif /* JJS_CPU_PROFILER */
+
 #if JJS_DEBUGGER
     if ((context_p->debugger_flags & JJS_DEBUGGER_CONNECTED)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_DEBUGGER_IGNORE)
@@ -1754,6 +1868,62 @@ ecma_compiled_code_get_tagged_template_collection (ecma_context_t *context_p, /*
   return ECMA_GET_INTERNAL_VALUE_POINTER (context_p, ecma_collection_t, base_p[-1]);
 } /* ecma_compiled_code_get_tagged_template_collection */
 
+/**
+ * Get the size of the slot table of the compiled code
+ *
+ * @return size of the slot table in bytes (0 if the compiled code has no slot table)
+ */
+uint32_t
+ecma_compiled_code_get_slot_table_size (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  JJS_ASSERT (bytecode_header_p != NULL);
+
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_SLOT_TABLE))
+  {
+    return 0;
+  }
+
+  uint32_t ident_count;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    ident_count = (uint32_t) (args_p->ident_end - args_p->register_end);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    ident_count = (uint32_t) (args_p->ident_end - args_p->register_end);
+  }
+
+  /* The first item is the slot count of the function's own lexical environment. */
+  return (uint32_t) JJS_ALIGNUP ((ident_count + 1) * sizeof (uint16_t), sizeof (ecma_value_t));
+} /* ecma_compiled_code_get_slot_table_size */
+
+/**
+ * Get the slot table of the compiled code
+ *
+ * @return pointer to the slot table
+ */
+uint16_t *
+ecma_compiled_code_resolve_slot_table (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  JJS_ASSERT (bytecode_header_p != NULL);
+  JJS_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_SLOT_TABLE);
+
+  ecma_value_t *base_p = ecma_compiled_code_resolve_function_name (bytecode_header_p);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
+  {
+    base_p--;
+  }
+
+  /* adjust for line info block */
+  base_p--;
+
+  return (uint16_t *) (((uint8_t *) base_p) - ecma_compiled_code_get_slot_table_size (bytecode_header_p));
+} /* ecma_compiled_code_resolve_slot_table */
+
 #if JJS_LINE_INFO
 
 /**
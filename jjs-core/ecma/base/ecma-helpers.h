@@ -414,16 +414,18 @@ void ecma_compact_collection_free (ecma_context_t *context_p, ecma_value_t *comp
 ecma_value_t *ecma_compact_collection_end (ecma_value_t *compact_collection_p);
 void ecma_compact_collection_destroy (ecma_context_t *context_p, ecma_value_t *compact_collection_p);
 
-/* string hashset */
+/* literal hashset */
 bool ecma_hashset_init (ecma_hashset_t *self, ecma_context_t *context_p, const jjs_allocator_t *allocator_p, jjs_size_t capacity);
 void ecma_hashset_free (ecma_hashset_t* self);
 ecma_value_t ecma_hashset_get (ecma_hashset_t *self, ecma_value_t key);
 ecma_value_t ecma_hashset_get_raw (ecma_hashset_t *self, const lit_utf8_byte_t *key_p, lit_utf8_size_t key_size);
+ecma_value_t ecma_hashset_get_number (ecma_hashset_t *self, ecma_number_t number);
 bool ecma_hashset_insert (ecma_hashset_t *self, ecma_value_t string_value, bool move_on_success);
 
 /* ecma-helpers.c */
 ecma_object_t *ecma_create_object (ecma_context_t *context_p, ecma_object_t *prototype_object_p, size_t ext_object_size, ecma_object_type_t type);
 ecma_object_t *ecma_create_decl_lex_env (ecma_context_t *context_p, ecma_object_t *outer_lexical_environment_p);
+ecma_object_t *ecma_create_slot_lex_env (ecma_context_t *context_p, ecma_object_t *outer_lexical_environment_p, uint32_t slot_count);
 ecma_object_t *ecma_create_object_lex_env (ecma_context_t *context_p, ecma_object_t *outer_lexical_environment_p, ecma_object_t *binding_obj_p);
 ecma_object_t *ecma_create_lex_env_class (ecma_context_t *context_p, ecma_object_t *outer_lexical_environment_p, size_t lexical_env_size);
 bool JJS_ATTR_PURE ecma_is_lexical_environment (const ecma_object_t *object_p);
@@ -498,12 +500,19 @@ ecma_value_t ecma_create_exception_from_object (ecma_context_t *context_p, ecma_
 void ecma_throw_exception (ecma_context_t *context_p, ecma_value_t value);
 
 void ecma_script_deref (ecma_context_t *context_p, ecma_value_t script_value);
+#if JJS_SNAPSHOT_EXEC
+struct cbc_snapshot_mapping_t;
+void ecma_snapshot_mapping_deref (ecma_context_t *context_p, struct cbc_snapshot_mapping_t *mapping_p);
+void ecma_snapshot_mapping_finalize (ecma_context_t *context_p);
+#endif /* JJS_SNAPSHOT_EXEC */
 void ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p);
 void ecma_bytecode_deref (ecma_context_t *context_p, ecma_compiled_code_t *bytecode_p);
 ecma_value_t ecma_script_get_from_value (ecma_context_t *context_p, ecma_value_t value);
 ecma_value_t *ecma_compiled_code_resolve_arguments_start (const ecma_compiled_code_t *bytecode_header_p);
 ecma_value_t *ecma_compiled_code_resolve_function_name (const ecma_compiled_code_t *bytecode_header_p);
 ecma_collection_t *ecma_compiled_code_get_tagged_template_collection (ecma_context_t *context_p, const ecma_compiled_code_t *bytecode_header_p);
+uint32_t ecma_compiled_code_get_slot_table_size (const ecma_compiled_code_t *bytecode_header_p);
+uint16_t *ecma_compiled_code_resolve_slot_table (const ecma_compiled_code_t *bytecode_header_p);
 #if JJS_LINE_INFO
 uint8_t *ecma_compiled_code_get_line_info (ecma_context_t *context_p, const ecma_compiled_code_t *bytecode_header_p);
 #endif /* JJS_LINE_INFO */
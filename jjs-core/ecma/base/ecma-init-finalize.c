@@ -15,6 +15,7 @@
 
 #include "ecma-init-finalize.h"
 
+#include "ecma-alloc.h"
 #include "ecma-builtins.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -23,6 +24,7 @@
 
 #include "jcontext.h"
 #include "jmem.h"
+#include "vm.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -42,6 +44,18 @@
  */
 #define ECMA_STRING_LITERAL_POOL_SIZE (1024)
 
+/**
+ * Initial capacity of the float number literal pool.
+ */
+#define ECMA_NUMBER_LITERAL_POOL_SIZE (64)
+
+#if JJS_BUILTIN_BIGINT
+/**
+ * Initial capacity of the BigInt literal pool.
+ */
+#define ECMA_BIGINT_LITERAL_POOL_SIZE (16)
+#endif /* JJS_BUILTIN_BIGINT */
+
 /**
  * Initialize ECMA components
  */
@@ -58,6 +72,18 @@ ecma_init (ecma_context_t *context_p)
                                          &context_p->vm_allocator,
                                          ECMA_STRING_LITERAL_POOL_SIZE);
 
+  hashset_init = hashset_init && ecma_hashset_init (&context_p->number_literal_pool,
+                                                    context_p,
+                                                    &context_p->vm_allocator,
+                                                    ECMA_NUMBER_LITERAL_POOL_SIZE);
+
+#if JJS_BUILTIN_BIGINT
+  hashset_init = hashset_init && ecma_hashset_init (&context_p->bigint_literal_pool,
+                                                    context_p,
+                                                    &context_p->vm_allocator,
+                                                    ECMA_BIGINT_LITERAL_POOL_SIZE);
+#endif /* JJS_BUILTIN_BIGINT */
+
   JJS_ASSERT (hashset_init);
 
   if (!hashset_init)
@@ -95,6 +121,13 @@ ecma_finalize (ecma_context_t *context_p)
 {
   JJS_ASSERT (context_p->current_new_target_p == NULL);
 
+#if JJS_CPU_PROFILER
+  if (context_p->vm_profiler_p != NULL)
+  {
+    vm_profiler_stop (context_p, NULL);
+  }
+#endif /* JJS_CPU_PROFILER */
+
   ecma_finalize_global_environment (context_p);
   uint8_t runs = 0;
 
@@ -107,6 +140,8 @@ ecma_finalize (ecma_context_t *context_p)
     }
   } while (context_p->ecma_gc_new_objects != 0);
 
+  ecma_gc_finalize (context_p);
+
   jmem_cpointer_t *global_symbols_cp = context_p->global_symbols_cp;
 
   for (uint32_t i = 0; i < ECMA_BUILTIN_GLOBAL_SYMBOL_COUNT; i++)
@@ -117,7 +152,16 @@ ecma_finalize (ecma_context_t *context_p)
     }
   }
 
+#if JJS_BUILTIN_REGEXP
+  re_cache_finalize (context_p);
+#endif /* JJS_BUILTIN_REGEXP */
+
   ecma_finalize_lit_storage (context_p);
+  ecma_free_number_cache (context_p);
+
+#if JJS_SNAPSHOT_EXEC
+  ecma_snapshot_mapping_finalize (context_p);
+#endif /* JJS_SNAPSHOT_EXEC */
 } /* ecma_finalize */
 
 /**
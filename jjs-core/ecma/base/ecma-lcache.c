@@ -32,17 +32,24 @@
 
 /**
  * Bitshift index for calculating hash.
+ *
+ * Note:
+ *   compressed pointers are heap offsets divided by JMEM_ALIGNMENT, except when they store
+ *   the pointer value directly, in which case the low bits are always zero
  */
-#if JJS_CPOINTER_32_BIT
-#define ECMA_LCACHE_HASH_BITSHIFT_INDEX (2 * JMEM_ALIGNMENT_LOG)
-#else /* !JJS_CPOINTER_32_BIT */
+#if defined(ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && JJS_CPOINTER_32_BIT
+#define ECMA_LCACHE_HASH_BITSHIFT_INDEX JMEM_ALIGNMENT_LOG
+#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JJS_CPOINTER_32_BIT */
 #define ECMA_LCACHE_HASH_BITSHIFT_INDEX 0
-#endif /* JJS_CPOINTER_32_BIT */
+#endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY && JJS_CPOINTER_32_BIT */
 
 /**
- * Mask for hash bits
+ * Number of bits used for the row index
  */
-#define ECMA_LCACHE_HASH_MASK ((ECMA_LCACHE_HASH_ROWS_COUNT - 1) << ECMA_LCACHE_HASH_BITSHIFT_INDEX)
+#define ECMA_LCACHE_HASH_ROW_BITS 7
+
+JJS_STATIC_ASSERT (ECMA_LCACHE_HASH_ROWS_COUNT == (1 << ECMA_LCACHE_HASH_ROW_BITS),
+                   ecma_lcache_hash_row_bits_must_match_rows_count);
 
 /**
  * Bitshift index for creating property identifier
@@ -79,8 +86,12 @@ ecma_lcache_row_index (jmem_cpointer_t object_cp, /**< compressed pointer to obj
                        jmem_cpointer_t name_cp) /**< compressed pointer to property name */
 {
   /* Randomize the property name with the object pointer using a xor operation,
-   * so properties of different objects with the same name can be cached effectively. */
-  return (size_t) (((name_cp ^ object_cp) & ECMA_LCACHE_HASH_MASK) >> ECMA_LCACHE_HASH_BITSHIFT_INDEX);
+   * so properties of different objects with the same name can be cached effectively.
+   * Objects are at least two units apart, and the upper bits are folded into the index,
+   * so names allocated close to each other (e.g. the variables of a scope) do not
+   * share the same row. */
+  size_t hash = (size_t) ((name_cp ^ (object_cp >> 1)) >> ECMA_LCACHE_HASH_BITSHIFT_INDEX);
+  return (hash ^ (hash >> ECMA_LCACHE_HASH_ROW_BITS)) & (ECMA_LCACHE_HASH_ROWS_COUNT - 1);
 } /* ecma_lcache_row_index */
 
 /**
@@ -58,63 +58,6 @@ ecma_free_symbol_list (ecma_context_t *context_p, /**< JJS context */
   }
 } /* ecma_free_symbol_list */
 
-/**
- * Free number list
- */
-static void
-ecma_free_number_list (ecma_context_t *context_p, /**< JJS context */
-                       jmem_cpointer_t number_list_cp) /**< number list */
-{
-  while (number_list_cp != JMEM_CP_NULL)
-  {
-    ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_lit_storage_item_t, number_list_cp);
-
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (number_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_dealloc_number (context_p, JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_number_t, number_list_p->values[i]));
-      }
-    }
-
-    jmem_cpointer_t next_item_cp = number_list_p->next_cp;
-    jmem_heap_free_block (context_p, number_list_p, sizeof (ecma_lit_storage_item_t));
-    number_list_cp = next_item_cp;
-  }
-} /* ecma_free_number_list */
-
-#if JJS_BUILTIN_BIGINT
-
-/**
- * Free bigint list
- */
-static void
-ecma_free_bigint_list (ecma_context_t *context_p, /**< JJS context */
-                       jmem_cpointer_t bigint_list_cp) /**< bigint list */
-{
-  while (bigint_list_cp != JMEM_CP_NULL)
-  {
-    ecma_lit_storage_item_t *bigint_list_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_lit_storage_item_t, bigint_list_cp);
-
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (bigint_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_extended_primitive_t *bigint_p =
-          JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_extended_primitive_t, bigint_list_p->values[i]);
-        JJS_ASSERT (ECMA_EXTENDED_PRIMITIVE_IS_REF_EQUALS_TO_ONE (bigint_p));
-        ecma_deref_bigint (context_p, bigint_p);
-      }
-    }
-
-    jmem_cpointer_t next_item_cp = bigint_list_p->next_cp;
-    jmem_heap_free_block (context_p, bigint_list_p, sizeof (ecma_lit_storage_item_t));
-    bigint_list_cp = next_item_cp;
-  }
-} /* ecma_free_bigint_list */
-
-#endif /* JJS_BUILTIN_BIGINT */
-
 /**
  * Finalize literal storage
  */
@@ -123,9 +66,9 @@ ecma_finalize_lit_storage (ecma_context_t *context_p) /**< JJS context */
 {
   ecma_free_symbol_list (context_p, context_p->symbol_list_first_cp);
   ecma_hashset_free (&context_p->string_literal_pool);
-  ecma_free_number_list (context_p, context_p->number_list_first_cp);
+  ecma_hashset_free (&context_p->number_literal_pool);
 #if JJS_BUILTIN_BIGINT
-  ecma_free_bigint_list (context_p, context_p->bigint_list_first_cp);
+  ecma_hashset_free (&context_p->bigint_literal_pool);
 #endif /* JJS_BUILTIN_BIGINT */
 } /* ecma_finalize_lit_storage */
 
@@ -233,64 +176,23 @@ ecma_find_or_create_literal_number (ecma_context_t *context_p, /**< JJS context
     return ecma_make_int32_value (context_p, int_num);
   }
 
-  jmem_cpointer_t number_list_cp = context_p->number_list_first_cp;
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  ecma_value_t num = ecma_hashset_get_number (&context_p->number_literal_pool, number_arg);
 
-  while (number_list_cp != JMEM_CP_NULL)
+  if (num != ECMA_VALUE_NOT_FOUND)
   {
-    ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_lit_storage_item_t, number_list_cp);
-
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_number_t, number_list_p->values[i]);
-
-        if (*number_p == number_arg)
-        {
-          return ecma_make_float_value (context_p, number_p);
-        }
-      }
-    }
-
-    number_list_cp = number_list_p->next_cp;
-  }
-
-  ecma_value_t num = ecma_make_number_value (context_p, number_arg);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (context_p, result, ecma_get_pointer_from_float_value (context_p, num));
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
     return num;
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_heap_alloc_block_null_on_error (
-    context_p, sizeof (ecma_lit_storage_item_t));
+  num = ecma_make_number_value (context_p, number_arg);
+  JJS_ASSERT (ecma_is_value_float_number (num));
 
-  if (!new_item_p)
+  /* transfer ownership of the number to the pool, not caller! */
+  if (!ecma_hashset_insert (&context_p->number_literal_pool, num, true))
   {
+    ecma_free_value (context_p, num);
     return ECMA_VALUE_EMPTY;
   }
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = context_p->number_list_first_cp;
-  JMEM_CP_SET_NON_NULL_POINTER (context_p, context_p->number_list_first_cp, new_item_p);
-
   return num;
 } /* ecma_find_or_create_literal_number */
 
@@ -312,66 +214,21 @@ ecma_find_or_create_literal_bigint (ecma_context_t *context_p, /**< JJS context
     return bigint;
   }
 
-  jmem_cpointer_t bigint_list_cp = context_p->bigint_list_first_cp;
-  jmem_cpointer_t *empty_cpointer_p = NULL;
-
-  while (bigint_list_cp != JMEM_CP_NULL)
-  {
-    ecma_lit_storage_item_t *bigint_list_p = JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_lit_storage_item_t, bigint_list_cp);
-
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (bigint_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = bigint_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_extended_primitive_t *other_bigint_p =
-          JMEM_CP_GET_NON_NULL_POINTER (context_p, ecma_extended_primitive_t, bigint_list_p->values[i]);
-        ecma_value_t other_bigint = ecma_make_extended_primitive_value (context_p, other_bigint_p, ECMA_TYPE_BIGINT);
-
-        if (ecma_bigint_is_equal_to_bigint (context_p, bigint, other_bigint))
-        {
-          ecma_free_value (context_p, bigint);
-          return other_bigint;
-        }
-      }
-    }
-
-    bigint_list_cp = bigint_list_p->next_cp;
-  }
-
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (context_p, result, ecma_get_extended_primitive_from_value (context_p, bigint));
+  ecma_value_t existing = ecma_hashset_get (&context_p->bigint_literal_pool, bigint);
 
-  if (empty_cpointer_p != NULL)
+  if (existing != ECMA_VALUE_NOT_FOUND)
   {
-    *empty_cpointer_p = result;
-    return bigint;
+    ecma_free_value (context_p, bigint);
+    return existing;
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_heap_alloc_block_null_on_error (
-    context_p, sizeof (ecma_lit_storage_item_t));
-
-  if (!new_item_p)
+  /* transfer ownership of the bigint to the pool, not caller! */
+  if (!ecma_hashset_insert (&context_p->bigint_literal_pool, bigint, true))
   {
+    ecma_free_value (context_p, bigint);
     return ECMA_VALUE_EMPTY;
   }
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = context_p->bigint_list_first_cp;
-  JMEM_CP_SET_NON_NULL_POINTER (context_p, context_p->bigint_list_first_cp, new_item_p);
-
   return bigint;
 } /* ecma_find_or_create_literal_bigint */
 
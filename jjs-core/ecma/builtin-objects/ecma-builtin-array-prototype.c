@@ -453,6 +453,31 @@ ecma_builtin_array_prototype_object_push (ecma_context_t *context_p, /**< JJS co
     }
 
     uint32_t new_length = ((uint32_t) length) + arguments_number;
+
+    if (ecma_fast_array_has_double_elements (obj_p)
+        || (ecma_is_value_float_number (argument_list_p[0])
+            && ecma_fast_array_convert_to_double (context_p, obj_p, true)))
+    {
+      uint32_t index = 0;
+
+      while (index < arguments_number && ecma_is_value_number (argument_list_p[index]))
+      {
+        index++;
+      }
+
+      if (index == arguments_number)
+      {
+        ecma_number_t *numbers_p = ecma_fast_array_extend_double (context_p, obj_p, new_length) + length;
+
+        for (index = 0; index < arguments_number; index++)
+        {
+          numbers_p[index] = ecma_get_number_from_value (context_p, argument_list_p[index]);
+        }
+
+        return ecma_make_uint32_value (context_p, new_length);
+      }
+    }
+
     ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
     ecma_value_t *buffer_p = ecma_fast_array_extend (context_p, obj_p, new_length) + length;
 
@@ -517,6 +542,20 @@ ecma_builtin_array_prototype_object_reverse (ecma_context_t *context_p, /**< JJS
 
     if (ext_obj_p->u.array.length_prop_and_hole_count < ECMA_FAST_ARRAY_HOLE_ONE && len != 0)
     {
+      if (ecma_fast_array_has_double_elements (obj_p))
+      {
+        ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+        for (uint32_t i = 0; i < middle; i++)
+        {
+          ecma_number_t tmp = numbers_p[i];
+          numbers_p[i] = numbers_p[len - 1 - i];
+          numbers_p[len - 1 - i] = tmp;
+        }
+
+        return ecma_copy_value (context_p, this_arg);
+      }
+
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
       for (uint32_t i = 0; i < middle; i++)
@@ -678,6 +717,17 @@ ecma_builtin_array_prototype_object_shift (ecma_context_t *context_p, /**< JJS c
 
     if (ext_obj_p->u.array.length_prop_and_hole_count < ECMA_FAST_ARRAY_HOLE_ONE && len != 0)
     {
+      if (ecma_fast_array_has_double_elements (obj_p))
+      {
+        ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+        ecma_value_t ret_value = ecma_make_number_value (context_p, numbers_p[0]);
+
+        memmove (numbers_p, numbers_p + 1, (size_t) (sizeof (ecma_number_t) * (len - 1)));
+        ecma_delete_fast_array_properties (context_p, obj_p, (uint32_t) (len - 1));
+
+        return ret_value;
+      }
+
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
       ecma_value_t ret_value = buffer_p[0];
 
@@ -835,6 +885,7 @@ ecma_builtin_array_prototype_object_slice (ecma_context_t *context_p, /**< JJS c
       }
 
       ecma_extended_object_t *ext_to_obj_p = (ecma_extended_object_t *) new_array_p;
+      ecma_fast_array_convert_to_generic (context_p, new_array_p);
 
       uint32_t target_length = ext_to_obj_p->u.array.length;
       ecma_value_t *to_buffer_p;
@@ -854,15 +905,29 @@ ecma_builtin_array_prototype_object_slice (ecma_context_t *context_p, /**< JJS c
         to_buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, new_array_p->u1.property_list_cp);
       }
 
-      ecma_value_t *from_buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
-
       /* 9. */
       uint32_t n = 0;
 
-      for (uint32_t k = (uint32_t) start; k < (uint32_t) end; k++, n++)
+      if (ecma_fast_array_has_double_elements (obj_p))
       {
-        ecma_free_value_if_not_object (context_p, to_buffer_p[n]);
-        to_buffer_p[n] = ecma_copy_value_if_not_object (context_p, from_buffer_p[k]);
+        ecma_number_t *from_numbers_p =
+          ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+        for (uint32_t k = (uint32_t) start; k < (uint32_t) end; k++, n++)
+        {
+          ecma_free_value_if_not_object (context_p, to_buffer_p[n]);
+          to_buffer_p[n] = ecma_make_number_value (context_p, from_numbers_p[k]);
+        }
+      }
+      else
+      {
+        ecma_value_t *from_buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
+
+        for (uint32_t k = (uint32_t) start; k < (uint32_t) end; k++, n++)
+        {
+          ecma_free_value_if_not_object (context_p, to_buffer_p[n]);
+          to_buffer_p[n] = ecma_copy_value_if_not_object (context_p, from_buffer_p[k]);
+        }
       }
 
       ext_to_obj_p->u.array.length_prop_and_hole_count &= ECMA_FAST_ARRAY_HOLE_ONE - 1;
@@ -1027,6 +1092,157 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_context_t *context
   return ecma_make_number_value (context_p, result);
 } /* ecma_builtin_array_prototype_object_sort_compare_helper */
 
+/**
+ * Compare two numbers by their string representations, which is the default sort order of arrays.
+ *
+ * @return true - if the string of the left number is less than or equal to the string of the right number,
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_array_prototype_number_string_less_or_equal (ecma_number_t left, /**< left number */
+                                                           ecma_number_t right) /**< right number */
+{
+  if (left == right)
+  {
+    /* Equal numbers (including -0 and +0) have the same string. */
+    return true;
+  }
+
+  lit_utf8_byte_t left_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  lit_utf8_byte_t right_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+
+  lit_utf8_size_t left_size = ecma_number_to_utf8_string (left, left_buffer, sizeof (left_buffer));
+  lit_utf8_size_t right_size = ecma_number_to_utf8_string (right, right_buffer, sizeof (right_buffer));
+
+  /* Number strings are ASCII, so comparing the bytes matches comparing the code units. */
+  int result = memcmp (left_buffer, right_buffer, JJS_MIN (left_size, right_size));
+  return (result < 0) || (result == 0 && left_size <= right_size);
+} /* ecma_builtin_array_prototype_number_string_less_or_equal */
+
+/**
+ * Sort unboxed numbers in the default (string) order with a stable bottom-up merge sort.
+ */
+static void
+ecma_builtin_array_prototype_sort_numbers (ecma_number_t *numbers_p, /**< numbers to sort */
+                                           ecma_number_t *temp_p, /**< buffer of the same length */
+                                           uint32_t length) /**< number of elements */
+{
+  ecma_number_t *source_p = numbers_p;
+  ecma_number_t *dest_p = temp_p;
+
+  for (uint32_t width = 1; width < length; width *= 2)
+  {
+    for (uint32_t start = 0; start < length; start += 2 * width)
+    {
+      uint32_t middle = JJS_MIN (start + width, length);
+      uint32_t end = JJS_MIN (start + 2 * width, length);
+      uint32_t i = start;
+      uint32_t j = middle;
+
+      for (uint32_t k = start; k < end; k++)
+      {
+        if (i < middle
+            && (j >= end || ecma_builtin_array_prototype_number_string_less_or_equal (source_p[i], source_p[j])))
+        {
+          dest_p[k] = source_p[i++];
+        }
+        else
+        {
+          dest_p[k] = source_p[j++];
+        }
+      }
+    }
+
+    ecma_number_t *swap_p = source_p;
+    source_p = dest_p;
+    dest_p = swap_p;
+  }
+
+  if (source_p != numbers_p)
+  {
+    memcpy (numbers_p, source_p, length * sizeof (ecma_number_t));
+  }
+} /* ecma_builtin_array_prototype_sort_numbers */
+
+/**
+ * The Array.prototype object's 'sort' routine for fast access mode arrays with double elements
+ *
+ * Note: the array has no holes, so the elements are copied directly
+ *       instead of collecting the existing array indices
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_array_prototype_object_sort_double (ecma_context_t *context_p, /**< JJS context */
+                                                 ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t compare_func, /**< comparefn */
+                                                 ecma_object_t *obj_p) /**< fast access mode array */
+{
+  const uint32_t length = ((ecma_extended_object_t *) obj_p)->u.array.length;
+  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+
+  if (length < 2)
+  {
+    return ecma_copy_value (context_p, this_arg);
+  }
+
+  ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+  if (ecma_is_value_undefined (compare_func))
+  {
+    /* No script code runs during the sort, so the numbers are sorted in place without boxing. */
+    JMEM_DEFINE_LOCAL_ARRAY (context_p, temp_buffer, length, ecma_number_t);
+    ecma_builtin_array_prototype_sort_numbers (numbers_p, temp_buffer, length);
+    JMEM_FINALIZE_LOCAL_ARRAY (context_p, temp_buffer);
+
+    return ecma_copy_value (context_p, this_arg);
+  }
+
+  JMEM_DEFINE_LOCAL_ARRAY (context_p, values_buffer, length, ecma_value_t);
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    values_buffer[i] = ecma_make_number_value (context_p, numbers_p[i]);
+  }
+
+  const ecma_builtin_helper_sort_compare_fn_t sort_cb = &ecma_builtin_array_prototype_object_sort_compare_helper;
+  ret_value =
+    ecma_builtin_helper_array_merge_sort_helper (context_p, values_buffer, length, compare_func, sort_cb, NULL);
+
+  if (!ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    ecma_free_value (context_p, ret_value);
+    ret_value = ECMA_VALUE_EMPTY;
+
+    /* The compare function may change the array, so the sorted values are stored with [[Set]]. */
+    for (uint32_t index = 0; index < length; index++)
+    {
+      ecma_value_t put_value = ecma_op_object_put_by_index (context_p, obj_p, index, values_buffer[index], true);
+
+      if (ECMA_IS_VALUE_ERROR (put_value))
+      {
+        ret_value = put_value;
+        break;
+      }
+    }
+  }
+
+  for (uint32_t index = 0; index < length; index++)
+  {
+    ecma_free_value (context_p, values_buffer[index]);
+  }
+
+  JMEM_FINALIZE_LOCAL_ARRAY (context_p, values_buffer);
+
+  if (ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    return ret_value;
+  }
+
+  return ecma_copy_value (context_p, this_arg);
+} /* ecma_builtin_array_prototype_object_sort_double */
+
 /**
  * The Array.prototype object's 'sort' routine
  *
@@ -1055,6 +1271,12 @@ ecma_builtin_array_prototype_object_sort (ecma_context_t *context_p, /**< JJS co
   {
     return len_value;
   }
+
+  if (ecma_op_object_is_fast_array (obj_p) && ecma_fast_array_has_double_elements (obj_p))
+  {
+    return ecma_builtin_array_prototype_object_sort_double (context_p, this_arg, arg1, obj_p);
+  }
+
   ecma_collection_t *array_index_props_p = ecma_new_collection (context_p);
 
   for (uint32_t i = 0; i < len; i++)
@@ -1613,6 +1835,29 @@ ecma_builtin_array_prototype_object_index_of (ecma_context_t *context_p, /**< JJ
 
       len = JJS_MIN (ext_obj_p->u.array.length, len);
 
+      if (ecma_fast_array_has_double_elements (obj_p))
+      {
+        if (!ecma_is_value_number (args[0]))
+        {
+          return ecma_make_integer_value (-1);
+        }
+
+        ecma_number_t search_num = ecma_get_number_from_value (context_p, args[0]);
+        ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+        while (from_idx < len)
+        {
+          if (numbers_p[from_idx] == search_num)
+          {
+            return ecma_make_uint32_value (context_p, (uint32_t) from_idx);
+          }
+
+          from_idx++;
+        }
+
+        return ecma_make_integer_value (-1);
+      }
+
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
       while (from_idx < len)
@@ -1719,6 +1964,27 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_context_t *context_p, /*
 
       len = JJS_MIN (ext_obj_p->u.array.length, len);
 
+      if (ecma_fast_array_has_double_elements (obj_p))
+      {
+        if (!ecma_is_value_number (search_element))
+        {
+          return ecma_make_integer_value (-1);
+        }
+
+        ecma_number_t search_num = ecma_get_number_from_value (context_p, search_element);
+        ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+        while (from_idx < len)
+        {
+          if (numbers_p[from_idx] == search_num)
+          {
+            return ecma_make_uint32_value (context_p, (uint32_t) from_idx);
+          }
+          from_idx--;
+        }
+        return ecma_make_integer_value (-1);
+      }
+
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
       while (from_idx < len)
@@ -2163,6 +2429,34 @@ ecma_builtin_array_reduce_from (ecma_context_t *context_p, /**< JJS context */
   return accumulator;
 } /* ecma_builtin_array_reduce_from */
 
+/**
+ * Fill the unboxed double elements of a fast access mode array with a number
+ */
+static void
+ecma_builtin_array_prototype_fill_double (ecma_context_t *context_p, /**< JJS context */
+                                          ecma_object_t *obj_p, /**< fast access mode array with double elements */
+                                          ecma_value_t value, /**< number value */
+                                          ecma_length_t k, /**< start index */
+                                          ecma_length_t final) /**< end index */
+{
+  JJS_ASSERT (ecma_fast_array_has_double_elements (obj_p) && ecma_is_value_number (value));
+
+  final = JJS_MIN (final, ((ecma_extended_object_t *) obj_p)->u.array.length);
+
+  if (k >= final)
+  {
+    return;
+  }
+
+  ecma_number_t num = ecma_get_number_from_value (context_p, value);
+  ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+  while (k < final)
+  {
+    numbers_p[k++] = num;
+  }
+} /* ecma_builtin_array_prototype_fill_double */
+
 /**
  * The Array.prototype object's 'fill' routine
  *
@@ -2208,6 +2502,17 @@ ecma_builtin_array_prototype_fill (ecma_context_t *context_p, /**< JJS context *
   {
     ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) obj_p;
 
+    /* Filling the whole array with a number replaces all elements, including the holes. */
+    if (ecma_is_value_number (value) && k == 0 && final == ext_obj_p->u.array.length
+        && (ecma_fast_array_has_double_elements (obj_p)
+            || (ecma_is_value_float_number (value) && ecma_fast_array_convert_to_double (context_p, obj_p, false))))
+    {
+      ecma_builtin_array_prototype_fill_double (context_p, obj_p, value, k, final);
+
+      ecma_ref_object (obj_p);
+      return ecma_make_object_value (context_p, obj_p);
+    }
+
     if (ext_obj_p->u.array.length_prop_and_hole_count < ECMA_FAST_ARRAY_HOLE_ONE)
     {
       if (JJS_UNLIKELY (obj_p->u1.property_list_cp == JMEM_CP_NULL))
@@ -2216,6 +2521,19 @@ ecma_builtin_array_prototype_fill (ecma_context_t *context_p, /**< JJS context *
         return ecma_make_object_value (context_p, obj_p);
       }
 
+      if (ecma_fast_array_has_double_elements (obj_p))
+      {
+        if (ecma_is_value_number (value))
+        {
+          ecma_builtin_array_prototype_fill_double (context_p, obj_p, value, k, final);
+
+          ecma_ref_object (obj_p);
+          return ecma_make_object_value (context_p, obj_p);
+        }
+
+        ecma_fast_array_convert_to_generic (context_p, obj_p);
+      }
+
       ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
       while (k < final)
@@ -2491,6 +2809,7 @@ ecma_builtin_array_prototype_object_copy_within (ecma_context_t *context_p, /**<
     {
       if (obj_p->u1.property_list_cp != JMEM_CP_NULL)
       {
+        ecma_fast_array_convert_to_generic (context_p, obj_p);
         ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
         for (; count > 0; count--)
@@ -2609,6 +2928,30 @@ ecma_builtin_array_prototype_includes (ecma_context_t *context_p, /**< JJS conte
       {
         len = JJS_MIN (ext_obj_p->u.array.length, len);
 
+        if (ecma_fast_array_has_double_elements (obj_p))
+        {
+          if (!ecma_is_value_number (args[0]))
+          {
+            return ECMA_VALUE_FALSE;
+          }
+
+          ecma_number_t search_num = ecma_get_number_from_value (context_p, args[0]);
+          ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, obj_p->u1.property_list_cp);
+
+          while (from_index < len)
+          {
+            if (numbers_p[from_index] == search_num
+                || (ecma_number_is_nan (search_num) && ecma_number_is_nan (numbers_p[from_index])))
+            {
+              return ECMA_VALUE_TRUE;
+            }
+
+            from_index++;
+          }
+
+          return ECMA_VALUE_FALSE;
+        }
+
         ecma_value_t *buffer_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, obj_p->u1.property_list_cp);
 
         while (from_index < len)
@@ -265,6 +265,215 @@ ecma_date_week_day (ecma_number_t time) /**< time value */
   return week_day >= 0 ? week_day : week_day + 7;
 } /* ecma_date_week_day */
 
+/**
+ * Distance of the time values probed around a time value missing from the local time zone
+ * adjustment cache. Time zone rules are assumed to change the adjustment at most once in a
+ * range of this size, so equal adjustments at both ends mean no transition in between.
+ */
+#define ECMA_DATE_TZA_PROBE_DISTANCE (16.0 * ECMA_DATE_MS_PER_DAY)
+
+/**
+ * Find the last time value with the given local time zone adjustment between a time value
+ * which has this adjustment and another one which has not, which can be on either side.
+ *
+ * @return the last time value with the adjustment, when moving from same_time towards other_time
+ */
+static ecma_number_t
+ecma_date_find_tza_transition (ecma_context_t *context_p, /**< JJS context */
+                               ecma_number_t same_time, /**< time value with the adjustment */
+                               ecma_number_t other_time, /**< time value with a different adjustment */
+                               int32_t tza) /**< local time zone adjustment */
+{
+  while (fabs (other_time - same_time) > 1)
+  {
+    ecma_number_t middle_time = floor ((same_time + other_time) / 2);
+    int32_t middle_tza;
+
+    if (jjs_platform_time_local_tza_impl (context_p, middle_time, &middle_tza) == JJS_STATUS_OK && middle_tza == tza)
+    {
+      same_time = middle_time;
+    }
+    else
+    {
+      other_time = middle_time;
+    }
+  }
+
+  return same_time;
+} /* ecma_date_find_tza_transition */
+
+/**
+ * Insert a range of time values with the same local time zone adjustment into the cache,
+ * replacing the oldest entry if the cache is full.
+ *
+ * @return index of the new cache entry
+ */
+static uint32_t
+ecma_date_insert_tza_cache_entry (ecma_context_t *context_p, /**< JJS context */
+                                  ecma_number_t start, /**< first time value of the range */
+                                  ecma_number_t end, /**< last time value of the range */
+                                  int32_t tza) /**< local time zone adjustment */
+{
+  uint32_t index = context_p->date_tza_cache_next;
+
+  context_p->date_tza_cache_next = (index + 1) % ECMA_DATE_TZA_CACHE_SIZE;
+
+  if (context_p->date_tza_cache_count < ECMA_DATE_TZA_CACHE_SIZE)
+  {
+    context_p->date_tza_cache_count++;
+  }
+
+  context_p->date_tza_cache[index].start = start;
+  context_p->date_tza_cache[index].end = end;
+  context_p->date_tza_cache[index].tza = tza;
+
+  return index;
+} /* ecma_date_insert_tza_cache_entry */
+
+/**
+ * Extend a cache entry towards a time value, which is outside of the entry but at most
+ * ECMA_DATE_TZA_PROBE_DISTANCE away from it. The entry grows by the probe distance if the
+ * adjustment is the same there, otherwise it grows up to the transition, and the range
+ * between the transition and the probed time value is cached as a new entry.
+ *
+ * @return true - if the time value is cached after the extension,
+ *         false - otherwise
+ */
+static bool
+ecma_date_extend_tza_cache_entry (ecma_context_t *context_p, /**< JJS context */
+                                  uint32_t index, /**< index of the cache entry */
+                                  ecma_number_t time) /**< time value */
+{
+  ecma_date_tza_cache_entry_t *entry_p = context_p->date_tza_cache + index;
+  bool forward = time > entry_p->end;
+  ecma_number_t edge = forward ? entry_p->end : entry_p->start;
+  ecma_number_t probe_time = forward ? edge + ECMA_DATE_TZA_PROBE_DISTANCE : edge - ECMA_DATE_TZA_PROBE_DISTANCE;
+  int32_t probe_tza;
+  bool probe_valid = jjs_platform_time_local_tza_impl (context_p, probe_time, &probe_tza) == JJS_STATUS_OK;
+
+  if (probe_valid && probe_tza == entry_p->tza)
+  {
+    edge = probe_time;
+    probe_valid = false;
+  }
+  else
+  {
+    edge = ecma_date_find_tza_transition (context_p, edge, probe_time, entry_p->tza);
+  }
+
+  if (forward)
+  {
+    entry_p->end = edge;
+  }
+  else
+  {
+    entry_p->start = edge;
+  }
+
+  bool in_entry = forward ? time <= edge : time >= edge;
+
+  if (probe_valid)
+  {
+    /* The adjustment of the probed time value holds from the transition onwards. */
+    uint32_t new_index = (forward ? ecma_date_insert_tza_cache_entry (context_p, edge + 1, probe_time, probe_tza)
+                                  : ecma_date_insert_tza_cache_entry (context_p, probe_time, edge - 1, probe_tza));
+
+    if (!in_entry)
+    {
+      context_p->date_tza_cache_last = new_index;
+      return true;
+    }
+
+    if (new_index == index)
+    {
+      /* The extended entry has been replaced, so the time value is no longer cached. */
+      return false;
+    }
+  }
+
+  if (in_entry)
+  {
+    context_p->date_tza_cache_last = index;
+  }
+
+  return in_entry;
+} /* ecma_date_extend_tza_cache_entry */
+
+/**
+ * Query the local time zone adjustment of a time value which is not in the cache,
+ * and cache the range of time values around it with the same adjustment.
+ *
+ * A time value close to a cached range extends that range, so consecutive time values
+ * need one platform call per ECMA_DATE_TZA_PROBE_DISTANCE, and a bisection per transition.
+ *
+ * @return local time zone adjustment
+ */
+static int32_t JJS_ATTR_NOINLINE
+ecma_date_local_time_zone_adjustment_slow (ecma_context_t *context_p, /**< JJS context */
+                                           ecma_number_t time) /**< time value */
+{
+  ecma_date_tza_cache_entry_t *cache_p = context_p->date_tza_cache;
+
+  for (uint32_t i = 0; i < context_p->date_tza_cache_count; i++)
+  {
+    if (time >= cache_p[i].start && time <= cache_p[i].end)
+    {
+      context_p->date_tza_cache_last = i;
+      return cache_p[i].tza;
+    }
+  }
+
+  int32_t tza;
+
+  if (!ecma_number_is_finite (time))
+  {
+    return (jjs_platform_time_local_tza_impl (context_p, time, &tza) == JJS_STATUS_OK) ? tza : 0;
+  }
+
+  uint32_t nearest_index = ECMA_DATE_TZA_CACHE_SIZE;
+  ecma_number_t nearest_distance = ECMA_DATE_TZA_PROBE_DISTANCE;
+
+  /* Only the nearest entry is extended, the others are separated from the time value by it. */
+  for (uint32_t i = 0; i < context_p->date_tza_cache_count; i++)
+  {
+    ecma_number_t distance = (time > cache_p[i].end) ? time - cache_p[i].end : cache_p[i].start - time;
+
+    if (distance <= nearest_distance)
+    {
+      nearest_index = i;
+      nearest_distance = distance;
+    }
+  }
+
+  if (nearest_index < ECMA_DATE_TZA_CACHE_SIZE && ecma_date_extend_tza_cache_entry (context_p, nearest_index, time))
+  {
+    return cache_p[context_p->date_tza_cache_last].tza;
+  }
+
+  if (jjs_platform_time_local_tza_impl (context_p, time, &tza) != JJS_STATUS_OK)
+  {
+    return 0;
+  }
+
+  ecma_number_t base_time = floor (time);
+  ecma_number_t start = base_time - ECMA_DATE_TZA_PROBE_DISTANCE;
+  ecma_number_t end = base_time + ECMA_DATE_TZA_PROBE_DISTANCE;
+  int32_t probe_tza;
+
+  if (jjs_platform_time_local_tza_impl (context_p, end, &probe_tza) != JJS_STATUS_OK || probe_tza != tza)
+  {
+    end = ecma_date_find_tza_transition (context_p, base_time, end, tza);
+  }
+
+  if (jjs_platform_time_local_tza_impl (context_p, start, &probe_tza) != JJS_STATUS_OK || probe_tza != tza)
+  {
+    start = ecma_date_find_tza_transition (context_p, base_time, start, tza);
+  }
+
+  context_p->date_tza_cache_last = ecma_date_insert_tza_cache_entry (context_p, start, end, tza);
+  return tza;
+} /* ecma_date_local_time_zone_adjustment_slow */
+
 /**
  * Abstract operation: LocalTZA
  *
@@ -277,12 +486,27 @@ extern inline int32_t JJS_ATTR_ALWAYS_INLINE
 ecma_date_local_time_zone_adjustment (ecma_context_t *context_p, /**< JJS context */
                                       ecma_number_t time) /**< time value */
 {
-  int32_t tza;
-  jjs_status_t status = jjs_platform_time_local_tza_impl(context_p, time, &tza);
+  const ecma_date_tza_cache_entry_t *entry_p = context_p->date_tza_cache + context_p->date_tza_cache_last;
+
+  if (context_p->date_tza_cache_count > 0 && time >= entry_p->start && time <= entry_p->end)
+  {
+    return entry_p->tza;
+  }
 
-  return (status == JJS_STATUS_OK) ? tza : 0;
+  return ecma_date_local_time_zone_adjustment_slow (context_p, time);
 } /* ecma_date_local_time_zone_adjustment */
 
+/**
+ * Drop the cached local time zone adjustments, e.g. because the time zone of the system changed.
+ */
+void
+ecma_date_clear_tza_cache (ecma_context_t *context_p) /**< JJS context */
+{
+  context_p->date_tza_cache_count = 0;
+  context_p->date_tza_cache_next = 0;
+  context_p->date_tza_cache_last = 0;
+} /* ecma_date_clear_tza_cache */
+
 /**
  * Abstract operation: UTC
  *
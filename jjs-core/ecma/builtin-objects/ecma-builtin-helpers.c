@@ -465,6 +465,64 @@ ecma_builtin_helper_string_index_normalize (ecma_number_t index, /**< index */
   return norm_index;
 } /* ecma_builtin_helper_string_index_normalize */
 
+/**
+ * Helper function for getting the start of the character at the given index of a cesu-8 string
+ *
+ * @return pointer to the character
+ */
+static const lit_utf8_byte_t *
+ecma_builtin_helper_string_get_char_position (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                                              lit_utf8_size_t string_size, /**< string size */
+                                              lit_utf8_size_t string_length, /**< string length */
+                                              uint32_t index) /**< character index */
+{
+  JJS_ASSERT (index <= string_length);
+
+  if (string_size == string_length)
+  {
+    return string_p + index;
+  }
+
+  while (index-- > 0)
+  {
+    lit_utf8_incr (&string_p);
+  }
+
+  return string_p;
+} /* ecma_builtin_helper_string_get_char_position */
+
+/**
+ * Helper function for checking whether a search string occurs at the given position
+ *
+ * Used by:
+ *         - The ecma_builtin_helper_string_prototype_object_index_of helper routine.
+ *
+ * @return true - if the search string is found at the given position
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_helper_string_matches_at (ecma_context_t *context_p, /**< JJS context */
+                                       ecma_string_t *original_str_p, /**< original string */
+                                       ecma_string_t *search_str_p, /**< search string */
+                                       uint32_t position) /**< position of the match */
+{
+  uint32_t original_length = ecma_string_get_length (context_p, original_str_p);
+
+  ECMA_STRING_TO_UTF8_STRING (context_p, search_str_p, search_str_utf8_p, search_str_size);
+  ECMA_STRING_TO_UTF8_STRING (context_p, original_str_p, original_str_utf8_p, original_str_size);
+
+  const lit_utf8_byte_t *current_p =
+    ecma_builtin_helper_string_get_char_position (original_str_utf8_p, original_str_size, original_length, position);
+
+  bool is_match = ((size_t) (original_str_utf8_p + original_str_size - current_p) >= search_str_size
+                   && memcmp (current_p, search_str_utf8_p, search_str_size) == 0);
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, original_str_utf8_p, original_str_size);
+  ECMA_FINALIZE_UTF8_STRING (context_p, search_str_utf8_p, search_str_size);
+
+  return is_match;
+} /* ecma_builtin_helper_string_matches_at */
+
 /**
  * Helper function for finding lastindex of a search string
  *
@@ -503,33 +561,37 @@ ecma_builtin_helper_string_find_last_index (ecma_context_t *context_p, /**< JJS
   {
     const lit_utf8_byte_t *end_p = original_str_utf8_p + original_str_size;
     const lit_utf8_byte_t *current_p = end_p;
+    bool is_ascii = (original_length == original_str_size);
 
-    for (uint32_t i = original_length; i > position; i--)
+    if (is_ascii)
     {
-      lit_utf8_decr (&current_p);
+      position = JJS_MIN (position, original_str_size - search_str_size);
+      current_p = original_str_utf8_p + position;
     }
-
-    while (current_p + search_str_size > end_p)
-    {
-      lit_utf8_decr (&current_p);
-      position--;
-    }
-
-    while (true)
+    else
     {
-      if (memcmp (current_p, search_str_utf8_p, search_str_size) == 0)
+      for (uint32_t i = original_length; i > position; i--)
       {
-        ret_value = position;
-        break;
+        lit_utf8_decr (&current_p);
       }
 
-      if (position == 0)
+      while (current_p + search_str_size > end_p)
       {
-        break;
+        lit_utf8_decr (&current_p);
+        position--;
       }
+    }
+
+    const lit_utf8_byte_t *match_p = lit_utf8_string_find_last (original_str_utf8_p,
+                                                                (lit_utf8_size_t) (current_p - original_str_utf8_p)
+                                                                  + search_str_size,
+                                                                search_str_utf8_p,
+                                                                search_str_size);
 
-      lit_utf8_decr (&current_p);
-      position--;
+    if (match_p != NULL)
+    {
+      lit_utf8_size_t skipped_size = (lit_utf8_size_t) (current_p - match_p);
+      ret_value = position - (is_ascii ? skipped_size : lit_utf8_string_length (match_p, skipped_size));
     }
   }
   ECMA_FINALIZE_UTF8_STRING (context_p, original_str_utf8_p, original_str_size);
@@ -632,8 +694,8 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_context_t *context_p,
         break;
       }
       /* 15, 16 (startsWith) */
-      uint32_t index = ecma_builtin_helper_string_find_index (context_p, original_str_p, search_str_p, start);
-      ret_value = ecma_make_boolean_value (index == start);
+      ret_value =
+        ecma_make_boolean_value (ecma_builtin_helper_string_matches_at (context_p, original_str_p, search_str_p, start));
       break;
     }
     case ECMA_STRING_INCLUDES:
@@ -665,8 +727,8 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_context_t *context_p,
       {
         break;
       }
-      uint32_t index = ecma_builtin_helper_string_find_index (context_p, original_str_p, search_str_p, (uint32_t) start_ends_with);
-      ret_value = ecma_make_boolean_value (index == (uint32_t) start_ends_with);
+      ret_value = ecma_make_boolean_value (
+        ecma_builtin_helper_string_matches_at (context_p, original_str_p, search_str_p, (uint32_t) start_ends_with));
       break;
     }
     case ECMA_STRING_INDEX_OF:
@@ -734,28 +796,30 @@ ecma_builtin_helper_string_find_index (ecma_context_t *context_p, /**< JJS conte
     return start_pos;
   }
 
+  uint32_t original_length = ecma_string_get_length (context_p, original_str_p);
+
   ECMA_STRING_TO_UTF8_STRING (context_p, search_str_p, search_str_utf8_p, search_str_size);
   ECMA_STRING_TO_UTF8_STRING (context_p, original_str_p, original_str_utf8_p, original_str_size);
 
-  const lit_utf8_byte_t *str_current_p = original_str_utf8_p;
+  const lit_utf8_byte_t *str_current_p =
+    ecma_builtin_helper_string_get_char_position (original_str_utf8_p, original_str_size, original_length, start_pos);
 
-  for (ecma_number_t i = 0; i < start_pos; i++)
-  {
-    lit_utf8_incr (&str_current_p);
-  }
-
-  const lit_utf8_byte_t *original_end_p = original_str_utf8_p + original_str_size;
+  const lit_utf8_byte_t *match_p = lit_utf8_string_find (str_current_p,
+                                                         (lit_utf8_size_t) (original_str_utf8_p + original_str_size
+                                                                            - str_current_p),
+                                                         search_str_utf8_p,
+                                                         search_str_size);
 
-  while (!((size_t) (original_end_p - str_current_p) < search_str_size))
+  if (match_p != NULL)
   {
-    if (memcmp (str_current_p, search_str_utf8_p, search_str_size) == 0)
+    lit_utf8_size_t skipped_size = (lit_utf8_size_t) (match_p - str_current_p);
+
+    if (original_length != original_str_size)
     {
-      match_found = start_pos;
-      break;
+      skipped_size = lit_utf8_string_length (str_current_p, skipped_size);
     }
 
-    lit_utf8_incr (&str_current_p);
-    start_pos++;
+    match_found = start_pos + skipped_size;
   }
 
   ECMA_FINALIZE_UTF8_STRING (context_p, original_str_utf8_p, original_str_size);
@@ -219,7 +219,9 @@ ecma_builtin_string_prototype_object_concat (ecma_context_t *context_p, /**< JJS
                                              const ecma_value_t *argument_list_p, /**< arguments list */
                                              uint32_t arguments_number) /**< number of arguments */
 {
-  ecma_stringbuilder_t builder = ecma_stringbuilder_create_from (context_p, this_string_p);
+  /* Long results are represented as ropes, so repeated concat calls do not copy the whole string. */
+  ecma_string_t *result_string_p = this_string_p;
+  ecma_ref_ecma_string (result_string_p);
 
   /* 5 */
   for (uint32_t arg_index = 0; arg_index < arguments_number; ++arg_index)
@@ -229,17 +231,17 @@ ecma_builtin_string_prototype_object_concat (ecma_context_t *context_p, /**< JJS
 
     if (JJS_UNLIKELY (get_arg_string_p == NULL))
     {
-      ecma_stringbuilder_destroy (&builder);
+      ecma_deref_ecma_string (context_p, result_string_p);
       return ECMA_VALUE_ERROR;
     }
 
-    ecma_stringbuilder_append (&builder, get_arg_string_p);
+    result_string_p = ecma_concat_ecma_strings (context_p, result_string_p, get_arg_string_p);
 
     ecma_deref_ecma_string (context_p, get_arg_string_p);
   }
 
   /* 6 */
-  return ecma_make_string_value (context_p, ecma_stringbuilder_finalize (&builder));
+  return ecma_make_string_value (context_p, result_string_p);
 } /* ecma_builtin_string_prototype_object_concat */
 
 /**
@@ -627,6 +629,22 @@ ecma_builtin_string_prototype_object_replace_helper (ecma_context_t *context_p,
     lit_utf8_size_t pos = 0;
     while (curr_p <= loop_end_p)
     {
+      if (search_size != 0)
+      {
+        /* Skip to the next occurrence of the search string. */
+        const lit_utf8_byte_t *match_p =
+          lit_utf8_string_find (curr_p, (lit_utf8_size_t) (input_end_p - curr_p), search_buf_p, search_size);
+
+        if (match_p == NULL)
+        {
+          break;
+        }
+
+        lit_utf8_size_t skipped_size = (lit_utf8_size_t) (match_p - curr_p);
+        pos += (input_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size : lit_utf8_string_length (curr_p, skipped_size);
+        curr_p = match_p;
+      }
+
       if (!memcmp (curr_p, search_buf_p, search_size))
       {
         const lit_utf8_size_t prefix_size = (lit_utf8_size_t) (curr_p - last_match_end_p);
@@ -998,6 +1016,18 @@ ecma_builtin_string_prototype_object_split (ecma_context_t *context_p, /**< JJS
 
   while (current_p < compare_end_p)
   {
+    if (separator_size != 0)
+    {
+      /* Skip to the next occurrence of the separator. */
+      current_p =
+        lit_utf8_string_find (current_p, (lit_utf8_size_t) (string_end_p - current_p), separator_buffer_p, separator_size);
+
+      if (current_p == NULL)
+      {
+        break;
+      }
+    }
+
     if (!memcmp (current_p, separator_buffer_p, separator_size) && (last_str_begin_p != current_p + separator_size))
     {
       ecma_string_t *substr_p =
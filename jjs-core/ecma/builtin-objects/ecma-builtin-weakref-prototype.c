@@ -15,6 +15,7 @@
 
 #include "ecma-container-object.h"
 #include "ecma-exceptions.h"
+#include "ecma-gc.h"
 
 #if JJS_BUILTIN_WEAKREF
 
@@ -75,6 +76,9 @@ ecma_builtin_weakref_prototype_object_deref (ecma_context_t *context_p, /**< JJS
     return ecma_raise_type_error (context_p, ECMA_ERR_TARGET_IS_NOT_WEAKREF);
   }
 
+  /* An unreachable target may still wait for an incremental sweep, which clears the target. */
+  ecma_gc_finish_sweep (context_p);
+
   return ecma_copy_value (context_p, this_ext_obj->u.cls.u3.target);
 } /* ecma_builtin_weakref_prototype_object_deref */
 
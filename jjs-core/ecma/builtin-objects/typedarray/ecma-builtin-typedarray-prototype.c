@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <float.h>
 #include <math.h>
 
 #include "ecma-arraybuffer-object.h"
@@ -545,6 +546,326 @@ cleanup:
   return ret_value;
 } /* ecma_builtin_typedarray_prototype_filter */
 
+/**
+ * Checks whether the elements of a TypedArray backing store can be accessed as native integers.
+ */
+#define ECMA_TYPEDARRAY_IS_ALIGNED(buffer_p, shift) ((((uintptr_t) (buffer_p)) & ((1u << (shift)) - 1)) == 0)
+
+/**
+ * Reverse the elements of an aligned backing store with a native element type.
+ */
+#define ECMA_TYPEDARRAY_REVERSE_ELEMENTS(type)                 \
+  do                                                           \
+  {                                                            \
+    type *lower_p = (type *) (void *) buffer_p;                \
+    type *upper_p = lower_p + (length - 1);                    \
+                                                               \
+    while (lower_p < upper_p)                                  \
+    {                                                          \
+      type tmp = *lower_p;                                     \
+      *lower_p++ = *upper_p;                                   \
+      *upper_p-- = tmp;                                        \
+    }                                                          \
+  } while (0)
+
+/**
+ * Reverse the order of the elements of a TypedArray backing store in place.
+ */
+static void
+ecma_builtin_typedarray_reverse_elements (uint8_t *buffer_p, /**< first element */
+                                          uint32_t length, /**< number of elements */
+                                          uint8_t shift) /**< element size shift */
+{
+  if (length < 2)
+  {
+    return;
+  }
+
+  if (ECMA_TYPEDARRAY_IS_ALIGNED (buffer_p, shift))
+  {
+    switch (shift)
+    {
+      case 0:
+      {
+        ECMA_TYPEDARRAY_REVERSE_ELEMENTS (uint8_t);
+        return;
+      }
+      case 1:
+      {
+        ECMA_TYPEDARRAY_REVERSE_ELEMENTS (uint16_t);
+        return;
+      }
+      case 2:
+      {
+        ECMA_TYPEDARRAY_REVERSE_ELEMENTS (uint32_t);
+        return;
+      }
+      default:
+      {
+        JJS_ASSERT (shift == 3);
+        ECMA_TYPEDARRAY_REVERSE_ELEMENTS (uint64_t);
+        return;
+      }
+    }
+  }
+
+  uint32_t element_size = 1u << shift;
+  uint32_t middle = (length / 2) << shift;
+  uint32_t buffer_last = (length << shift) - element_size;
+
+  for (uint32_t lower = 0; lower < middle; lower += element_size)
+  {
+    uint8_t *lower_p = buffer_p + lower;
+    uint8_t *upper_p = buffer_p + (buffer_last - lower);
+
+    uint8_t tmp[8];
+    memcpy (&tmp[0], lower_p, element_size);
+    memcpy (lower_p, upper_p, element_size);
+    memcpy (upper_p, &tmp[0], element_size);
+  }
+} /* ecma_builtin_typedarray_reverse_elements */
+
+#undef ECMA_TYPEDARRAY_REVERSE_ELEMENTS
+
+/**
+ * Fill a range of a TypedArray backing store with copies of an encoded element.
+ */
+static void
+ecma_builtin_typedarray_fill_elements (uint8_t *buffer_p, /**< first element of the range */
+                                       uint32_t count, /**< number of elements in the range */
+                                       const uint8_t *element_p, /**< encoded element */
+                                       uint8_t shift) /**< element size shift */
+{
+  size_t element_size = (size_t) 1 << shift;
+  size_t total_size = (size_t) count << shift;
+  bool is_uniform = true;
+
+  for (size_t i = 1; i < element_size; i++)
+  {
+    is_uniform = is_uniform && element_p[i] == element_p[0];
+  }
+
+  if (is_uniform)
+  {
+    memset (buffer_p, element_p[0], total_size);
+    return;
+  }
+
+  if (total_size == 0)
+  {
+    return;
+  }
+
+  /* copy the already filled prefix after itself, doubling the filled size each time */
+  memcpy (buffer_p, element_p, element_size);
+
+  size_t filled_size = element_size;
+
+  while (filled_size < total_size)
+  {
+    size_t copy_size = JJS_MIN (filled_size, total_size - filled_size);
+    memcpy (buffer_p + filled_size, buffer_p, copy_size);
+    filled_size += copy_size;
+  }
+} /* ecma_builtin_typedarray_fill_elements */
+
+/**
+ * Index returned by ecma_builtin_typedarray_search when no element matches.
+ */
+#define ECMA_TYPEDARRAY_SEARCH_NOT_FOUND UINT32_MAX
+
+/**
+ * Search loop over an aligned backing store with a native element type. The 'element'
+ * variable holds the current element in the match expression.
+ */
+#define ECMA_TYPEDARRAY_SEARCH_ELEMENTS(type, is_match)        \
+  do                                                           \
+  {                                                            \
+    const type *array_p = (const type *) (const void *) buffer_p; \
+                                                               \
+    if (is_backward)                                           \
+    {                                                          \
+      for (uint32_t i = from + 1; i-- > 0;)                    \
+      {                                                        \
+        type element = array_p[i];                             \
+                                                               \
+        if (is_match)                                          \
+        {                                                      \
+          return i;                                            \
+        }                                                      \
+      }                                                        \
+    }                                                          \
+    else                                                       \
+    {                                                          \
+      for (uint32_t i = from; i < length; i++)                 \
+      {                                                        \
+        type element = array_p[i];                             \
+                                                               \
+        if (is_match)                                          \
+        {                                                      \
+          return i;                                            \
+        }                                                      \
+      }                                                        \
+    }                                                          \
+                                                               \
+    return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;                   \
+  } while (0)
+
+/**
+ * Search a value in a TypedArray starting from an index, comparing the elements with SameValueZero,
+ * or with strict equality if is_strict is set.
+ *
+ * The value is converted to the representation of the elements once, and the backing store is
+ * scanned with native comparisons. Values which cannot be represented exactly never match.
+ *
+ * @return index of the first matching element in the search direction
+ *         ECMA_TYPEDARRAY_SEARCH_NOT_FOUND - if no element matches
+ */
+static uint32_t
+ecma_builtin_typedarray_search (ecma_context_t *context_p, /**< JJS context */
+                                ecma_typedarray_info_t *info_p, /**< object info */
+                                ecma_value_t value, /**< searched value */
+                                uint32_t from, /**< index of the first examined element */
+                                bool is_backward, /**< search towards index 0 */
+                                bool is_strict) /**< use strict equality instead of SameValueZero */
+{
+  uint8_t *buffer_p = ecma_typedarray_get_buffer (context_p, info_p);
+  uint32_t length = info_p->length;
+
+  JJS_ASSERT (from < length);
+
+  if (!ECMA_TYPEDARRAY_IS_ALIGNED (buffer_p, info_p->shift))
+  {
+    ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
+    uint32_t index = from;
+
+    while (index < length)
+    {
+      ecma_value_t element = getter_cb (context_p, buffer_p + (index << info_p->shift));
+      bool is_match = ecma_op_same_value_zero (context_p, value, element, is_strict);
+      ecma_free_value (context_p, element);
+
+      if (is_match)
+      {
+        return index;
+      }
+
+      /* the backward search ends when index wraps around to UINT32_MAX */
+      index = is_backward ? index - 1 : index + 1;
+    }
+
+    return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+  }
+
+  if (info_p->id == ECMA_FLOAT32_ARRAY || info_p->id == ECMA_FLOAT64_ARRAY)
+  {
+    if (!ecma_is_value_number (value))
+    {
+      return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+    }
+
+    ecma_number_t number = ecma_get_number_from_value (context_p, value);
+
+    if (ecma_number_is_nan (number))
+    {
+      if (is_strict)
+      {
+        return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+      }
+
+      if (info_p->id == ECMA_FLOAT32_ARRAY)
+      {
+        ECMA_TYPEDARRAY_SEARCH_ELEMENTS (float, element != element);
+      }
+
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (double, element != element);
+    }
+
+    if (info_p->id == ECMA_FLOAT32_ARRAY)
+    {
+      if (!ecma_number_is_infinity (number) && fabs (number) > (ecma_number_t) FLT_MAX)
+      {
+        return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+      }
+
+      float key = (float) number;
+
+      if ((ecma_number_t) key != number)
+      {
+        return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+      }
+
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (float, element == key);
+    }
+
+    double key = (double) number;
+    ECMA_TYPEDARRAY_SEARCH_ELEMENTS (double, element == key);
+  }
+
+#if JJS_BUILTIN_BIGINT
+  if (ECMA_TYPEDARRAY_IS_BIGINT_TYPE (info_p->id) ? !ecma_is_value_bigint (value) : !ecma_is_value_number (value))
+#else /* !JJS_BUILTIN_BIGINT */
+  if (!ecma_is_value_number (value))
+#endif /* JJS_BUILTIN_BIGINT */
+  {
+    return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+  }
+
+  /* Integer elements have a unique representation, so the value is encoded once and the elements
+   * are compared bitwise. The value is found only if decoding gives back the same value. */
+  union
+  {
+    uint8_t u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t u64;
+  } key;
+
+  key.u64 = 0;
+
+  ecma_value_t set_element = ecma_get_typedarray_setter_fn (info_p->id) (context_p, (lit_utf8_byte_t *) &key, value);
+  JJS_ASSERT (!ECMA_IS_VALUE_ERROR (set_element));
+  ecma_free_value (context_p, set_element);
+
+  ecma_value_t decoded = ecma_get_typedarray_getter_fn (info_p->id) (context_p, (lit_utf8_byte_t *) &key);
+  bool is_exact = ecma_op_same_value_zero (context_p, value, decoded, false);
+  ecma_free_value (context_p, decoded);
+
+  if (!is_exact)
+  {
+    return ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+  }
+
+  switch (info_p->shift)
+  {
+    case 0:
+    {
+      if (!is_backward)
+      {
+        const uint8_t *match_p = memchr (buffer_p + from, key.u8, length - from);
+        return match_p != NULL ? (uint32_t) (match_p - buffer_p) : ECMA_TYPEDARRAY_SEARCH_NOT_FOUND;
+      }
+
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (uint8_t, element == key.u8);
+    }
+    case 1:
+    {
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (uint16_t, element == key.u16);
+    }
+    case 2:
+    {
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (uint32_t, element == key.u32);
+    }
+    default:
+    {
+      JJS_ASSERT (info_p->shift == 3);
+      ECMA_TYPEDARRAY_SEARCH_ELEMENTS (uint64_t, element == key.u64);
+    }
+  }
+} /* ecma_builtin_typedarray_search */
+
+#undef ECMA_TYPEDARRAY_SEARCH_ELEMENTS
+
 /**
  * The %TypedArray%.prototype object's 'reverse' routine
  *
@@ -565,24 +886,65 @@ ecma_builtin_typedarray_prototype_reverse (ecma_context_t *context_p, /**< JJS c
   }
 
   uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
-  uint32_t middle = (info_p->length / 2) << info_p->shift;
-  uint32_t buffer_last = (info_p->length << info_p->shift) - info_p->element_size;
 
-  for (uint32_t lower = 0; lower < middle; lower += info_p->element_size)
-  {
-    uint32_t upper = buffer_last - lower;
-    uint8_t *lower_p = buffer_p + lower;
-    uint8_t *upper_p = buffer_p + upper;
-
-    uint8_t tmp[8];
-    memcpy (&tmp[0], lower_p, info_p->element_size);
-    memcpy (lower_p, upper_p, info_p->element_size);
-    memcpy (upper_p, &tmp[0], info_p->element_size);
-  }
+  ecma_builtin_typedarray_reverse_elements (buffer_p, info_p->length, info_p->shift);
 
   return ecma_copy_value (context_p, this_arg);
 } /* ecma_builtin_typedarray_prototype_reverse */
 
+/**
+ * Checks whether converting elements from one TypedArray type to another keeps their bits, so the
+ * elements can be copied with memmove. This holds between the signed and unsigned variants of the
+ * same integer size, because their conversions are modular, except that only non-negative values
+ * can be stored in a Uint8ClampedArray without clamping.
+ *
+ * @return true - if the elements can be copied bitwise
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_typedarray_is_bitwise_convertible (ecma_typedarray_type_t src_id, /**< source type */
+                                                ecma_typedarray_type_t target_id) /**< target type */
+{
+  if (src_id == target_id)
+  {
+    return true;
+  }
+
+  switch (target_id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_UINT8_ARRAY:
+    {
+      return src_id == ECMA_INT8_ARRAY || src_id == ECMA_UINT8_ARRAY || src_id == ECMA_UINT8_CLAMPED_ARRAY;
+    }
+    case ECMA_UINT8_CLAMPED_ARRAY:
+    {
+      return src_id == ECMA_UINT8_ARRAY;
+    }
+    case ECMA_INT16_ARRAY:
+    case ECMA_UINT16_ARRAY:
+    {
+      return src_id == ECMA_INT16_ARRAY || src_id == ECMA_UINT16_ARRAY;
+    }
+    case ECMA_INT32_ARRAY:
+    case ECMA_UINT32_ARRAY:
+    {
+      return src_id == ECMA_INT32_ARRAY || src_id == ECMA_UINT32_ARRAY;
+    }
+#if JJS_BUILTIN_BIGINT
+    case ECMA_BIGINT64_ARRAY:
+    case ECMA_BIGUINT64_ARRAY:
+    {
+      return src_id == ECMA_BIGINT64_ARRAY || src_id == ECMA_BIGUINT64_ARRAY;
+    }
+#endif /* JJS_BUILTIN_BIGINT */
+    default:
+    {
+      return false;
+    }
+  }
+} /* ecma_builtin_typedarray_is_bitwise_convertible */
+
 /**
  * The %TypedArray%.prototype object's 'set' routine for a typedArray source
  *
@@ -659,7 +1021,7 @@ ecma_op_typedarray_set_with_typedarray (ecma_context_t *context_p, /**< JJS cont
   /* 27. limit */
   uint32_t limit = src_info.length << target_info.shift;
 
-  if (src_info.id == target_info.id)
+  if (ecma_builtin_typedarray_is_bitwise_convertible (src_info.id, target_info.id))
   {
     memmove (target_buffer_p, src_buffer_p, limit);
   }
@@ -1116,26 +1478,296 @@ ecma_builtin_typedarray_prototype_fill (ecma_context_t *context_p, /**< JJS cont
 
   buffer_p += begin_index_uint32 << info_p->shift;
 
-  uint8_t *limit_p = buffer_p + (subarray_length << info_p->shift);
+  /* encode the value once, and copy the encoded element over the range */
+  uint64_t element = 0;
   ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info_p->id);
+  ecma_value_t set_element = typedarray_setter_cb (context_p, (lit_utf8_byte_t *) &element, value_to_set);
 
-  while (buffer_p < limit_p)
+  ecma_free_value (context_p, value_to_set);
+
+  if (ECMA_IS_VALUE_ERROR (set_element))
   {
-    ecma_value_t set_element = typedarray_setter_cb (context_p, buffer_p, value_to_set);
+    return set_element;
+  }
 
-    if (ECMA_IS_VALUE_ERROR (set_element))
+  ecma_builtin_typedarray_fill_elements (buffer_p, subarray_length, (const uint8_t *) &element, info_p->shift);
+
+  return ecma_copy_value (context_p, this_arg);
+} /* ecma_builtin_typedarray_prototype_fill */
+
+/**
+ * Ranges shorter than this are sorted by insertion sort instead of radix sort.
+ */
+#define ECMA_TYPEDARRAY_RADIX_SORT_MIN_LENGTH 32
+
+/**
+ * Define an in-place MSD radix sort (American flag sort) for an unsigned integer key type.
+ *
+ * Each level distributes the elements into 256 buckets by one byte of the key, starting from the
+ * most significant byte, and sorts the buckets by the next byte. No extra memory is allocated.
+ */
+#define ECMA_TYPEDARRAY_DEFINE_RADIX_SORT(name, type)                                      \
+  static void name (type *array_p, /**< keys */                                            \
+                    uint32_t length, /**< number of keys */                                \
+                    uint32_t shift) /**< bit position of the byte used by this level */    \
+  {                                                                                        \
+    if (length < ECMA_TYPEDARRAY_RADIX_SORT_MIN_LENGTH)                                    \
+    {                                                                                      \
+      for (uint32_t i = 1; i < length; i++)                                                \
+      {                                                                                    \
+        type value = array_p[i];                                                           \
+        uint32_t j = i;                                                                    \
+                                                                                           \
+        while (j > 0 && array_p[j - 1] > value)                                            \
+        {                                                                                  \
+          array_p[j] = array_p[j - 1];                                                     \
+          j--;                                                                             \
+        }                                                                                  \
+                                                                                           \
+        array_p[j] = value;                                                                \
+      }                                                                                    \
+      return;                                                                              \
+    }                                                                                      \
+                                                                                           \
+    uint32_t heads[256];                                                                   \
+    uint32_t tails[256];                                                                   \
+                                                                                           \
+    memset (tails, 0, sizeof (tails));                                                     \
+                                                                                           \
+    for (uint32_t i = 0; i < length; i++)                                                  \
+    {                                                                                      \
+      tails[(uint32_t) (array_p[i] >> shift) & 0xff]++;                                    \
+    }                                                                                      \
+                                                                                           \
+    uint32_t start = 0;                                                                    \
+                                                                                           \
+    for (uint32_t bucket = 0; bucket < 256; bucket++)                                      \
+    {                                                                                      \
+      uint32_t count = tails[bucket];                                                      \
+                                                                                           \
+      if (count == length)                                                                 \
+      {                                                                                    \
+        /* all keys share this byte */                                                     \
+        if (shift > 0)                                                                     \
+        {                                                                                  \
+          name (array_p, length, shift - 8);                                               \
+        }                                                                                  \
+        return;                                                                            \
+      }                                                                                    \
+                                                                                           \
+      heads[bucket] = start;                                                               \
+      start += count;                                                                      \
+      tails[bucket] = start;                                                               \
+    }                                                                                      \
+                                                                                           \
+    for (uint32_t bucket = 0; bucket < 256; bucket++)                                      \
+    {                                                                                      \
+      while (heads[bucket] < tails[bucket])                                                \
+      {                                                                                    \
+        type value = array_p[heads[bucket]];                                               \
+        uint32_t digit = (uint32_t) (value >> shift) & 0xff;                               \
+                                                                                           \
+        while (digit != bucket)                                                            \
+        {                                                                                  \
+          type next_value = array_p[heads[digit]];                                         \
+          array_p[heads[digit]++] = value;                                                 \
+          value = next_value;                                                              \
+          digit = (uint32_t) (value >> shift) & 0xff;                                      \
+        }                                                                                  \
+                                                                                           \
+        array_p[heads[bucket]++] = value;                                                  \
+      }                                                                                    \
+    }                                                                                      \
+                                                                                           \
+    if (shift == 0)                                                                        \
+    {                                                                                      \
+      return;                                                                              \
+    }                                                                                      \
+                                                                                           \
+    start = 0;                                                                             \
+                                                                                           \
+    for (uint32_t bucket = 0; bucket < 256; bucket++)                                      \
+    {                                                                                      \
+      if (tails[bucket] - start > 1)                                                       \
+      {                                                                                    \
+        name (array_p + start, tails[bucket] - start, shift - 8);                          \
+      }                                                                                    \
+                                                                                           \
+      start = tails[bucket];                                                               \
+    }                                                                                      \
+  }
+
+ECMA_TYPEDARRAY_DEFINE_RADIX_SORT (ecma_typedarray_radix_sort_u8, uint8_t)
+ECMA_TYPEDARRAY_DEFINE_RADIX_SORT (ecma_typedarray_radix_sort_u16, uint16_t)
+ECMA_TYPEDARRAY_DEFINE_RADIX_SORT (ecma_typedarray_radix_sort_u32, uint32_t)
+ECMA_TYPEDARRAY_DEFINE_RADIX_SORT (ecma_typedarray_radix_sort_u64, uint64_t)
+
+#undef ECMA_TYPEDARRAY_DEFINE_RADIX_SORT
+
+/**
+ * Sort the elements of a TypedArray in place with the default comparison of
+ * %TypedArray%.prototype.sort, without creating ecma values for the elements.
+ *
+ * The elements are mapped to unsigned keys whose order is the numeric order of the elements:
+ * the sign bit of signed integers is flipped, and negative floats have all bits flipped, so -0
+ * is ordered before +0. NaNs are moved to the end before sorting.
+ *
+ * @return true - if the elements are sorted
+ *         false - if the buffer is not aligned to the element size, the elements are unchanged
+ */
+static bool
+ecma_builtin_typedarray_prototype_sort_native (uint8_t *buffer_p, /**< first element */
+                                               uint32_t length, /**< number of elements */
+                                               ecma_typedarray_type_t id, /**< TypedArray type */
+                                               uint8_t shift) /**< element size shift */
+{
+  if ((((uintptr_t) buffer_p) & ((1u << shift) - 1)) != 0)
+  {
+    return false;
+  }
+
+  switch (id)
+  {
+    case ECMA_INT8_ARRAY:
+    case ECMA_UINT8_ARRAY:
+    case ECMA_UINT8_CLAMPED_ARRAY:
     {
-      ecma_free_value (context_p, value_to_set);
-      return set_element;
+      uint8_t sign = (id == ECMA_INT8_ARRAY) ? 0x80 : 0;
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        buffer_p[i] ^= sign;
+      }
+
+      ecma_typedarray_radix_sort_u8 (buffer_p, length, 0);
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        buffer_p[i] ^= sign;
+      }
+      break;
     }
+    case ECMA_INT16_ARRAY:
+    case ECMA_UINT16_ARRAY:
+    {
+      uint16_t *array_p = (uint16_t *) (void *) buffer_p;
+      uint16_t sign = (id == ECMA_INT16_ARRAY) ? 0x8000 : 0;
 
-    buffer_p += info_p->element_size;
-  }
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
 
-  ecma_free_value (context_p, value_to_set);
+      ecma_typedarray_radix_sort_u16 (array_p, length, 8);
 
-  return ecma_copy_value (context_p, this_arg);
-} /* ecma_builtin_typedarray_prototype_fill */
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
+      break;
+    }
+    case ECMA_INT32_ARRAY:
+    case ECMA_UINT32_ARRAY:
+    {
+      uint32_t *array_p = (uint32_t *) (void *) buffer_p;
+      uint32_t sign = (id == ECMA_INT32_ARRAY) ? UINT32_C (0x80000000) : 0;
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
+
+      ecma_typedarray_radix_sort_u32 (array_p, length, 24);
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
+      break;
+    }
+    case ECMA_FLOAT32_ARRAY:
+    {
+      uint32_t *array_p = (uint32_t *) (void *) buffer_p;
+      const uint32_t sign = UINT32_C (0x80000000);
+      uint32_t count = 0;
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        uint32_t value = array_p[i];
+
+        /* NaN: all exponent bits and at least one fraction bit are set */
+        if ((value & ~sign) <= UINT32_C (0x7f800000))
+        {
+          array_p[i] = array_p[count];
+          array_p[count++] = (value & sign) ? ~value : (value | sign);
+        }
+      }
+
+      ecma_typedarray_radix_sort_u32 (array_p, count, 24);
+
+      for (uint32_t i = 0; i < count; i++)
+      {
+        uint32_t key = array_p[i];
+        array_p[i] = (key & sign) ? (key & ~sign) : ~key;
+      }
+      break;
+    }
+    case ECMA_FLOAT64_ARRAY:
+    {
+      uint64_t *array_p = (uint64_t *) (void *) buffer_p;
+      const uint64_t sign = UINT64_C (0x8000000000000000);
+      uint32_t count = 0;
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        uint64_t value = array_p[i];
+
+        /* NaN: all exponent bits and at least one fraction bit are set */
+        if ((value & ~sign) <= UINT64_C (0x7ff0000000000000))
+        {
+          array_p[i] = array_p[count];
+          array_p[count++] = (value & sign) ? ~value : (value | sign);
+        }
+      }
+
+      ecma_typedarray_radix_sort_u64 (array_p, count, 56);
+
+      for (uint32_t i = 0; i < count; i++)
+      {
+        uint64_t key = array_p[i];
+        array_p[i] = (key & sign) ? (key & ~sign) : ~key;
+      }
+      break;
+    }
+#if JJS_BUILTIN_BIGINT
+    case ECMA_BIGINT64_ARRAY:
+    case ECMA_BIGUINT64_ARRAY:
+    {
+      uint64_t *array_p = (uint64_t *) (void *) buffer_p;
+      uint64_t sign = (id == ECMA_BIGINT64_ARRAY) ? UINT64_C (0x8000000000000000) : 0;
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
+
+      ecma_typedarray_radix_sort_u64 (array_p, length, 56);
+
+      for (uint32_t i = 0; i < length; i++)
+      {
+        array_p[i] ^= sign;
+      }
+      break;
+    }
+#endif /* JJS_BUILTIN_BIGINT */
+    default:
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_builtin_typedarray_prototype_sort_native */
 
 /**
  * SortCompare abstract method
@@ -1263,13 +1895,20 @@ ecma_builtin_typedarray_prototype_sort (ecma_context_t *context_p, /**< JJS cont
     return ecma_copy_value (context_p, this_arg);
   }
 
+  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
+
+  if (ecma_is_value_undefined (compare_func)
+      && ecma_builtin_typedarray_prototype_sort_native (buffer_p, info_p->length, info_p->id, info_p->shift))
+  {
+    return ecma_copy_value (context_p, this_arg);
+  }
+
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   JMEM_DEFINE_LOCAL_ARRAY (context_p, values_buffer, info_p->length, ecma_value_t);
 
   uint32_t buffer_index = 0;
 
   ecma_typedarray_getter_fn_t typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
   uint8_t *limit_p = buffer_p + (info_p->length << info_p->shift);
 
   /* Copy unsorted array into a native c array. */
@@ -1566,27 +2205,15 @@ ecma_builtin_typedarray_prototype_index_of (ecma_context_t *context_p, /**< JJS
     }
   }
 
-  uint8_t *buffer_p = ecma_typedarray_get_buffer (context_p, info_p);
-
-  uint8_t *limit_p = buffer_p + (info_p->length << info_p->shift);
-  ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-
-  buffer_p += from_index << info_p->shift;
-
   /* 11. */
-  while (buffer_p < limit_p)
+  if (from_index < info_p->length)
   {
-    ecma_value_t element = getter_cb (context_p, buffer_p);
+    uint32_t index = ecma_builtin_typedarray_search (context_p, info_p, args[0], from_index, false, true);
 
-    if (ecma_op_same_value_zero (context_p, args[0], element, true))
+    if (index != ECMA_TYPEDARRAY_SEARCH_NOT_FOUND)
     {
-      ecma_free_value (context_p, element);
-      return ecma_make_number_value (context_p, from_index);
+      return ecma_make_number_value (context_p, index);
     }
-
-    ecma_free_value (context_p, element);
-    buffer_p += info_p->element_size;
-    from_index++;
   }
 
   /* 12. */
@@ -1653,24 +2280,12 @@ ecma_builtin_typedarray_prototype_last_index_of (ecma_context_t *context_p, /**<
     from_index = JJS_MIN (from_index, info_p->length - 1);
   }
 
-  ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
-  uint8_t *current_element_p = buffer_p + (from_index << info_p->shift);
-
   /* 10. */
-  while (current_element_p >= buffer_p)
-  {
-    ecma_value_t element = getter_cb (context_p, current_element_p);
-
-    if (ecma_op_same_value_zero (context_p, args[0], element, true))
-    {
-      ecma_free_value (context_p, element);
-      return ecma_make_number_value (context_p, (ecma_number_t) from_index);
-    }
+  uint32_t index = ecma_builtin_typedarray_search (context_p, info_p, args[0], from_index, true, true);
 
-    ecma_free_value (context_p, element);
-    current_element_p -= info_p->element_size;
-    from_index--;
+  if (index != ECMA_TYPEDARRAY_SEARCH_NOT_FOUND)
+  {
+    return ecma_make_number_value (context_p, (ecma_number_t) index);
   }
 
   /* 11. */
@@ -1976,25 +2591,11 @@ ecma_builtin_typedarray_prototype_includes (ecma_context_t *context_p, /**< JJS
     }
   }
 
-  uint8_t *buffer_p = ecma_typedarray_get_buffer (context_p, info_p);
-
-  ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  uint8_t *limit_p = buffer_p + (info_p->length << info_p->shift);
-
-  buffer_p += from_index << info_p->shift;
-
-  while (buffer_p < limit_p)
+  if (from_index < info_p->length
+      && ecma_builtin_typedarray_search (context_p, info_p, args[0], from_index, false, false)
+           != ECMA_TYPEDARRAY_SEARCH_NOT_FOUND)
   {
-    ecma_value_t element = getter_cb (context_p, buffer_p);
-
-    if (ecma_op_same_value_zero (context_p, args[0], element, false))
-    {
-      ecma_free_value (context_p, element);
-      return ECMA_VALUE_TRUE;
-    }
-
-    ecma_free_value (context_p, element);
-    buffer_p += info_p->element_size;
+    return ECMA_VALUE_TRUE;
   }
 
   return ECMA_VALUE_FALSE;
@@ -2167,27 +2768,12 @@ ecma_builtin_typedarray_prototype_to_reversed (ecma_context_t *context_p, /**< J
 
   JJS_ASSERT (info_p->length == new_typedarray_info.length);
 
-  ecma_typedarray_getter_fn_t src_typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  ecma_typedarray_setter_fn_t new_typedarray_setter_cb = ecma_get_typedarray_setter_fn (new_typedarray_info.id);
-  uint8_t *src_buffer_p = ecma_typedarray_get_buffer (context_p, info_p) + ((info_p->length - 1) * info_p->element_size);
-  uint8_t *dst_buffer_p = ecma_typedarray_get_buffer (context_p, &new_typedarray_info);
-
-  for (uint32_t k = 0; k < info_p->length; k++)
-  {
-    ecma_value_t element = src_typedarray_getter_cb (context_p, src_buffer_p);
-    ecma_value_t set_element = new_typedarray_setter_cb (context_p, dst_buffer_p, element);
-    ecma_free_value (context_p, element);
+  JJS_ASSERT (info_p->id == new_typedarray_info.id);
 
-    if (ECMA_IS_VALUE_ERROR (set_element))
-    {
-      ecma_free_value (context_p, new_typedarray);
-      return set_element;
-    }
+  uint8_t *dst_buffer_p = ecma_typedarray_get_buffer (context_p, &new_typedarray_info);
 
-    ecma_free_value (context_p, set_element);
-    src_buffer_p -= info_p->element_size;
-    dst_buffer_p += new_typedarray_info.element_size;
-  }
+  memcpy (dst_buffer_p, ecma_typedarray_get_buffer (context_p, info_p), info_p->length << info_p->shift);
+  ecma_builtin_typedarray_reverse_elements (dst_buffer_p, info_p->length, info_p->shift);
 
   return new_typedarray;
 } /* ecma_builtin_typedarray_prototype_to_reversed */
@@ -2222,12 +2808,29 @@ ecma_builtin_typedarray_prototype_to_sorted (ecma_context_t *context_p, /**< JJS
     return new_typedarray;
   }
 
+  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
+  ecma_object_t *new_typedarray_p = ecma_get_object_from_value (context_p, new_typedarray);
+  ecma_typedarray_info_t new_typedarray_info = ecma_typedarray_get_info (context_p, new_typedarray_p);
+
+  if (ecma_is_value_undefined (compare_fn))
+  {
+    uint8_t *new_buffer_p =
+      ecma_arraybuffer_get_buffer (context_p, new_typedarray_info.array_buffer_p) + new_typedarray_info.offset;
+
+    JJS_ASSERT (new_typedarray_info.id == info_p->id && new_typedarray_info.length == info_p->length);
+    memcpy (new_buffer_p, buffer_p, info_p->length << info_p->shift);
+
+    if (ecma_builtin_typedarray_prototype_sort_native (new_buffer_p, info_p->length, info_p->id, info_p->shift))
+    {
+      return new_typedarray;
+    }
+  }
+
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   JMEM_DEFINE_LOCAL_ARRAY (context_p, values_buffer, info_p->length, ecma_value_t);
 
   uint32_t buffer_index = 0;
   ecma_typedarray_getter_fn_t typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
-  uint8_t *buffer_p = ecma_arraybuffer_get_buffer (context_p, info_p->array_buffer_p) + info_p->offset;
   uint8_t *limit_p = buffer_p + (info_p->length << info_p->shift);
 
   /* Copy unsorted array into a native c array. */
@@ -2263,8 +2866,6 @@ ecma_builtin_typedarray_prototype_to_sorted (ecma_context_t *context_p, /**< JJS
     return ecma_raise_type_error (context_p, ECMA_ERR_ARRAYBUFFER_IS_DETACHED);
   }
 
-  ecma_object_t *new_typedarray_p = ecma_get_object_from_value (context_p, new_typedarray);
-  ecma_typedarray_info_t new_typedarray_info = ecma_typedarray_get_info (context_p, new_typedarray_p);
   ecma_typedarray_setter_fn_t new_typedarray_setter_cb = ecma_get_typedarray_setter_fn (new_typedarray_info.id);
 
   buffer_p = ecma_arraybuffer_get_buffer (context_p, new_typedarray_info.array_buffer_p) + new_typedarray_info.offset;
@@ -289,6 +289,8 @@ ecma_fast_array_convert_to_normal (ecma_context_t *context_p, /**< JJS context *
 
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
 
+  ecma_fast_array_convert_to_generic (context_p, object_p);
+
   if (object_p->u1.property_list_cp == JMEM_CP_NULL)
   {
     ext_obj_p->u.array.length_prop_and_hole_count &= (uint32_t) ~ECMA_FAST_ARRAY_FLAG;
@@ -344,6 +346,191 @@ ecma_fast_array_convert_to_normal (ecma_context_t *context_p, /**< JJS context *
   ecma_deref_object (object_p);
 } /* ecma_fast_array_convert_to_normal */
 
+/**
+ * Check whether the given fast access mode array stores unboxed double elements
+ *
+ * @return true - if the underlying buffer of the array contains ecma_number_t elements
+ *         false, otherwise
+ */
+extern inline bool JJS_ATTR_ALWAYS_INLINE
+ecma_fast_array_has_double_elements (ecma_object_t *obj_p) /**< fast access mode array object */
+{
+  JJS_ASSERT (ecma_op_object_is_fast_array (obj_p));
+
+  return ((ecma_extended_object_t *) obj_p)->u.array.length_prop_and_hole_count & ECMA_FAST_ARRAY_DOUBLE_ELEMENTS;
+} /* ecma_fast_array_has_double_elements */
+
+/**
+ * Switch a fast access mode array to unboxed double elements
+ *
+ * Note: if keep_values is false, the current elements (including holes) are dropped
+ *       and the elements of the new buffer are set to zero
+ *
+ * @return true - if the array stores double elements after the call
+ *         false - if the array cannot be switched to double elements
+ */
+bool
+ecma_fast_array_convert_to_double (ecma_context_t *context_p, /**< JJS context */
+                                   ecma_object_t *object_p, /**< fast access mode array object */
+                                   bool keep_values) /**< true - convert the current elements
+                                                      *   false - drop the current elements */
+{
+  JJS_ASSERT (ecma_op_object_is_fast_array (object_p));
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+
+  const uint32_t element_kind_flags = ECMA_FAST_ARRAY_DOUBLE_ELEMENTS | ECMA_FAST_ARRAY_GENERIC_ELEMENTS;
+
+  if (ext_obj_p->u.array.length_prop_and_hole_count & element_kind_flags)
+  {
+    return ecma_fast_array_has_double_elements (object_p);
+  }
+
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    JJS_ASSERT (ext_obj_p->u.array.length == 0);
+    ext_obj_p->u.array.length_prop_and_hole_count |= ECMA_FAST_ARRAY_DOUBLE_ELEMENTS;
+    return true;
+  }
+
+  const uint32_t length = ext_obj_p->u.array.length;
+  const uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (length);
+  ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
+
+  if (keep_values)
+  {
+    if (ext_obj_p->u.array.length_prop_and_hole_count >= ECMA_FAST_ARRAY_HOLE_ONE)
+    {
+      return false;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      if (!ecma_is_value_number (values_p[i]))
+      {
+        /* The scan is not repeated for this array. */
+        ext_obj_p->u.array.length_prop_and_hole_count |= ECMA_FAST_ARRAY_GENERIC_ELEMENTS;
+        return false;
+      }
+    }
+  }
+
+  ecma_ref_object (object_p);
+  const size_t numbers_size = aligned_length * sizeof (ecma_number_t);
+  ecma_number_t *numbers_p = (ecma_number_t *) jmem_heap_alloc_block_null_on_error (context_p, numbers_size);
+  ecma_deref_object (object_p);
+
+  if (JJS_UNLIKELY (numbers_p == NULL))
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    numbers_p[i] = keep_values ? ecma_get_number_from_value (context_p, values_p[i]) : ECMA_NUMBER_ZERO;
+  }
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    ecma_free_value_if_not_object (context_p, values_p[i]);
+  }
+
+  jmem_heap_free_block (context_p, values_p, aligned_length * sizeof (ecma_value_t));
+
+  ext_obj_p->u.array.length_prop_and_hole_count &= ECMA_FAST_ARRAY_HOLE_ONE - 1;
+  ext_obj_p->u.array.length_prop_and_hole_count |= ECMA_FAST_ARRAY_DOUBLE_ELEMENTS;
+  ECMA_SET_NON_NULL_POINTER (context_p, object_p->u1.property_list_cp, numbers_p);
+  return true;
+} /* ecma_fast_array_convert_to_double */
+
+/**
+ * Box the unboxed double elements of a fast access mode array
+ *
+ * Note: the array is marked to keep ecma_value_t elements, so it is never
+ *       switched back to double elements
+ */
+void
+ecma_fast_array_convert_to_generic (ecma_context_t *context_p, /**< JJS context */
+                                    ecma_object_t *object_p) /**< fast access mode array object */
+{
+  JJS_ASSERT (ecma_op_object_is_fast_array (object_p));
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+
+  if (JJS_LIKELY (!(ext_obj_p->u.array.length_prop_and_hole_count & ECMA_FAST_ARRAY_DOUBLE_ELEMENTS)))
+  {
+    return;
+  }
+
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    const uint32_t length = ext_obj_p->u.array.length;
+    const uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (length);
+
+    ecma_ref_object (object_p);
+
+    /* The array keeps its double buffer until the boxed buffer is complete, since
+     * allocating the boxed numbers can trigger a garbage collection. */
+    ecma_value_t *values_p = jmem_heap_alloc_block (context_p, aligned_length * sizeof (ecma_value_t));
+    ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+      values_p[i] = ecma_make_number_value (context_p, numbers_p[i]);
+    }
+
+    for (uint32_t i = length; i < aligned_length; i++)
+    {
+      values_p[i] = ECMA_VALUE_ARRAY_HOLE;
+    }
+
+    jmem_heap_free_block (context_p, numbers_p, aligned_length * sizeof (ecma_number_t));
+    ECMA_SET_NON_NULL_POINTER (context_p, object_p->u1.property_list_cp, values_p);
+
+    ecma_deref_object (object_p);
+  }
+
+  ext_obj_p->u.array.length_prop_and_hole_count &= (uint32_t) ~ECMA_FAST_ARRAY_DOUBLE_ELEMENTS;
+  ext_obj_p->u.array.length_prop_and_hole_count |= ECMA_FAST_ARRAY_GENERIC_ELEMENTS;
+} /* ecma_fast_array_convert_to_generic */
+
+/**
+ * [[Put]] operation for a fast access mode array with double elements
+ *
+ * Note: an array with generic elements is switched to double elements if possible
+ *
+ * @return true - if the value is stored as an unboxed double element
+ *         false - if the array stores generic elements after the call
+ */
+static bool
+ecma_fast_array_set_double_property (ecma_context_t *context_p, /**< JJS context */
+                                     ecma_object_t *object_p, /**< fast access mode array object */
+                                     uint32_t index, /**< property name index */
+                                     ecma_value_t value) /**< value to be set */
+{
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+  uint32_t old_length = ext_obj_p->u.array.length;
+
+  if (!ecma_is_value_number (value) || index > old_length
+      || !ecma_fast_array_convert_to_double (context_p, object_p, true))
+  {
+    ecma_fast_array_convert_to_generic (context_p, object_p);
+    return false;
+  }
+
+  ecma_number_t *numbers_p;
+
+  if (JJS_LIKELY (index < old_length))
+  {
+    numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+  }
+  else
+  {
+    numbers_p = ecma_fast_array_extend_double (context_p, object_p, index + 1);
+  }
+
+  numbers_p[index] = ecma_get_number_from_value (context_p, value);
+  return true;
+} /* ecma_fast_array_set_double_property */
+
 /**
  * [[Put]] operation for a fast access mode array
  *
@@ -362,6 +549,16 @@ ecma_fast_array_set_property (ecma_context_t *context_p, /**< JJS context */
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
   uint32_t old_length = ext_obj_p->u.array.length;
 
+  if (JJS_UNLIKELY (ext_obj_p->u.array.length_prop_and_hole_count & ECMA_FAST_ARRAY_DOUBLE_ELEMENTS)
+      || (ecma_is_value_float_number (value)
+          && !(ext_obj_p->u.array.length_prop_and_hole_count & ECMA_FAST_ARRAY_GENERIC_ELEMENTS)))
+  {
+    if (ecma_fast_array_set_double_property (context_p, object_p, index, value))
+    {
+      return true;
+    }
+  }
+
   ecma_value_t *values_p;
 
   if (JJS_LIKELY (index < old_length))
@@ -450,6 +647,7 @@ ecma_fast_array_extend (ecma_context_t *context_p, /**< JJS context */
 
   JJS_ASSERT (old_length < new_length);
 
+  ecma_fast_array_convert_to_generic (context_p, object_p);
   ecma_ref_object (object_p);
 
   ecma_value_t *new_values_p;
@@ -482,6 +680,55 @@ ecma_fast_array_extend (ecma_context_t *context_p, /**< JJS context */
   return new_values_p;
 } /* ecma_fast_array_extend */
 
+/**
+ * Extend the underlying double buffer of a fast mode access array for the given new length
+ *
+ * Note: the new elements are not initialized, the caller must set all of them
+ *
+ * @return pointer to the extended underlying double buffer
+ */
+ecma_number_t *
+ecma_fast_array_extend_double (ecma_context_t *context_p, /**< JJS context */
+                               ecma_object_t *object_p, /**< fast access mode array object */
+                               uint32_t new_length) /**< new length of the fast access mode array */
+{
+  JJS_ASSERT (ecma_fast_array_has_double_elements (object_p));
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+  uint32_t old_length = ext_obj_p->u.array.length;
+
+  JJS_ASSERT (old_length < new_length);
+
+  const uint32_t old_length_aligned = ECMA_FAST_ARRAY_ALIGN_LENGTH (old_length);
+  const uint32_t new_length_aligned = ECMA_FAST_ARRAY_ALIGN_LENGTH (new_length);
+  ecma_number_t *numbers_p;
+
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    ecma_ref_object (object_p);
+    numbers_p = jmem_heap_alloc_block (context_p, new_length_aligned * sizeof (ecma_number_t));
+    ecma_deref_object (object_p);
+  }
+  else
+  {
+    numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+
+    if (new_length_aligned != old_length_aligned)
+    {
+      ecma_ref_object (object_p);
+      numbers_p = (ecma_number_t *) jmem_heap_realloc_block (context_p,
+                                                             numbers_p,
+                                                             old_length_aligned * sizeof (ecma_number_t),
+                                                             new_length_aligned * sizeof (ecma_number_t));
+      ecma_deref_object (object_p);
+    }
+  }
+
+  ext_obj_p->u.array.length = new_length;
+  ECMA_SET_NON_NULL_POINTER (context_p, object_p->u1.property_list_cp, numbers_p);
+
+  return numbers_p;
+} /* ecma_fast_array_extend_double */
+
 /**
  * Delete the array object's property referenced by its value pointer.
  *
@@ -510,6 +757,8 @@ ecma_array_object_delete_property (ecma_context_t *context_p, /**< JJS context *
   JJS_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
   JJS_ASSERT (index < ext_obj_p->u.array.length);
 
+  ecma_fast_array_convert_to_generic (context_p, object_p);
+
   ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
   if (ecma_is_value_array_hole (values_p[index]))
@@ -524,6 +773,41 @@ ecma_array_object_delete_property (ecma_context_t *context_p, /**< JJS context *
   return true;
 } /* ecma_array_object_delete_property */
 
+/**
+ * Shrink the underlying double buffer of a fast access mode array to the given new length
+ */
+static void
+ecma_fast_array_shrink_double (ecma_context_t *context_p, /**< JJS context */
+                               ecma_object_t *object_p, /**< fast access mode array with double elements */
+                               uint32_t new_length) /**< new length of the fast access mode array */
+{
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
+  ecma_number_t *numbers_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+
+  const uint32_t old_aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (ext_obj_p->u.array.length);
+  const uint32_t new_aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (new_length);
+
+  ext_obj_p->u.array.length = new_length;
+
+  if (new_length == 0)
+  {
+    jmem_heap_free_block (context_p, numbers_p, old_aligned_length * sizeof (ecma_number_t));
+    object_p->u1.property_list_cp = JMEM_CP_NULL;
+    return;
+  }
+
+  if (new_aligned_length != old_aligned_length)
+  {
+    ecma_ref_object (object_p);
+    numbers_p = (ecma_number_t *) jmem_heap_realloc_block (context_p,
+                                                           numbers_p,
+                                                           old_aligned_length * sizeof (ecma_number_t),
+                                                           new_aligned_length * sizeof (ecma_number_t));
+    ECMA_SET_NON_NULL_POINTER (context_p, object_p->u1.property_list_cp, numbers_p);
+    ecma_deref_object (object_p);
+  }
+} /* ecma_fast_array_shrink_double */
+
 /**
  * Low level delete of fast access mode array items
  *
@@ -538,12 +822,19 @@ ecma_delete_fast_array_properties (ecma_context_t *context_p, /**< JJS context *
 
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
 
+  uint32_t old_length = ext_obj_p->u.array.length;
+  JJS_ASSERT (new_length < old_length);
+
+  if (ecma_fast_array_has_double_elements (object_p))
+  {
+    ecma_fast_array_shrink_double (context_p, object_p, new_length);
+    return new_length;
+  }
+
   ecma_ref_object (object_p);
   ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
-  uint32_t old_length = ext_obj_p->u.array.length;
   const uint32_t old_aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (old_length);
-  JJS_ASSERT (new_length < old_length);
 
   for (uint32_t i = new_length; i < old_length; i++)
   {
@@ -650,11 +941,12 @@ ecma_fast_array_object_own_property_keys (ecma_context_t *context_p, /**< JJS co
 
     if (length != 0)
     {
+      bool has_holes = !ecma_fast_array_has_double_elements (object_p);
       ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
       for (uint32_t i = 0; i < length; i++)
       {
-        if (ecma_is_value_array_hole (values_p[i]))
+        if (has_holes && ecma_is_value_array_hole (values_p[i]))
         {
           continue;
         }
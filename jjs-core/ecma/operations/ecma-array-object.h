@@ -38,6 +38,16 @@
  * - The conversion is also required when a property is set if:
  *  - The property name is not an array index
  *  - The new hole count of the array would reach ECMA_FAST_ARRAY_MAX_NEW_HOLES_COUNT
+ *
+ * Element kinds of fast access mode arrays:
+ *
+ * - Generic: the buffer stores ecma_value_t elements and may contain array holes
+ * - Double (ECMA_FAST_ARRAY_DOUBLE_ELEMENTS): the buffer stores unboxed ecma_number_t elements and has no holes
+ *  - An array without holes is switched to double elements when a non-integer number is stored into it
+ *    and all of its current elements are numbers
+ *  - Storing a non-number value, creating a hole or any operation which is not aware of the double buffer
+ *    boxes the elements again and sets ECMA_FAST_ARRAY_GENERIC_ELEMENTS, so the array never goes back
+ *    to double elements
  */
 
 /**
@@ -76,8 +86,16 @@ bool ecma_op_array_is_fast_array (ecma_extended_object_t *array_p);
 
 uint32_t ecma_fast_array_get_hole_count (ecma_object_t *obj_p);
 
+bool ecma_fast_array_has_double_elements (ecma_object_t *obj_p);
+
+bool ecma_fast_array_convert_to_double (ecma_context_t *context_p, ecma_object_t *object_p, bool keep_values);
+
+void ecma_fast_array_convert_to_generic (ecma_context_t *context_p, ecma_object_t *object_p);
+
 ecma_value_t *ecma_fast_array_extend (ecma_context_t *context_p, ecma_object_t *object_p, uint32_t new_lengt);
 
+ecma_number_t *ecma_fast_array_extend_double (ecma_context_t *context_p, ecma_object_t *object_p, uint32_t new_length);
+
 bool ecma_fast_array_set_property (ecma_context_t *context_p, ecma_object_t *object_p, uint32_t index, ecma_value_t value);
 
 bool ecma_array_object_delete_property (ecma_context_t *context_p, ecma_object_t *object_p, ecma_string_t *property_name_p);
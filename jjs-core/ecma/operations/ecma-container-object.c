@@ -16,6 +16,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-big-uint.h"
 #include "ecma-builtin-helpers.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
@@ -37,12 +38,35 @@
  * @{
  */
 
+/**
+ * Minimum number of live entries required to build a hash index for the internal buffer.
+ * Smaller containers are searched linearly.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_THRESHOLD 8
+
+/**
+ * Minimum number of slots of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_MIN_CAPACITY 16
+
+/**
+ * Get the slots of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_SLOTS(index_p) ((uint32_t *) ((index_p) + 1))
+
+/**
+ * Compute the total allocated size of a hash index based on its capacity.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE(capacity) \
+  (sizeof (ecma_container_hash_index_t) + (capacity) * sizeof (uint32_t))
+
 /**
  * Create a new internal buffer.
  *
  * Note:
  *   The first element of the collection tracks the size of the buffer.
  *   ECMA_VALUE_EMPTY values are not calculated into the size.
+ *   The second element of the collection is the (optional) hash index of the entries.
  *
  * @return pointer to the internal buffer
  */
@@ -50,11 +74,166 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (ecma_context_t *context_p)
 {
   ecma_collection_t *collection_p = ecma_new_collection (context_p);
-  ecma_collection_push_back (context_p, collection_p, (ecma_value_t) 0);
+  ecma_value_t header[] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (context_p, collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (context_p, ECMA_CONTAINER_HASH_INDEX (collection_p), NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Calculate the hash of a container key.
+ *
+ * Note:
+ *   Keys which are equal according to SameValueZero have the same hash.
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_op_container_hash_key (ecma_context_t *context_p, /**< JJS context */
+                            ecma_value_t key) /**< key */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_integer_number (key))
+  {
+    hash = (uint32_t) ecma_get_integer_from_value (key);
+  }
+  else if (ecma_is_value_float_number (key))
+  {
+    ecma_number_t num = ecma_get_float_from_value (context_p, key);
+
+    if (ecma_number_is_nan (num))
+    {
+      hash = 0x7ff80000;
+    }
+    else if (num >= ECMA_INTEGER_NUMBER_MIN && num <= ECMA_INTEGER_NUMBER_MAX
+             && (ecma_number_t) (ecma_integer_value_t) num == num)
+    {
+      /* Integral floats (including -0) must match their integer representation. */
+      hash = (uint32_t) (ecma_integer_value_t) num;
+    }
+    else
+    {
+      hash = lit_utf8_string_calc_hash ((const lit_utf8_byte_t *) &num, sizeof (ecma_number_t));
+    }
+  }
+  else if (ecma_is_value_string (key))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (context_p, key));
+  }
+#if JJS_BUILTIN_BIGINT
+  else if (ecma_is_value_bigint (key) && key != ECMA_BIGINT_ZERO)
+  {
+    ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (context_p, key);
+
+    hash = lit_utf8_string_calc_hash ((const lit_utf8_byte_t *) ECMA_BIGINT_GET_DIGITS (bigint_p, 0),
+                                      ECMA_BIGINT_GET_SIZE (bigint_p));
+    hash ^= bigint_p->u.bigint_sign_and_size;
+  }
+#endif /* JJS_BUILTIN_BIGINT */
+  else
+  {
+    /* Objects and symbols are compared by identity, simple values are unique. */
+    hash = (uint32_t) key;
+  }
+
+  /* Spread the bits, since the low bits of pointers and integers are often the same. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+
+  return hash;
+} /* ecma_op_container_hash_key */
+
+/**
+ * Insert an entry offset into a hash index. The index must have a free slot.
+ */
+static void
+ecma_op_container_hash_index_insert (ecma_container_hash_index_t *index_p, /**< hash index */
+                                     uint32_t hash, /**< hash of the entry's key */
+                                     uint32_t offset) /**< offset of the entry */
+{
+  uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p);
+  uint32_t mask = index_p->capacity - 1;
+  uint32_t slot = hash & mask;
+
+  while (slots_p[slot] != 0)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  slots_p[slot] = offset + 1;
+  index_p->used_count++;
+} /* ecma_op_container_hash_index_insert */
+
+/**
+ * Release the hash index of the internal buffer.
+ */
+static void
+ecma_op_container_hash_index_free (ecma_context_t *context_p, /**< JJS context */
+                                   ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (context_p,
+                                                 ecma_container_hash_index_t,
+                                                 ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p != NULL)
+  {
+    jmem_heap_free_block (context_p, index_p, ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE (index_p->capacity));
+    ECMA_SET_INTERNAL_VALUE_ANY_POINTER (context_p, ECMA_CONTAINER_HASH_INDEX (container_p), NULL);
+  }
+} /* ecma_op_container_hash_index_free */
+
+/**
+ * (Re)build the hash index of the internal buffer from its live entries.
+ *
+ * Note:
+ *   If the allocation fails, the container falls back to linear search.
+ */
+static void
+ecma_op_container_hash_index_rebuild (ecma_context_t *context_p, /**< JJS context */
+                                      ecma_collection_t *container_p, /**< internal container pointer */
+                                      uint8_t entry_size) /**< size of the entries */
+{
+  ecma_op_container_hash_index_free (context_p, container_p);
+
+  uint32_t live_count = ECMA_CONTAINER_GET_SIZE (container_p);
+  uint32_t capacity = ECMA_CONTAINER_HASH_INDEX_MIN_CAPACITY;
+
+  /* At least half of the slots must be unused. */
+  while (capacity < live_count * 2)
+  {
+    capacity <<= 1;
+  }
+
+  size_t total_size = ECMA_CONTAINER_HASH_INDEX_GET_TOTAL_SIZE (capacity);
+  ecma_container_hash_index_t *index_p;
+  index_p = (ecma_container_hash_index_t *) jmem_heap_alloc_block_null_on_error (context_p, total_size);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  memset (index_p, 0, total_size);
+  index_p->capacity = capacity;
+
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_container_hash_index_insert (index_p, ecma_op_container_hash_key (context_p, start_p[i]), i);
+    }
+  }
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (context_p, ECMA_CONTAINER_HASH_INDEX (container_p), index_p);
+} /* ecma_op_container_hash_index_rebuild */
+
 /**
  * Append values to the internal buffer.
  */
@@ -78,6 +257,31 @@ ecma_op_internal_buffer_append (ecma_context_t *context_p, /**< JJS context */
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (context_p,
+                                                 ecma_container_hash_index_t,
+                                                 ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p == NULL)
+  {
+    if (ECMA_CONTAINER_GET_SIZE (container_p) >= ECMA_CONTAINER_HASH_INDEX_THRESHOLD)
+    {
+      ecma_op_container_hash_index_rebuild (context_p, container_p, entry_size);
+    }
+    return;
+  }
+
+  /* Keep the load factor (including deleted entries) below 3/4. */
+  if ((index_p->used_count + 1) * 4 > index_p->capacity * 3)
+  {
+    ecma_op_container_hash_index_rebuild (context_p, container_p, entry_size);
+    return;
+  }
+
+  uint32_t offset = ECMA_CONTAINER_ENTRY_COUNT (container_p) - entry_size;
+  ecma_op_container_hash_index_insert (index_p, ecma_op_container_hash_key (context_p, key_arg), offset);
 } /* ecma_op_internal_buffer_append */
 
 /**
@@ -136,9 +340,35 @@ ecma_op_internal_buffer_find (ecma_context_t *context_p, /**< JJS context */
 {
   JJS_ASSERT (container_p != NULL);
 
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+  ecma_container_hash_index_t *index_p;
+  index_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (context_p,
+                                                 ecma_container_hash_index_t,
+                                                 ECMA_CONTAINER_HASH_INDEX (container_p));
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_HASH_INDEX_SLOTS (index_p);
+    uint32_t mask = index_p->capacity - 1;
+    uint32_t slot = ecma_op_container_hash_key (context_p, key_arg) & mask;
+
+    while (slots_p[slot] != 0)
+    {
+      ecma_value_t *entry_p = start_p + (slots_p[slot] - 1);
+
+      if (ecma_op_same_value_zero (context_p, *entry_p, key_arg, false))
+      {
+        return entry_p;
+      }
+
+      slot = (slot + 1) & mask;
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -346,6 +576,7 @@ ecma_op_container_free_entries (ecma_context_t *context_p, ecma_object_t *object
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
+  ecma_op_container_hash_index_free (context_p, container_p);
 } /* ecma_op_container_free_entries */
 
 /**
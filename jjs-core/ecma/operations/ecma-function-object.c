@@ -1136,7 +1136,17 @@ ecma_op_function_call_simple (ecma_context_t *context_p, /**< JJS context */
   if (!(status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED))
   {
     shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV;
-    scope_p = ecma_create_decl_lex_env (context_p, scope_p);
+
+    if (status_flags & CBC_CODE_FLAGS_HAS_SLOT_TABLE)
+    {
+      /* The first item of the slot table is the number of binding slots. */
+      uint16_t slot_count = ecma_compiled_code_resolve_slot_table (bytecode_data_p)[0];
+      scope_p = ecma_create_slot_lex_env (context_p, scope_p, slot_count);
+    }
+    else
+    {
+      scope_p = ecma_create_decl_lex_env (context_p, scope_p);
+    }
   }
 
   /* 1. */
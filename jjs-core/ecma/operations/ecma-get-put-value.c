@@ -321,6 +321,42 @@ ecma_op_put_value_lex_env_base (ecma_context_t *context_p, /**< JJS context */
   return ECMA_VALUE_EMPTY;
 } /* ecma_op_put_value_lex_env_base */
 
+/**
+ * PutValue operation part for identifiers, which may be resolved to a binding slot
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_op_put_slot_value (ecma_context_t *context_p, /**< JJS context */
+                        ecma_object_t *lex_env_p, /**< lexical environment */
+                        uint16_t slot_info, /**< slot info of the variable */
+                        ecma_string_t *name_p, /**< variable name */
+                        bool is_strict, /**< flag indicating strict mode */
+                        ecma_value_t value) /**< ECMA-value */
+{
+  if (slot_info != 0)
+  {
+    ecma_object_t *slot_env_p = lex_env_p;
+    ecma_property_t *property_p = ecma_op_find_slot_binding (context_p, &slot_env_p, slot_info, name_p);
+
+    if (property_p != NULL)
+    {
+      ecma_property_value_t *property_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+
+      if ((*property_p & ECMA_PROPERTY_FLAG_WRITABLE) && property_value_p->value != ECMA_VALUE_UNINITIALIZED)
+      {
+        ecma_named_data_property_assign_value (context_p, slot_env_p, property_value_p, value);
+        return ECMA_VALUE_EMPTY;
+      }
+
+      return ecma_op_raise_set_binding_error (context_p, property_p, is_strict);
+    }
+  }
+
+  return ecma_op_put_value_lex_env_base (context_p, lex_env_p, name_p, is_strict, value);
+} /* ecma_op_put_slot_value */
+
 /**
  * @}
  * @}
@@ -51,6 +51,12 @@ ecma_value_t ecma_op_put_value_lex_env_base (ecma_context_t *context_p,
                                              ecma_string_t *var_name_string_p,
                                              bool is_strict,
                                              ecma_value_t value);
+ecma_value_t ecma_op_put_slot_value (ecma_context_t *context_p,
+                                     ecma_object_t *lex_env_p,
+                                     uint16_t slot_info,
+                                     ecma_string_t *name_p,
+                                     bool is_strict,
+                                     ecma_value_t value);
 
 /* ECMA-262 v5, Table 17. Abstract methods of Environment Records */
 ecma_value_t ecma_op_has_binding (ecma_context_t *context_p, ecma_object_t *lex_env_p, ecma_string_t *name_p);
@@ -256,6 +256,18 @@ ecma_op_object_get_own_property (ecma_context_t *context_p, /**< JJS context */
         {
           if (JJS_LIKELY (index < ext_object_p->u.array.length))
           {
+            if (ecma_fast_array_has_double_elements (object_p))
+            {
+              if (options & ECMA_PROPERTY_GET_VALUE)
+              {
+                ecma_number_t *numbers_p =
+                  ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+                property_ref_p->virtual_value = ecma_make_number_value (context_p, numbers_p[index]);
+              }
+
+              return ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE | ECMA_PROPERTY_VIRTUAL;
+            }
+
             ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
             if (ecma_is_value_array_hole (values_p[index]))
@@ -616,6 +628,13 @@ ecma_op_object_find_own (ecma_context_t *context_p, /**< JJS context */
         {
           if (JJS_LIKELY (index < ext_object_p->u.array.length))
           {
+            if (ecma_fast_array_has_double_elements (object_p))
+            {
+              ecma_number_t *numbers_p =
+                ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+              return ecma_make_number_value (context_p, numbers_p[index]);
+            }
+
             ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
             return (ecma_is_value_array_hole (values_p[index]) ? ECMA_VALUE_NOT_FOUND
@@ -276,6 +276,88 @@ ecma_op_object_bound_environment_resolve_reference_value (ecma_context_t *contex
   return ECMA_IS_VALUE_ERROR (blocked) ? blocked : ECMA_VALUE_NOT_FOUND;
 } /* ecma_op_object_bound_environment_resolve_reference_value */
 
+/**
+ * Find the binding of an identifier, which was resolved to a binding slot by the parser.
+ *
+ * The slot info gives the number of environments with binding slots which must be passed
+ * to reach the environment of the binding. Other environments of the scope chain cannot
+ * contain a binding with the same name (see parser_resolve_binding_slots).
+ *
+ * @return pointer to the binding, and the environment of the binding is stored into lex_env_p
+ *         NULL - if the binding is not created yet
+ */
+ecma_property_t *
+ecma_op_find_slot_binding (ecma_context_t *context_p, /**< JJS context */
+                           ecma_object_t **lex_env_p, /**< [in, out] starting lexical environment */
+                           uint16_t slot_info, /**< slot info of the identifier */
+                           ecma_string_t *name_p) /**< identifier's name */
+{
+  uint32_t depth = CBC_SLOT_INFO_GET_DEPTH (slot_info);
+  ecma_object_t *slot_env_p = *lex_env_p;
+
+  JJS_ASSERT (depth > 0);
+
+  while (!ECMA_LEX_ENV_HAS_SLOTS (slot_env_p) || --depth > 0)
+  {
+    if (slot_env_p->u2.outer_reference_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    slot_env_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, slot_env_p->u2.outer_reference_cp);
+  }
+
+  ecma_lexical_environment_slots_t *slots_p = (ecma_lexical_environment_slots_t *) slot_env_p;
+  uint32_t index = CBC_SLOT_INFO_GET_INDEX (slot_info);
+
+  JJS_ASSERT (index < slots_p->slot_count);
+
+  ecma_property_t *property_p = slots_p->slots[index];
+
+  if (property_p == NULL)
+  {
+    property_p = ecma_find_named_property (context_p, slot_env_p, name_p);
+    slots_p->slots[index] = property_p;
+  }
+
+  JJS_ASSERT (property_p == ecma_find_named_property (context_p, slot_env_p, name_p));
+
+  *lex_env_p = slot_env_p;
+  return property_p;
+} /* ecma_op_find_slot_binding */
+
+/**
+ * Resolve value corresponding to an identifier, which may be resolved to a binding slot.
+ *
+ * @return value of the reference
+ */
+ecma_value_t
+ecma_op_resolve_slot_reference_value (ecma_context_t *context_p, /**< JJS context */
+                                      ecma_object_t *lex_env_p, /**< starting lexical environment */
+                                      uint16_t slot_info, /**< slot info of the identifier */
+                                      ecma_string_t *name_p) /**< identifier's name */
+{
+  if (slot_info != 0)
+  {
+    ecma_object_t *slot_env_p = lex_env_p;
+    ecma_property_t *property_p = ecma_op_find_slot_binding (context_p, &slot_env_p, slot_info, name_p);
+
+    if (property_p != NULL)
+    {
+      ecma_property_value_t *property_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+
+      if (JJS_UNLIKELY (property_value_p->value == ECMA_VALUE_UNINITIALIZED))
+      {
+        return ecma_raise_reference_error (context_p, ECMA_ERR_LET_CONST_NOT_INITIALIZED);
+      }
+
+      return ecma_fast_copy_value (context_p, property_value_p->value);
+    }
+  }
+
+  return ecma_op_resolve_reference_value (context_p, lex_env_p, name_p);
+} /* ecma_op_resolve_slot_reference_value */
+
 /**
  * Resolve value corresponding to reference.
  *
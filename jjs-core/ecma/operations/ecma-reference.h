@@ -29,6 +29,8 @@
 
 ecma_object_t *ecma_op_resolve_reference_base (ecma_context_t *context_p, ecma_object_t *lex_env_p, ecma_string_t *name_p);
 ecma_value_t ecma_op_resolve_reference_value (ecma_context_t *context_p, ecma_object_t *lex_env_p, ecma_string_t *name_p);
+ecma_property_t *ecma_op_find_slot_binding (ecma_context_t *context_p, ecma_object_t **lex_env_p, uint16_t slot_info, ecma_string_t *name_p);
+ecma_value_t ecma_op_resolve_slot_reference_value (ecma_context_t *context_p, ecma_object_t *lex_env_p, uint16_t slot_info, ecma_string_t *name_p);
 ecma_value_t ecma_op_object_bound_environment_resolve_reference_value (ecma_context_t *context_p, ecma_object_t *lex_env_p, ecma_string_t *name_p);
 ecma_value_t ecma_op_resolve_super_base (ecma_context_t *context_p, ecma_object_t *lex_env_p);
 
@@ -527,6 +527,114 @@ ecma_regexp_is_word_boundary (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context *
   return lit_char_is_word_char (left_cp) != lit_char_is_word_char (right_cp);
 } /* ecma_regexp_is_word_boundary */
 
+/**
+ * Check if a code point is matched by a character class.
+ *
+ * @return true, if the code point matches the class
+ *         false, otherwise
+ */
+static inline bool JJS_ATTR_ALWAYS_INLINE
+ecma_regexp_check_char_class (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                              const uint8_t **bc_p, /**< [in, out] pointer to the class operands */
+                              lit_code_point_t cp) /**< code point */
+{
+  const uint8_t *class_p = *bc_p;
+  const uint8_t flags = re_get_byte (&class_p);
+  uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&class_p) : 0;
+  uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&class_p) : 0;
+  const bool is_inverted = (flags & RE_CLASS_INVERT) != 0;
+
+  uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
+  while (escape_count > 0)
+  {
+    escape_count--;
+    const ecma_class_escape_t escape = re_get_byte (&class_p);
+    if (ecma_regexp_check_class_escape (cp, escape))
+    {
+      goto class_found;
+    }
+  }
+
+  while (char_count > 0)
+  {
+    char_count--;
+    const lit_code_point_t curr = re_get_char (&class_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+    if (cp == curr)
+    {
+      goto class_found;
+    }
+  }
+
+  while (range_count > 0)
+  {
+    range_count--;
+    const lit_code_point_t begin = re_get_char (&class_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+
+    if (cp < begin)
+    {
+      class_p += re_ctx_p->char_size;
+      continue;
+    }
+
+    const lit_code_point_t end = re_get_char (&class_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+    if (cp <= end)
+    {
+      goto class_found;
+    }
+  }
+
+  /* Not found */
+  *bc_p = class_p;
+  return is_inverted;
+
+class_found:
+  *bc_p = class_p + escape_count + (char_count + range_count * 2) * re_ctx_p->char_size;
+  return !is_inverted;
+} /* ecma_regexp_check_char_class */
+
+/**
+ * Check if a zero-width assertion holds at the current position.
+ *
+ * @return true, if the assertion holds
+ *         false, otherwise
+ */
+static inline bool JJS_ATTR_ALWAYS_INLINE
+ecma_regexp_check_assertion (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                             re_opcode_t op, /**< assertion opcode */
+                             const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  switch (op)
+  {
+    case RE_OP_ASSERT_LINE_START:
+    {
+      if (str_curr_p <= re_ctx_p->input_start_p)
+      {
+        return true;
+      }
+
+      return (re_ctx_p->flags & RE_FLAG_MULTILINE) && lit_char_is_line_terminator (lit_cesu8_peek_prev (str_curr_p));
+    }
+    case RE_OP_ASSERT_LINE_END:
+    {
+      if (str_curr_p >= re_ctx_p->input_end_p)
+      {
+        return true;
+      }
+
+      return (re_ctx_p->flags & RE_FLAG_MULTILINE) && lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p));
+    }
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    {
+      return ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p);
+    }
+    default:
+    {
+      JJS_ASSERT (op == RE_OP_ASSERT_NOT_WORD_BOUNDARY);
+      return !ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p);
+    }
+  }
+} /* ecma_regexp_check_assertion */
+
 /**
  * Recursive function for executing RegExp bytecode.
  *
@@ -1165,45 +1273,11 @@ ecma_regexp_run (ecma_context_t *context_p, /**< JJS context */
         continue;
       }
       case RE_OP_ASSERT_LINE_START:
-      {
-        if (str_curr_p <= re_ctx_p->input_start_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_prev (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_LINE_END:
-      {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_WORD_BOUNDARY:
-      {
-        if (!ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
       {
-        if (ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
+        if (!ecma_regexp_check_assertion (re_ctx_p, op, str_curr_p))
         {
           goto fail;
         }
@@ -1323,68 +1397,13 @@ ecma_regexp_run (ecma_context_t *context_p, /**< JJS context */
           goto fail;
         }
 
-        uint8_t flags = re_get_byte (&bc_p);
-        uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
-        uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
-
         const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
 
-        uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
-        while (escape_count > 0)
-        {
-          escape_count--;
-          const ecma_class_escape_t escape = re_get_byte (&bc_p);
-          if (ecma_regexp_check_class_escape (cp, escape))
-          {
-            goto class_found;
-          }
-        }
-
-        while (char_count > 0)
-        {
-          char_count--;
-          const lit_code_point_t curr = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp == curr)
-          {
-            goto class_found;
-          }
-        }
-
-        while (range_count > 0)
-        {
-          range_count--;
-          const lit_code_point_t begin = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-
-          if (cp < begin)
-          {
-            bc_p += re_ctx_p->char_size;
-            continue;
-          }
-
-          const lit_code_point_t end = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp <= end)
-          {
-            goto class_found;
-          }
-        }
-
-        /* Not found */
-        if (flags & RE_CLASS_INVERT)
-        {
-          continue;
-        }
-
-        goto fail;
-
-class_found:
-        if (flags & RE_CLASS_INVERT)
+        if (!ecma_regexp_check_char_class (re_ctx_p, &bc_p, cp))
         {
           goto fail;
         }
 
-        const uint32_t chars_size = char_count * re_ctx_p->char_size;
-        const uint32_t ranges_size = range_count * re_ctx_p->char_size * 2;
-        bc_p = bc_p + escape_count + chars_size + ranges_size;
         continue;
       }
       case RE_OP_UNICODE_PERIOD:
@@ -1467,6 +1486,455 @@ fail:
   }
 } /* ecma_regexp_run */
 
+/**
+ * Find the first position, starting from the current position, where a match of the RegExp can start.
+ *
+ * @return pointer to the first possible start of a match
+ *         NULL - if no match can start at or after the current position
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_prefilter (const ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                       const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  switch (re_ctx_p->prefilter_type)
+  {
+    case RE_PREFILTER_ANCHORED:
+    {
+      return (str_curr_p == re_ctx_p->input_start_p) ? str_curr_p : NULL;
+    }
+    case RE_PREFILTER_LITERAL:
+    {
+      return lit_utf8_string_find (str_curr_p,
+                                   (lit_utf8_size_t) (re_ctx_p->input_end_p - str_curr_p),
+                                   re_ctx_p->prefilter_p,
+                                   re_ctx_p->prefilter_size);
+    }
+    case RE_PREFILTER_FIRST_BYTES:
+    {
+      const uint8_t *const bitmap_p = re_ctx_p->prefilter_p;
+      const lit_utf8_byte_t *const str_start_p = str_curr_p;
+
+      /* The bitmap contains no continuation bytes, so every found position is a character boundary. */
+      for (; str_curr_p < re_ctx_p->input_end_p; str_curr_p++)
+      {
+        const lit_utf8_byte_t byte = *str_curr_p;
+
+        if (!(bitmap_p[byte >> 3] & (1u << (byte & 0x7))))
+        {
+          continue;
+        }
+
+        /* In unicode mode a match cannot start between the surrogates of a code point. */
+        if (JJS_UNLIKELY (re_ctx_p->flags & RE_FLAG_UNICODE) && str_curr_p - str_start_p >= LIT_UTF8_MAX_BYTES_IN_CODE_UNIT
+            && lit_is_code_point_utf16_low_surrogate (lit_cesu8_peek_next (str_curr_p))
+            && lit_is_code_point_utf16_high_surrogate (lit_cesu8_peek_prev (str_curr_p)))
+        {
+          continue;
+        }
+
+        return str_curr_p;
+      }
+
+      return NULL;
+    }
+    default:
+    {
+      JJS_ASSERT (re_ctx_p->prefilter_type == RE_PREFILTER_NONE);
+      return str_curr_p;
+    }
+  }
+} /* ecma_regexp_prefilter */
+
+/**
+ * Move the input string pointer forward, and advance its index by the number of skipped code units.
+ */
+static void
+ecma_regexp_skip_to (const lit_utf8_byte_t **str_curr_p, /**< [in, out] input string pointer */
+                     ecma_length_t *index_p, /**< [in, out] index of the input string pointer */
+                     const lit_utf8_byte_t *target_p, /**< new position of the input string pointer */
+                     bool is_ascii) /**< input string is ascii */
+{
+  const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (target_p - *str_curr_p);
+
+  *index_p += is_ascii ? skipped_size : lit_utf8_string_length (*str_curr_p, skipped_size);
+  *str_curr_p = target_p;
+} /* ecma_regexp_skip_to */
+
+/**
+ * Marker of a linear-time automaton stack entry which continues with an instruction.
+ */
+#define ECMA_REGEXP_NFA_NO_SLOT UINT32_MAX
+
+/**
+ * Linear-time automaton stack entry
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *value_p; /**< overwritten capture slot value */
+  uint32_t slot; /**< capture slot to restore, or ECMA_REGEXP_NFA_NO_SLOT */
+  uint32_t pc; /**< pending instruction */
+} ecma_regexp_nfa_entry_t;
+
+/**
+ * Linear-time automaton thread list
+ */
+typedef struct
+{
+  uint32_t count; /**< number of threads */
+  uint32_t *pc_p; /**< instruction of each thread */
+  const lit_utf8_byte_t **slots_p; /**< capture slots of each thread */
+} ecma_regexp_nfa_list_t;
+
+/**
+ * Linear-time automaton simulation state
+ */
+typedef struct
+{
+  ecma_regexp_ctx_t *re_ctx_p; /**< RegExp matcher context */
+  const re_nfa_inst_t *inst_p; /**< instructions */
+  const lit_utf8_byte_t **slots_p; /**< capture slots of the followed thread */
+  ecma_regexp_nfa_entry_t *stack_p; /**< stack of pending instructions and overwritten slots */
+  uint32_t *visited_p; /**< generation in which each instruction was last visited */
+  uint32_t generation; /**< current generation, one for each input position */
+  uint32_t slot_count; /**< number of capture slots */
+} ecma_regexp_nfa_t;
+
+/**
+ * Calculate the size of the working memory of a linear-time automaton.
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_regexp_nfa_buffer_size (const re_nfa_program_t *program_p, /**< automaton program */
+                             uint32_t captures_count) /**< number of capturing groups */
+{
+  const size_t slot_count = (size_t) captures_count * 2;
+
+  return ((2 * (size_t) program_p->thread_count + 1) * slot_count * sizeof (const lit_utf8_byte_t *)
+          + program_p->stack_size * sizeof (ecma_regexp_nfa_entry_t)
+          + (2 * (size_t) program_p->thread_count + program_p->inst_count) * sizeof (uint32_t));
+} /* ecma_regexp_nfa_buffer_size */
+
+/**
+ * Follow the non-consuming instructions of the automaton from an instruction, and add the reached consuming
+ * instructions to a thread list in priority order.
+ */
+static void
+ecma_regexp_nfa_add_thread (ecma_regexp_nfa_t *nfa_p, /**< automaton state */
+                            ecma_regexp_nfa_list_t *list_p, /**< thread list */
+                            uint32_t pc, /**< instruction */
+                            const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  const lit_utf8_byte_t **const slots_p = nfa_p->slots_p;
+  ecma_regexp_nfa_entry_t *const stack_p = nfa_p->stack_p;
+  ecma_regexp_nfa_entry_t *stack_top_p = stack_p;
+
+  while (true)
+  {
+    if (nfa_p->visited_p[pc] != nfa_p->generation)
+    {
+      nfa_p->visited_p[pc] = nfa_p->generation;
+      const re_nfa_inst_t *const inst_p = nfa_p->inst_p + pc;
+
+      switch (inst_p->opcode)
+      {
+        case RE_NFA_OP_JUMP:
+        {
+          pc = inst_p->arg1;
+          continue;
+        }
+        case RE_NFA_OP_SPLIT:
+        {
+          stack_top_p->slot = ECMA_REGEXP_NFA_NO_SLOT;
+          stack_top_p->pc = inst_p->arg2;
+          stack_top_p++;
+
+          pc = inst_p->arg1;
+          continue;
+        }
+        case RE_NFA_OP_SAVE:
+        {
+          /* Overwritten slots only need to be restored for the pending instructions. */
+          if (stack_top_p != stack_p)
+          {
+            stack_top_p->slot = inst_p->arg1;
+            stack_top_p->value_p = slots_p[inst_p->arg1];
+            stack_top_p++;
+          }
+
+          slots_p[inst_p->arg1] = str_curr_p;
+          pc++;
+          continue;
+        }
+        case RE_NFA_OP_RESET:
+        {
+          /* Captures are undefined if their begin slot is not set. */
+          for (uint32_t i = 0; i < inst_p->arg2; i++)
+          {
+            const uint32_t slot = (inst_p->arg1 + i) * 2;
+
+            if (stack_top_p != stack_p)
+            {
+              stack_top_p->slot = slot;
+              stack_top_p->value_p = slots_p[slot];
+              stack_top_p++;
+            }
+
+            slots_p[slot] = NULL;
+          }
+
+          pc++;
+          continue;
+        }
+        case RE_NFA_OP_ASSERT:
+        {
+          if (ecma_regexp_check_assertion (nfa_p->re_ctx_p, (re_opcode_t) inst_p->arg1, str_curr_p))
+          {
+            pc++;
+            continue;
+          }
+
+          break;
+        }
+        case RE_NFA_OP_CHAR:
+        case RE_NFA_OP_MATCH:
+        {
+          const uint32_t index = list_p->count++;
+          list_p->pc_p[index] = pc;
+          memcpy (list_p->slots_p + index * nfa_p->slot_count, slots_p, nfa_p->slot_count * sizeof (*slots_p));
+          break;
+        }
+        default:
+        {
+          JJS_ASSERT (inst_p->opcode == RE_NFA_OP_FAIL);
+          break;
+        }
+      }
+    }
+
+    /* Restore the overwritten slots, and continue with the next pending instruction. */
+    while (true)
+    {
+      if (stack_top_p == stack_p)
+      {
+        return;
+      }
+
+      stack_top_p--;
+
+      if (stack_top_p->slot == ECMA_REGEXP_NFA_NO_SLOT)
+      {
+        pc = stack_top_p->pc;
+        break;
+      }
+
+      slots_p[stack_top_p->slot] = stack_top_p->value_p;
+    }
+  }
+} /* ecma_regexp_nfa_add_thread */
+
+/**
+ * Check if the current character is matched by a character matching opcode.
+ *
+ * @return true, if the character matches
+ *         false, otherwise
+ */
+static bool
+ecma_regexp_nfa_check_char (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                            const uint8_t *bc_p, /**< pointer to the character matching opcode */
+                            lit_code_point_t cp, /**< current character */
+                            const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_CLASS_ESCAPE:
+    {
+      return ecma_regexp_check_class_escape (cp, (ecma_class_escape_t) re_get_byte (&bc_p));
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      return ecma_regexp_check_char_class (re_ctx_p, &bc_p, cp);
+    }
+    case RE_OP_UNICODE_PERIOD:
+    case RE_OP_PERIOD:
+    {
+      /* Line terminators are single code units, which are not changed by canonicalization. */
+      return (re_ctx_p->flags & RE_FLAG_DOTALL) || !lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p));
+    }
+    case RE_OP_CHAR:
+    {
+      return re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE) == cp;
+    }
+    default:
+    {
+      JJS_ASSERT (bc_p[-1] == RE_OP_BYTE);
+      return *bc_p == *str_curr_p;
+    }
+  }
+} /* ecma_regexp_nfa_check_char */
+
+/**
+ * Match a RegExp with its linear-time automaton.
+ *
+ * The automaton is simulated for all threads in parallel, one input character at a time. Threads are kept
+ * in priority order and only the first thread reaching an instruction at a given position survives, which
+ * gives the same result as the backtracking matcher.
+ *
+ * @return pointer to the end of the matched sub-string
+ *         NULL, if pattern did not match
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_nfa_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                     const uint8_t *bc_p, /**< pointer to the RegExp bytecode */
+                     const lit_utf8_byte_t *str_curr_p, /**< input string pointer */
+                     bool is_anchored) /**< only match at the current position */
+{
+  const re_nfa_program_t *program_p = re_ctx_p->nfa_p;
+  const uint32_t slot_count = re_ctx_p->captures_count * 2;
+  const uint32_t thread_count = program_p->thread_count;
+
+  ecma_regexp_nfa_t nfa;
+  ecma_regexp_nfa_list_t lists[2];
+
+  const lit_utf8_byte_t **slots_p = (const lit_utf8_byte_t **) re_ctx_p->nfa_buffer_p;
+  lists[0].slots_p = slots_p;
+  lists[1].slots_p = slots_p + thread_count * slot_count;
+  nfa.slots_p = slots_p + 2 * thread_count * slot_count;
+  nfa.stack_p = (ecma_regexp_nfa_entry_t *) (nfa.slots_p + slot_count);
+
+  uint32_t *pc_p = (uint32_t *) (nfa.stack_p + program_p->stack_size);
+  lists[0].pc_p = pc_p;
+  lists[1].pc_p = pc_p + thread_count;
+  nfa.visited_p = pc_p + 2 * thread_count;
+
+  nfa.re_ctx_p = re_ctx_p;
+  nfa.inst_p = RE_NFA_GET_INSTRUCTIONS (program_p);
+  nfa.generation = 1;
+  nfa.slot_count = slot_count;
+  memset (nfa.visited_p, 0, program_p->inst_count * sizeof (uint32_t));
+
+  ecma_regexp_nfa_list_t *current_list_p = lists;
+  ecma_regexp_nfa_list_t *next_list_p = lists + 1;
+  const lit_utf8_byte_t *match_end_p = NULL;
+
+  current_list_p->count = 0;
+
+  if (is_anchored)
+  {
+    memset (nfa.slots_p, 0, slot_count * sizeof (*nfa.slots_p));
+    ecma_regexp_nfa_add_thread (&nfa, current_list_p, 0, str_curr_p);
+  }
+
+  while (true)
+  {
+    if (!is_anchored && match_end_p == NULL)
+    {
+      if (current_list_p->count == 0 && re_ctx_p->prefilter_type != RE_PREFILTER_NONE)
+      {
+        /* Skip the positions where no match can start. */
+        const lit_utf8_byte_t *const str_start_p = str_curr_p;
+        str_curr_p = ecma_regexp_prefilter (re_ctx_p, str_curr_p);
+
+        if (str_curr_p == NULL)
+        {
+          return NULL;
+        }
+
+        if (str_curr_p != str_start_p && JJS_UNLIKELY (++nfa.generation == 0))
+        {
+          memset (nfa.visited_p, 0, program_p->inst_count * sizeof (uint32_t));
+          nfa.generation = 1;
+        }
+      }
+
+      /* A match starting at the current position has lower priority than the already running threads. */
+      memset (nfa.slots_p, 0, slot_count * sizeof (*nfa.slots_p));
+      ecma_regexp_nfa_add_thread (&nfa, current_list_p, 0, str_curr_p);
+    }
+    else if (current_list_p->count == 0)
+    {
+      return match_end_p;
+    }
+
+    const bool is_end = (str_curr_p >= re_ctx_p->input_end_p);
+    const lit_utf8_byte_t *str_next_p = str_curr_p;
+    lit_code_point_t cp = LIT_INVALID_CP;
+
+    if (!is_end)
+    {
+      cp = ecma_regexp_advance (re_ctx_p, &str_next_p);
+    }
+
+    if (JJS_UNLIKELY (++nfa.generation == 0))
+    {
+      memset (nfa.visited_p, 0, program_p->inst_count * sizeof (uint32_t));
+      nfa.generation = 1;
+    }
+
+    next_list_p->count = 0;
+
+    for (uint32_t i = 0; i < current_list_p->count; i++)
+    {
+      const re_nfa_inst_t *const inst_p = nfa.inst_p + current_list_p->pc_p[i];
+      const lit_utf8_byte_t **const thread_slots_p = current_list_p->slots_p + i * slot_count;
+
+      if (inst_p->opcode == RE_NFA_OP_MATCH)
+      {
+        /* Threads with lower priority are discarded. */
+        for (uint32_t j = 0; j < re_ctx_p->captures_count; j++)
+        {
+          re_ctx_p->captures_p[j].begin_p = thread_slots_p[j * 2];
+          re_ctx_p->captures_p[j].end_p = thread_slots_p[j * 2 + 1];
+        }
+
+        match_end_p = str_curr_p;
+        break;
+      }
+
+      if (!is_end && ecma_regexp_nfa_check_char (re_ctx_p, bc_p + inst_p->arg1, cp, str_curr_p))
+      {
+        memcpy (nfa.slots_p, thread_slots_p, slot_count * sizeof (*nfa.slots_p));
+        ecma_regexp_nfa_add_thread (&nfa, next_list_p, current_list_p->pc_p[i] + 1, str_next_p);
+      }
+    }
+
+    if (is_end)
+    {
+      return match_end_p;
+    }
+
+    ecma_regexp_nfa_list_t *const list_p = current_list_p;
+    current_list_p = next_list_p;
+    next_list_p = list_p;
+    str_curr_p = str_next_p;
+  }
+} /* ecma_regexp_nfa_run */
+
+/**
+ * Find the first match of a RegExp with its linear-time automaton, starting from the current position.
+ *
+ * The current position and its index are advanced to the start of the match.
+ *
+ * @return pointer to the end of the matched sub-string
+ *         NULL, if pattern did not match
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_nfa_search (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                        const uint8_t *bc_p, /**< pointer to the RegExp bytecode */
+                        const lit_utf8_byte_t **str_curr_p, /**< [in, out] input string pointer */
+                        ecma_length_t *index_p, /**< [in, out] index of the input string pointer */
+                        bool is_ascii) /**< input string is ascii */
+{
+  const lit_utf8_byte_t *matched_p = ecma_regexp_nfa_run (re_ctx_p, bc_p, *str_curr_p, false);
+
+  if (matched_p != NULL)
+  {
+    ecma_regexp_skip_to (str_curr_p, index_p, re_ctx_p->captures_p[RE_GLOBAL_CAPTURE].begin_p, is_ascii);
+  }
+
+  return matched_p;
+} /* ecma_regexp_nfa_search */
+
 /**
  * Match a RegExp at a specific position in the input string.
  *
@@ -1479,6 +1947,11 @@ ecma_regexp_match (ecma_context_t *context_p, /**< JJS context */
                    const uint8_t *bc_p, /**< pointer to the current RegExp bytecode */
                    const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
 {
+  if (re_ctx_p->nfa_p != NULL)
+  {
+    return ecma_regexp_nfa_run (re_ctx_p, bc_p, str_curr_p, true);
+  }
+
   re_ctx_p->captures_p[RE_GLOBAL_CAPTURE].begin_p = str_curr_p;
 
   for (uint32_t i = 1; i < re_ctx_p->captures_count; ++i)
@@ -1545,6 +2018,73 @@ ecma_regexp_create_result_object (ecma_context_t *context_p, /**< JJS context */
   return ecma_make_object_value (context_p, result_p);
 } /* ecma_regexp_create_result_object */
 
+/**
+ * Find the index of the first position, starting from the given index, where a match of the RegExp can start.
+ *
+ * Note:
+ *      the sticky flag of the RegExp is ignored
+ *
+ * @return index of the first possible start of a match
+ *         length of the string - if no match can start at or after the given index
+ */
+static ecma_length_t
+ecma_regexp_prefilter_index (ecma_context_t *context_p, /**< JJS context */
+                             ecma_object_t *regexp_object_p, /**< RegExp object */
+                             ecma_string_t *string_p, /**< input string */
+                             ecma_length_t index) /**< start index */
+{
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) regexp_object_p;
+  re_compiled_code_t *bc_p = ECMA_GET_INTERNAL_VALUE_POINTER (context_p, re_compiled_code_t, ext_object_p->u.cls.u3.value);
+
+  if (bc_p->prefilter_type == RE_PREFILTER_NONE)
+  {
+    return index;
+  }
+
+  lit_utf8_size_t input_size;
+  lit_utf8_size_t input_length;
+  uint8_t input_flags = ECMA_STRING_FLAG_IS_ASCII;
+  lit_utf8_byte_t string_uint_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  const lit_utf8_byte_t *input_buffer_p =
+    ecma_string_get_chars (context_p, string_p, &input_size, &input_length, &string_uint_buffer[0], &input_flags);
+
+  JJS_ASSERT ((input_flags & ECMA_STRING_FLAG_MUST_BE_FREED) == 0);
+  JJS_ASSERT (index <= input_length);
+
+  const bool is_ascii = (input_flags & ECMA_STRING_FLAG_IS_ASCII) != 0;
+  const lit_utf8_byte_t *input_curr_p = input_buffer_p;
+
+  if (is_ascii)
+  {
+    input_curr_p += index;
+  }
+  else
+  {
+    for (ecma_length_t i = 0; i < index; i++)
+    {
+      lit_utf8_incr (&input_curr_p);
+    }
+  }
+
+  ecma_regexp_ctx_t re_ctx;
+  re_ctx.flags = bc_p->header.status_flags;
+  re_ctx.input_start_p = input_buffer_p;
+  re_ctx.input_end_p = input_buffer_p + input_size;
+  re_ctx.prefilter_p = RE_GET_PREFILTER (bc_p);
+  re_ctx.prefilter_type = bc_p->prefilter_type;
+  re_ctx.prefilter_size = bc_p->prefilter_size;
+
+  const lit_utf8_byte_t *start_p = ecma_regexp_prefilter (&re_ctx, input_curr_p);
+
+  if (start_p == NULL)
+  {
+    return input_length;
+  }
+
+  ecma_regexp_skip_to (&input_curr_p, &index, start_p, is_ascii);
+  return index;
+} /* ecma_regexp_prefilter_index */
+
 /**
  * Helper function to initialize a regexp match context
  */
@@ -1575,6 +2115,26 @@ ecma_regexp_initialize_context (ecma_context_t *context_p, /**< JJS context */
   {
     ctx_p->non_captures_p = jmem_heap_alloc_block (context_p, ctx_p->non_captures_count * sizeof (ecma_regexp_non_capture_t));
   }
+
+  /* Sticky patterns only match at the last index, so they never skip ahead. */
+  ctx_p->prefilter_p = RE_GET_PREFILTER (bc_p);
+  ctx_p->prefilter_type = (ctx_p->flags & RE_FLAG_STICKY) ? RE_PREFILTER_NONE : bc_p->prefilter_type;
+  ctx_p->prefilter_size = bc_p->prefilter_size;
+
+  ctx_p->nfa_p = NULL;
+
+  if (bc_p->nfa_offset != 0)
+  {
+    const re_nfa_program_t *program_p = RE_NFA_GET_PROGRAM (bc_p);
+    ctx_p->nfa_buffer_size = ecma_regexp_nfa_buffer_size (program_p, ctx_p->captures_count);
+    ctx_p->nfa_buffer_p = jmem_heap_alloc_block_null_on_error (context_p, ctx_p->nfa_buffer_size);
+
+    /* The backtracking matcher is used if there is not enough memory for the automaton. */
+    if (ctx_p->nfa_buffer_p != NULL)
+    {
+      ctx_p->nfa_p = program_p;
+    }
+  }
 } /* ecma_regexp_initialize_context */
 
 /**
@@ -1591,6 +2151,11 @@ ecma_regexp_cleanup_context (ecma_context_t *context_p, /**< JJS context */
   {
     jmem_heap_free_block (context_p, ctx_p->non_captures_p, ctx_p->non_captures_count * sizeof (ecma_regexp_non_capture_t));
   }
+
+  if (ctx_p->nfa_p != NULL)
+  {
+    jmem_heap_free_block (context_p, ctx_p->nfa_buffer_p, ctx_p->nfa_buffer_size);
+  }
 } /* ecma_regexp_cleanup_context */
 
 /**
@@ -1686,8 +2251,49 @@ ecma_regexp_exec_helper (ecma_context_t *context_p, /**< JJS context */
 
   /* 12. */
   JJS_ASSERT (index <= input_length);
+
+  if (re_ctx.nfa_p != NULL && !(re_ctx.flags & RE_FLAG_STICKY))
+  {
+    /* The automaton tries all starting positions in a single pass. */
+    matched_p = ecma_regexp_nfa_search (&re_ctx,
+                                        bc_start_p,
+                                        &input_curr_p,
+                                        &index,
+                                        (input_flags & ECMA_STRING_FLAG_IS_ASCII) != 0);
+
+    if (matched_p != NULL)
+    {
+      goto match_found;
+    }
+
+    if (re_ctx.flags & RE_FLAG_GLOBAL)
+    {
+      goto fail_put_lastindex;
+    }
+
+    goto match_failed;
+  }
+
   while (true)
   {
+    if (re_ctx.prefilter_type != RE_PREFILTER_NONE)
+    {
+      /* Skip the positions where no match can start. */
+      const lit_utf8_byte_t *start_p = ecma_regexp_prefilter (&re_ctx, input_curr_p);
+
+      if (start_p == NULL)
+      {
+        if (re_ctx.flags & RE_FLAG_GLOBAL)
+        {
+          goto fail_put_lastindex;
+        }
+
+        goto match_failed;
+      }
+
+      ecma_regexp_skip_to (&input_curr_p, &index, start_p, (input_flags & ECMA_STRING_FLAG_IS_ASCII) != 0);
+    }
+
     matched_p = ecma_regexp_match (context_p, &re_ctx, bc_start_p, input_curr_p);
 
     if (matched_p != NULL)
@@ -2107,9 +2713,37 @@ ecma_regexp_split_helper (ecma_context_t *context_p, /**< JJS context */
 
   ecma_string_t *const lastindex_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
 
+  /* The built-in 'exec' method has no side effects when no match starts at an index,
+   * so those indices can be skipped with the prefilter of the splitter. */
+  bool use_prefilter = false;
+
+  if (ecma_object_class_is (splitter_obj_p, ECMA_OBJECT_CLASS_REGEXP))
+  {
+    result = ecma_op_object_get_by_magic_id (context_p, splitter_obj_p, LIT_MAGIC_STRING_EXEC);
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      goto cleanup_array;
+    }
+
+    use_prefilter = (ecma_op_is_callable (context_p, result)
+                     && ecma_builtin_is_regexp_exec ((ecma_extended_object_t *) ecma_get_object_from_value (context_p, result)));
+    ecma_free_value (context_p, result);
+  }
+
   /* 24. */
   while (current_index < string_length)
   {
+    if (use_prefilter)
+    {
+      current_index = ecma_regexp_prefilter_index (context_p, splitter_obj_p, string_p, current_index);
+
+      if (current_index >= string_length)
+      {
+        break;
+      }
+    }
+
     /* 24.a-b. */
     ecma_value_t index_value = ecma_make_length_value (context_p, current_index);
     result = ecma_op_object_put (context_p, splitter_obj_p, lastindex_str_p, index_value, true);
@@ -2369,7 +3003,37 @@ ecma_regexp_replace_helper_fast (ecma_context_t *context_p, /**< JJS context */
 
   while (true)
   {
-    matched_p = ecma_regexp_match (context_p, &re_ctx, bc_start_p, current_p);
+    if (re_ctx.nfa_p != NULL && (re_ctx.flags & RE_FLAG_STICKY) == 0)
+    {
+      /* The automaton tries all remaining starting positions in a single pass. */
+      matched_p = ecma_regexp_nfa_search (&re_ctx,
+                                          bc_start_p,
+                                          &current_p,
+                                          &index,
+                                          (string_flags & ECMA_STRING_FLAG_IS_ASCII) != 0);
+
+      if (matched_p == NULL)
+      {
+        break;
+      }
+    }
+    else
+    {
+      if (re_ctx.prefilter_type != RE_PREFILTER_NONE)
+      {
+        /* Skip the positions where no match can start. */
+        const lit_utf8_byte_t *start_p = ecma_regexp_prefilter (&re_ctx, current_p);
+
+        if (start_p == NULL)
+        {
+          break;
+        }
+
+        ecma_regexp_skip_to (&current_p, &index, start_p, (string_flags & ECMA_STRING_FLAG_IS_ASCII) != 0);
+      }
+
+      matched_p = ecma_regexp_match (context_p, &re_ctx, bc_start_p, current_p);
+    }
 
     if (matched_p != NULL)
     {
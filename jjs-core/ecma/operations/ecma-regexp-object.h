@@ -19,6 +19,7 @@
 #include "ecma-globals.h"
 
 #include "re-compiler.h"
+#include "re-nfa.h"
 
 #if JJS_BUILTIN_REGEXP
 
@@ -143,6 +144,12 @@ typedef struct
   uint32_t non_captures_count; /**< number of non-capture groups */
   ecma_regexp_capture_t *captures_p; /**< capturing groups */
   ecma_regexp_non_capture_t *non_captures_p; /**< non-capturing groups */
+  const re_nfa_program_t *nfa_p; /**< linear-time automaton, NULL if the pattern is matched by backtracking */
+  uint8_t *nfa_buffer_p; /**< working memory of the linear-time automaton */
+  size_t nfa_buffer_size; /**< size of the working memory */
+  const uint8_t *prefilter_p; /**< literal prefix or first byte bitmap */
+  uint8_t prefilter_type; /**< re_prefilter_type_t */
+  uint8_t prefilter_size; /**< size of the literal prefix or the first byte bitmap */
   uint16_t flags; /**< RegExp flags */
   uint8_t char_size; /**< size of encoded characters */
 } ecma_regexp_ctx_t;
@@ -61,7 +61,10 @@ void *jjs_heap_alloc (jjs_context_t* context_p, jjs_size_t size);
 void jjs_heap_free (jjs_context_t* context_p, void *mem_p, jjs_size_t size);
 
 bool jjs_heap_stats (jjs_context_t* context_p, jjs_heap_stats_t *out_stats_p);
+bool jjs_regexp_cache_stats (jjs_context_t* context_p, jjs_regexp_cache_stats_t *out_stats_p);
 void jjs_heap_gc (jjs_context_t* context_p, jjs_gc_mode_t mode);
+bool jjs_heap_gc_step (jjs_context_t* context_p, uint32_t sweep_limit);
+jjs_value_t jjs_heap_snapshot (jjs_context_t *context_p, const jjs_wstream_t *wstream_p);
 
 bool jjs_foreach_live_object (jjs_context_t* context_p, jjs_foreach_live_object_cb_t callback, void *user_data);
 bool jjs_foreach_live_object_with_info (jjs_context_t* context_p,
@@ -125,6 +128,7 @@ bool jjs_validate_string (jjs_context_t* context_p, const jjs_char_t *buffer_p,
 bool JJS_ATTR_CONST jjs_feature_enabled (const jjs_feature_t feature);
 void
 jjs_register_magic_strings (jjs_context_t* context_p, const jjs_char_t *const *ext_strings_p, uint32_t count, const jjs_length_t *str_lengths_p);
+void jjs_time_zone_changed (jjs_context_t* context_p);
 
 jjs_optional_u32_t jjs_optional_u32 (uint32_t value);
 jjs_optional_encoding_t jjs_optional_encoding (jjs_encoding_t encoding);
@@ -238,6 +242,16 @@ bool jjs_frame_is_strict (jjs_context_t* context_p, jjs_frame_t *frame_p);
  * jjs-api-backtrace @}
  */
 
+/**
+ * @defgroup jjs-api-cpu-profiler CPU profiler
+ * @{
+ */
+jjs_value_t jjs_cpu_profiler_start (jjs_context_t *context_p, uint32_t interval_us);
+jjs_value_t jjs_cpu_profiler_stop (jjs_context_t *context_p, const jjs_wstream_t *wstream_p);
+/**
+ * jjs-api-cpu-profiler @}
+ */
+
 /**
  * @defgroup jjs-api-value Values
  * @{
@@ -1398,6 +1412,28 @@ jjs_value_t jjs_pmap_resolve_sz (jjs_context_t* context_p, const char* specifier
  * jjs-pmap-ops @}
  */
 
+/**
+ * @defgroup jjs-code-cache Module Code Cache
+ * @{
+ */
+
+/**
+ * @defgroup jjs-code-cache-ops Operations
+ * @{
+ */
+
+jjs_value_t jjs_code_cache (jjs_context_t* context_p, jjs_value_t dir, jjs_own_t dir_o);
+jjs_value_t jjs_code_cache_sz (jjs_context_t* context_p, const char* dir_p);
+bool jjs_code_cache_stats (jjs_context_t* context_p, jjs_code_cache_stats_t *out_stats_p);
+
+/**
+ * jjs-code-cache-ops @}
+ */
+
+/**
+ * jjs-code-cache @}
+ */
+
 /**
  * jjs-platform @}
  */
@@ -27,7 +27,7 @@ JJS_C_API_BEGIN
 /**
  * JJS snapshot format version.
  */
-#define JJS_SNAPSHOT_VERSION (71u)
+#define JJS_SNAPSHOT_VERSION (72u)
 
 /**
  * Flags for jjs_generate_snapshot and jjs_generate_function_snapshot.
@@ -80,6 +80,18 @@ jjs_value_t jjs_exec_snapshot (jjs_context_t* context_p,
                                uint32_t exec_snapshot_opts,
                                const jjs_exec_snapshot_option_values_t *options_values_p);
 
+jjs_value_t jjs_exec_snapshot_file (jjs_context_t* context_p,
+                                    jjs_value_t path,
+                                    jjs_own_t path_o,
+                                    size_t func_index,
+                                    uint32_t exec_snapshot_opts,
+                                    const jjs_exec_snapshot_option_values_t *options_values_p);
+jjs_value_t jjs_exec_snapshot_file_sz (jjs_context_t* context_p,
+                                       const char *path_p,
+                                       size_t func_index,
+                                       uint32_t exec_snapshot_opts,
+                                       const jjs_exec_snapshot_option_values_t *options_values_p);
+
 size_t jjs_merge_snapshots (jjs_context_t* context_p,
                             const uint32_t **inp_buffers_p,
                             size_t *inp_buffer_sizes_p,
@@ -135,8 +135,10 @@ typedef enum
   JJS_STATUS_PLATFORM_FILE_SIZE_TOO_BIG, /**< */
   JJS_STATUS_PLATFORM_FILE_SEEK_ERR, /**< */
   JJS_STATUS_PLATFORM_FILE_OPEN_ERR, /**< */
+  JJS_STATUS_PLATFORM_FILE_WRITE_ERR, /**< */
 
   JJS_STATUS_CONTEXT_VM_STACK_LIMIT_DISABLED,
+  JJS_STATUS_CONTEXT_VM_HEAP_GROWABLE_DISABLED,
 } jjs_status_t;
 
 /**
@@ -300,6 +302,10 @@ typedef enum
   JJS_FEATURE_PMAP, /**< Package Map support */
   JJS_FEATURE_VMOD, /**< Virtual Module support */
   JJS_FEATURE_VM_STACK_LIMIT, /**< VM stack limit size has been set at compile time. */
+  JJS_FEATURE_VM_HEAP_GROWABLE, /**< VM heap can grow beyond its initial size */
+  JJS_FEATURE_CODE_CACHE, /**< on-disk code cache of CommonJS and ES modules */
+  JJS_FEATURE_CPU_PROFILER, /**< sampling cpu profiler */
+  JJS_FEATURE_HEAP_SNAPSHOT, /**< heap snapshot export */
   JJS_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jjs_feature_t;
 
@@ -488,6 +494,31 @@ typedef struct
   size_t reserved[4]; /**< padding for future extensions */
 } jjs_heap_stats_t;
 
+/**
+ * Description of JJS RegExp cache stats.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t size; /**< maximum number of cached patterns */
+  size_t count; /**< number of currently cached patterns */
+  size_t hits; /**< number of compilations served from the cache */
+  size_t misses; /**< number of compilations not found in the cache */
+  size_t reserved[4]; /**< padding for future extensions */
+} jjs_regexp_cache_stats_t;
+
+/**
+ * Description of JJS module code cache stats.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t hits; /**< number of modules loaded from the code cache */
+  size_t misses; /**< number of cacheable modules not found in the code cache */
+  size_t writes; /**< number of modules written to the code cache */
+  size_t reserved[4]; /**< padding for future extensions */
+} jjs_code_cache_stats_t;
+
 /**
  * Call related information passed to jjs_external_handler_t.
  */
@@ -1418,10 +1449,37 @@ typedef struct
    * If JJS_VM_HEAP_STATIC is ON, the vm heap cannot be manually configured. If you try to
    * change the heap size, jjs_init will return an error code.
    *
+   * If JJS_VM_HEAP_GROWABLE is ON, this is the initial size of the vm heap.
+   *
    * Default: JJS_DEFAULT_VM_HEAP_SIZE
    */
   jjs_optional_u32_t vm_heap_size_kb;
 
+  /**
+   * Maximum size of the vm heap in kilobytes.
+   *
+   * When an allocation cannot be satisfied after a garbage collection, the vm heap grows by
+   * adding a segment, allocated with the context allocator, until this size is reached.
+   * Segments that become empty are returned to the context allocator after a garbage
+   * collection. If the value is not greater than vm_heap_size_kb, the vm heap does not grow.
+   *
+   * If JJS_VM_HEAP_GROWABLE is OFF, jjs_context_new will return an error status if you
+   * attempt to set this field.
+   *
+   * Default: JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB
+   */
+  jjs_optional_u32_t vm_heap_max_size_kb;
+
+  /**
+   * Minimum size of a segment added to the vm heap in kilobytes.
+   *
+   * If JJS_VM_HEAP_GROWABLE is OFF, jjs_context_new will return an error status if you
+   * attempt to set this field.
+   *
+   * Default: JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB
+   */
+  jjs_optional_u32_t vm_heap_step_size_kb;
+
   /**
    * VM stack size limit in kilobytes.
    *
@@ -1463,6 +1521,33 @@ typedef struct
    */
   jjs_optional_u32_t gc_new_objects_fraction;
 
+  /**
+   * Maximum number of unreachable objects freed by a garbage collection step.
+   *
+   * This limits the sweep only: garbage collections triggered by allocations mark all
+   * reachable objects at once, but free at most this many unreachable objects. The rest
+   * are freed by the following allocation triggered steps, which bounds the sweep part of
+   * a pause; the mark phase is not incremental. A high pressure garbage collection always
+   * frees all unreachable objects.
+   *
+   * If 0, all unreachable objects are freed in the same step.
+   *
+   * Default: JJS_DEFAULT_GC_SWEEP_LIMIT
+   */
+  jjs_optional_u32_t gc_sweep_limit;
+
+  /**
+   * Maximum number of compiled RegExp patterns kept in the RegExp cache.
+   *
+   * Compiling a RegExp with a pattern and flags found in the cache reuses the cached
+   * bytecode. When the cache is full, the least recently used pattern is evicted.
+   *
+   * If 0, the RegExp cache is disabled.
+   *
+   * Default: JJS_DEFAULT_REGEXP_CACHE_SIZE
+   */
+  jjs_optional_u32_t regexp_cache_size;
+
   /**
    * Size of scratch buffer in kilobytes.
    *
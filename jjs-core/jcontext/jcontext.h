@@ -83,7 +83,7 @@ struct jjs_context_t
   jmem_cellocator_t jmem_cellocator_32; /**< vm heap cell allocator. 32 byte cells. */
 
   uint32_t context_flags; /**< context flags */
-  jjs_allocator_t context_allocator; /**< allocator that created this context, scratch and vm heap. stored for cleanup only. */
+  jjs_allocator_t context_allocator; /**< allocator that created this context, scratch, vm heap and vm heap segments. */
   jjs_allocator_t vm_allocator; /**< vm allocator associated with the context */
   jjs_size_t context_block_size_b; /**< size of context allocation. used to free context. */
 
@@ -104,26 +104,47 @@ struct jjs_context_t
   uint32_t gc_limit; /**< allocation limit before triggering a gc */
   uint32_t gc_mark_limit; /**< gc mark recursion depth */
   uint32_t gc_new_objects_fraction; /**< number of new objects before triggering gc */
+  uint32_t gc_sweep_limit; /**< maximum number of objects freed by a gc step; 0 is unlimited */
 
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< improves deallocation performance */
   uint8_t* jmem_area_end; /**< precomputed address of end of heap; only for pointer validation */
 
+#if JJS_VM_HEAP_GROWABLE
+  uint32_t vm_heap_max_size; /**< maximum size of vm heap, including segments */
+  uint32_t vm_heap_step_size; /**< minimum size of a segment added to the vm heap */
+  uint32_t jmem_heap_segments_size; /**< total size of the segment heap areas */
+  uint32_t jmem_heap_first_chunk; /**< heap offset of the first segment chunk >> JMEM_HEAP_CHUNK_SIZE_LOG */
+  uint32_t jmem_heap_chunk_count; /**< number of entries in jmem_heap_chunks_p */
+  uint32_t jmem_heap_chunk_hash_mask; /**< number of entries in jmem_heap_chunk_hash_p - 1 */
+  uint8_t **jmem_heap_chunks_p; /**< address of each segment chunk; NULL if the chunk is not used */
+  uint32_t *jmem_heap_chunk_hash_p; /**< maps the address of a segment chunk to its index + 1 in jmem_heap_chunks_p */
+  jmem_heap_segment_t *jmem_heap_segments_p; /**< segments added to the vm heap */
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   jjs_context_data_entry_t data_entries[JJS_CONTEXT_DATA_LIMIT]; /**< context data entries */
   int32_t data_entries_size; /**< number of data_entries in use */
 
 #if JJS_BUILTIN_REGEXP
-  re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  re_cache_entry_t *re_cache_p; /**< regex cache entries followed by the hash bucket heads */
+  uint32_t re_cache_size; /**< maximum number of cached regexps, 0 disables the cache */
+  uint32_t re_cache_count; /**< number of used regex cache entries */
+  uint32_t re_cache_bucket_mask; /**< number of regex cache hash buckets - 1 */
+  uint32_t re_cache_lru_head; /**< most recently used regex cache entry */
+  uint32_t re_cache_lru_tail; /**< least recently used regex cache entry */
+  size_t re_cache_hits; /**< number of regex compilations served from the cache */
+  size_t re_cache_misses; /**< number of regex compilations not found in the cache */
 #endif /* JJS_BUILTIN_REGEXP */
   const lit_utf8_byte_t *const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
+  jmem_cpointer_t ecma_gc_sweep_cp; /**< List of unreachable objects waiting to be freed. */
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
-  jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
-#if JJS_BUILTIN_BIGINT
-  jmem_cpointer_t bigint_list_first_cp; /**< first item of the literal bigint list */
-#endif /* JJS_BUILTIN_BIGINT */
   jmem_cpointer_t global_symbols_cp[ECMA_BUILTIN_GLOBAL_SYMBOL_COUNT]; /**< global symbols */
   ecma_hashset_t string_literal_pool; /**< string literal cache used during parsing and snapshot loading */
+  ecma_hashset_t number_literal_pool; /**< float number literal cache used during parsing and snapshot loading */
+#if JJS_BUILTIN_BIGINT
+  ecma_hashset_t bigint_literal_pool; /**< BigInt literal cache used during parsing and snapshot loading */
+#endif /* JJS_BUILTIN_BIGINT */
 #if JJS_MODULE_SYSTEM
   ecma_module_t *module_current_p; /**< current module context */
   ecma_module_on_init_scope_cb module_on_init_scope_p; /**< callback which is called on initialization
@@ -164,15 +185,32 @@ struct jjs_context_t
   uint32_t status_flags; /**< run-time flags (the top 8 bits are used for passing class parsing options) */
 
   uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
+  uint32_t ecma_number_cache_count; /**< number of entries in ecma_number_cache */
+  ecma_number_t *ecma_number_cache[ECMA_NUMBER_CACHE_SIZE]; /**< freed float numbers kept for reuse */
+  ecma_string_position_cache_entry_t string_position_cache[ECMA_STRING_POSITION_CACHE_SIZE]; /**< recently indexed
+                                                                                              *   non-ASCII strings */
+  uint32_t string_position_cache_next; /**< next entry to be replaced in string_position_cache (round-robin) */
+#if JJS_BUILTIN_DATE
+  ecma_date_tza_cache_entry_t date_tza_cache[ECMA_DATE_TZA_CACHE_SIZE]; /**< time ranges with a known local
+                                                                         *   time zone adjustment */
+  uint32_t date_tza_cache_count; /**< number of used entries in date_tza_cache */
+  uint32_t date_tza_cache_next; /**< next entry to be replaced in date_tza_cache (round-robin) */
+  uint32_t date_tza_cache_last; /**< most recently used entry of date_tza_cache */
+#endif /* JJS_BUILTIN_DATE */
+  uint32_t ecma_gc_mark_stack_size; /**< number of objects in ecma_gc_mark_stack_p */
+  uint32_t ecma_gc_mark_stack_capacity; /**< capacity of ecma_gc_mark_stack_p */
+  ecma_object_t **ecma_gc_mark_stack_p; /**< gray objects whose references are not marked yet */
+#if JJS_HEAP_SNAPSHOT
+  ecma_gc_visitor_cb_t ecma_gc_visitor_cb; /**< receives the objects reported by the mark routines
+                                            *   instead of marking them (see ecma_gc_visit_references) */
+  void *ecma_gc_visitor_user_p; /**< user pointer passed to ecma_gc_visitor_cb */
+#endif /* JJS_HEAP_SNAPSHOT */
 
 #if JJS_PROPERTY_HASHMAP
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
 #endif /* JJS_PROPERTY_HASHMAP */
 
-#if JJS_BUILTIN_REGEXP
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
-#endif /* JJS_BUILTIN_REGEXP */
   ecma_job_queue_item_t *job_queue_head_p; /**< points to the head item of the job queue */
   ecma_job_queue_item_t *job_queue_tail_p; /**< points to the tail item of the job queue */
 #if JJS_PROMISE_CALLBACK
@@ -198,6 +236,11 @@ struct jjs_context_t
                                                  *   ECMAScript execution should be stopped */
 #endif /* JJS_VM_HALT */
 
+#if JJS_CPU_PROFILER
+  vm_profiler_t *vm_profiler_p; /**< running cpu profiler (NULL if the profiler is stopped) */
+  uint32_t vm_profiler_countdown; /**< number of vm checkpoints until the next profiler tick */
+#endif /* JJS_CPU_PROFILER */
+
 #if JJS_VM_THROW
   void *vm_throw_callback_user_p; /**< user pointer for vm_throw_callback_p */
   jjs_throw_cb_t vm_throw_callback_p; /**< callback for capturing throws */
@@ -233,11 +276,27 @@ struct jjs_context_t
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* JJS_LCACHE */
 
+#if JJS_VM_INLINE_CACHE
+  /** positions of the properties accessed by property access sites */
+  vm_inline_cache_entry_t vm_inline_cache[VM_INLINE_CACHE_SIZE];
+#endif /* JJS_VM_INLINE_CACHE */
+
 #if JJS_ANNEX_PMAP
   ecma_value_t pmap; /**< global package map */
   ecma_value_t pmap_root; /**< base directory for resolving relative pmap paths */
 #endif /* JJS_ANNEX_PMAP */
 
+#if JJS_SNAPSHOT_EXEC
+  cbc_snapshot_mapping_t *snapshot_mappings_p; /**< list of memory mapped snapshot files */
+#endif /* JJS_SNAPSHOT_EXEC */
+
+#if JJS_ANNEX_CODE_CACHE
+  ecma_value_t code_cache_dir; /**< directory of the module code cache or undefined, if disabled */
+  size_t code_cache_hits; /**< number of modules loaded from the code cache */
+  size_t code_cache_misses; /**< number of cacheable modules not found in the code cache */
+  size_t code_cache_writes; /**< number of modules written to the code cache */
+#endif /* JJS_ANNEX_CODE_CACHE */
+
   /**
    * Allowed values and it's meaning:
    * * NULL (0x0): the current "new.target" is undefined, that is the execution is inside a normal method.
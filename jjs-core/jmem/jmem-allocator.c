@@ -188,9 +188,13 @@ jmem_compress_pointer (jjs_context_t *context_p, /**< JJS context */
 #if defined(ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && JJS_CPOINTER_32_BIT
   JJS_ASSERT (((jmem_cpointer_t) uint_ptr) == uint_ptr);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JJS_CPOINTER_32_BIT */
+#if JJS_VM_HEAP_GROWABLE
+  uint_ptr = jmem_heap_get_offset (context_p, pointer_p);
+#else /* !JJS_VM_HEAP_GROWABLE */
   const uintptr_t heap_start = (uintptr_t) &context_p->heap_p->first;
 
   uint_ptr -= heap_start;
+#endif /* JJS_VM_HEAP_GROWABLE */
   uint_ptr >>= JMEM_ALIGNMENT_LOG;
 
 #if JJS_CPOINTER_32_BIT
@@ -223,10 +227,14 @@ jmem_decompress_pointer (jjs_context_t *context_p, /**< JJS context */
   JJS_UNUSED (context_p);
   JJS_ASSERT (uint_ptr % JMEM_ALIGNMENT == 0);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JJS_CPOINTER_32_BIT */
+#if JJS_VM_HEAP_GROWABLE
+  uint_ptr = (uintptr_t) jmem_heap_get_pointer (context_p, (uint32_t) (uint_ptr << JMEM_ALIGNMENT_LOG));
+#else /* !JJS_VM_HEAP_GROWABLE */
   const uintptr_t heap_start = (uintptr_t) &context_p->heap_p->first;
 
   uint_ptr <<= JMEM_ALIGNMENT_LOG;
   uint_ptr += heap_start;
+#endif /* JJS_VM_HEAP_GROWABLE */
 
   JJS_ASSERT (jmem_is_heap_pointer (context_p, (void *) uint_ptr));
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY && JJS_CPOINTER_32_BIT */
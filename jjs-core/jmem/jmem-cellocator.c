@@ -17,6 +17,93 @@
 
 #include "jcontext.h"
 
+/*
+ * Cell pages are allocated from the main heap. To find the page that owns a cell in constant time, the heap
+ * is divided into granules (the largest power of 2 not above the page size) and the page table maps each
+ * granule to the page whose header is in it. Since a page is at least as large as a granule, a granule
+ * holds at most one page header, and since a page is smaller than two granules, a cell belongs to the page
+ * registered in its own granule or in one of the previous two granules.
+ */
+
+/* maximum number of granules between a page header and its last cell */
+#define JMEM_CELLOCATOR_PAGE_GRANULE_SPAN 2
+
+static size_t
+jmem_cellocator_page_table_alloc_size (uint32_t page_table_size)
+{
+  return (size_t) page_table_size * sizeof (jmem_cellocator_page_t *);
+}
+
+static bool
+jmem_cellocator_page_table_init (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p)
+{
+  size_t page_size = JMEM_CELLOCATOR_PAGE_SIZE (context_p->vm_cell_count);
+  uint32_t granule_log = 0;
+
+  while (((size_t) 2 << granule_log) <= page_size)
+  {
+    granule_log++;
+  }
+
+#if JJS_VM_HEAP_GROWABLE
+  /* segments are indexed by heap offset, which reaches past the initial heap */
+  uint32_t heap_offset_limit = context_p->vm_heap_size;
+
+  if (context_p->jmem_heap_chunk_count > 0)
+  {
+    heap_offset_limit = context_p->jmem_heap_first_chunk + context_p->jmem_heap_chunk_count;
+    heap_offset_limit <<= JMEM_HEAP_CHUNK_SIZE_LOG;
+  }
+
+  uint32_t page_table_size = (heap_offset_limit >> granule_log) + 1;
+#else /* !JJS_VM_HEAP_GROWABLE */
+  uint32_t page_table_size = (context_p->vm_heap_size >> granule_log) + 1;
+#endif /* JJS_VM_HEAP_GROWABLE */
+
+  /* the table must not fit in a cell, otherwise allocating it would recurse into the cellocator */
+  page_table_size = JJS_MAX (page_table_size, (uint32_t) (JMEM_CELLOCATOR_CELL_SIZE / sizeof (jmem_cellocator_page_t *)) + 1);
+
+  size_t alloc_size = jmem_cellocator_page_table_alloc_size (page_table_size);
+  jmem_cellocator_page_t **page_table_p = jmem_heap_alloc_block_null_on_error (context_p, alloc_size);
+
+  if (!page_table_p)
+  {
+    return false;
+  }
+
+  memset (page_table_p, 0, alloc_size);
+
+  cellocator_p->page_table_p = page_table_p;
+  cellocator_p->page_table_base_p = context_p->heap_p->area;
+  cellocator_p->page_table_size = page_table_size;
+  cellocator_p->page_table_granule_log = granule_log;
+
+  return true;
+}
+
+static inline uint32_t JJS_ATTR_ALWAYS_INLINE
+jmem_cellocator_granule (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p, const void *p)
+{
+#if JJS_VM_HEAP_GROWABLE
+  uint32_t granule = jmem_heap_get_offset (context_p, p) >> cellocator_p->page_table_granule_log;
+#else /* !JJS_VM_HEAP_GROWABLE */
+  JJS_UNUSED (context_p);
+  JJS_ASSERT ((const uint8_t *) p >= cellocator_p->page_table_base_p);
+
+  uint32_t granule = (uint32_t) (((const uint8_t *) p - cellocator_p->page_table_base_p) >> cellocator_p->page_table_granule_log);
+#endif /* JJS_VM_HEAP_GROWABLE */
+
+  JJS_ASSERT (granule < cellocator_p->page_table_size);
+  return granule;
+}
+
+static void
+jmem_cellocator_free_page (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p, jmem_cellocator_page_t *page_p)
+{
+  cellocator_p->page_table_p[jmem_cellocator_granule (context_p, cellocator_p, page_p)] = NULL;
+  jmem_heap_free_block (context_p, page_p, JMEM_CELLOCATOR_PAGE_SIZE (context_p->vm_cell_count));
+}
+
 void
 jmem_cellocator_init (jjs_context_t *context_p)
 {
@@ -27,20 +114,35 @@ jmem_cellocator_init (jjs_context_t *context_p)
 void
 jmem_cellocator_finalize (jjs_context_t *context_p)
 {
-  jmem_cellocator_page_t *iter_p = context_p->jmem_cellocator_32.pages;
+  jmem_cellocator_t *cellocator_p = &context_p->jmem_cellocator_32;
+  jmem_cellocator_page_t *iter_p = cellocator_p->pages;
   jmem_cellocator_page_t *next_p;
 
   while (iter_p)
   {
     next_p = iter_p->next_p;
-    jmem_heap_free_block (context_p, iter_p, JMEM_CELLOCATOR_PAGE_SIZE (context_p->vm_cell_count));
+    jmem_cellocator_free_page (context_p, cellocator_p, iter_p);
     iter_p = next_p;
   }
+
+  if (cellocator_p->page_table_p)
+  {
+    jmem_heap_free_block (context_p,
+                          cellocator_p->page_table_p,
+                          jmem_cellocator_page_table_alloc_size (cellocator_p->page_table_size));
+  }
+
+  *cellocator_p = (jmem_cellocator_t) { 0 };
 }
 
 bool
 jmem_cellocator_add_page (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p)
 {
+  if (!cellocator_p->page_table_p && !jmem_cellocator_page_table_init (context_p, cellocator_p))
+  {
+    return false;
+  }
+
   uint8_t *chunk_p = jmem_heap_alloc_block_null_on_error (context_p, JMEM_CELLOCATOR_PAGE_SIZE(context_p->vm_cell_count));
   JJS_ASSERT (chunk_p);
 
@@ -49,7 +151,6 @@ jmem_cellocator_add_page (jjs_context_t *context_p, jmem_cellocator_t *cellocato
     return false;
   }
 
-  /* TODO: need a way to cleanup empty pages. gc mark? */
   jmem_cellocator_page_t *page_p = (jmem_cellocator_page_t *) chunk_p;
 
   *page_p = (jmem_cellocator_page_t) {
@@ -57,22 +158,27 @@ jmem_cellocator_add_page (jjs_context_t *context_p, jmem_cellocator_t *cellocato
     .end_p = (chunk_p + JMEM_CELLOCATOR_PAGE_HEADER_SIZE)
              + (JMEM_CELLOCATOR_CELL_SIZE * (context_p->vm_cell_count - 1)),
     .next_p = cellocator_p->pages,
+    .next_available_p = cellocator_p->available_pages,
+    .free_cells = NULL,
+    .used_count = 0,
   };
 
-  uint8_t *iter_p = page_p->start_p;
+  /* push the cells in reverse, so allocation starts at the beginning of the page */
   jmem_cellocator_free_cell_t * cell_p;
 
-  while (iter_p <= page_p->end_p)
+  for (uint32_t i = context_p->vm_cell_count; i > 0; i--)
   {
-    cell_p = (jmem_cellocator_free_cell_t *) iter_p;
-    cell_p->next_p = cellocator_p->free_cells;
-    cellocator_p->free_cells = cell_p;
-
-    iter_p += JMEM_CELLOCATOR_CELL_SIZE;
+    cell_p = (jmem_cellocator_free_cell_t *) (page_p->start_p + (JMEM_CELLOCATOR_CELL_SIZE * (i - 1)));
+    cell_p->next_p = page_p->free_cells;
+    page_p->free_cells = cell_p;
   }
 
-  page_p->next_p = cellocator_p->pages;
+  uint32_t granule = jmem_cellocator_granule (context_p, cellocator_p, page_p);
+  JJS_ASSERT (cellocator_p->page_table_p[granule] == NULL);
+  cellocator_p->page_table_p[granule] = page_p;
+
   cellocator_p->pages = page_p;
+  cellocator_p->available_pages = page_p;
 
   return true;
 }
@@ -80,11 +186,24 @@ jmem_cellocator_add_page (jjs_context_t *context_p, jmem_cellocator_t *cellocato
 void *
 jmem_cellocator_alloc (jmem_cellocator_t *cellocator_p)
 {
-  jmem_cellocator_free_cell_t *cell_p = cellocator_p->free_cells;
+  jmem_cellocator_page_t *page_p = cellocator_p->available_pages;
 
-  if (cell_p)
+  if (!page_p)
   {
-    cellocator_p->free_cells = cell_p->next_p;
+    return NULL;
+  }
+
+  jmem_cellocator_free_cell_t *cell_p = page_p->free_cells;
+  JJS_ASSERT (cell_p);
+
+  page_p->free_cells = cell_p->next_p;
+  page_p->used_count++;
+
+  if (!page_p->free_cells)
+  {
+    /* page is full */
+    cellocator_p->available_pages = page_p->next_available_p;
+    page_p->next_available_p = NULL;
   }
 
   return cell_p;
@@ -93,27 +212,119 @@ jmem_cellocator_alloc (jmem_cellocator_t *cellocator_p)
 void
 jmem_cellocator_cell_free (jmem_cellocator_t *cellocator_p, jmem_cellocator_page_t *page_p, void *chunk_p)
 {
-  (void) page_p;
+  JJS_ASSERT (page_p->used_count > 0);
   jmem_cellocator_free_cell_t *item_p = chunk_p;
 
-  item_p->next_p = cellocator_p->free_cells;
-  cellocator_p->free_cells = item_p;
+  if (!page_p->free_cells)
+  {
+    /* page was full, make its cells available again */
+    page_p->next_available_p = cellocator_p->available_pages;
+    cellocator_p->available_pages = page_p;
+  }
+
+  item_p->next_p = page_p->free_cells;
+  page_p->free_cells = item_p;
+  page_p->used_count--;
 }
 
 jmem_cellocator_page_t *
-jmem_cellocator_find (jmem_cellocator_t *cellocator_p, void *chunk_p)
+jmem_cellocator_find (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p, void *chunk_p)
+{
+  if (!cellocator_p->page_table_p)
+  {
+    return NULL;
+  }
+
+  uint32_t granule = jmem_cellocator_granule (context_p, cellocator_p, chunk_p);
+  uint32_t last_granule = granule > JMEM_CELLOCATOR_PAGE_GRANULE_SPAN ? granule - JMEM_CELLOCATOR_PAGE_GRANULE_SPAN : 0;
+
+  while (true)
+  {
+    jmem_cellocator_page_t *page_p = cellocator_p->page_table_p[granule];
+
+    if (page_p && (uint8_t *) chunk_p >= page_p->start_p)
+    {
+      /* the closest page header before the chunk decides the ownership */
+      return ((uint8_t *) chunk_p <= page_p->end_p) ? page_p : NULL;
+    }
+
+    if (granule == last_granule)
+    {
+      return NULL;
+    }
+
+    granule--;
+  }
+}
+
+/**
+ * Return empty pages to the main heap. One empty page is kept to avoid re-allocating a page
+ * right after a gc.
+ *
+ * The list of available pages is rebuilt, so partially used pages are preferred over the empty one.
+ */
+void
+jmem_cellocator_release_empty_pages (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p)
 {
+  jmem_cellocator_page_t **prev_p = &cellocator_p->pages;
   jmem_cellocator_page_t *iter_p = cellocator_p->pages;
+  jmem_cellocator_page_t *empty_page_p = NULL;
+  jmem_cellocator_page_t *available_p = NULL;
+  jmem_cellocator_page_t *available_tail_p = NULL;
 
   while (iter_p)
   {
-    if ((uint8_t *) chunk_p >= iter_p->start_p && (uint8_t *) chunk_p <= iter_p->end_p)
+    jmem_cellocator_page_t *next_p = iter_p->next_p;
+
+    if (iter_p->used_count == 0)
     {
-      return iter_p;
+      if (!empty_page_p)
+      {
+        empty_page_p = iter_p;
+        prev_p = &iter_p->next_p;
+      }
+      else
+      {
+        *prev_p = next_p;
+        jmem_cellocator_free_page (context_p, cellocator_p, iter_p);
+      }
     }
+    else
+    {
+      if (iter_p->free_cells)
+      {
+        iter_p->next_available_p = available_p;
+        available_p = iter_p;
 
-    iter_p = iter_p->next_p;
+        if (!available_tail_p)
+        {
+          available_tail_p = iter_p;
+        }
+      }
+      else
+      {
+        iter_p->next_available_p = NULL;
+      }
+
+      prev_p = &iter_p->next_p;
+    }
+
+    iter_p = next_p;
+  }
+
+  if (empty_page_p)
+  {
+    empty_page_p->next_available_p = NULL;
+
+    if (available_tail_p)
+    {
+      available_tail_p->next_available_p = empty_page_p;
+    }
+    else
+    {
+      available_p = empty_page_p;
+    }
   }
 
-  return NULL;
+  cellocator_p->available_pages = available_p;
 }
@@ -49,7 +49,11 @@
 /* In this case we simply store the pointer, since it fits anyway. */
 #define JMEM_HEAP_GET_OFFSET_FROM_ADDR(ctx, p) ((uint32_t) (p))
 #define JMEM_HEAP_GET_ADDR_FROM_OFFSET(ctx, u) ((jmem_heap_free_t *) (u))
-#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+#elif JJS_VM_HEAP_GROWABLE
+/* Segments are outside of the heap block, so the offsets are translated through the chunk table. */
+#define JMEM_HEAP_GET_OFFSET_FROM_ADDR(ctx, p) jmem_heap_get_free_offset ((ctx), (p))
+#define JMEM_HEAP_GET_ADDR_FROM_OFFSET(ctx, u) jmem_heap_get_free_region ((ctx), (u))
+#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY && !JJS_VM_HEAP_GROWABLE */
 #define JMEM_HEAP_GET_OFFSET_FROM_ADDR(ctx, p) ((uint32_t) ((uint8_t *) (p) -(ctx)->heap_p->area))
 #define JMEM_HEAP_GET_ADDR_FROM_OFFSET(ctx, u) ((jmem_heap_free_t *) ((ctx)->heap_p->area + (u)))
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
@@ -57,6 +61,224 @@
  * @}
  */
 
+#if JJS_VM_HEAP_GROWABLE
+
+/**
+ * Maximum number of chunks addressable by heap offsets. Heap offsets must stay below JMEM_HEAP_END_OF_LIST.
+ */
+#define JMEM_HEAP_CHUNK_LIMIT ((uint32_t) (UINT32_MAX >> JMEM_HEAP_CHUNK_SIZE_LOG))
+
+/**
+ * Size of the segment header, which precedes the heap area of the segment.
+ */
+#define JMEM_HEAP_SEGMENT_HEADER_SIZE ((uint32_t) JJS_ALIGNUP (sizeof (jmem_heap_segment_t), JMEM_ALIGNMENT))
+
+/**
+ * Get the number of entries of the chunk hash table.
+ *
+ * @return smallest power of 2 which is at least twice the chunk count
+ */
+static uint32_t
+jmem_heap_chunk_hash_size (uint32_t chunk_count) /**< number of chunks */
+{
+  uint32_t hash_size = 1;
+
+  while (hash_size < chunk_count * 2)
+  {
+    hash_size <<= 1;
+  }
+
+  return hash_size;
+} /* jmem_heap_chunk_hash_size */
+
+/**
+ * Get the number of chunks that can be assigned to the segments of a growable heap.
+ *
+ * Note:
+ *      Twice the chunks needed to reach the maximum size are reserved, so the chunks of
+ *      released segments do not fragment the chunk table.
+ *
+ * @return number of chunks, 0 if the heap cannot grow
+ */
+uint32_t
+jmem_heap_segment_chunk_count (uint32_t heap_size, /**< initial heap size */
+                               uint32_t max_size) /**< maximum heap size */
+{
+  if (max_size <= heap_size)
+  {
+    return 0;
+  }
+
+  uint32_t first_chunk = (heap_size >> JMEM_HEAP_CHUNK_SIZE_LOG) + ((heap_size & (JMEM_HEAP_CHUNK_SIZE - 1)) != 0);
+
+  if (first_chunk >= JMEM_HEAP_CHUNK_LIMIT)
+  {
+    return 0;
+  }
+
+  uint32_t chunk_count = (((max_size - heap_size) >> JMEM_HEAP_CHUNK_SIZE_LOG) + 1) * 2;
+
+  return JJS_MIN (chunk_count, JMEM_HEAP_CHUNK_LIMIT - first_chunk);
+} /* jmem_heap_segment_chunk_count */
+
+/**
+ * Get the size of the chunk table and the chunk hash table.
+ *
+ * @return size in bytes
+ */
+size_t
+jmem_heap_segment_tables_size (uint32_t chunk_count) /**< number of chunks */
+{
+  if (chunk_count == 0)
+  {
+    return 0;
+  }
+
+  return (chunk_count * sizeof (uint8_t *)) + (jmem_heap_chunk_hash_size (chunk_count) * sizeof (uint32_t));
+} /* jmem_heap_segment_tables_size */
+
+/**
+ * Get the first slot of a chunk in the chunk hash table.
+ *
+ * @return slot index
+ */
+static inline uint32_t JJS_ATTR_ALWAYS_INLINE
+jmem_heap_chunk_hash_slot (jjs_context_t *context_p, /**< JJS context */
+                           uintptr_t chunk_offset) /**< real offset of the chunk from the heap start */
+{
+  return (uint32_t) (chunk_offset >> JMEM_HEAP_CHUNK_SIZE_LOG) & context_p->jmem_heap_chunk_hash_mask;
+} /* jmem_heap_chunk_hash_slot */
+
+/**
+ * Rebuild the chunk hash table from the chunk table.
+ */
+static void
+jmem_heap_chunk_hash_rebuild (jjs_context_t *context_p) /**< JJS context */
+{
+  const uintptr_t heap_start = (uintptr_t) &context_p->heap_p->first;
+  uint32_t *hash_p = context_p->jmem_heap_chunk_hash_p;
+  const uint32_t mask = context_p->jmem_heap_chunk_hash_mask;
+
+  memset (hash_p, 0, (mask + 1) * sizeof (uint32_t));
+
+  for (uint32_t i = 0; i < context_p->jmem_heap_chunk_count; i++)
+  {
+    if (context_p->jmem_heap_chunks_p[i] != NULL)
+    {
+      uint32_t slot = jmem_heap_chunk_hash_slot (context_p, (uintptr_t) context_p->jmem_heap_chunks_p[i] - heap_start);
+
+      while (hash_p[slot] != 0)
+      {
+        slot = (slot + 1) & mask;
+      }
+
+      hash_p[slot] = i + 1;
+    }
+  }
+} /* jmem_heap_chunk_hash_rebuild */
+
+/**
+ * Get the heap offset of a pointer which is in a segment.
+ *
+ * @return heap offset
+ */
+static uint32_t
+jmem_heap_get_segment_offset (jjs_context_t *context_p, /**< JJS context */
+                              const void *pointer_p, /**< pointer into a segment */
+                              uintptr_t real_offset) /**< pointer_p - heap start */
+{
+  const uintptr_t chunk_start = (uintptr_t) pointer_p - (real_offset & (JMEM_HEAP_CHUNK_SIZE - 1));
+  const uint32_t *hash_p = context_p->jmem_heap_chunk_hash_p;
+  uint32_t slot = jmem_heap_chunk_hash_slot (context_p, real_offset);
+
+  while (hash_p[slot] != 0)
+  {
+    uint32_t chunk = hash_p[slot] - 1;
+
+    if ((uintptr_t) context_p->jmem_heap_chunks_p[chunk] == chunk_start)
+    {
+      return ((context_p->jmem_heap_first_chunk + chunk) << JMEM_HEAP_CHUNK_SIZE_LOG)
+             | (uint32_t) (real_offset & (JMEM_HEAP_CHUNK_SIZE - 1));
+    }
+
+    slot = (slot + 1) & context_p->jmem_heap_chunk_hash_mask;
+  }
+
+  JJS_UNREACHABLE ();
+  return 0;
+} /* jmem_heap_get_segment_offset */
+
+/**
+ * Get the heap offset of a heap pointer.
+ *
+ * Pointers into the initial heap block are at their real offset from the heap start. The chunks of
+ * the segments follow the initial heap block.
+ *
+ * @return heap offset
+ */
+extern inline uint32_t JJS_ATTR_PURE JJS_ATTR_ALWAYS_INLINE
+jmem_heap_get_offset (jjs_context_t *context_p, /**< JJS context */
+                      const void *pointer_p) /**< heap pointer */
+{
+  const uintptr_t real_offset = (uintptr_t) pointer_p - (uintptr_t) &context_p->heap_p->first;
+
+  if (JJS_LIKELY (real_offset < context_p->vm_heap_size))
+  {
+    return (uint32_t) real_offset;
+  }
+
+  return jmem_heap_get_segment_offset (context_p, pointer_p, real_offset);
+} /* jmem_heap_get_offset */
+
+/**
+ * Get the heap pointer of a heap offset.
+ *
+ * @return heap pointer
+ */
+extern inline void *JJS_ATTR_PURE JJS_ATTR_ALWAYS_INLINE
+jmem_heap_get_pointer (jjs_context_t *context_p, /**< JJS context */
+                       uint32_t offset) /**< heap offset */
+{
+  if (JJS_LIKELY (offset < context_p->vm_heap_size))
+  {
+    return (uint8_t *) &context_p->heap_p->first + offset;
+  }
+
+  const uint32_t chunk = (offset >> JMEM_HEAP_CHUNK_SIZE_LOG) - context_p->jmem_heap_first_chunk;
+
+  JJS_ASSERT (chunk < context_p->jmem_heap_chunk_count && context_p->jmem_heap_chunks_p[chunk] != NULL);
+
+  return context_p->jmem_heap_chunks_p[chunk] + (offset & (JMEM_HEAP_CHUNK_SIZE - 1));
+} /* jmem_heap_get_pointer */
+
+#ifndef ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
+/**
+ * Get the free list offset of a free region.
+ *
+ * @return heap offset of the region, JMEM_HEAP_END_OF_LIST if region_p is NULL
+ */
+static inline uint32_t JJS_ATTR_ALWAYS_INLINE
+jmem_heap_get_free_offset (jjs_context_t *context_p, /**< JJS context */
+                           const void *region_p) /**< free region */
+{
+  return region_p == NULL ? JMEM_HEAP_END_OF_LIST : jmem_heap_get_offset (context_p, region_p);
+} /* jmem_heap_get_free_offset */
+
+/**
+ * Get the free region of a free list offset.
+ *
+ * @return free region, NULL if the offset is JMEM_HEAP_END_OF_LIST
+ */
+static inline jmem_heap_free_t *JJS_ATTR_ALWAYS_INLINE
+jmem_heap_get_free_region (jjs_context_t *context_p, /**< JJS context */
+                           uint32_t offset) /**< free list offset */
+{
+  return offset == JMEM_HEAP_END_OF_LIST ? NULL : (jmem_heap_free_t *) jmem_heap_get_pointer (context_p, offset);
+} /* jmem_heap_get_free_region */
+#endif /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+
+#endif /* JJS_VM_HEAP_GROWABLE */
+
 /**
  * Get end of region
  *
@@ -95,6 +317,24 @@ jmem_heap_init (jjs_context_t *context_p)
 
   context_p->jmem_heap_list_skip_p = &context_p->heap_p->first;
 
+#if JJS_VM_HEAP_GROWABLE
+  const uint32_t heap_size = context_p->vm_heap_size;
+
+  context_p->jmem_heap_first_chunk =
+    (heap_size >> JMEM_HEAP_CHUNK_SIZE_LOG) + ((heap_size & (JMEM_HEAP_CHUNK_SIZE - 1)) != 0);
+  context_p->jmem_heap_segments_p = NULL;
+  context_p->jmem_heap_segments_size = 0;
+
+  if (context_p->jmem_heap_chunk_count > 0)
+  {
+    const uint32_t chunk_count = context_p->jmem_heap_chunk_count;
+
+    context_p->jmem_heap_chunk_hash_p = (uint32_t *) (context_p->jmem_heap_chunks_p + chunk_count);
+    context_p->jmem_heap_chunk_hash_mask = jmem_heap_chunk_hash_size (chunk_count) - 1;
+    memset (context_p->jmem_heap_chunks_p, 0, jmem_heap_segment_tables_size (chunk_count));
+  }
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   jmem_cellocator_init (context_p);
 
   JMEM_VALGRIND_NOACCESS_SPACE (&context_p->heap_p->first, sizeof (jmem_heap_free_t));
@@ -111,6 +351,19 @@ jmem_heap_finalize (jjs_context_t *context_p)
 {
   jmem_cellocator_finalize (context_p);
 
+#if JJS_VM_HEAP_GROWABLE
+  jmem_heap_segment_t *segment_p = context_p->jmem_heap_segments_p;
+
+  while (segment_p != NULL)
+  {
+    jmem_heap_segment_t *next_p = segment_p->next_p;
+    jjs_allocator_free (&context_p->context_allocator, segment_p, segment_p->block_size);
+    segment_p = next_p;
+  }
+
+  context_p->jmem_heap_segments_p = NULL;
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   JJS_ASSERT (context_p->jmem_heap_allocated_size == 0);
   if (context_p->jmem_heap_allocated_size > 0)
   {
@@ -280,6 +533,10 @@ jmem_heap_alloc (jjs_context_t *context_p, /**< JJS context */
   return (void *) data_space_p;
 } /* jmem_heap_alloc */
 
+#if JJS_VM_HEAP_GROWABLE
+static bool jmem_heap_add_segment (jjs_context_t *context_p, const size_t size);
+#endif /* JJS_VM_HEAP_GROWABLE */
+
 /**
  * Allocation of memory block, reclaiming memory if the request cannot be fulfilled.
  *
@@ -316,8 +573,26 @@ jmem_heap_gc_and_alloc_block (jjs_context_t *context_p, /**< JJS context */
 
   void *data_space_p = jmem_heap_alloc (context_p, size);
 
+#if JJS_VM_HEAP_GROWABLE
+  bool is_grow_attempted = false;
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   while (JJS_UNLIKELY (data_space_p == NULL) && JJS_LIKELY (pressure < max_pressure))
   {
+#if JJS_VM_HEAP_GROWABLE
+    /* grow the heap when a low pressure gc was not enough, before throwing away caches */
+    if (pressure >= JMEM_PRESSURE_LOW && !is_grow_attempted)
+    {
+      is_grow_attempted = true;
+
+      if (jmem_heap_add_segment (context_p, size))
+      {
+        data_space_p = jmem_heap_alloc (context_p, size);
+        continue;
+      }
+    }
+#endif /* JJS_VM_HEAP_GROWABLE */
+
     pressure++;
     ecma_free_unused_memory (context_p, pressure);
     data_space_p = jmem_heap_alloc (context_p, size);
@@ -391,7 +666,15 @@ jmem_heap_find_prev (jjs_context_t *context_p, /**< JJS context */
 {
   const jmem_heap_free_t *prev_p;
 
+  JJS_ASSERT (jmem_is_heap_pointer (context_p, block_p));
+  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (context_p, block_p);
+
+#if JJS_VM_HEAP_GROWABLE
+  /* the free list is ordered by offset, which does not follow the address order of the segments */
+  if (block_offset > JMEM_HEAP_GET_OFFSET_FROM_ADDR (context_p, context_p->jmem_heap_list_skip_p))
+#else /* !JJS_VM_HEAP_GROWABLE */
   if (block_p > context_p->jmem_heap_list_skip_p)
+#endif /* JJS_VM_HEAP_GROWABLE */
   {
     prev_p = context_p->jmem_heap_list_skip_p;
   }
@@ -400,9 +683,6 @@ jmem_heap_find_prev (jjs_context_t *context_p, /**< JJS context */
     prev_p = &context_p->heap_p->first;
   }
 
-  JJS_ASSERT (jmem_is_heap_pointer (context_p, block_p));
-  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (context_p, block_p);
-
   JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
   /* Find position of region in the list. */
   while (prev_p->next_offset < block_offset)
@@ -476,6 +756,169 @@ jmem_heap_insert_block (jjs_context_t *context_p, /**< JJS context */
   JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
 } /* jmem_heap_insert_block */
 
+#if JJS_VM_HEAP_GROWABLE
+
+/**
+ * Add a segment to the heap which can hold a block of the given size.
+ *
+ * The segment is allocated with the context allocator. Its heap area is mapped to a free run of
+ * the chunk table, and it is added to the free region list as a single region. Since the header
+ * of a segment precedes its heap area, free regions of different segments are never merged.
+ *
+ * @return true - if the segment is added,
+ *         false - if the maximum heap size is reached or the segment cannot be allocated
+ */
+static bool
+jmem_heap_add_segment (jjs_context_t *context_p, /**< JJS context */
+                       const size_t size) /**< size of the block to hold */
+{
+  const uint32_t heap_size = context_p->vm_heap_size + context_p->jmem_heap_segments_size;
+
+  if (context_p->jmem_heap_chunk_count == 0 || size > context_p->vm_heap_max_size - heap_size)
+  {
+    return false;
+  }
+
+  uint32_t area_size = JJS_ALIGNUP ((uint32_t) JJS_MAX (size, context_p->vm_heap_step_size), JMEM_HEAP_CHUNK_SIZE);
+
+  if (area_size > context_p->vm_heap_max_size - heap_size)
+  {
+    area_size = JJS_ALIGNUP ((uint32_t) size, JMEM_HEAP_CHUNK_SIZE);
+
+    if (area_size > context_p->vm_heap_max_size - heap_size)
+    {
+      return false;
+    }
+  }
+
+  const uint32_t area_chunk_count = area_size >> JMEM_HEAP_CHUNK_SIZE_LOG;
+  uint32_t first_chunk = 0;
+  uint32_t free_chunk_count = 0;
+
+  for (uint32_t i = 0; i < context_p->jmem_heap_chunk_count && free_chunk_count < area_chunk_count; i++)
+  {
+    if (context_p->jmem_heap_chunks_p[i] != NULL)
+    {
+      first_chunk = i + 1;
+      free_chunk_count = 0;
+    }
+    else
+    {
+      free_chunk_count++;
+    }
+  }
+
+  if (free_chunk_count < area_chunk_count)
+  {
+    return false;
+  }
+
+  /* the block has room to align the heap area to a chunk boundary relative to the heap start */
+  const uint32_t block_size = JMEM_HEAP_SEGMENT_HEADER_SIZE + JMEM_HEAP_CHUNK_SIZE + area_size;
+  jmem_heap_segment_t *segment_p = jjs_allocator_alloc (&context_p->context_allocator, block_size);
+
+  if (segment_p == NULL)
+  {
+    return false;
+  }
+
+  const uintptr_t heap_start = (uintptr_t) &context_p->heap_p->first;
+  const uintptr_t area_offset = JJS_ALIGNUP ((uintptr_t) segment_p + JMEM_HEAP_SEGMENT_HEADER_SIZE - heap_start,
+                                             (uintptr_t) JMEM_HEAP_CHUNK_SIZE);
+
+  segment_p->area_p = (uint8_t *) (heap_start + area_offset);
+  segment_p->size = area_size;
+  segment_p->block_size = block_size;
+  segment_p->first_chunk = first_chunk;
+  segment_p->next_p = context_p->jmem_heap_segments_p;
+  context_p->jmem_heap_segments_p = segment_p;
+  context_p->jmem_heap_segments_size += area_size;
+
+  for (uint32_t i = 0; i < area_chunk_count; i++)
+  {
+    context_p->jmem_heap_chunks_p[first_chunk + i] = segment_p->area_p + (i << JMEM_HEAP_CHUNK_SIZE_LOG);
+  }
+
+  jmem_heap_chunk_hash_rebuild (context_p);
+
+#if JJS_MEM_STATS
+  context_p->jmem_heap_stats.size += area_size;
+#endif /* JJS_MEM_STATS */
+
+  jmem_heap_free_t *const region_p = (jmem_heap_free_t *) segment_p->area_p;
+  jmem_heap_insert_block (context_p, region_p, jmem_heap_find_prev (context_p, region_p), area_size);
+
+  return true;
+} /* jmem_heap_add_segment */
+
+/**
+ * Return empty segments to the context allocator. One empty segment is kept to avoid re-allocating
+ * a segment right after a gc.
+ */
+void
+jmem_heap_release_empty_segments (jjs_context_t *context_p) /**< JJS context */
+{
+  jmem_heap_segment_t **prev_p = &context_p->jmem_heap_segments_p;
+  jmem_heap_segment_t *iter_p = context_p->jmem_heap_segments_p;
+  bool is_empty_segment_kept = false;
+  bool is_released = false;
+
+  while (iter_p != NULL)
+  {
+    jmem_heap_segment_t *next_p = iter_p->next_p;
+    jmem_heap_free_t *const region_p = (jmem_heap_free_t *) iter_p->area_p;
+    jmem_heap_free_t *const prev_region_p = jmem_heap_find_prev (context_p, region_p);
+
+    JMEM_VALGRIND_DEFINED_SPACE (prev_region_p, sizeof (jmem_heap_free_t));
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+    /* the segment is empty, if a single free region covers its heap area */
+    bool is_empty = (JMEM_HEAP_GET_ADDR_FROM_OFFSET (context_p, prev_region_p->next_offset) == region_p
+                     && region_p->size == iter_p->size);
+
+    if (!is_empty || !is_empty_segment_kept)
+    {
+      is_empty_segment_kept |= is_empty;
+
+      JMEM_VALGRIND_NOACCESS_SPACE (prev_region_p, sizeof (jmem_heap_free_t));
+      JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+      prev_p = &iter_p->next_p;
+      iter_p = next_p;
+      continue;
+    }
+
+    prev_region_p->next_offset = region_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (prev_region_p, sizeof (jmem_heap_free_t));
+
+    if (context_p->jmem_heap_list_skip_p == region_p)
+    {
+      context_p->jmem_heap_list_skip_p = prev_region_p;
+    }
+
+    memset (context_p->jmem_heap_chunks_p + iter_p->first_chunk,
+            0,
+            (iter_p->size >> JMEM_HEAP_CHUNK_SIZE_LOG) * sizeof (uint8_t *));
+
+    context_p->jmem_heap_segments_size -= iter_p->size;
+
+#if JJS_MEM_STATS
+    context_p->jmem_heap_stats.size -= iter_p->size;
+#endif /* JJS_MEM_STATS */
+
+    *prev_p = next_p;
+    jjs_allocator_free (&context_p->context_allocator, iter_p, iter_p->block_size);
+    is_released = true;
+    iter_p = next_p;
+  }
+
+  if (is_released)
+  {
+    jmem_heap_chunk_hash_rebuild (context_p);
+  }
+} /* jmem_heap_release_empty_segments */
+
+#endif /* JJS_VM_HEAP_GROWABLE */
+
 /**
  * Internal method for freeing a memory block.
  */
@@ -492,9 +935,9 @@ jmem_heap_free_block_internal (jjs_context_t *context_p, /**< JJS context */
   JJS_ASSERT (jmem_is_heap_pointer (context_p, ptr));
   JJS_ASSERT ((uintptr_t) ptr % JMEM_ALIGNMENT == 0);
 
-  /* TODO: can't use size because it will be removed. is there a better way to do this? */
-  /* find the page associated with this buffer. if not page, this is not a cell free. */
-  jmem_cellocator_page_t *page_p = jmem_cellocator_find (&context_p->jmem_cellocator_32, ptr);
+  /* can't use size because it will be removed. */
+  /* find the page associated with this buffer (constant time). if not page, this is not a cell free. */
+  jmem_cellocator_page_t *page_p = jmem_cellocator_find (context_p, &context_p->jmem_cellocator_32, ptr);
 
   if (page_p)
   {
@@ -543,7 +986,7 @@ jmem_heap_realloc_block (jjs_context_t *context_p, /**< JJS context */
   const size_t aligned_old_size = (old_size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
   /* search for the page of the ptr. if null, the ptr is not a cell */
-  jmem_cellocator_page_t *page_p = jmem_cellocator_find (&context_p->jmem_cellocator_32, ptr);
+  jmem_cellocator_page_t *page_p = jmem_cellocator_find (context_p, &context_p->jmem_cellocator_32, ptr);
 
   if (page_p)
   {
@@ -583,7 +1026,7 @@ jmem_heap_realloc_block (jjs_context_t *context_p, /**< JJS context */
     {
       /* jmem_heap_alloc will go through cellocator for this size */
       void* new_buffer = jmem_heap_alloc (context_p, aligned_new_size);
-      JJS_ASSERT (jmem_cellocator_find (&context_p->jmem_cellocator_32, new_buffer));
+      JJS_ASSERT (jmem_cellocator_find (context_p, &context_p->jmem_cellocator_32, new_buffer));
 
       if (new_buffer)
       {
@@ -765,6 +1208,20 @@ bool
 jmem_is_heap_pointer (jjs_context_t *context_p, /**< JJS context */
                       const void *pointer) /**< pointer */
 {
+#if JJS_VM_HEAP_GROWABLE
+  const jmem_heap_segment_t *segment_p = context_p->jmem_heap_segments_p;
+
+  while (segment_p != NULL)
+  {
+    if ((uint8_t *) pointer >= segment_p->area_p && (uint8_t *) pointer <= segment_p->area_p + segment_p->size)
+    {
+      return true;
+    }
+
+    segment_p = segment_p->next_p;
+  }
+#endif /* JJS_VM_HEAP_GROWABLE */
+
   return ((uint8_t *) pointer >= context_p->heap_p->area && (uint8_t *) pointer <= context_p->jmem_area_end);
 } /* jmem_is_heap_pointer */
 #endif /* !JJS_NDEBUG */
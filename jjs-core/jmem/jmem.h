@@ -139,6 +139,40 @@ void *jmem_heap_alloc_block_null_on_error (jjs_context_t *context_p, const size_
 void *jmem_heap_realloc_block (jjs_context_t *context_p, void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (jjs_context_t *context_p, void *ptr, const size_t size);
 
+#if JJS_VM_HEAP_GROWABLE
+/**
+ * Logarithm of the granularity used to map heap segments to heap offsets
+ */
+#define JMEM_HEAP_CHUNK_SIZE_LOG 16
+
+/**
+ * Granularity used to map heap segments to heap offsets
+ */
+#define JMEM_HEAP_CHUNK_SIZE ((uint32_t) 1 << JMEM_HEAP_CHUNK_SIZE_LOG)
+
+/**
+ * Segment added to a growable heap
+ *
+ * The header is stored at the beginning of the block allocated for the segment. The heap area
+ * of the segment follows it, aligned to JMEM_HEAP_CHUNK_SIZE relative to the start of the heap.
+ */
+typedef struct jmem_heap_segment_s
+{
+  struct jmem_heap_segment_s *next_p; /**< next segment */
+  uint8_t *area_p; /**< heap area of the segment */
+  uint32_t size; /**< size of the heap area */
+  uint32_t block_size; /**< size of the block allocated for the segment */
+  uint32_t first_chunk; /**< index of the first chunk of the heap area in the chunk table */
+} jmem_heap_segment_t;
+
+uint32_t jmem_heap_segment_chunk_count (uint32_t heap_size, uint32_t max_size);
+size_t jmem_heap_segment_tables_size (uint32_t chunk_count);
+void jmem_heap_release_empty_segments (jjs_context_t *context_p);
+
+uint32_t JJS_ATTR_PURE jmem_heap_get_offset (jjs_context_t *context_p, const void *pointer_p);
+void *JJS_ATTR_PURE jmem_heap_get_pointer (jjs_context_t *context_p, uint32_t offset);
+#endif /* JJS_VM_HEAP_GROWABLE */
+
 #if JJS_MEM_STATS
 /**
  * Heap memory usage statistics
@@ -338,24 +372,32 @@ typedef struct jmem_cellocator_free_cell_s
 
 typedef struct jmem_cellocator_page_s
 {
-  uint8_t *start_p;
-  uint8_t *end_p;
-  struct jmem_cellocator_page_s *next_p;
+  uint8_t *start_p; /**< first cell of the page */
+  uint8_t *end_p; /**< last cell of the page */
+  struct jmem_cellocator_page_s *next_p; /**< next page in the list of all pages */
+  struct jmem_cellocator_page_s *next_available_p; /**< next page in the list of pages with free cells */
+  jmem_cellocator_free_cell_t *free_cells; /**< free cells of this page */
+  uint32_t used_count; /**< number of allocated cells */
 } jmem_cellocator_page_t;
 
 typedef struct
 {
-  jmem_cellocator_page_t *pages;
-  jmem_cellocator_free_cell_t *free_cells;
+  jmem_cellocator_page_t *pages; /**< all pages */
+  jmem_cellocator_page_t *available_pages; /**< pages with at least one free cell */
+  jmem_cellocator_page_t **page_table_p; /**< pages indexed by the heap granule their header is in */
+  uint8_t *page_table_base_p; /**< heap address of the first granule */
+  uint32_t page_table_size; /**< number of granules */
+  uint32_t page_table_granule_log; /**< log2 of the granule size, which is at most the page size */
 } jmem_cellocator_t;
 
 void jmem_cellocator_init (jjs_context_t *context_p);
 void jmem_cellocator_finalize (jjs_context_t *context_p);
 
-jmem_cellocator_page_t *jmem_cellocator_find (jmem_cellocator_t *cellocator_p, void *chunk_p);
+jmem_cellocator_page_t *jmem_cellocator_find (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p, void *chunk_p);
 void jmem_cellocator_cell_free (jmem_cellocator_t *cellocator_p, jmem_cellocator_page_t *page_p, void *chunk_p);
 void *jmem_cellocator_alloc (jmem_cellocator_t *cellocator_p);
 bool jmem_cellocator_add_page (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p);
+void jmem_cellocator_release_empty_pages (jjs_context_t *context_p, jmem_cellocator_t *cellocator_p);
 
 #define JMEM_CELLOCATOR_CELL_SIZE (32)
 #define JMEM_CELLOCATOR_PAGE_HEADER_SIZE ((size_t) JJS_ALIGNUP (sizeof (jmem_cellocator_page_t), JMEM_ALIGNMENT))
@@ -1135,3 +1135,92 @@ lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**< utf-
 
   return (string1_pos >= string1_end_p && string2_pos < string2_end_p);
 } /* lit_compare_utf8_strings_relational */
+
+/**
+ * Find the first occurrence of a cesu-8 string in another cesu-8 string.
+ *
+ * Note:
+ *   The candidate positions are located with memchr, which is vectorized by most C libraries,
+ *   so long runs without the first byte of the searched string are skipped quickly. Since a
+ *   valid cesu-8 string never starts with a continuation byte, every match starts at a
+ *   character boundary of the haystack.
+ *
+ * @return pointer to the start of the first match - if the string is found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find (const lit_utf8_byte_t *haystack_p, /**< string to search in */
+                      lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                      const lit_utf8_byte_t *needle_p, /**< string to search for */
+                      lit_utf8_size_t needle_size) /**< size of the string to search for, must be non-zero */
+{
+  JJS_ASSERT (needle_p != NULL && needle_size > 0);
+
+  if (needle_size > haystack_size)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *last_p = haystack_p + (haystack_size - needle_size);
+  const lit_utf8_byte_t first_byte = needle_p[0];
+  const lit_utf8_byte_t last_byte = needle_p[needle_size - 1];
+
+  while (haystack_p <= last_p)
+  {
+    haystack_p = memchr (haystack_p, first_byte, (size_t) (last_p - haystack_p) + 1);
+
+    if (haystack_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (haystack_p[needle_size - 1] == last_byte && memcmp (haystack_p + 1, needle_p + 1, needle_size - 1) == 0)
+    {
+      return haystack_p;
+    }
+
+    haystack_p++;
+  }
+
+  return NULL;
+} /* lit_utf8_string_find */
+
+/**
+ * Find the last occurrence of a cesu-8 string in another cesu-8 string.
+ *
+ * @return pointer to the start of the last match - if the string is found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p, /**< string to search in */
+                           lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                           const lit_utf8_byte_t *needle_p, /**< string to search for */
+                           lit_utf8_size_t needle_size) /**< size of the string to search for, must be non-zero */
+{
+  JJS_ASSERT (needle_p != NULL && needle_size > 0);
+
+  if (needle_size > haystack_size)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *current_p = haystack_p + (haystack_size - needle_size);
+  const lit_utf8_byte_t first_byte = needle_p[0];
+  const lit_utf8_byte_t last_byte = needle_p[needle_size - 1];
+
+  while (true)
+  {
+    if (*current_p == first_byte && current_p[needle_size - 1] == last_byte
+        && memcmp (current_p + 1, needle_p + 1, needle_size - 1) == 0)
+    {
+      return current_p;
+    }
+
+    if (current_p == haystack_p)
+    {
+      return NULL;
+    }
+
+    current_p--;
+  }
+} /* lit_utf8_string_find_last */
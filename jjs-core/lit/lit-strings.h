@@ -133,6 +133,16 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p,
                                           const lit_utf8_byte_t *string2_p,
                                           lit_utf8_size_t string2_size);
 
+/* search */
+const lit_utf8_byte_t *lit_utf8_string_find (const lit_utf8_byte_t *haystack_p,
+                                             lit_utf8_size_t haystack_size,
+                                             const lit_utf8_byte_t *needle_p,
+                                             lit_utf8_size_t needle_size);
+const lit_utf8_byte_t *lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p,
+                                                  lit_utf8_size_t haystack_size,
+                                                  const lit_utf8_byte_t *needle_p,
+                                                  lit_utf8_size_t needle_size);
+
 uint8_t lit_utf16_encode_code_point (lit_code_point_t cp, ecma_char_t *cu_p);
 
 /* read code point from buffer */
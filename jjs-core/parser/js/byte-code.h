@@ -833,6 +833,7 @@ typedef enum
   CBC_CODE_FLAGS_STATIC_FUNCTION = (1u << 8), /**< this function is a static snapshot function */
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 9), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 10), /**< compiled code needs a lexical block */
+  CBC_CODE_FLAGS_HAS_SLOT_TABLE = (1u << 11), /**< this function has a binding slot table */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
@@ -851,6 +852,12 @@ typedef enum
  *   - when CBC_CODE_FLAGS_HAS_TAGGED_LITERALS is set:
  *     pointer to the tagged template collection encoded as value
  *
+ * Slot table when CBC_CODE_FLAGS_HAS_SLOT_TABLE is set (padded to ecma_value_t):
+ *   - number of binding slots of the lexical environment of the function
+ *     (the environment has no slots when CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED is set)
+ *   - a uint16_t slot info for each identifier between register_end and ident_end
+ *     (see CBC_SLOT_INFO_GET_DEPTH and CBC_SLOT_INFO_GET_INDEX)
+ *
  * Byte fields when CBC_CODE_FLAGS_HAS_EXTENDED_INFO is set:
  *   - always available:
  *     a byte which contains a combination of CBC_EXTENDED_CODE_FLAGS bits
@@ -931,6 +938,37 @@ typedef enum
                                                                  *   the function arguments */
 } cbc_extended_code_flags_t;
 
+/**
+ * Number of bits used by the slot index of a slot info.
+ */
+#define CBC_SLOT_INFO_INDEX_BITS 12
+
+/**
+ * Maximum slot index of a slot info.
+ */
+#define CBC_SLOT_INFO_MAX_INDEX ((1u << CBC_SLOT_INFO_INDEX_BITS) - 1)
+
+/**
+ * Maximum environment depth of a slot info.
+ */
+#define CBC_SLOT_INFO_MAX_DEPTH ((1u << (16 - CBC_SLOT_INFO_INDEX_BITS)) - 1)
+
+/**
+ * Create a slot info from the number of slot environments which must be
+ * passed to reach the binding and the slot index in the last one.
+ */
+#define CBC_SLOT_INFO_CREATE(depth, index) ((uint16_t) (((depth) << CBC_SLOT_INFO_INDEX_BITS) | (index)))
+
+/**
+ * Get the environment depth of a slot info (0 means the identifier is not resolved).
+ */
+#define CBC_SLOT_INFO_GET_DEPTH(slot_info) ((uint32_t) (slot_info) >> CBC_SLOT_INFO_INDEX_BITS)
+
+/**
+ * Get the slot index of a slot info.
+ */
+#define CBC_SLOT_INFO_GET_INDEX(slot_info) ((uint32_t) (slot_info) & CBC_SLOT_INFO_MAX_INDEX)
+
 /**
  * Shared script data.
  */
@@ -941,12 +979,13 @@ typedef enum
   CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS = (1 << 2), /**< script is a function with arguments source code */
   CBC_SCRIPT_HAS_IMPORT_META = (1 << 3), /**< script is a module with import.meta object */
   CBC_SCRIPT_IS_EVAL_CODE = (1 << 4), /**< script is compiled by eval like (eval, new Function, etc.) expression */
+  CBC_SCRIPT_HAS_SNAPSHOT_MAPPING = (1 << 5), /**< byte code of the script references a mapped snapshot file */
 } cbc_script_type;
 
 /**
  * Value for increasing or decreasing the script reference counter.
  */
-#define CBC_SCRIPT_REF_ONE 0x20
+#define CBC_SCRIPT_REF_ONE 0x40
 
 /**
  * Maximum value of script reference counter.
@@ -987,11 +1026,21 @@ typedef struct
 #endif /* JJS_FUNCTION_TO_STRING */
 } cbc_script_t;
 
+/**
+ * Memory mapped snapshot file, which is shared by the scripts loaded from it.
+ */
+typedef struct cbc_snapshot_mapping_t
+{
+  struct cbc_snapshot_mapping_t *next_p; /**< next mapping of the context */
+  jjs_platform_buffer_t buffer; /**< mapped snapshot data */
+  uint32_t refs; /**< number of scripts (and static snapshot functions) using the mapping */
+} cbc_snapshot_mapping_t;
+
 /**
  * Get the array of optional values assigned to a script.
  *
  * First value: user value
- * Second value: function arguments value
+ * Second value: function arguments, import.meta object or snapshot mapping value
  */
 #define CBC_SCRIPT_GET_OPTIONAL_VALUES(script_p) ((ecma_value_t *) ((script_p) + 1))
 
@@ -1012,6 +1061,12 @@ typedef struct
 #define CBC_SCRIPT_GET_IMPORT_META(script_p, type) \
   (CBC_SCRIPT_GET_OPTIONAL_VALUES (script_p)[((type) &CBC_SCRIPT_HAS_USER_VALUE) ? 1 : 0])
 
+/**
+ * Get snapshot mapping value.
+ */
+#define CBC_SCRIPT_GET_SNAPSHOT_MAPPING(script_p, type) \
+  (CBC_SCRIPT_GET_OPTIONAL_VALUES (script_p)[((type) &CBC_SCRIPT_HAS_USER_VALUE) ? 1 : 0])
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
 /**
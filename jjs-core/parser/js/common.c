@@ -452,6 +452,8 @@ util_print_cbc (ecma_context_t *context_p, /**< JJS context */
   /* adjust for line info block */
   size -= sizeof (ecma_value_t);
 
+  size -= ecma_compiled_code_get_slot_table_size (compiled_code_p);
+
   byte_code_end_p = ((uint8_t *) compiled_code_p) + size;
   byte_code_p = byte_code_start_p;
 
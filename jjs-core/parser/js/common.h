@@ -77,6 +77,8 @@ typedef enum
   LEXER_FLAG_LATE_INIT = (1 << 3), /**< initialize this variable after the byte code is freed */
   LEXER_FLAG_ASCII = (1 << 4), /**< the literal contains only ascii characters */
   LEXER_FLAG_GLOBAL = (1 << 5), /**< this local identifier is not a let or const declaration */
+  LEXER_FLAG_NO_SLOT = (1 << 6), /**< this identifier may be bound by the lexical environment of a block
+                                  *   or a with statement, so it cannot be resolved to a binding slot */
 } lexer_literal_status_flags_t;
 
 /**
@@ -113,6 +115,8 @@ typedef struct
 
   uint8_t type; /**< type of the literal */
   uint8_t status_flags; /**< status flags */
+  uint16_t slot_info; /**< binding slot of an identifier during post processing
+                       *   (see parser_resolve_binding_slots) */
 } lexer_literal_t;
 
 void util_free_literal (ecma_context_t *context_p, lexer_literal_t *literal_p);
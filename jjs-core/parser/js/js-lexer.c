@@ -2473,6 +2473,226 @@ lexer_construct_unused_literal (parser_context_t *parser_context_p) /**< context
   return literal_p;
 } /* lexer_construct_unused_literal */
 
+/**
+ * Number of literals in the literal pool above which the
+ * identifier and string literals are found by a hash index.
+ */
+#define LEXER_LITERAL_HASH_THRESHOLD 32
+
+/**
+ * Minimum number of slots of the literal hash index (must be a power of 2).
+ */
+#define LEXER_LITERAL_HASH_MIN_SIZE 64
+
+/**
+ * Compute the hash of an identifier or string literal.
+ *
+ * @return hash value
+ */
+static uint32_t
+lexer_literal_hash (const uint8_t *char_p, /**< characters of the literal */
+                    prop_length_t length, /**< length of the literal */
+                    uint8_t literal_type) /**< literal type */
+{
+  return (uint32_t) lit_utf8_string_calc_hash (char_p, length) ^ literal_type;
+} /* lexer_literal_hash */
+
+/**
+ * Insert a literal into the literal hash index.
+ */
+static void
+lexer_literal_hash_insert (parser_context_t *parser_context_p, /**< context */
+                           lexer_literal_t *literal_p, /**< identifier or string literal */
+                           uint32_t literal_index) /**< index of the literal */
+{
+  JJS_ASSERT (literal_p->type == LEXER_IDENT_LITERAL || literal_p->type == LEXER_STRING_LITERAL);
+  JJS_ASSERT (parser_context_p->literal_hash_count < parser_context_p->literal_hash_size / 2);
+
+  uint32_t mask = parser_context_p->literal_hash_size - 1;
+  uint32_t slot = lexer_literal_hash (literal_p->u.char_p, literal_p->prop.length, literal_p->type) & mask;
+  lexer_lit_object_t *hash_p = parser_context_p->literal_hash_p;
+
+  while (hash_p[slot].literal_p != NULL)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  hash_p[slot].literal_p = literal_p;
+  hash_p[slot].index = (uint16_t) literal_index;
+  parser_context_p->literal_hash_count++;
+} /* lexer_literal_hash_insert */
+
+/**
+ * Build the literal hash index from the identifier and string literals of the literal pool.
+ */
+static void
+lexer_literal_hash_build (parser_context_t *parser_context_p, /**< context */
+                          uint32_t size) /**< number of slots */
+{
+  JJS_ASSERT (size >= LEXER_LITERAL_HASH_MIN_SIZE && (size & (size - 1)) == 0);
+
+  lexer_free_literal_hash (parser_context_p);
+
+  size_t hash_size = size * sizeof (lexer_lit_object_t);
+  parser_context_p->literal_hash_p = (lexer_lit_object_t *) parser_malloc_scratch (parser_context_p, (jjs_size_t) hash_size);
+  parser_context_p->literal_hash_size = size;
+  memset (parser_context_p->literal_hash_p, 0, hash_size);
+
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+  uint32_t literal_index = 0;
+
+  parser_list_iterator_init (&parser_context_p->literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (literal_p->type == LEXER_IDENT_LITERAL || literal_p->type == LEXER_STRING_LITERAL)
+    {
+      lexer_literal_hash_insert (parser_context_p, literal_p, literal_index);
+    }
+
+    literal_index++;
+  }
+} /* lexer_literal_hash_build */
+
+/**
+ * Probe a literal hash index for an identifier or string literal.
+ *
+ * @return the literal - if found
+ *         NULL - otherwise
+ */
+static lexer_literal_t *
+lexer_literal_hash_lookup (lexer_lit_object_t *hash_p, /**< literal hash index */
+                           uint32_t hash_size, /**< number of slots of the literal hash index */
+                           const uint8_t *char_p, /**< characters of the literal */
+                           prop_length_t length, /**< length of the literal */
+                           uint8_t literal_type, /**< literal type */
+                           uint32_t *literal_index_p) /**< [out] index of the literal */
+{
+  uint32_t mask = hash_size - 1;
+  uint32_t slot = lexer_literal_hash (char_p, length, literal_type) & mask;
+
+  while (hash_p[slot].literal_p != NULL)
+  {
+    lexer_literal_t *literal_p = hash_p[slot].literal_p;
+
+    if (literal_p->type == literal_type && literal_p->prop.length == length
+        && memcmp (literal_p->u.char_p, char_p, length) == 0)
+    {
+      *literal_index_p = hash_p[slot].index;
+      return literal_p;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  return NULL;
+} /* lexer_literal_hash_lookup */
+
+/**
+ * Find an identifier or string literal using the literal hash index.
+ *
+ * @return the literal - if found
+ *         NULL - otherwise
+ */
+static lexer_literal_t *
+lexer_literal_hash_find (parser_context_t *parser_context_p, /**< context */
+                         const uint8_t *char_p, /**< characters of the literal */
+                         prop_length_t length, /**< length of the literal */
+                         uint8_t literal_type, /**< literal type */
+                         uint32_t *literal_index_p) /**< [out] index of the literal */
+{
+  if (parser_context_p->literal_hash_p == NULL)
+  {
+    uint32_t size = LEXER_LITERAL_HASH_MIN_SIZE;
+
+    while (size < 4 * (uint32_t) parser_context_p->literal_count)
+    {
+      size <<= 1;
+    }
+
+    lexer_literal_hash_build (parser_context_p, size);
+  }
+
+  return lexer_literal_hash_lookup (parser_context_p->literal_hash_p,
+                                    parser_context_p->literal_hash_size,
+                                    char_p,
+                                    length,
+                                    literal_type,
+                                    literal_index_p);
+} /* lexer_literal_hash_find */
+
+/**
+ * Find an identifier literal in the literal pool of an enclosing function.
+ *
+ * @return index of the literal - if found
+ *         PARSER_INVALID_LITERAL_INDEX - otherwise
+ */
+uint16_t
+lexer_find_saved_ident_literal (parser_context_t *parser_context_p, /**< context */
+                                parser_saved_context_t *saved_context_p, /**< context of the enclosing function */
+                                const uint8_t *char_p, /**< characters of the identifier */
+                                prop_length_t length) /**< length of the identifier */
+{
+  uint32_t literal_index = 0;
+
+  if (saved_context_p->literal_hash_p != NULL)
+  {
+    if (lexer_literal_hash_lookup (saved_context_p->literal_hash_p,
+                                   saved_context_p->literal_hash_size,
+                                   char_p,
+                                   length,
+                                   LEXER_IDENT_LITERAL,
+                                   &literal_index)
+        == NULL)
+    {
+      return PARSER_INVALID_LITERAL_INDEX;
+    }
+
+    return (uint16_t) literal_index;
+  }
+
+  /* The literal pools of all functions share the same item and page sizes. */
+  parser_list_t literal_pool = parser_context_p->literal_pool;
+  literal_pool.data = saved_context_p->literal_pool_data;
+
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+
+  parser_list_iterator_init (&literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (literal_p->type == LEXER_IDENT_LITERAL && literal_p->prop.length == length
+        && memcmp (literal_p->u.char_p, char_p, length) == 0)
+    {
+      return (uint16_t) literal_index;
+    }
+
+    literal_index++;
+  }
+
+  return PARSER_INVALID_LITERAL_INDEX;
+} /* lexer_find_saved_ident_literal */
+
+/**
+ * Free the literal hash index of the current literal pool.
+ */
+void
+lexer_free_literal_hash (parser_context_t *parser_context_p) /**< context */
+{
+  if (parser_context_p->literal_hash_p != NULL)
+  {
+    parser_free_scratch (parser_context_p,
+                         parser_context_p->literal_hash_p,
+                         (jjs_size_t) (parser_context_p->literal_hash_size * sizeof (lexer_lit_object_t)));
+  }
+
+  parser_context_p->literal_hash_p = NULL;
+  parser_context_p->literal_hash_size = 0;
+  parser_context_p->literal_hash_count = 0;
+} /* lexer_free_literal_hash */
+
 /**
  * Construct a literal object from an identifier.
  */
@@ -2502,46 +2722,63 @@ lexer_construct_literal_object (parser_context_t *parser_context_p, /**< context
   JJS_ASSERT (literal_type != LEXER_IDENT_LITERAL || length <= PARSER_MAXIMUM_IDENT_LENGTH);
   JJS_ASSERT (literal_type != LEXER_STRING_LITERAL || length <= PARSER_MAXIMUM_STRING_LENGTH);
 
-  parser_list_iterator_init (&parser_context_p->literal_pool, &literal_iterator);
-
-  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  if (parser_context_p->literal_count > LEXER_LITERAL_HASH_THRESHOLD)
   {
-    if (literal_p->type == literal_type && literal_p->prop.length == length
-        && memcmp (literal_p->u.char_p, char_p, length) == 0)
+    literal_p = lexer_literal_hash_find (parser_context_p, char_p, length, literal_type, &literal_index);
+  }
+  else
+  {
+    parser_list_iterator_init (&parser_context_p->literal_pool, &literal_iterator);
+
+    while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
     {
-      parser_context_p->lit_object.literal_p = literal_p;
-      parser_context_p->lit_object.index = (uint16_t) literal_index;
+      if (literal_p->type == literal_type && literal_p->prop.length == length
+          && memcmp (literal_p->u.char_p, char_p, length) == 0)
+      {
+        break;
+      }
+
+      literal_index++;
+    }
+  }
 
-      parser_free_allocated_buffer (parser_context_p);
+  if (literal_p != NULL)
+  {
+    parser_context_p->lit_object.literal_p = literal_p;
+    parser_context_p->lit_object.index = (uint16_t) literal_index;
+
+    parser_free_allocated_buffer (parser_context_p);
 
-      if (search_scope_stack)
+    if (search_scope_stack)
+    {
+      parser_scope_stack_t *scope_stack_start_p = parser_context_p->scope_stack_p;
+      parser_scope_stack_t *scope_stack_p
+        = scope_stack_start_p ? scope_stack_start_p + parser_context_p->scope_stack_top : NULL;
+
+      while (scope_stack_p > scope_stack_start_p)
       {
-        parser_scope_stack_t *scope_stack_start_p = parser_context_p->scope_stack_p;
-        parser_scope_stack_t *scope_stack_p
-          = scope_stack_start_p ? scope_stack_start_p + parser_context_p->scope_stack_top : NULL;
+        scope_stack_p--;
 
-        while (scope_stack_p > scope_stack_start_p)
+        if (scope_stack_p->map_from == literal_index)
         {
-          scope_stack_p--;
-
-          if (scope_stack_p->map_from == literal_index)
-          {
-            JJS_ASSERT (scanner_decode_map_to (scope_stack_p) >= PARSER_REGISTER_START
-                          || (literal_p->status_flags & LEXER_FLAG_USED));
-            parser_context_p->lit_object.index = scanner_decode_map_to (scope_stack_p);
-            return;
-          }
+          JJS_ASSERT (scanner_decode_map_to (scope_stack_p) >= PARSER_REGISTER_START
+                        || (literal_p->status_flags & LEXER_FLAG_USED));
+          parser_context_p->lit_object.index = scanner_decode_map_to (scope_stack_p);
+          return;
         }
+      }
 
-        literal_p->status_flags |= LEXER_FLAG_USED;
+      literal_p->status_flags |= LEXER_FLAG_USED;
+
+      if (parser_context_p->status_flags & PARSER_INSIDE_WITH)
+      {
+        literal_p->status_flags |= LEXER_FLAG_NO_SLOT;
       }
-      return;
     }
-
-    literal_index++;
+    return;
   }
 
-  JJS_ASSERT (literal_index == parser_context_p->literal_count);
+  literal_index = parser_context_p->literal_count;
 
   if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
@@ -2577,6 +2814,11 @@ lexer_construct_literal_object (parser_context_t *parser_context_p, /**< context
   if (search_scope_stack)
   {
     status_flags |= LEXER_FLAG_USED;
+
+    if (parser_context_p->status_flags & PARSER_INSIDE_WITH)
+    {
+      status_flags |= LEXER_FLAG_NO_SLOT;
+    }
   }
 
   if (lit_location_p->status_flags & LEXER_LIT_LOCATION_IS_ASCII)
@@ -2590,6 +2832,18 @@ lexer_construct_literal_object (parser_context_t *parser_context_p, /**< context
   parser_context_p->lit_object.index = (uint16_t) literal_index;
   parser_context_p->literal_count++;
 
+  if (parser_context_p->literal_hash_p != NULL)
+  {
+    if (parser_context_p->literal_hash_count >= parser_context_p->literal_hash_size / 2 - 1)
+    {
+      lexer_literal_hash_build (parser_context_p, parser_context_p->literal_hash_size * 2);
+    }
+    else
+    {
+      lexer_literal_hash_insert (parser_context_p, literal_p, literal_index);
+    }
+  }
+
   JJS_ASSERT (parser_context_p->u.allocated_buffer_p == NULL);
 } /* lexer_construct_literal_object */
 
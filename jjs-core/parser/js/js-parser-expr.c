@@ -1061,7 +1061,7 @@ parser_parse_class (parser_context_t *parser_context_p, /**< context */
     class_ident_index = parser_context_p->lit_object.index;
 
     lexer_construct_literal_object (parser_context_p, &parser_context_p->token.lit_location, LEXER_NEW_IDENT_LITERAL);
-    parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED;
+    parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED | LEXER_FLAG_NO_SLOT;
     class_name_index = parser_context_p->lit_object.index;
 
 #if JJS_MODULE_SYSTEM
@@ -1079,7 +1079,7 @@ parser_parse_class (parser_context_t *parser_context_p, /**< context */
     if (parser_context_p->token.type == LEXER_LITERAL && parser_context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
     {
       lexer_construct_literal_object (parser_context_p, &parser_context_p->token.lit_location, LEXER_NEW_IDENT_LITERAL);
-      parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED;
+      parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED | LEXER_FLAG_NO_SLOT;
       class_name_index = parser_context_p->lit_object.index;
       lexer_next_token (parser_context_p);
     }
@@ -1580,6 +1580,7 @@ parser_parse_function_expression (parser_context_t *parser_context_p, /**< parse
   uint16_t literal2 = 0;
   uint16_t function_literal_index;
   int32_t function_name_index = -1;
+  bool is_function_name_bound = false;
 
   if (status_flags & PARSER_IS_FUNC_EXPRESSION)
   {
@@ -1645,6 +1646,10 @@ parser_parse_function_expression (parser_context_t *parser_context_p, /**< parse
       }
 
       function_name_index = parser_context_p->lit_object.index;
+
+      /* The binding of the name is only created when the function body may reference it. */
+      JJS_ASSERT (parser_context_p->next_scanner_info_p->type == SCANNER_TYPE_FUNCTION);
+      is_function_name_bound = !(parser_context_p->next_scanner_info_p->u8_arg & SCANNER_FUNCTION_NAME_UNUSED);
     }
 
     parser_context_p->status_flags = parent_status_flags;
@@ -1664,6 +1669,14 @@ parser_parse_function_expression (parser_context_t *parser_context_p, /**< parse
     parser_context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
   }
 
+  /* The function context only keeps the flag when the name has its own binding. */
+  status_flags &= (uint32_t) ~PARSER_IS_FUNC_EXPRESSION;
+
+  if (is_function_name_bound)
+  {
+    status_flags |= PARSER_FUNCTION_NAME_IS_BOUND;
+  }
+
   function_literal_index = lexer_construct_function_object (parser_context_p, status_flags);
 
   JJS_ASSERT (parser_context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
@@ -1690,7 +1703,7 @@ parser_parse_function_expression (parser_context_t *parser_context_p, /**< parse
   {
     parser_emit_cbc_literal (parser_context_p, CBC_PUSH_LITERAL, function_literal_index);
 
-    if (function_name_index != -1)
+    if (is_function_name_bound)
     {
       parser_context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_NAMED_FUNC_EXPRESSION);
       parser_context_p->last_cbc.value = (uint16_t) function_name_index;
@@ -78,10 +78,14 @@ typedef enum
   PARSER_IS_CLASS_STATIC_BLOCK = (1u << 26), /**< a class static block is parsed */
   PARSER_PRIVATE_FUNCTION_NAME = PARSER_IS_FUNC_EXPRESSION, /**< represents private method for
                                                              *   parser_set_function_name*/
+  PARSER_FUNCTION_NAME_IS_BOUND = PARSER_IS_FUNC_EXPRESSION, /**< the name of a function expression is bound
+                                                              *   in a lexical environment around its scope */
 #if JJS_MODULE_SYSTEM
   PARSER_MODULE_DEFAULT_CLASS_OR_FUNC = (1u << 27), /**< parsing a function or class default export */
   PARSER_MODULE_STORE_IDENT = (1u << 28), /**< store identifier of the current export statement */
 #endif /* JJS_MODULE_SYSTEM */
+  PARSER_HAS_SLOT_LEXICAL_ENV = (1u << 29), /**< the variables of the function are stored in binding slots,
+                                            *   see parser_resolve_binding_slots */
   PARSER_HAS_LATE_LIT_INIT = (1u << 30), /**< there are identifier or string literals which construction
                                           *   is postponed after the local parser data is freed */
 #ifndef JJS_NDEBUG
@@ -496,6 +500,9 @@ typedef struct parser_saved_context_t
   parser_mem_data_t byte_code; /**< byte code buffer */
   uint32_t byte_code_size; /**< byte code size for branches */
   parser_mem_data_t literal_pool_data; /**< literal list */
+  lexer_lit_object_t *literal_hash_p; /**< hash index of identifier and string literals */
+  uint32_t literal_hash_size; /**< number of slots of the literal hash index */
+  uint32_t literal_hash_count; /**< number of literals in the literal hash index */
   parser_scope_stack_t *scope_stack_p; /**< scope stack */
   uint16_t scope_stack_size; /**< size of scope stack */
   uint16_t scope_stack_top; /**< preserved top of scope stack */
@@ -581,6 +588,9 @@ typedef struct
   parser_mem_data_t byte_code; /**< byte code buffer */
   uint32_t byte_code_size; /**< current byte code size for branches */
   parser_list_t literal_pool; /**< literal list */
+  lexer_lit_object_t *literal_hash_p; /**< hash index of identifier and string literals */
+  uint32_t literal_hash_size; /**< number of slots of the literal hash index */
+  uint32_t literal_hash_count; /**< number of literals in the literal hash index */
   parser_mem_data_t stack; /**< storage space */
   parser_scope_stack_t *scope_stack_p; /**< scope stack */
   parser_mem_page_t *free_page_p; /**< space for fast allocation */
@@ -760,6 +770,11 @@ const uint8_t *lexer_convert_literal_to_chars (parser_context_t *parser_context_
                                                lexer_string_options_t opts);
 void lexer_expect_object_literal_id (parser_context_t *parser_context_p, uint32_t ident_opts);
 lexer_literal_t *lexer_construct_unused_literal (parser_context_t *parser_context_p);
+void lexer_free_literal_hash (parser_context_t *parser_context_p);
+uint16_t lexer_find_saved_ident_literal (parser_context_t *parser_context_p,
+                                        parser_saved_context_t *saved_context_p,
+                                        const uint8_t *char_p,
+                                        prop_length_t length);
 void lexer_construct_literal_object (parser_context_t *parser_context_p,
                                      const lexer_lit_location_t *lit_location_p,
                                      uint8_t literal_type);
@@ -573,6 +573,163 @@ parser_append_breakpoint_info (parser_context_t *parser_context_p, /**< parser c
     }                                                        \
   } while (0)
 
+/**
+ * Count the binding slots of the non-register variables in the first items of a scope stack.
+ *
+ * @return number of binding slots
+ */
+static uint16_t
+parser_count_binding_slots (const parser_scope_stack_t *scope_stack_p, /**< scope stack */
+                            uint16_t end) /**< number of scope stack items */
+{
+  uint16_t slot_count = 0;
+
+  for (uint16_t i = 0; i < end; i++)
+  {
+    if (scope_stack_p[i].map_from != PARSER_SCOPE_STACK_FUNC
+        && (scope_stack_p[i].map_to & PARSER_SCOPE_STACK_REGISTER_MASK) == 0)
+    {
+      slot_count++;
+    }
+  }
+
+  return slot_count;
+} /* parser_count_binding_slots */
+
+/**
+ * Resolve an identifier of the current function to a binding slot of an enclosing function.
+ *
+ * @return slot info of the identifier - if resolved
+ *         0 - otherwise
+ */
+static uint16_t
+parser_resolve_binding_slot (parser_context_t *parser_context_p, /**< context */
+                             const lexer_literal_t *literal_p) /**< identifier literal */
+{
+  const uint32_t stop_flags = (PARSER_INSIDE_WITH | PARSER_FUNCTION_IS_PARSING_ARGS | PARSER_INSIDE_CLASS_FIELD
+                               | PARSER_IS_CLASS_STATIC_BLOCK);
+  uint32_t depth = (parser_context_p->status_flags & PARSER_HAS_SLOT_LEXICAL_ENV) ? 1 : 0;
+  parser_saved_context_t *saved_context_p = parser_context_p->last_context_p;
+
+  while (saved_context_p != NULL)
+  {
+    uint32_t status_flags = saved_context_p->status_flags;
+
+    if (!(status_flags & PARSER_IS_FUNCTION) || (status_flags & stop_flags))
+    {
+      return 0;
+    }
+
+    uint16_t literal_index =
+      lexer_find_saved_ident_literal (parser_context_p, saved_context_p, literal_p->u.char_p, literal_p->prop.length);
+
+    if (literal_index != PARSER_INVALID_LITERAL_INDEX)
+    {
+      parser_scope_stack_t *scope_stack_p = saved_context_p->scope_stack_p;
+      uint16_t i = saved_context_p->scope_stack_top;
+
+      while (i > 0)
+      {
+        i--;
+
+        if (scope_stack_p[i].map_from != literal_index)
+        {
+          continue;
+        }
+
+        /* Only the function level variables of slot functions are stored in binding slots. */
+        if (i >= saved_context_p->scope_stack_global_end
+            || (scope_stack_p[i].map_to & PARSER_SCOPE_STACK_REGISTER_MASK) != 0
+            || !(status_flags & PARSER_HAS_SLOT_LEXICAL_ENV))
+        {
+          return 0;
+        }
+
+        uint16_t slot_index = parser_count_binding_slots (scope_stack_p, i);
+
+        depth++;
+
+        if (depth > CBC_SLOT_INFO_MAX_DEPTH || slot_index > CBC_SLOT_INFO_MAX_INDEX)
+        {
+          return 0;
+        }
+
+        return CBC_SLOT_INFO_CREATE (depth, slot_index);
+      }
+    }
+
+    if (status_flags & PARSER_HAS_SLOT_LEXICAL_ENV)
+    {
+      depth++;
+    }
+
+    /* The environment of the function name is not a slot environment. */
+    if (status_flags & PARSER_FUNCTION_NAME_IS_BOUND)
+    {
+      return 0;
+    }
+
+    saved_context_p = saved_context_p->prev_context_p;
+  }
+
+  return 0;
+} /* parser_resolve_binding_slot */
+
+/**
+ * Resolve the free identifiers of the current function to the binding slots of the lexical
+ * environments of the enclosing functions. The slot info of each used identifier literal is
+ * stored in its slot_info member.
+ *
+ * An identifier is resolved when it is declared at the function level of an enclosing slot
+ * function, and no environment between the two functions can have a binding with the same
+ * name: the identifier is not bound by a block, catch clause, class, with statement, direct
+ * eval or function name between them. The vm walks the same number of slot environments
+ * (other environments are skipped) to find the binding.
+ *
+ * @return true - if the byte code needs a slot table
+ *         false - otherwise
+ */
+static bool
+parser_resolve_binding_slots (parser_context_t *parser_context_p) /**< context */
+{
+  const uint32_t skip_flags = (PARSER_FUNCTION_NAME_IS_BOUND | PARSER_INSIDE_WITH | PARSER_INSIDE_CLASS_FIELD
+                               | PARSER_IS_CLASS_STATIC_BLOCK);
+  uint32_t status_flags = parser_context_p->status_flags;
+  bool has_slot_info = false;
+
+  /* The binding slots of functions with a non-slot lexical environment cannot be reached. */
+  bool can_resolve = ((status_flags & (PARSER_HAS_SLOT_LEXICAL_ENV | PARSER_LEXICAL_ENV_NEEDED))
+                      != PARSER_LEXICAL_ENV_NEEDED)
+                     && (status_flags & PARSER_IS_FUNCTION) && !(status_flags & skip_flags);
+
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+
+  parser_list_iterator_init (&parser_context_p->literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (literal_p->type != LEXER_IDENT_LITERAL || !(literal_p->status_flags & LEXER_FLAG_USED))
+    {
+      continue;
+    }
+
+    literal_p->slot_info = 0;
+
+    if (can_resolve && !(literal_p->status_flags & LEXER_FLAG_NO_SLOT))
+    {
+      literal_p->slot_info = parser_resolve_binding_slot (parser_context_p, literal_p);
+
+      if (literal_p->slot_info != 0)
+      {
+        has_slot_info = true;
+      }
+    }
+  }
+
+  return has_slot_info || (status_flags & PARSER_HAS_SLOT_LEXICAL_ENV) != 0;
+} /* parser_resolve_binding_slots */
+
 /**
  * Post processing main function.
  *
@@ -683,6 +840,9 @@ parser_post_processing (parser_context_t *parser_context_p) /**< parser context
   }
 #endif /* JJS_DEBUGGER */
 
+  /* Must be done before the identifier names are replaced by the literal indicies. */
+  bool has_slot_table = parser_resolve_binding_slots (parser_context_p);
+
   parser_compute_indicies (parser_context_p, &ident_end, &const_literal_end);
 
   if (parser_context_p->literal_count <= CBC_MAXIMUM_SMALL_VALUE)
@@ -916,6 +1076,15 @@ parser_post_processing (parser_context_t *parser_context_p) /**< parser context
   /* space for line info block */
   total_size += sizeof (ecma_value_t);
 
+  size_t slot_table_size = 0;
+
+  if (has_slot_table)
+  {
+    slot_table_size = (size_t) (ident_end - parser_context_p->register_count + 1) * sizeof (uint16_t);
+    slot_table_size = JJS_ALIGNUP (slot_table_size, sizeof (ecma_value_t));
+    total_size += slot_table_size;
+  }
+
   uint8_t extended_info = 0;
 
   if (parser_context_p->argument_length != UINT16_MAX)
@@ -1356,12 +1525,39 @@ parser_post_processing (parser_context_t *parser_context_p) /**< parser context
   base_p[-1] = JMEM_CP_NULL;
 #endif /* JJS_LINE_INFO */
 
+  if (has_slot_table)
+  {
+    uint16_t *slot_table_p = (uint16_t *) (((uint8_t *) (base_p - 1)) - slot_table_size);
+    uint16_t register_count = parser_context_p->register_count;
+    parser_list_iterator_t literal_iterator;
+    lexer_literal_t *literal_p;
+
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_HAS_SLOT_TABLE;
+    memset (slot_table_p, 0, slot_table_size);
+
+    if (parser_context_p->status_flags & PARSER_HAS_SLOT_LEXICAL_ENV)
+    {
+      slot_table_p[0] =
+        parser_count_binding_slots (parser_context_p->scope_stack_p, parser_context_p->scope_stack_global_end);
+    }
+
+    parser_list_iterator_init (&parser_context_p->literal_pool, &literal_iterator);
+    while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
+    {
+      if (literal_p->type == LEXER_IDENT_LITERAL && (literal_p->status_flags & LEXER_FLAG_USED))
+      {
+        JJS_ASSERT (literal_p->prop.index >= register_count && literal_p->prop.index < ident_end);
+        slot_table_p[1 + literal_p->prop.index - register_count] = literal_p->slot_info;
+      }
+    }
+  }
+
   if (extended_info != 0)
   {
     /* adjust for line info block */
     base_p--;
 
-    uint8_t *extended_info_p = ((uint8_t *) base_p) - 1;
+    uint8_t *extended_info_p = ((uint8_t *) base_p) - slot_table_size - 1;
 
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_HAS_EXTENDED_INFO;
     *extended_info_p = extended_info;
@@ -1598,6 +1794,24 @@ parser_free_literals (parser_context_t *parser_context_p, /**< parser context */
   parser_list_free (parser_context_p, literal_pool_p);
 } /* parser_free_literals */
 
+/**
+ * Mark the function as a slot function when all of its non-register variables are declared by
+ * its function body and no direct eval can add further bindings to its lexical environment.
+ */
+static void
+parser_check_slot_lexical_env (parser_context_t *context_p, /**< parser context */
+                               uint8_t scanner_flags) /**< flags of the function scanner info */
+{
+  const uint32_t mask = (PARSER_LEXICAL_ENV_NEEDED | PARSER_LEXICAL_BLOCK_NEEDED | PARSER_FUNCTION_HAS_COMPLEX_ARGUMENT
+                         | PARSER_CLASS_CONSTRUCTOR | PARSER_INSIDE_CLASS_FIELD | PARSER_IS_CLASS_STATIC_BLOCK);
+
+  if ((context_p->status_flags & mask) == PARSER_LEXICAL_ENV_NEEDED
+      && !(scanner_flags & SCANNER_FUNCTION_LEXICAL_ENV_NEEDED))
+  {
+    context_p->status_flags |= PARSER_HAS_SLOT_LEXICAL_ENV;
+  }
+} /* parser_check_slot_lexical_env */
+
 /**
  * Parse function arguments
  */
@@ -1607,6 +1821,8 @@ parser_parse_function_arguments (parser_context_t *context_p, /**< parser contex
 {
   JJS_ASSERT (context_p->next_scanner_info_p->type == SCANNER_TYPE_FUNCTION);
 
+  uint8_t scanner_flags = context_p->next_scanner_info_p->u8_arg;
+
   JJS_ASSERT (context_p->status_flags & PARSER_IS_FUNCTION);
   JJS_ASSERT (!(context_p->status_flags & PARSER_LEXICAL_BLOCK_NEEDED));
 
@@ -1633,10 +1849,12 @@ parser_parse_function_arguments (parser_context_t *context_p, /**< parser contex
       parser_emit_cbc_ext (context_p, CBC_EXT_CREATE_GENERATOR);
       parser_emit_cbc (context_p, CBC_POP);
       scanner_create_variables (context_p, SCANNER_CREATE_VARS_IS_FUNCTION_BODY);
+      parser_check_slot_lexical_env (context_p, scanner_flags);
       return;
     }
 
     scanner_create_variables (context_p, SCANNER_CREATE_VARS_NO_OPTS);
+    parser_check_slot_lexical_env (context_p, scanner_flags);
     return;
   }
 
@@ -1934,6 +2152,8 @@ parser_parse_function_arguments (parser_context_t *context_p, /**< parser contex
   {
     context_p->status_flags |= PARSER_IS_STRICT;
   }
+
+  parser_check_slot_lexical_env (context_p, scanner_flags);
 } /* parser_parse_function_arguments */
 
 #ifndef JJS_NDEBUG
@@ -2151,6 +2371,9 @@ parser_parse_source (ecma_context_t *context_p, /**< JJS context */
   parser_list_init (&context.literal_pool,
                     sizeof (lexer_literal_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_literal_t)));
+  context.literal_hash_p = NULL;
+  context.literal_hash_size = 0;
+  context.literal_hash_count = 0;
   context.scope_stack_p = NULL;
   context.scope_stack_size = 0;
   context.scope_stack_top = 0;
@@ -2424,6 +2647,8 @@ parser_parse_source (ecma_context_t *context_p, /**< JJS context */
   }
   PARSER_TRY_END
 
+  lexer_free_literal_hash (&context);
+
   if (context.scope_stack_p != NULL)
   {
     parser_free_scratch (&context, context.scope_stack_p, context.scope_stack_size * sizeof (parser_scope_stack_t));
@@ -2559,6 +2784,9 @@ parser_save_context (parser_context_t *parser_context_p, /**< parser context */
   saved_context_p->byte_code = parser_context_p->byte_code;
   saved_context_p->byte_code_size = parser_context_p->byte_code_size;
   saved_context_p->literal_pool_data = parser_context_p->literal_pool.data;
+  saved_context_p->literal_hash_p = parser_context_p->literal_hash_p;
+  saved_context_p->literal_hash_size = parser_context_p->literal_hash_size;
+  saved_context_p->literal_hash_count = parser_context_p->literal_hash_count;
   saved_context_p->scope_stack_p = parser_context_p->scope_stack_p;
   saved_context_p->scope_stack_size = parser_context_p->scope_stack_size;
   saved_context_p->scope_stack_top = parser_context_p->scope_stack_top;
@@ -2594,6 +2822,9 @@ parser_save_context (parser_context_t *parser_context_p, /**< parser context */
   parser_cbc_stream_init (&parser_context_p->byte_code);
   parser_context_p->byte_code_size = 0;
   parser_list_reset (&parser_context_p->literal_pool);
+  parser_context_p->literal_hash_p = NULL;
+  parser_context_p->literal_hash_size = 0;
+  parser_context_p->literal_hash_count = 0;
   parser_context_p->scope_stack_p = NULL;
   parser_context_p->scope_stack_size = 0;
   parser_context_p->scope_stack_top = 0;
@@ -2618,6 +2849,7 @@ parser_restore_context (parser_context_t *parser_context_p, /**< parser context
                         parser_saved_context_t *saved_context_p) /**< target for saving the context */
 {
   parser_list_free (parser_context_p, &parser_context_p->literal_pool);
+  lexer_free_literal_hash (parser_context_p);
 
   if (parser_context_p->scope_stack_p != NULL)
   {
@@ -2648,6 +2880,9 @@ parser_restore_context (parser_context_t *parser_context_p, /**< parser context
   parser_context_p->byte_code = saved_context_p->byte_code;
   parser_context_p->byte_code_size = saved_context_p->byte_code_size;
   parser_context_p->literal_pool.data = saved_context_p->literal_pool_data;
+  parser_context_p->literal_hash_p = saved_context_p->literal_hash_p;
+  parser_context_p->literal_hash_size = saved_context_p->literal_hash_size;
+  parser_context_p->literal_hash_count = saved_context_p->literal_hash_count;
   parser_context_p->scope_stack_p = saved_context_p->scope_stack_p;
   parser_context_p->scope_stack_size = saved_context_p->scope_stack_size;
   parser_context_p->scope_stack_top = saved_context_p->scope_stack_top;
@@ -3313,6 +3548,11 @@ parser_raise_error (parser_context_t *parser_context_p, /**< parser context */
     parser_free_literals (parser_context_p, &parser_context_p->literal_pool);
     parser_context_p->literal_pool.data = saved_context_p->literal_pool_data;
 
+    lexer_free_literal_hash (parser_context_p);
+    parser_context_p->literal_hash_p = saved_context_p->literal_hash_p;
+    parser_context_p->literal_hash_size = saved_context_p->literal_hash_size;
+    parser_context_p->literal_hash_count = saved_context_p->literal_hash_count;
+
     if (parser_context_p->scope_stack_p != NULL)
     {
       parser_free_scratch (parser_context_p,
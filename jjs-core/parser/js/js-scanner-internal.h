@@ -317,6 +317,7 @@ typedef struct scanner_literal_pool_t
   struct scanner_literal_pool_t *prev_p; /**< previous literal pool */
   const uint8_t *source_p; /**< source position where the final data needs to be inserted */
   parser_list_t literal_pool; /**< list of literal */
+  lexer_lit_location_t function_name; /**< name of a function expression (char_p is NULL if not present) */
   uint16_t status_flags; /**< combination of scanner_literal_pool_flags_t flags */
   uint16_t no_declarations; /**< size of scope stack required during parsing */
 } scanner_literal_pool_t;
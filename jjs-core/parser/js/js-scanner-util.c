@@ -620,6 +620,7 @@ scanner_push_literal_pool (parser_context_t *context_p, /**< context */
                     sizeof (lexer_lit_location_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_lit_location_t)));
   literal_pool_p->source_p = NULL;
+  literal_pool_p->function_name.char_p = NULL;
   literal_pool_p->status_flags = status_flags;
   literal_pool_p->no_declarations = 0;
 
@@ -631,6 +632,32 @@ scanner_push_literal_pool (parser_context_t *context_p, /**< context */
 
 JJS_STATIC_ASSERT (PARSER_MAXIMUM_IDENT_LENGTH <= UINT8_MAX, maximum_ident_length_must_fit_in_a_byte);
 
+/**
+ * Checks whether an identifier is present in a literal pool.
+ *
+ * @return true - if the identifier is present, false - otherwise
+ */
+static bool
+scanner_literal_pool_has_literal (parser_context_t *context_p, /**< context */
+                                  scanner_literal_pool_t *literal_pool_p, /**< literal pool */
+                                  const lexer_lit_location_t *literal_location_p) /**< identifier */
+{
+  parser_list_iterator_t literal_iterator;
+  lexer_lit_location_t *literal_p;
+
+  parser_list_iterator_init (&literal_pool_p->literal_pool, &literal_iterator);
+
+  while ((literal_p = (lexer_lit_location_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+  {
+    if (lexer_compare_identifiers (context_p, literal_p, literal_location_p))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* scanner_literal_pool_has_literal */
+
 /**
  * Current status of arguments.
  */
@@ -1028,6 +1055,12 @@ scanner_pop_literal_pool (parser_context_t *parser_context_p, /**< parser contex
         u8_arg |= SCANNER_FUNCTION_IS_STRICT;
       }
 
+      if (literal_pool_p->function_name.char_p != NULL && !(status_flags & SCANNER_LITERAL_POOL_CAN_EVAL)
+          && !scanner_literal_pool_has_literal (parser_context_p, literal_pool_p, &literal_pool_p->function_name))
+      {
+        u8_arg |= SCANNER_FUNCTION_NAME_UNUSED;
+      }
+
       info_p->u8_arg = u8_arg;
       info_p->u16_arg = (uint16_t) no_declarations;
     }
@@ -1255,6 +1288,8 @@ scanner_filter_arguments (parser_context_t *parser_context_p, /**< parser contex
     }
 
     literal_pool_p->status_flags &= (uint16_t) ~SCANNER_LITERAL_POOL_CAN_EVAL;
+    /* The function name may be referenced by the eval calls of the arguments. */
+    literal_pool_p->function_name.char_p = NULL;
   }
   else
   {
@@ -1354,6 +1389,13 @@ scanner_filter_arguments (parser_context_t *parser_context_p, /**< parser contex
       lexer_lit_location_t *literal_location_p = scanner_add_custom_literal (parser_context_p, prev_literal_pool_p, literal_p);
       type |= SCANNER_LITERAL_NO_REG | SCANNER_LITERAL_IS_USED;
       literal_location_p->type |= type;
+
+      if (new_literal_pool_p->function_name.char_p != NULL
+          && lexer_compare_identifiers (parser_context_p, literal_p, &new_literal_pool_p->function_name))
+      {
+        /* The function name is referenced by an argument initializer. */
+        new_literal_pool_p->function_name.char_p = NULL;
+      }
     }
   }
 
@@ -2443,7 +2485,7 @@ scanner_create_variables (parser_context_t *parser_context_p, /**< context */
       }
       else
       {
-        parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED;
+        parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED | LEXER_FLAG_NO_SLOT;
         map_to = parser_context_p->lit_object.index;
 
         parser_context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
@@ -2639,7 +2681,7 @@ scanner_create_variables (parser_context_t *parser_context_p, /**< context */
     }
     else
     {
-      parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED;
+      parser_context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_USED | LEXER_FLAG_NO_SLOT;
       map_to = parser_context_p->lit_object.index;
 
       uint16_t scope_stack_map_to = 0;
@@ -2879,7 +2921,7 @@ scanner_save_literal (parser_context_t *parser_context_p, /**< context */
              || literal_index != (scope_stack_p->map_to & PARSER_SCOPE_STACK_REGISTER_MASK));
 
     literal_index = scope_stack_p->map_from;
-    PARSER_GET_LITERAL (literal_index)->status_flags |= LEXER_FLAG_USED;
+    PARSER_GET_LITERAL (literal_index)->status_flags |= LEXER_FLAG_USED | LEXER_FLAG_NO_SLOT;
   }
 
   return literal_index;
@@ -136,6 +136,8 @@ scanner_scan_primary_expression (parser_context_t *context_p, /**< context */
 
       if (context_p->token.type == LEXER_LITERAL && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
       {
+        scanner_context_p->active_literal_pool_p->function_name = context_p->token.lit_location;
+
 #if JJS_MODULE_SYSTEM
         if (is_export_default)
         {
@@ -240,6 +240,8 @@ typedef enum
                                           *   this flag must be combined with the type of function (e.g. async) */
   SCANNER_FUNCTION_ASYNC = (1 << 4), /**< function is async function */
   SCANNER_FUNCTION_IS_STRICT = (1 << 5), /**< function is strict */
+  SCANNER_FUNCTION_NAME_UNUSED = (1 << 6), /**< the name of a function expression is not referenced
+                                            *   by its body, so no binding is needed for it */
 } scanner_function_flags_t;
 
 /**
@@ -19,6 +19,7 @@
 #include "ecma-regexp-object.h"
 
 #include "lit-strings.h"
+#include "re-nfa.h"
 
 #if JJS_BUILTIN_REGEXP
 
@@ -359,6 +360,58 @@ re_dump_bytecode (re_compiler_ctx_t *re_ctx_p) /**< RegExp bytecode context */
   JJS_DEBUG_MSG (context_p, "Capturing groups: %d ", compiled_code_p->captures_count);
   JJS_DEBUG_MSG (context_p, "Non-capturing groups: %d\n", compiled_code_p->non_captures_count);
 
+  if (compiled_code_p->nfa_offset != 0)
+  {
+    JJS_DEBUG_MSG (context_p,
+                   "Execution mode: linear-time automaton (%u instructions)\n",
+                   RE_NFA_GET_PROGRAM (compiled_code_p)->inst_count);
+  }
+  else
+  {
+    JJS_DEBUG_MSG (context_p, "Execution mode: backtracking\n");
+  }
+
+  switch (compiled_code_p->prefilter_type)
+  {
+    case RE_PREFILTER_ANCHORED:
+    {
+      JJS_DEBUG_MSG (context_p, "Prefilter: anchored\n");
+      break;
+    }
+    case RE_PREFILTER_LITERAL:
+    {
+      JJS_DEBUG_MSG (context_p, "Prefilter: literal prefix ");
+
+      for (uint32_t i = 0; i < compiled_code_p->prefilter_size; i++)
+      {
+        JJS_DEBUG_MSG (context_p, "\\x%02x", RE_GET_PREFILTER (compiled_code_p)[i]);
+      }
+
+      JJS_DEBUG_MSG (context_p, "\n");
+      break;
+    }
+    case RE_PREFILTER_FIRST_BYTES:
+    {
+      JJS_DEBUG_MSG (context_p, "Prefilter: first bytes ");
+
+      for (uint32_t i = 0; i < RE_PREFILTER_BITMAP_SIZE * 8; i++)
+      {
+        if (RE_GET_PREFILTER (compiled_code_p)[i >> 3] & (1u << (i & 0x7)))
+        {
+          JJS_DEBUG_MSG (context_p, "\\x%02x", i);
+        }
+      }
+
+      JJS_DEBUG_MSG (context_p, "\n");
+      break;
+    }
+    default:
+    {
+      JJS_DEBUG_MSG (context_p, "Prefilter: none\n");
+      break;
+    }
+  }
+
   const uint8_t *bytecode_start_p = (const uint8_t *) (compiled_code_p + 1);
   const uint8_t *bytecode_p = bytecode_start_p;
 
@@ -600,6 +653,12 @@ re_dump_bytecode (re_compiler_ctx_t *re_ctx_p) /**< RegExp bytecode context */
       case RE_OP_EOF:
       {
         JJS_DEBUG_MSG (context_p, "EOF\n");
+
+        if (compiled_code_p->nfa_offset != 0)
+        {
+          re_nfa_dump (context_p, RE_NFA_GET_PROGRAM (compiled_code_p));
+        }
+
         return;
       }
       default:
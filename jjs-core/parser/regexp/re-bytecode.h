@@ -32,11 +32,6 @@
  * @{
  */
 
-/**
- * Size of the RegExp bytecode cache
- */
-#define RE_CACHE_SIZE 8u
-
 /**
  * Maximum value that can be encoded in the RegExp bytecode as a single byte.
  */
@@ -88,6 +83,27 @@ typedef enum
   RE_OP_BYTE, /**< 1-byte utf8 character */
 } re_opcode_t;
 
+/**
+ * Maximum size of the literal prefix used by the start position prefilter.
+ */
+#define RE_PREFILTER_MAX_LITERAL_SIZE 32
+
+/**
+ * Size of the first byte bitmap used by the start position prefilter.
+ */
+#define RE_PREFILTER_BITMAP_SIZE 32
+
+/**
+ * Start position prefilter types
+ */
+typedef enum
+{
+  RE_PREFILTER_NONE, /**< a match can start at any position */
+  RE_PREFILTER_ANCHORED, /**< a match can only start at the start of the input */
+  RE_PREFILTER_LITERAL, /**< a match starts with a literal byte sequence */
+  RE_PREFILTER_FIRST_BYTES, /**< a match starts with one of the bytes in a bitmap */
+} re_prefilter_type_t;
+
 /**
  * Compiled byte code data.
  */
@@ -96,9 +112,35 @@ typedef struct
   ecma_compiled_code_t header; /**< compiled code header */
   uint32_t captures_count; /**< number of capturing groups */
   uint32_t non_captures_count; /**< number of non-capturing groups */
+  uint32_t nfa_offset; /**< offset of the linear-time automaton, 0 if the pattern is matched by backtracking */
+  uint32_t prefilter_offset; /**< offset of the literal prefix or the first byte bitmap */
+  uint8_t prefilter_type; /**< re_prefilter_type_t */
+  uint8_t prefilter_size; /**< size of the literal prefix or the first byte bitmap */
   ecma_value_t source; /**< original RegExp pattern */
 } re_compiled_code_t;
 
+/**
+ * Get the literal prefix or the first byte bitmap of a compiled RegExp.
+ */
+#define RE_GET_PREFILTER(compiled_code_p) ((const uint8_t *) (compiled_code_p) + (compiled_code_p)->prefilter_offset)
+
+/**
+ * Index of a missing RegExp cache entry.
+ */
+#define RE_CACHE_NO_ENTRY UINT32_MAX
+
+/**
+ * RegExp bytecode cache entry.
+ */
+typedef struct
+{
+  re_compiled_code_t *bytecode_p; /**< cached bytecode */
+  uint32_t hash; /**< hash of the pattern and the flags */
+  uint32_t bucket_next; /**< next entry in the same hash bucket */
+  uint32_t lru_prev; /**< previous (more recently used) entry */
+  uint32_t lru_next; /**< next (less recently used) entry */
+} re_cache_entry_t;
+
 void re_initialize_regexp_bytecode (re_compiler_ctx_t *re_ctx_p);
 uint32_t re_bytecode_size (re_compiler_ctx_t *re_ctx_p);
 
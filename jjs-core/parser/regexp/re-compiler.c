@@ -25,6 +25,7 @@
 #include "lit-char-helpers.h"
 #include "re-bytecode.h"
 #include "re-compiler-context.h"
+#include "re-nfa.h"
 #include "re-parser.h"
 
 #if JJS_BUILTIN_REGEXP
@@ -39,6 +40,75 @@
  * @{
  */
 
+/**
+ * Get the hash bucket heads of the RegExp cache.
+ */
+#define RE_CACHE_GET_BUCKETS(context_p) ((uint32_t *) ((context_p)->re_cache_p + (context_p)->re_cache_size))
+
+/**
+ * Calculate the RegExp cache hash of a pattern and its flags.
+ *
+ * @return hash value
+ */
+static uint32_t
+re_cache_hash (ecma_string_t *pattern_str_p, /**< pattern string */
+               uint16_t flags) /**< flags */
+{
+  return (uint32_t) ecma_string_hash (pattern_str_p) ^ ((uint32_t) flags * 0x9e3779b1u);
+} /* re_cache_hash */
+
+/**
+ * Unlink an entry from the LRU list of the RegExp cache.
+ */
+static void
+re_cache_lru_unlink (ecma_context_t *context_p, /**< JJS engine context */
+                     uint32_t index) /**< entry index */
+{
+  re_cache_entry_t *entry_p = context_p->re_cache_p + index;
+
+  if (entry_p->lru_prev != RE_CACHE_NO_ENTRY)
+  {
+    context_p->re_cache_p[entry_p->lru_prev].lru_next = entry_p->lru_next;
+  }
+  else
+  {
+    context_p->re_cache_lru_head = entry_p->lru_next;
+  }
+
+  if (entry_p->lru_next != RE_CACHE_NO_ENTRY)
+  {
+    context_p->re_cache_p[entry_p->lru_next].lru_prev = entry_p->lru_prev;
+  }
+  else
+  {
+    context_p->re_cache_lru_tail = entry_p->lru_prev;
+  }
+} /* re_cache_lru_unlink */
+
+/**
+ * Make an entry the most recently used entry of the RegExp cache.
+ */
+static void
+re_cache_lru_push_front (ecma_context_t *context_p, /**< JJS engine context */
+                         uint32_t index) /**< entry index */
+{
+  re_cache_entry_t *entry_p = context_p->re_cache_p + index;
+
+  entry_p->lru_prev = RE_CACHE_NO_ENTRY;
+  entry_p->lru_next = context_p->re_cache_lru_head;
+
+  if (context_p->re_cache_lru_head != RE_CACHE_NO_ENTRY)
+  {
+    context_p->re_cache_p[context_p->re_cache_lru_head].lru_prev = index;
+  }
+  else
+  {
+    context_p->re_cache_lru_tail = index;
+  }
+
+  context_p->re_cache_lru_head = index;
+} /* re_cache_lru_push_front */
+
 /**
  * Search for the given pattern in the RegExp cache.
  *
@@ -48,55 +118,608 @@
 static re_compiled_code_t *
 re_cache_lookup (ecma_context_t *context_p, /**< JJS engine context */
                  ecma_string_t *pattern_str_p, /**< pattern string */
-                 uint16_t flags) /**< flags */
+                 uint16_t flags, /**< flags */
+                 uint32_t hash) /**< hash of the pattern and the flags */
 {
-  re_compiled_code_t **cache_p = context_p->re_cache;
-
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  if (context_p->re_cache_count == 0)
   {
-    re_compiled_code_t *cached_bytecode_p = cache_p[idx];
+    return NULL;
+  }
 
-    if (cached_bytecode_p == NULL)
-    {
-      break;
-    }
+  uint32_t index = RE_CACHE_GET_BUCKETS (context_p)[hash & context_p->re_cache_bucket_mask];
 
-    ecma_string_t *cached_pattern_str_p = ecma_get_string_from_value (context_p, cached_bytecode_p->source);
+  while (index != RE_CACHE_NO_ENTRY)
+  {
+    re_cache_entry_t *entry_p = context_p->re_cache_p + index;
+    re_compiled_code_t *cached_bytecode_p = entry_p->bytecode_p;
 
-    if (cached_bytecode_p->header.status_flags == flags
-        && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+    if (entry_p->hash == hash && cached_bytecode_p->header.status_flags == flags
+        && ecma_compare_ecma_strings (ecma_get_string_from_value (context_p, cached_bytecode_p->source), pattern_str_p))
     {
+      if (context_p->re_cache_lru_head != index)
+      {
+        re_cache_lru_unlink (context_p, index);
+        re_cache_lru_push_front (context_p, index);
+      }
+
       return cached_bytecode_p;
     }
+
+    index = entry_p->bucket_next;
   }
 
   return NULL;
 } /* re_cache_lookup */
 
 /**
- * Run garbage collection in RegExp cache.
+ * Remove the least recently used entry from the RegExp cache.
+ *
+ * @return index of the removed entry
  */
-void
-re_cache_gc (ecma_context_t *context_p)
+static uint32_t
+re_cache_evict (ecma_context_t *context_p) /**< JJS engine context */
 {
-  re_compiled_code_t **cache_p = context_p->re_cache;
+  uint32_t index = context_p->re_cache_lru_tail;
+  re_cache_entry_t *entry_p = context_p->re_cache_p + index;
+  uint32_t *next_p = RE_CACHE_GET_BUCKETS (context_p) + (entry_p->hash & context_p->re_cache_bucket_mask);
 
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  while (*next_p != index)
   {
-    const re_compiled_code_t *cached_bytecode_p = cache_p[i];
+    next_p = &context_p->re_cache_p[*next_p].bucket_next;
+  }
+
+  *next_p = entry_p->bucket_next;
+  re_cache_lru_unlink (context_p, index);
+
+  ecma_bytecode_deref (context_p, (ecma_compiled_code_t *) entry_p->bytecode_p);
+  return index;
+} /* re_cache_evict */
+
+/**
+ * Insert a bytecode into the RegExp cache. If the cache is full, the least recently used bytecode is
+ * released.
+ *
+ * @return true - if the bytecode is inserted into the cache
+ *         false - otherwise
+ */
+static bool
+re_cache_insert (ecma_context_t *context_p, /**< JJS engine context */
+                 re_compiled_code_t *bytecode_p, /**< compiled bytecode */
+                 uint32_t hash) /**< hash of the pattern and the flags */
+{
+  if (context_p->re_cache_size == 0)
+  {
+    return false;
+  }
 
-    if (cached_bytecode_p == NULL)
+  if (context_p->re_cache_p == NULL)
+  {
+    uint32_t bucket_count = 1;
+
+    while (bucket_count < context_p->re_cache_size)
     {
-      break;
+      bucket_count <<= 1;
     }
 
-    ecma_bytecode_deref (context_p, (ecma_compiled_code_t *) cached_bytecode_p);
-    cache_p[i] = NULL;
+    size_t size = context_p->re_cache_size * sizeof (re_cache_entry_t) + bucket_count * sizeof (uint32_t);
+    context_p->re_cache_p = jjs_allocator_alloc (&context_p->context_allocator, (jjs_size_t) size);
+
+    if (context_p->re_cache_p == NULL)
+    {
+      return false;
+    }
+
+    memset (RE_CACHE_GET_BUCKETS (context_p), 0xff, bucket_count * sizeof (uint32_t));
+    context_p->re_cache_bucket_mask = bucket_count - 1;
+    context_p->re_cache_count = 0;
+    context_p->re_cache_lru_head = RE_CACHE_NO_ENTRY;
+    context_p->re_cache_lru_tail = RE_CACHE_NO_ENTRY;
+  }
+
+  uint32_t index;
+
+  if (context_p->re_cache_count < context_p->re_cache_size)
+  {
+    index = context_p->re_cache_count++;
+  }
+  else
+  {
+    index = re_cache_evict (context_p);
+  }
+
+  re_cache_entry_t *entry_p = context_p->re_cache_p + index;
+  uint32_t *bucket_p = RE_CACHE_GET_BUCKETS (context_p) + (hash & context_p->re_cache_bucket_mask);
+
+  entry_p->bytecode_p = bytecode_p;
+  entry_p->hash = hash;
+  entry_p->bucket_next = *bucket_p;
+  *bucket_p = index;
+
+  re_cache_lru_push_front (context_p, index);
+  return true;
+} /* re_cache_insert */
+
+/**
+ * Release all bytecodes stored in the RegExp cache.
+ */
+void
+re_cache_gc (ecma_context_t *context_p) /**< JJS engine context */
+{
+  if (context_p->re_cache_count == 0)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0u; i < context_p->re_cache_count; i++)
+  {
+    ecma_bytecode_deref (context_p, (ecma_compiled_code_t *) context_p->re_cache_p[i].bytecode_p);
   }
 
-  context_p->re_cache_idx = 0;
+  memset (RE_CACHE_GET_BUCKETS (context_p), 0xff, (context_p->re_cache_bucket_mask + 1) * sizeof (uint32_t));
+  context_p->re_cache_count = 0;
+  context_p->re_cache_lru_head = RE_CACHE_NO_ENTRY;
+  context_p->re_cache_lru_tail = RE_CACHE_NO_ENTRY;
 } /* re_cache_gc */
 
+/**
+ * Release the RegExp cache.
+ */
+void
+re_cache_finalize (ecma_context_t *context_p) /**< JJS engine context */
+{
+  if (context_p->re_cache_p == NULL)
+  {
+    return;
+  }
+
+  re_cache_gc (context_p);
+
+  size_t size =
+    context_p->re_cache_size * sizeof (re_cache_entry_t) + (context_p->re_cache_bucket_mask + 1) * sizeof (uint32_t);
+  jjs_allocator_free (&context_p->context_allocator, context_p->re_cache_p, (jjs_size_t) size);
+  context_p->re_cache_p = NULL;
+} /* re_cache_finalize */
+
+/**
+ * Start position prefilter of a pattern
+ */
+typedef struct
+{
+  uint8_t type; /**< re_prefilter_type_t */
+  uint8_t size; /**< size of the data */
+  uint8_t data[RE_PREFILTER_MAX_LITERAL_SIZE]; /**< literal prefix or first byte bitmap */
+} re_prefilter_t;
+
+JJS_STATIC_ASSERT (RE_PREFILTER_BITMAP_SIZE <= RE_PREFILTER_MAX_LITERAL_SIZE,
+                   prefilter_bitmap_must_fit_into_the_prefilter_data);
+
+/**
+ * Add the first bytes of the cesu-8 encoded characters in a code point range to a first byte bitmap.
+ */
+static void
+re_prefilter_add_range (uint8_t *bitmap_p, /**< [in, out] first byte bitmap */
+                        lit_code_point_t begin, /**< first code point of the range */
+                        lit_code_point_t end) /**< last code point of the range */
+{
+  JJS_ASSERT (begin <= end);
+
+  if (end > LIT_UTF16_CODE_UNIT_MAX)
+  {
+    /* Supplementary code points are encoded as surrogate pairs. */
+    re_prefilter_add_range (bitmap_p, LIT_UTF16_HIGH_SURROGATE_MIN, LIT_UTF16_HIGH_SURROGATE_MIN);
+
+    if (begin > LIT_UTF16_CODE_UNIT_MAX)
+    {
+      return;
+    }
+
+    end = LIT_UTF16_CODE_UNIT_MAX;
+  }
+
+  lit_utf8_byte_t begin_buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+  lit_utf8_byte_t end_buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+  lit_code_unit_to_utf8 ((ecma_char_t) begin, begin_buf);
+  lit_code_unit_to_utf8 ((ecma_char_t) end, end_buf);
+
+  /* The first byte of an encoded character grows monotonically with the code unit. */
+  for (uint32_t byte = begin_buf[0]; byte <= end_buf[0]; byte++)
+  {
+    if ((byte & LIT_UTF8_EXTRA_BYTE_MASK) != LIT_UTF8_EXTRA_BYTE_MARKER)
+    {
+      bitmap_p[byte >> 3] |= (uint8_t) (1u << (byte & 0x7));
+    }
+  }
+} /* re_prefilter_add_range */
+
+/**
+ * Add the first bytes of the characters matched by a class escape to a first byte bitmap.
+ *
+ * @return true - if the class escape matches a limited set of characters
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_class_escape (uint8_t *bitmap_p, /**< [in, out] first byte bitmap */
+                               ecma_class_escape_t escape) /**< class escape */
+{
+  switch (escape)
+  {
+    case RE_ESCAPE_DIGIT:
+    {
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_0, LIT_CHAR_9);
+      return true;
+    }
+    case RE_ESCAPE_WORD_CHAR:
+    {
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_0, LIT_CHAR_9);
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_UPPERCASE_A, LIT_CHAR_UPPERCASE_Z);
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_LOWERCASE_A, LIT_CHAR_LOWERCASE_Z);
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_UNDERSCORE, LIT_CHAR_UNDERSCORE);
+      return true;
+    }
+    case RE_ESCAPE_WHITESPACE:
+    {
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_TAB, LIT_CHAR_CR);
+      re_prefilter_add_range (bitmap_p, LIT_CHAR_SP, LIT_CHAR_SP);
+      re_prefilter_add_range (bitmap_p, LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1, LIT_UTF16_CODE_UNIT_MAX);
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* re_prefilter_add_class_escape */
+
+/**
+ * Add the first bytes of the characters matched by a character matching opcode to a first byte bitmap.
+ *
+ * @return true - if the opcode matches a limited set of characters
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_char (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                       uint8_t *bitmap_p, /**< [in, out] first byte bitmap */
+                       const uint8_t *bc_p) /**< pointer to the opcode */
+{
+  const bool is_unicode = (re_ctx_p->flags & RE_FLAG_UNICODE) != 0;
+  const bool is_ignore_case = (re_ctx_p->flags & RE_FLAG_IGNORE_CASE) != 0;
+
+  const re_opcode_t opcode = re_get_opcode (&bc_p);
+
+  switch (opcode)
+  {
+    case RE_OP_BYTE:
+    case RE_OP_CHAR:
+    {
+      const lit_code_point_t ch = (opcode == RE_OP_BYTE) ? re_get_byte (&bc_p) : re_get_char (&bc_p, is_unicode);
+
+      if (!is_ignore_case)
+      {
+        re_prefilter_add_range (bitmap_p, ch, ch);
+        return true;
+      }
+
+      /* Canonicalization never maps non-ascii characters to ascii characters, except for case folding in unicode
+       * mode, which maps a few non-ascii characters to ascii letters. */
+      if (ch > LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+      {
+        re_prefilter_add_range (bitmap_p,
+                                LIT_UTF8_2_BYTE_CODE_POINT_MIN,
+                                is_unicode ? LIT_UNICODE_CODE_POINT_MAX : LIT_UTF16_CODE_UNIT_MAX);
+        return true;
+      }
+
+      const lit_code_point_t lower_ch = LEXER_TO_ASCII_LOWERCASE (ch);
+
+      if (lower_ch >= LIT_CHAR_LOWERCASE_A && lower_ch <= LIT_CHAR_LOWERCASE_Z)
+      {
+        re_prefilter_add_range (bitmap_p, lower_ch, lower_ch);
+        re_prefilter_add_range (bitmap_p, lower_ch - LIT_CHAR_SP, lower_ch - LIT_CHAR_SP);
+      }
+      else
+      {
+        re_prefilter_add_range (bitmap_p, ch, ch);
+      }
+
+      if (is_unicode)
+      {
+        re_prefilter_add_range (bitmap_p, LIT_UTF8_2_BYTE_CODE_POINT_MIN, LIT_UTF16_CODE_UNIT_MAX);
+      }
+
+      return true;
+    }
+    case RE_OP_CLASS_ESCAPE:
+    {
+      return !is_ignore_case && re_prefilter_add_class_escape (bitmap_p, (ecma_class_escape_t) re_get_byte (&bc_p));
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t flags = re_get_byte (&bc_p);
+
+      if (is_ignore_case || (flags & RE_CLASS_INVERT))
+      {
+        return false;
+      }
+
+      uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+      uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
+
+      while (escape_count-- > 0)
+      {
+        if (!re_prefilter_add_class_escape (bitmap_p, (ecma_class_escape_t) re_get_byte (&bc_p)))
+        {
+          return false;
+        }
+      }
+
+      while (char_count-- > 0)
+      {
+        const lit_code_point_t ch = re_get_char (&bc_p, is_unicode);
+        re_prefilter_add_range (bitmap_p, ch, ch);
+      }
+
+      while (range_count-- > 0)
+      {
+        const lit_code_point_t begin = re_get_char (&bc_p, is_unicode);
+        const lit_code_point_t end = re_get_char (&bc_p, is_unicode);
+        re_prefilter_add_range (bitmap_p, begin, end);
+      }
+
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* re_prefilter_add_char */
+
+static bool re_prefilter_add_alternatives (re_compiler_ctx_t *re_ctx_p, uint8_t *bitmap_p, const uint8_t *bc_p);
+
+/**
+ * Add the first bytes of the strings matched by an alternative to a first byte bitmap.
+ *
+ * @return true - if every non-empty match of the alternative starts with a byte in the bitmap
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_terms (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                        uint8_t *bitmap_p, /**< [in, out] first byte bitmap */
+                        const uint8_t *bc_p) /**< pointer to the first atom */
+{
+  while (true)
+  {
+    switch (*bc_p)
+    {
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        bc_p++;
+        break;
+      }
+      case RE_OP_NO_ALTERNATIVE:
+      {
+        return true;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        if (re_get_opcode (&bc_p) == RE_OP_NON_CAPTURING_GROUP_START)
+        {
+          re_get_value (&bc_p);
+        }
+
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+
+        if (re_get_value (&bc_p) > 0)
+        {
+          return re_prefilter_add_alternatives (re_ctx_p, bitmap_p, bc_p);
+        }
+
+        /* Optional groups are followed by the rest of the alternative. */
+        const uint32_t end_offset = re_get_value (&bc_p);
+
+        if (!re_prefilter_add_alternatives (re_ctx_p, bitmap_p, bc_p))
+        {
+          return false;
+        }
+
+        bc_p += end_offset;
+        re_get_opcode (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        bc_p++;
+        const uint32_t qmin = re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        const uint32_t end_offset = re_get_value (&bc_p);
+
+        if (!re_prefilter_add_char (re_ctx_p, bitmap_p, bc_p))
+        {
+          return false;
+        }
+
+        if (qmin > 0)
+        {
+          return true;
+        }
+
+        bc_p += end_offset;
+        break;
+      }
+      case RE_OP_CLASS_ESCAPE:
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_UNICODE_PERIOD:
+      case RE_OP_PERIOD:
+      case RE_OP_CHAR:
+      case RE_OP_BYTE:
+      {
+        return re_prefilter_add_char (re_ctx_p, bitmap_p, bc_p);
+      }
+      default:
+      {
+        /* The alternative can match an empty string, or its start depends on an assertion. */
+        return false;
+      }
+    }
+  }
+} /* re_prefilter_add_terms */
+
+/**
+ * Add the first bytes of the strings matched by a disjunction to a first byte bitmap.
+ *
+ * @return true - if every non-empty match of the disjunction starts with a byte in the bitmap
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_alternatives (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                               uint8_t *bitmap_p, /**< [in, out] first byte bitmap */
+                               const uint8_t *bc_p) /**< pointer to the first opcode */
+{
+  if (*bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_prefilter_add_terms (re_ctx_p, bitmap_p, bc_p);
+  }
+
+  while (true)
+  {
+    /* Skip the opcode and read the offset of the next alternative. */
+    bc_p++;
+    const uint32_t offset = re_get_value (&bc_p);
+
+    if (!re_prefilter_add_terms (re_ctx_p, bitmap_p, bc_p))
+    {
+      return false;
+    }
+
+    bc_p += offset;
+
+    if (*bc_p != RE_OP_ALTERNATIVE_NEXT)
+    {
+      return true;
+    }
+  }
+} /* re_prefilter_add_alternatives */
+
+/**
+ * Collect the literal prefix which starts every match of the pattern.
+ */
+static void
+re_prefilter_find_literal (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                           re_prefilter_t *prefilter_p, /**< [in, out] prefilter */
+                           const uint8_t *bc_p) /**< pointer to the first opcode */
+{
+  const bool is_unicode = (re_ctx_p->flags & RE_FLAG_UNICODE) != 0;
+
+  if (re_ctx_p->flags & RE_FLAG_IGNORE_CASE)
+  {
+    return;
+  }
+
+  while (true)
+  {
+    lit_utf8_byte_t buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+    lit_utf8_size_t size = 0;
+
+    switch (re_get_opcode (&bc_p))
+    {
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        if (bc_p[-1] == RE_OP_NON_CAPTURING_GROUP_START)
+        {
+          re_get_value (&bc_p);
+        }
+
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+
+        /* The first iteration of a mandatory group continues the prefix. */
+        if (re_get_value (&bc_p) == 0)
+        {
+          return;
+        }
+
+        break;
+      }
+      case RE_OP_BYTE:
+      {
+        buf[0] = re_get_byte (&bc_p);
+        size = 1;
+        break;
+      }
+      case RE_OP_CHAR:
+      {
+        const lit_code_point_t ch = re_get_char (&bc_p, is_unicode);
+
+        /* Surrogates are matched as part of a code point in unicode mode. */
+        if (is_unicode && (ch > LIT_UTF16_CODE_UNIT_MAX || lit_is_code_point_utf16_high_surrogate (ch)
+                           || lit_is_code_point_utf16_low_surrogate (ch)))
+        {
+          return;
+        }
+
+        size = lit_code_unit_to_utf8 ((ecma_char_t) ch, buf);
+        break;
+      }
+      default:
+      {
+        return;
+      }
+    }
+
+    if (prefilter_p->size + size > RE_PREFILTER_MAX_LITERAL_SIZE)
+    {
+      return;
+    }
+
+    memcpy (prefilter_p->data + prefilter_p->size, buf, size);
+    prefilter_p->size = (uint8_t) (prefilter_p->size + size);
+  }
+} /* re_prefilter_find_literal */
+
+/**
+ * Compute the prefilter which finds the positions where a match of the pattern can start.
+ */
+static void
+re_prefilter_compute (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                      re_prefilter_t *prefilter_p) /**< [out] prefilter */
+{
+  const uint8_t *bc_p = re_ctx_p->bytecode_start_p + sizeof (re_compiled_code_t);
+
+  prefilter_p->type = RE_PREFILTER_NONE;
+  prefilter_p->size = 0;
+
+  if (*bc_p == RE_OP_ASSERT_LINE_START && !(re_ctx_p->flags & RE_FLAG_MULTILINE))
+  {
+    prefilter_p->type = RE_PREFILTER_ANCHORED;
+    return;
+  }
+
+  re_prefilter_find_literal (re_ctx_p, prefilter_p, bc_p);
+
+  if (prefilter_p->size > 0)
+  {
+    prefilter_p->type = RE_PREFILTER_LITERAL;
+    return;
+  }
+
+  memset (prefilter_p->data, 0, RE_PREFILTER_BITMAP_SIZE);
+
+  if (re_prefilter_add_alternatives (re_ctx_p, prefilter_p->data, bc_p))
+  {
+    prefilter_p->type = RE_PREFILTER_FIRST_BYTES;
+    prefilter_p->size = RE_PREFILTER_BITMAP_SIZE;
+  }
+} /* re_prefilter_compute */
+
 /**
  * Compilation of RegExp bytecode
  *
@@ -108,14 +731,18 @@ re_compile_bytecode (ecma_context_t *context_p, /**< JJS engine context */
                      ecma_string_t *pattern_str_p, /**< pattern */
                      uint16_t flags) /**< flags */
 {
-  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (context_p, pattern_str_p, flags);
+  uint32_t hash = re_cache_hash (pattern_str_p, flags);
+  re_compiled_code_t *cached_bytecode_p = re_cache_lookup (context_p, pattern_str_p, flags, hash);
 
   if (cached_bytecode_p != NULL)
   {
+    context_p->re_cache_hits++;
     ecma_bytecode_ref ((ecma_compiled_code_t *) cached_bytecode_p);
     return cached_bytecode_p;
   }
 
+  context_p->re_cache_misses++;
+
   re_compiler_ctx_t re_ctx;
   re_ctx.flags = flags;
   re_ctx.captures_count = 1;
@@ -144,13 +771,33 @@ re_compile_bytecode (ecma_context_t *context_p, /**< JJS engine context */
     return NULL;
   }
 
+  /* The prefilter data is stored after the bytecode. */
+  re_prefilter_t prefilter;
+  re_prefilter_compute (&re_ctx, &prefilter);
+  const uint32_t prefilter_offset = (uint32_t) re_ctx.bytecode_size;
+  const uint32_t prefilter_end = prefilter_offset + prefilter.size;
+
+  /* Patterns without backreferences and lookaheads are matched by a linear-time automaton, which is stored
+   * after the prefilter data. */
+  size_t nfa_size = 0;
+  re_nfa_program_t *nfa_p = re_nfa_compile (&re_ctx, &nfa_size);
+  const uint32_t nfa_offset = (nfa_p != NULL) ? JJS_ALIGNUP (prefilter_end, sizeof (uint32_t)) : 0;
+
   /* Align bytecode size to JMEM_ALIGNMENT so that it can be stored in the bytecode header. */
-  const uint32_t final_size = JJS_ALIGNUP (re_ctx.bytecode_size, JMEM_ALIGNMENT);
+  const uint32_t final_size =
+    JJS_ALIGNUP ((nfa_p != NULL) ? nfa_offset + (uint32_t) nfa_size : prefilter_end, JMEM_ALIGNMENT);
   re_compiled_code_t *re_compiled_code_p =
     (re_compiled_code_t *) jmem_heap_realloc_block (context_p, re_ctx.bytecode_start_p, re_ctx.bytecode_size, final_size);
+  re_ctx.bytecode_start_p = (uint8_t *) re_compiled_code_p;
+  memcpy ((uint8_t *) re_compiled_code_p + prefilter_offset, prefilter.data, prefilter.size);
+
+  if (nfa_p != NULL)
+  {
+    memcpy ((uint8_t *) re_compiled_code_p + nfa_offset, nfa_p, nfa_size);
+    jmem_heap_free_block (context_p, nfa_p, nfa_size);
+  }
 
-  /* Bytecoded will be inserted into the cache and returned to the caller, so refcount is implicitly set to 2. */
-  re_compiled_code_p->header.refs = 2;
+  re_compiled_code_p->header.refs = 1;
   re_compiled_code_p->header.size = (uint16_t) (final_size >> JMEM_ALIGNMENT_LOG);
   re_compiled_code_p->header.status_flags = re_ctx.flags;
 
@@ -158,6 +805,10 @@ re_compile_bytecode (ecma_context_t *context_p, /**< JJS engine context */
   re_compiled_code_p->source = ecma_make_string_value (context_p, pattern_str_p);
   re_compiled_code_p->captures_count = re_ctx.captures_count;
   re_compiled_code_p->non_captures_count = re_ctx.non_captures_count;
+  re_compiled_code_p->nfa_offset = nfa_offset;
+  re_compiled_code_p->prefilter_offset = prefilter_offset;
+  re_compiled_code_p->prefilter_type = prefilter.type;
+  re_compiled_code_p->prefilter_size = prefilter.size;
 
 #if JJS_REGEXP_DUMP_BYTE_CODE
   if (context_p->context_flags & JJS_CONTEXT_FLAG_SHOW_REGEXP_OPCODES)
@@ -166,16 +817,12 @@ re_compile_bytecode (ecma_context_t *context_p, /**< JJS engine context */
   }
 #endif /* JJS_REGEXP_DUMP_BYTE_CODE */
 
-  uint8_t cache_idx = context_p->re_cache_idx;
-
-  if (context_p->re_cache[cache_idx] != NULL)
+  /* The cache holds a reference to the bytecode as well. */
+  if (re_cache_insert (context_p, re_compiled_code_p, hash))
   {
-    ecma_bytecode_deref (context_p, (ecma_compiled_code_t *) context_p->re_cache[cache_idx]);
+    re_compiled_code_p->header.refs = 2;
   }
 
-  context_p->re_cache[cache_idx] = re_compiled_code_p;
-  context_p->re_cache_idx = (uint8_t) (cache_idx + 1) % RE_CACHE_SIZE;
-
   return re_compiled_code_p;
 } /* re_compile_bytecode */
 
@@ -35,6 +35,7 @@
 re_compiled_code_t *re_compile_bytecode (ecma_context_t *context_p, ecma_string_t *pattern_str_p, uint16_t flags);
 
 void re_cache_gc (ecma_context_t *context_p);
+void re_cache_finalize (ecma_context_t *context_p);
 
 /**
  * @}
@@ -0,0 +1,745 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "re-nfa.h"
+
+#include "ecma-regexp-object.h"
+
+#include "jcontext.h"
+#include "jmem.h"
+#include "re-bytecode.h"
+#include "re-parser.h"
+
+#if JJS_BUILTIN_REGEXP
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_nfa Linear-time automaton
+ * @{
+ */
+
+/**
+ * Marker of the end of an unpatched jump list.
+ */
+#define RE_NFA_NO_INSTRUCTION UINT32_MAX
+
+/**
+ * Linear-time automaton compiler state
+ */
+typedef struct
+{
+  const uint8_t *bytecode_start_p; /**< start of the RegExp bytecode */
+  re_nfa_inst_t *inst_p; /**< instruction buffer */
+  uint32_t inst_count; /**< number of emitted instructions */
+  uint32_t choice_count; /**< number of compiled variable quantifiers and disjunctions */
+  uint8_t char_size; /**< size of encoded characters */
+  bool has_nested_choice; /**< a variable quantifier contains another quantifier or a disjunction */
+  bool is_dry_run; /**< only the end and the nullability of the bytecode is computed */
+} re_nfa_compiler_t;
+
+/**
+ * Quantified atom: a group or an iterator
+ */
+typedef struct
+{
+  const uint8_t *body_p; /**< body of the atom */
+  re_opcode_t opcode; /**< start opcode of the atom */
+  uint32_t capture_idx; /**< index of the capturing group */
+  uint32_t capture_start; /**< index of the first nested capturing group */
+  uint32_t capture_count; /**< number of nested capturing groups */
+} re_nfa_atom_t;
+
+static const uint8_t *re_nfa_compile_alternatives (re_nfa_compiler_t *compiler_p,
+                                                   const uint8_t *bc_p,
+                                                   bool *nullable_p);
+
+/**
+ * Append an instruction to the automaton.
+ *
+ * @return index of the instruction
+ *         RE_NFA_NO_INSTRUCTION - if the instruction limit is reached
+ */
+static uint32_t
+re_nfa_emit (re_nfa_compiler_t *compiler_p, /**< compiler state */
+             re_nfa_opcode_t opcode, /**< opcode */
+             uint32_t arg1, /**< first argument */
+             uint32_t arg2) /**< second argument */
+{
+  if (compiler_p->inst_count >= RE_NFA_MAX_INSTRUCTIONS)
+  {
+    return RE_NFA_NO_INSTRUCTION;
+  }
+
+  re_nfa_inst_t *inst_p = compiler_p->inst_p + compiler_p->inst_count;
+  inst_p->opcode = (uint32_t) opcode;
+  inst_p->arg1 = arg1;
+  inst_p->arg2 = arg2;
+
+  return compiler_p->inst_count++;
+} /* re_nfa_emit */
+
+/**
+ * Point every jump of a jump list to the next instruction.
+ *
+ * The jump list is linked through the arguments which are patched.
+ */
+static void
+re_nfa_patch_list (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                   uint32_t list, /**< index of the last jump instruction */
+                   bool is_second_arg) /**< the second argument is patched */
+{
+  while (list != RE_NFA_NO_INSTRUCTION)
+  {
+    re_nfa_inst_t *inst_p = compiler_p->inst_p + list;
+
+    if (is_second_arg)
+    {
+      list = inst_p->arg2;
+      inst_p->arg2 = compiler_p->inst_count;
+    }
+    else
+    {
+      list = inst_p->arg1;
+      inst_p->arg1 = compiler_p->inst_count;
+    }
+  }
+} /* re_nfa_patch_list */
+
+/**
+ * Skip a character matching opcode.
+ *
+ * @return pointer to the next opcode
+ */
+static const uint8_t *
+re_nfa_skip_char (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                  const uint8_t *bc_p) /**< pointer to the opcode */
+{
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_CLASS_ESCAPE:
+    case RE_OP_BYTE:
+    {
+      return bc_p + 1;
+    }
+    case RE_OP_CHAR:
+    {
+      return bc_p + compiler_p->char_size;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t flags = re_get_byte (&bc_p);
+      const uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      const uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+
+      return bc_p + (flags & RE_CLASS_ESCAPE_COUNT_MASK) + (char_count + range_count * 2) * compiler_p->char_size;
+    }
+    default:
+    {
+      JJS_ASSERT (bc_p[-1] == RE_OP_PERIOD || bc_p[-1] == RE_OP_UNICODE_PERIOD);
+      return bc_p;
+    }
+  }
+} /* re_nfa_skip_char */
+
+/**
+ * Emit an iteration of a quantified atom.
+ *
+ * Capturing group iterations store the boundaries of the group, and clear the results of the nested groups
+ * when the atom is quantified.
+ *
+ * @return pointer to the end of the atom body
+ *         NULL - if the atom cannot be matched by the automaton
+ */
+static const uint8_t *
+re_nfa_compile_iteration (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                          const re_nfa_atom_t *atom_p, /**< quantified atom */
+                          bool is_quantified, /**< the atom has a quantifier */
+                          bool *nullable_p) /**< [out] the body can match an empty string */
+{
+  if (is_quantified && atom_p->capture_count > 0
+      && re_nfa_emit (compiler_p, RE_NFA_OP_RESET, atom_p->capture_start, atom_p->capture_count)
+           == RE_NFA_NO_INSTRUCTION)
+  {
+    return NULL;
+  }
+
+  const bool is_capturing = (atom_p->opcode == RE_OP_CAPTURING_GROUP_START);
+
+  if (is_capturing && re_nfa_emit (compiler_p, RE_NFA_OP_SAVE, atom_p->capture_idx * 2, 0) == RE_NFA_NO_INSTRUCTION)
+  {
+    return NULL;
+  }
+
+  const uint8_t *end_p;
+
+  if (atom_p->opcode == RE_OP_GREEDY_ITERATOR || atom_p->opcode == RE_OP_LAZY_ITERATOR)
+  {
+    if (re_nfa_emit (compiler_p, RE_NFA_OP_CHAR, (uint32_t) (atom_p->body_p - compiler_p->bytecode_start_p), 0)
+        == RE_NFA_NO_INSTRUCTION)
+    {
+      return NULL;
+    }
+
+    end_p = re_nfa_skip_char (compiler_p, atom_p->body_p);
+    JJS_ASSERT (*end_p == RE_OP_ITERATOR_END);
+    *nullable_p = false;
+  }
+  else
+  {
+    end_p = re_nfa_compile_alternatives (compiler_p, atom_p->body_p, nullable_p);
+  }
+
+  if (end_p == NULL)
+  {
+    return NULL;
+  }
+
+  if (is_capturing && re_nfa_emit (compiler_p, RE_NFA_OP_SAVE, atom_p->capture_idx * 2 + 1, 0) == RE_NFA_NO_INSTRUCTION)
+  {
+    return NULL;
+  }
+
+  return end_p;
+} /* re_nfa_compile_iteration */
+
+/**
+ * Compile a group or an iterator.
+ *
+ * The mandatory iterations are unrolled, and the optional iterations are either unrolled as a chain of
+ * optional copies, or compiled as a loop if the number of iterations is unbounded.
+ *
+ * @return pointer to the bytecode after the atom
+ *         NULL - if the atom cannot be matched by the automaton
+ */
+static const uint8_t *
+re_nfa_compile_quantified (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                           const uint8_t *bc_p, /**< pointer to the start opcode */
+                           bool *nullable_p) /**< [out] the atom can match an empty string */
+{
+  re_nfa_atom_t atom;
+  atom.opcode = re_get_opcode (&bc_p);
+  atom.capture_idx = 0;
+  atom.capture_start = 0;
+  atom.capture_count = 0;
+  uint32_t qmin;
+  uint32_t qmax;
+  bool is_greedy;
+
+  if (atom.opcode == RE_OP_GREEDY_ITERATOR || atom.opcode == RE_OP_LAZY_ITERATOR)
+  {
+    qmin = re_get_value (&bc_p);
+    qmax = re_get_value (&bc_p) - RE_QMAX_OFFSET;
+    re_get_value (&bc_p);
+    is_greedy = (atom.opcode == RE_OP_GREEDY_ITERATOR);
+  }
+  else
+  {
+    atom.capture_idx = re_get_value (&bc_p);
+
+    if (atom.opcode == RE_OP_CAPTURING_GROUP_START)
+    {
+      atom.capture_start = atom.capture_idx + 1;
+      atom.capture_count = re_get_value (&bc_p) - 1;
+    }
+    else
+    {
+      JJS_ASSERT (atom.opcode == RE_OP_NON_CAPTURING_GROUP_START);
+      atom.capture_start = re_get_value (&bc_p);
+      atom.capture_count = re_get_value (&bc_p);
+    }
+
+    qmin = re_get_value (&bc_p);
+
+    if (qmin == 0)
+    {
+      re_get_value (&bc_p);
+    }
+
+    /* Quantifiers are stored by the end opcode of the group. */
+    qmax = 0;
+    is_greedy = true;
+  }
+
+  atom.body_p = bc_p;
+  const uint32_t start_inst_count = compiler_p->inst_count;
+  const uint32_t start_choice_count = compiler_p->choice_count;
+  const bool was_dry_run = compiler_p->is_dry_run;
+  bool body_nullable;
+
+  /* A dry run computes the end of the body and its nullability, without compiling nested atoms repeatedly. */
+  compiler_p->is_dry_run = true;
+  const uint8_t *end_p = re_nfa_compile_iteration (compiler_p, &atom, false, &body_nullable);
+  compiler_p->is_dry_run = was_dry_run;
+  compiler_p->inst_count = start_inst_count;
+
+  if (end_p == NULL)
+  {
+    return NULL;
+  }
+
+  if (atom.opcode == RE_OP_GREEDY_ITERATOR || atom.opcode == RE_OP_LAZY_ITERATOR)
+  {
+    end_p++;
+  }
+  else
+  {
+    const re_opcode_t end_opcode = re_get_opcode (&end_p);
+    JJS_ASSERT (end_opcode >= RE_OP_GREEDY_CAPTURING_GROUP_END && end_opcode <= RE_OP_LAZY_NON_CAPTURING_GROUP_END);
+    re_get_value (&end_p);
+    re_get_value (&end_p);
+    qmax = re_get_value (&end_p) - RE_QMAX_OFFSET;
+    is_greedy = (end_opcode == RE_OP_GREEDY_CAPTURING_GROUP_END || end_opcode == RE_OP_GREEDY_NON_CAPTURING_GROUP_END);
+  }
+
+  *nullable_p = (qmin == 0 || body_nullable);
+
+  /* Iterations beyond the minimum must not match an empty string. This check depends on the position where the
+   * iteration started, which cannot be represented by the automaton states. */
+  if (body_nullable && qmax > qmin)
+  {
+    return NULL;
+  }
+
+  if (qmax > qmin)
+  {
+    /* The backtracking matcher may try exponentially many ways to split the input between the iterations. */
+    if (compiler_p->choice_count != start_choice_count)
+    {
+      compiler_p->has_nested_choice = true;
+    }
+
+    compiler_p->choice_count++;
+  }
+
+  if (compiler_p->is_dry_run)
+  {
+    return end_p;
+  }
+
+  const bool is_quantified = (qmin != 1 || qmax != 1);
+  bool nullable;
+
+  for (uint32_t i = 1; i < qmin; i++)
+  {
+    if (re_nfa_compile_iteration (compiler_p, &atom, is_quantified, &nullable) == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  if (qmax == RE_INFINITY)
+  {
+    uint32_t loop_start;
+
+    if (qmin > 0)
+    {
+      /* The last mandatory iteration is followed by a backward split. */
+      loop_start = compiler_p->inst_count;
+
+      if (re_nfa_compile_iteration (compiler_p, &atom, is_quantified, &nullable) == NULL)
+      {
+        return NULL;
+      }
+
+      const uint32_t next = compiler_p->inst_count + 1;
+      const uint32_t split = is_greedy ? re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, loop_start, next)
+                                       : re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, next, loop_start);
+
+      return (split == RE_NFA_NO_INSTRUCTION) ? NULL : end_p;
+    }
+
+    loop_start = re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, 0, 0);
+
+    if (loop_start == RE_NFA_NO_INSTRUCTION
+        || re_nfa_compile_iteration (compiler_p, &atom, is_quantified, &nullable) == NULL
+        || re_nfa_emit (compiler_p, RE_NFA_OP_JUMP, loop_start, 0) == RE_NFA_NO_INSTRUCTION)
+    {
+      return NULL;
+    }
+
+    re_nfa_inst_t *split_p = compiler_p->inst_p + loop_start;
+    split_p->arg1 = is_greedy ? loop_start + 1 : compiler_p->inst_count;
+    split_p->arg2 = is_greedy ? compiler_p->inst_count : loop_start + 1;
+    return end_p;
+  }
+
+  if (qmin > 0
+      && re_nfa_compile_iteration (compiler_p, &atom, is_quantified, &nullable) == NULL)
+  {
+    return NULL;
+  }
+
+  /* Optional iterations are nested: skipping an iteration skips all of the following ones as well. */
+  uint32_t greedy_exits = RE_NFA_NO_INSTRUCTION;
+  uint32_t lazy_exits = RE_NFA_NO_INSTRUCTION;
+
+  for (uint32_t i = qmin; i < qmax; i++)
+  {
+    uint32_t split;
+
+    if (is_greedy)
+    {
+      split = re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, compiler_p->inst_count + 1, greedy_exits);
+      greedy_exits = split;
+    }
+    else
+    {
+      split = re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, lazy_exits, compiler_p->inst_count + 1);
+      lazy_exits = split;
+    }
+
+    if (split == RE_NFA_NO_INSTRUCTION
+        || re_nfa_compile_iteration (compiler_p, &atom, is_quantified, &nullable) == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  re_nfa_patch_list (compiler_p, greedy_exits, true);
+  re_nfa_patch_list (compiler_p, lazy_exits, false);
+  return end_p;
+} /* re_nfa_compile_quantified */
+
+/**
+ * Compile the atoms of an alternative.
+ *
+ * @return pointer to the opcode which terminates the alternative
+ *         NULL - if the alternative cannot be matched by the automaton
+ */
+static const uint8_t *
+re_nfa_compile_terms (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                      const uint8_t *bc_p, /**< pointer to the first atom */
+                      bool *nullable_p) /**< [out] the alternative can match an empty string */
+{
+  *nullable_p = true;
+
+  while (true)
+  {
+    switch (*bc_p)
+    {
+      case RE_OP_EOF:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        return bc_p;
+      }
+      case RE_OP_BACKREFERENCE:
+      case RE_OP_ASSERT_LOOKAHEAD_POS:
+      case RE_OP_ASSERT_LOOKAHEAD_NEG:
+      case RE_OP_ASSERT_END:
+      case RE_OP_ITERATOR_END:
+      {
+        return NULL;
+      }
+      case RE_OP_NO_ALTERNATIVE:
+      {
+        if (re_nfa_emit (compiler_p, RE_NFA_OP_FAIL, 0, 0) == RE_NFA_NO_INSTRUCTION)
+        {
+          return NULL;
+        }
+
+        bc_p++;
+        break;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        bool nullable;
+        bc_p = re_nfa_compile_quantified (compiler_p, bc_p, &nullable);
+
+        if (bc_p == NULL)
+        {
+          return NULL;
+        }
+
+        *nullable_p = *nullable_p && nullable;
+        break;
+      }
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        if (re_nfa_emit (compiler_p, RE_NFA_OP_ASSERT, *bc_p, 0) == RE_NFA_NO_INSTRUCTION)
+        {
+          return NULL;
+        }
+
+        bc_p++;
+        break;
+      }
+      default:
+      {
+        if (re_nfa_emit (compiler_p, RE_NFA_OP_CHAR, (uint32_t) (bc_p - compiler_p->bytecode_start_p), 0)
+            == RE_NFA_NO_INSTRUCTION)
+        {
+          return NULL;
+        }
+
+        bc_p = re_nfa_skip_char (compiler_p, bc_p);
+        *nullable_p = false;
+        break;
+      }
+    }
+  }
+} /* re_nfa_compile_terms */
+
+/**
+ * Compile a disjunction.
+ *
+ * @return pointer to the opcode which terminates the disjunction
+ *         NULL - if the disjunction cannot be matched by the automaton
+ */
+static const uint8_t *
+re_nfa_compile_alternatives (re_nfa_compiler_t *compiler_p, /**< compiler state */
+                             const uint8_t *bc_p, /**< pointer to the first opcode */
+                             bool *nullable_p) /**< [out] the disjunction can match an empty string */
+{
+  if (*bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_nfa_compile_terms (compiler_p, bc_p, nullable_p);
+  }
+
+  uint32_t exits = RE_NFA_NO_INSTRUCTION;
+  *nullable_p = false;
+  compiler_p->choice_count++;
+
+  while (true)
+  {
+    /* Skip the opcode and read the offset of the next alternative. */
+    bc_p++;
+    const uint32_t offset = re_get_value (&bc_p);
+    const bool is_last = (bc_p[offset] != RE_OP_ALTERNATIVE_NEXT);
+    uint32_t split = RE_NFA_NO_INSTRUCTION;
+
+    if (!is_last)
+    {
+      split = re_nfa_emit (compiler_p, RE_NFA_OP_SPLIT, compiler_p->inst_count + 1, 0);
+
+      if (split == RE_NFA_NO_INSTRUCTION)
+      {
+        return NULL;
+      }
+    }
+
+    bool nullable;
+    bc_p = re_nfa_compile_terms (compiler_p, bc_p, &nullable);
+
+    if (bc_p == NULL)
+    {
+      return NULL;
+    }
+
+    *nullable_p = *nullable_p || nullable;
+
+    if (is_last)
+    {
+      break;
+    }
+
+    JJS_ASSERT (*bc_p == RE_OP_ALTERNATIVE_NEXT);
+    exits = re_nfa_emit (compiler_p, RE_NFA_OP_JUMP, exits, 0);
+
+    if (exits == RE_NFA_NO_INSTRUCTION)
+    {
+      return NULL;
+    }
+
+    compiler_p->inst_p[split].arg2 = compiler_p->inst_count;
+  }
+
+  re_nfa_patch_list (compiler_p, exits, false);
+  return bc_p;
+} /* re_nfa_compile_alternatives */
+
+/**
+ * Compile the RegExp bytecode to a linear-time automaton.
+ *
+ * Patterns without backreferences and lookahead assertions, which have a quantified atom containing another
+ * quantifier or a disjunction, are matched by simulating the automaton. This needs time proportional to the
+ * input length times the instruction count, while the backtracking matcher may need exponential time.
+ *
+ * @return automaton program allocated on the heap
+ *         NULL - if the pattern must be matched by the backtracking matcher
+ */
+re_nfa_program_t *
+re_nfa_compile (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                size_t *size_p) /**< [out] size of the program */
+{
+  ecma_context_t *context_p = re_ctx_p->context_p;
+  const size_t buffer_size = sizeof (re_nfa_program_t) + RE_NFA_MAX_INSTRUCTIONS * sizeof (re_nfa_inst_t);
+  re_nfa_program_t *program_p = jmem_heap_alloc_block_null_on_error (context_p, buffer_size);
+
+  if (program_p == NULL)
+  {
+    return NULL;
+  }
+
+  re_nfa_compiler_t compiler;
+  compiler.bytecode_start_p = re_ctx_p->bytecode_start_p + sizeof (re_compiled_code_t);
+  compiler.inst_p = (re_nfa_inst_t *) (program_p + 1);
+  compiler.inst_count = 0;
+  compiler.choice_count = 0;
+  compiler.has_nested_choice = false;
+  compiler.char_size = (re_ctx_p->flags & RE_FLAG_UNICODE) ? sizeof (lit_code_point_t) : sizeof (ecma_char_t);
+  compiler.is_dry_run = false;
+
+  bool nullable;
+  const uint8_t *end_p = NULL;
+
+  if (re_nfa_emit (&compiler, RE_NFA_OP_SAVE, 0, 0) != RE_NFA_NO_INSTRUCTION)
+  {
+    end_p = re_nfa_compile_alternatives (&compiler, compiler.bytecode_start_p, &nullable);
+  }
+
+  /* Other patterns are matched faster by the backtracking matcher, without the risk of exponential runtime. */
+  if (end_p == NULL || !compiler.has_nested_choice
+      || re_nfa_emit (&compiler, RE_NFA_OP_SAVE, 1, 0) == RE_NFA_NO_INSTRUCTION
+      || re_nfa_emit (&compiler, RE_NFA_OP_MATCH, 0, 0) == RE_NFA_NO_INSTRUCTION)
+  {
+    jmem_heap_free_block (context_p, program_p, buffer_size);
+    return NULL;
+  }
+
+  JJS_ASSERT (*end_p == RE_OP_EOF);
+
+  /* A thread list holds at most one thread for each consuming instruction and the final instruction. Following
+   * the non-consuming instructions visits each instruction once per position, and the stack holds the pending
+   * alternatives and the overwritten capture slots. */
+  uint32_t thread_count = 1;
+  uint32_t stack_size = 1;
+
+  for (uint32_t i = 0; i < compiler.inst_count; i++)
+  {
+    switch (compiler.inst_p[i].opcode)
+    {
+      case RE_NFA_OP_CHAR:
+      {
+        thread_count++;
+        break;
+      }
+      case RE_NFA_OP_SPLIT:
+      case RE_NFA_OP_SAVE:
+      {
+        stack_size++;
+        break;
+      }
+      case RE_NFA_OP_RESET:
+      {
+        stack_size += compiler.inst_p[i].arg2;
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  if (thread_count * re_ctx_p->captures_count * 2 > RE_NFA_MAX_THREAD_SLOTS)
+  {
+    jmem_heap_free_block (context_p, program_p, buffer_size);
+    return NULL;
+  }
+
+  program_p->inst_count = compiler.inst_count;
+  program_p->thread_count = thread_count;
+  program_p->stack_size = stack_size;
+
+  *size_p = sizeof (re_nfa_program_t) + compiler.inst_count * sizeof (re_nfa_inst_t);
+  return jmem_heap_realloc_block (context_p, program_p, buffer_size, *size_p);
+} /* re_nfa_compile */
+
+#if JJS_REGEXP_DUMP_BYTE_CODE
+
+/**
+ * Dump the instructions of a linear-time automaton.
+ */
+void
+re_nfa_dump (ecma_context_t *context_p, /**< JJS context */
+             const re_nfa_program_t *program_p) /**< automaton program */
+{
+  const re_nfa_inst_t *inst_p = RE_NFA_GET_INSTRUCTIONS (program_p);
+
+  for (uint32_t i = 0; i < program_p->inst_count; i++, inst_p++)
+  {
+    JJS_DEBUG_MSG (context_p, "<%3u> ", i);
+
+    switch (inst_p->opcode)
+    {
+      case RE_NFA_OP_CHAR:
+      {
+        JJS_DEBUG_MSG (context_p, "CHAR [%3u]\n", inst_p->arg1);
+        break;
+      }
+      case RE_NFA_OP_SPLIT:
+      {
+        JJS_DEBUG_MSG (context_p, "SPLIT <%3u>, <%3u>\n", inst_p->arg1, inst_p->arg2);
+        break;
+      }
+      case RE_NFA_OP_JUMP:
+      {
+        JJS_DEBUG_MSG (context_p, "JUMP <%3u>\n", inst_p->arg1);
+        break;
+      }
+      case RE_NFA_OP_SAVE:
+      {
+        JJS_DEBUG_MSG (context_p, "SAVE slot: %u\n", inst_p->arg1);
+        break;
+      }
+      case RE_NFA_OP_RESET:
+      {
+        JJS_DEBUG_MSG (context_p, "RESET capture start: %u, capture count: %u\n", inst_p->arg1, inst_p->arg2);
+        break;
+      }
+      case RE_NFA_OP_ASSERT:
+      {
+        static const char *const assertion_names[] = { "LINE_START", "LINE_END", "WORD_BOUNDARY", "NOT_WORD_BOUNDARY" };
+        JJS_DEBUG_MSG (context_p, "ASSERT_%s\n", assertion_names[inst_p->arg1 - RE_OP_ASSERT_LINE_START]);
+        break;
+      }
+      case RE_NFA_OP_FAIL:
+      {
+        JJS_DEBUG_MSG (context_p, "FAIL\n");
+        break;
+      }
+      default:
+      {
+        JJS_ASSERT (inst_p->opcode == RE_NFA_OP_MATCH);
+        JJS_DEBUG_MSG (context_p, "MATCH\n");
+        break;
+      }
+    }
+  }
+} /* re_nfa_dump */
+
+#endif /* JJS_REGEXP_DUMP_BYTE_CODE */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* JJS_BUILTIN_REGEXP */
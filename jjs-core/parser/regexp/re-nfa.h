@@ -0,0 +1,104 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RE_NFA_H
+#define RE_NFA_H
+
+#include "ecma-globals.h"
+
+#include "re-compiler-context.h"
+
+#if JJS_BUILTIN_REGEXP
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup regexparser Regular expression
+ * @{
+ *
+ * \addtogroup regexparser_nfa Linear-time automaton
+ * @{
+ */
+
+/**
+ * Maximum number of instructions of a linear-time automaton.
+ */
+#define RE_NFA_MAX_INSTRUCTIONS 1024
+
+/**
+ * Maximum number of capture slots kept by the threads of a thread list.
+ */
+#define RE_NFA_MAX_THREAD_SLOTS 8192
+
+/**
+ * Linear-time automaton opcodes
+ */
+typedef enum
+{
+  RE_NFA_OP_CHAR, /**< match one character with the RegExp opcode at bytecode offset arg1 */
+  RE_NFA_OP_SPLIT, /**< continue at arg1, then at arg2 with lower priority */
+  RE_NFA_OP_JUMP, /**< continue at arg1 */
+  RE_NFA_OP_SAVE, /**< store the current position into capture slot arg1 */
+  RE_NFA_OP_RESET, /**< clear arg2 captures starting from capture arg1 */
+  RE_NFA_OP_ASSERT, /**< zero-width assertion, arg1 is the RegExp assertion opcode */
+  RE_NFA_OP_FAIL, /**< never matches */
+  RE_NFA_OP_MATCH, /**< successful match */
+} re_nfa_opcode_t;
+
+/**
+ * Linear-time automaton instruction
+ */
+typedef struct
+{
+  uint32_t opcode; /**< re_nfa_opcode_t */
+  uint32_t arg1; /**< first argument */
+  uint32_t arg2; /**< second argument */
+} re_nfa_inst_t;
+
+/**
+ * Linear-time automaton program, followed by its instructions.
+ */
+typedef struct
+{
+  uint32_t inst_count; /**< number of instructions */
+  uint32_t thread_count; /**< maximum number of threads in a thread list */
+  uint32_t stack_size; /**< maximum stack size used while following non-consuming instructions */
+} re_nfa_program_t;
+
+/**
+ * Get the linear-time automaton program of a compiled RegExp.
+ */
+#define RE_NFA_GET_PROGRAM(compiled_code_p) \
+  ((const re_nfa_program_t *) ((const uint8_t *) (compiled_code_p) + (compiled_code_p)->nfa_offset))
+
+/**
+ * Get the instructions of a linear-time automaton program.
+ */
+#define RE_NFA_GET_INSTRUCTIONS(program_p) ((const re_nfa_inst_t *) ((program_p) + 1))
+
+re_nfa_program_t *re_nfa_compile (re_compiler_ctx_t *re_ctx_p, size_t *size_p);
+
+#if JJS_REGEXP_DUMP_BYTE_CODE
+void re_nfa_dump (ecma_context_t *context_p, const re_nfa_program_t *program_p);
+#endif /* JJS_REGEXP_DUMP_BYTE_CODE */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* JJS_BUILTIN_REGEXP */
+#endif /* !RE_NFA_H */
@@ -150,6 +150,113 @@ typedef struct
   vm_frame_ctx_t frame_ctx; /**< frame context part */
 } vm_executable_object_t;
 
+#if JJS_VM_INLINE_CACHE
+
+/**
+ * Number of inline cache entries (must be a power of 2).
+ */
+#define VM_INLINE_CACHE_SIZE 256
+
+/**
+ * Inline cache entry of property access sites.
+ *
+ * Objects created by the same code define their properties in the same
+ * order, so the property is found at the same position of their property
+ * lists. The entry records this position.
+ */
+typedef struct
+{
+  uint8_t pair_index; /**< index of the property pair in the property list */
+  uint8_t slot; /**< index of the property in the property pair */
+} vm_inline_cache_entry_t;
+
+#endif /* JJS_VM_INLINE_CACHE */
+
+#if JJS_CPU_PROFILER
+
+/**
+ * Default sampling interval of the cpu profiler in microseconds.
+ */
+#define VM_PROFILER_DEFAULT_INTERVAL 1000
+
+/**
+ * Maximum number of frames recorded by a cpu profiler sample.
+ *
+ * When the stack is deeper, the outermost frames are not recorded.
+ */
+#define VM_PROFILER_MAX_DEPTH 64
+
+/**
+ * Marks the end of the cpu profiler node and position lists.
+ */
+#define VM_PROFILER_NONE UINT32_MAX
+
+/**
+ * Node of the call tree built by the cpu profiler.
+ *
+ * The first node is the root of the tree. Every other node is a function
+ * called from the function of its parent node.
+ */
+typedef struct
+{
+  const ecma_compiled_code_t *bytecode_p; /**< byte code of the function (NULL if the
+                                           *   byte code was freed during profiling) */
+  ecma_value_t function_name; /**< name of the function */
+  ecma_value_t source_name; /**< source name of the function */
+  uint32_t line; /**< line of the first instruction of the function (0 if unknown) */
+  uint32_t column; /**< column of the first instruction of the function (0 if unknown) */
+  uint32_t hit_count; /**< number of samples taken while the function was on the top of the stack */
+  uint32_t first_child; /**< index of the first child node */
+  uint32_t next_sibling; /**< index of the next node with the same parent */
+  uint32_t first_position; /**< index of the first line hit record of the node */
+} vm_profiler_node_t;
+
+/**
+ * Number of samples taken at a source line of a cpu profiler node.
+ */
+typedef struct
+{
+  uint32_t line; /**< source line */
+  uint32_t hit_count; /**< number of samples taken at this line */
+  uint32_t next; /**< index of the next line hit record of the same node */
+} vm_profiler_position_t;
+
+/**
+ * Sample recorded by the cpu profiler.
+ */
+typedef struct
+{
+  uint32_t node; /**< index of the node which was on the top of the stack */
+  uint32_t time_delta; /**< microseconds elapsed since the previous sample */
+} vm_profiler_sample_t;
+
+/**
+ * State of a running cpu profiler.
+ *
+ * The buffers are allocated from the context allocator, so a long profile
+ * does not consume the vm heap.
+ */
+typedef struct
+{
+  vm_profiler_node_t *nodes_p; /**< nodes of the call tree */
+  vm_profiler_position_t *positions_p; /**< line hit records */
+  vm_profiler_sample_t *samples_p; /**< recorded samples */
+  uint32_t node_count; /**< number of used nodes */
+  uint32_t node_capacity; /**< number of allocated nodes */
+  uint32_t position_count; /**< number of used line hit records */
+  uint32_t position_capacity; /**< number of allocated line hit records */
+  uint32_t sample_count; /**< number of recorded samples */
+  uint32_t sample_capacity; /**< number of allocated samples */
+  uint32_t interval; /**< sampling interval in microseconds */
+  uint32_t check_period; /**< average number of vm checkpoints between two clock reads */
+  uint32_t random_state; /**< state of the generator which randomizes the clock reads */
+  double start_time; /**< time when profiling started in microseconds */
+  double last_sample_time; /**< time of the last sample in microseconds */
+  double next_sample_time; /**< earliest time of the next sample in microseconds */
+} vm_profiler_t;
+
+#endif /* JJS_CPU_PROFILER */
+
 /**
  * Real backtrace frame data passed to the jjs_backtrace_cb_t handler.
  */
@@ -0,0 +1,708 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "ecma-helpers.h"
+#include "ecma-line-info.h"
+
+#include "jcontext.h"
+#include "jjs-platform.h"
+#include "lit-char-helpers.h"
+#include "vm.h"
+
+#if JJS_CPU_PROFILER
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_profiler CPU profiler
+ * @{
+ *
+ * The profiler is driven by the vm checkpoints (function entries and
+ * backward branches) which decrement context_p->vm_profiler_countdown.
+ * When the countdown reaches zero, the clock is read and a sample is
+ * recorded if the sampling interval has elapsed. The number of checkpoints
+ * between two clock reads adapts to the speed of the executed code, so
+ * the clock is read only a few times per sampling interval. The number is
+ * randomized around its average, otherwise the reads of a loop with a
+ * fixed number of checkpoints per iteration would always happen at the
+ * same place, and some functions would never be sampled.
+ */
+
+/**
+ * Maximum number of vm checkpoints between two clock reads.
+ */
+#define VM_PROFILER_MAX_CHECK_PERIOD (1u << 20)
+
+/**
+ * Compute the number of vm checkpoints until the next clock read.
+ *
+ * @return a pseudo random number in the [check_period / 2, check_period * 3 / 2] range
+ */
+static uint32_t
+vm_profiler_next_countdown (vm_profiler_t *profiler_p) /**< profiler */
+{
+  /* Xorshift generator. */
+  uint32_t random = profiler_p->random_state;
+  random ^= random << 13;
+  random ^= random >> 17;
+  random ^= random << 5;
+  profiler_p->random_state = random;
+
+  uint32_t check_period = profiler_p->check_period;
+  return (check_period >> 1) + 1 + (random % (check_period + 1));
+} /* vm_profiler_next_countdown */
+
+/**
+ * Get the current time in microseconds.
+ *
+ * @return current time
+ */
+static double
+vm_profiler_now (jjs_context_t *context_p) /**< JJS context */
+{
+  double now_ms;
+
+  if (jjs_platform_time_now_ms_impl (context_p, &now_ms) != JJS_STATUS_OK)
+  {
+    return 0;
+  }
+
+  return now_ms * 1000.0;
+} /* vm_profiler_now */
+
+/**
+ * Grow a profiler buffer to twice of its size.
+ *
+ * @return true - if the buffer is grown,
+ *         false - otherwise (the buffer is unchanged)
+ */
+static bool
+vm_profiler_grow (jjs_context_t *context_p, /**< JJS context */
+                  void **buffer_p, /**< [in/out] buffer */
+                  uint32_t *capacity_p, /**< [in/out] number of items in the buffer */
+                  size_t item_size) /**< size of an item */
+{
+  uint32_t old_capacity = *capacity_p;
+  uint32_t new_capacity = (old_capacity == 0) ? 64 : old_capacity * 2;
+
+  if (new_capacity <= old_capacity || (size_t) new_capacity * item_size > UINT32_MAX)
+  {
+    return false;
+  }
+
+  void *new_buffer_p = jjs_allocator_alloc (&context_p->context_allocator, (jjs_size_t) (new_capacity * item_size));
+
+  if (new_buffer_p == NULL)
+  {
+    return false;
+  }
+
+  if (old_capacity > 0)
+  {
+    memcpy (new_buffer_p, *buffer_p, old_capacity * item_size);
+    jjs_allocator_free (&context_p->context_allocator, *buffer_p, (jjs_size_t) (old_capacity * item_size));
+  }
+
+  *buffer_p = new_buffer_p;
+  *capacity_p = new_capacity;
+  return true;
+} /* vm_profiler_grow */
+
+/**
+ * Get the name of the function executed by a frame.
+ *
+ * @return function name string value
+ */
+static ecma_value_t
+vm_profiler_get_function_name (jjs_context_t *context_p, /**< JJS context */
+                               const vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  const ecma_compiled_code_t *bytecode_p = frame_ctx_p->shared_p->bytecode_header_p;
+
+  if (CBC_FUNCTION_GET_TYPE (bytecode_p->status_flags) != CBC_FUNCTION_CONSTRUCTOR)
+  {
+    ecma_value_t name = *ecma_compiled_code_resolve_function_name (bytecode_p);
+
+    if (ecma_is_value_string (name))
+    {
+      return ecma_copy_value (context_p, name);
+    }
+  }
+  else if (frame_ctx_p->shared_p->function_object_p != NULL)
+  {
+    /* Class constructors have no name in their byte code. */
+    ecma_property_t *property_p = ecma_find_named_property (context_p,
+                                                            frame_ctx_p->shared_p->function_object_p,
+                                                            ecma_get_magic_string (LIT_MAGIC_STRING_NAME));
+
+    if (property_p != NULL && ECMA_PROPERTY_IS_RAW_DATA (*property_p)
+        && ecma_is_value_string (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
+    {
+      return ecma_copy_value (context_p, ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+    }
+  }
+
+  return ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+} /* vm_profiler_get_function_name */
+
+/**
+ * Find the child node of a node which belongs to the function executed by a frame.
+ * The child node is created if it does not exist.
+ *
+ * @return index of the child node - if found or created,
+ *         VM_PROFILER_NONE - if there is not enough memory
+ */
+static uint32_t
+vm_profiler_get_child (jjs_context_t *context_p, /**< JJS context */
+                       vm_profiler_t *profiler_p, /**< profiler */
+                       uint32_t parent, /**< index of the parent node */
+                       const vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  const ecma_compiled_code_t *bytecode_p = frame_ctx_p->shared_p->bytecode_header_p;
+  uint32_t index = profiler_p->nodes_p[parent].first_child;
+
+  while (index != VM_PROFILER_NONE)
+  {
+    if (profiler_p->nodes_p[index].bytecode_p == bytecode_p)
+    {
+      return index;
+    }
+
+    index = profiler_p->nodes_p[index].next_sibling;
+  }
+
+  if (profiler_p->node_count == profiler_p->node_capacity
+      && !vm_profiler_grow (context_p,
+                            (void **) &profiler_p->nodes_p,
+                            &profiler_p->node_capacity,
+                            sizeof (vm_profiler_node_t)))
+  {
+    return VM_PROFILER_NONE;
+  }
+
+  jjs_frame_location_t location = { ECMA_VALUE_EMPTY, 0, 0 };
+
+#if JJS_LINE_INFO
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_USING_LINE_INFO)
+  {
+    ecma_line_info_get (ecma_compiled_code_get_line_info (context_p, bytecode_p), 0, &location);
+  }
+#endif /* JJS_LINE_INFO */
+
+  /* Computing the name may allocate memory, so it is done before the node is initialized. */
+  ecma_value_t function_name = vm_profiler_get_function_name (context_p, frame_ctx_p);
+
+  index = profiler_p->node_count++;
+
+  vm_profiler_node_t *node_p = profiler_p->nodes_p + index;
+  node_p->bytecode_p = bytecode_p;
+  node_p->function_name = function_name;
+  node_p->source_name = ecma_copy_value (context_p, ecma_get_source_name (context_p, bytecode_p));
+  node_p->line = location.line;
+  node_p->column = location.column;
+  node_p->hit_count = 0;
+  node_p->first_child = VM_PROFILER_NONE;
+  node_p->next_sibling = profiler_p->nodes_p[parent].first_child;
+  node_p->first_position = VM_PROFILER_NONE;
+
+  profiler_p->nodes_p[parent].first_child = index;
+  return index;
+} /* vm_profiler_get_child */
+
+/**
+ * Count a sample at the current line of the top frame.
+ */
+static void
+vm_profiler_count_position (jjs_context_t *context_p, /**< JJS context */
+                            vm_profiler_t *profiler_p, /**< profiler */
+                            uint32_t node, /**< index of the node of the top frame */
+                            const vm_frame_ctx_t *frame_ctx_p) /**< top frame context */
+{
+#if JJS_LINE_INFO
+  const ecma_compiled_code_t *bytecode_p = frame_ctx_p->shared_p->bytecode_header_p;
+
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_USING_LINE_INFO))
+  {
+    return;
+  }
+
+  jjs_frame_location_t location;
+  ecma_line_info_get (ecma_compiled_code_get_line_info (context_p, bytecode_p),
+                      (uint32_t) (frame_ctx_p->byte_code_p - frame_ctx_p->byte_code_start_p),
+                      &location);
+
+  uint32_t index = profiler_p->nodes_p[node].first_position;
+
+  while (index != VM_PROFILER_NONE)
+  {
+    if (profiler_p->positions_p[index].line == location.line)
+    {
+      profiler_p->positions_p[index].hit_count++;
+      return;
+    }
+
+    index = profiler_p->positions_p[index].next;
+  }
+
+  if (profiler_p->position_count == profiler_p->position_capacity
+      && !vm_profiler_grow (context_p,
+                            (void **) &profiler_p->positions_p,
+                            &profiler_p->position_capacity,
+                            sizeof (vm_profiler_position_t)))
+  {
+    return;
+  }
+
+  index = profiler_p->position_count++;
+
+  vm_profiler_position_t *position_p = profiler_p->positions_p + index;
+  position_p->line = location.line;
+  position_p->hit_count = 1;
+  position_p->next = profiler_p->nodes_p[node].first_position;
+  profiler_p->nodes_p[node].first_position = index;
+#else /* !JJS_LINE_INFO */
+  JJS_UNUSED_ALL (context_p, profiler_p, node, frame_ctx_p);
+#endif /* JJS_LINE_INFO */
+} /* vm_profiler_count_position */
+
+/**
+ * Record the current call stack as a sample.
+ *
+ * Samples are dropped when there is not enough memory to record them.
+ */
+static void
+vm_profiler_record_sample (jjs_context_t *context_p, /**< JJS context */
+                           vm_profiler_t *profiler_p, /**< profiler */
+                           double now) /**< current time in microseconds */
+{
+  if (profiler_p->sample_count == profiler_p->sample_capacity
+      && !vm_profiler_grow (context_p,
+                            (void **) &profiler_p->samples_p,
+                            &profiler_p->sample_capacity,
+                            sizeof (vm_profiler_sample_t)))
+  {
+    return;
+  }
+
+  vm_frame_ctx_t *frames_p[VM_PROFILER_MAX_DEPTH];
+  uint32_t depth = 0;
+
+  for (vm_frame_ctx_t *frame_ctx_p = context_p->vm_top_context_p;
+       frame_ctx_p != NULL && depth < VM_PROFILER_MAX_DEPTH;
+       frame_ctx_p = frame_ctx_p->prev_context_p)
+  {
+    frames_p[depth++] = frame_ctx_p;
+  }
+
+  uint32_t node = 0;
+
+  for (uint32_t i = depth; i > 0; i--)
+  {
+    node = vm_profiler_get_child (context_p, profiler_p, node, frames_p[i - 1]);
+
+    if (node == VM_PROFILER_NONE)
+    {
+      return;
+    }
+  }
+
+  profiler_p->nodes_p[node].hit_count++;
+
+  if (depth > 0)
+  {
+    vm_profiler_count_position (context_p, profiler_p, node, frames_p[0]);
+  }
+
+  double time_delta = now - profiler_p->last_sample_time;
+
+  vm_profiler_sample_t *sample_p = profiler_p->samples_p + profiler_p->sample_count++;
+  sample_p->node = node;
+  sample_p->time_delta = (time_delta > 0 && time_delta < UINT32_MAX) ? (uint32_t) time_delta : 0;
+
+  profiler_p->last_sample_time = now;
+} /* vm_profiler_record_sample */
+
+/**
+ * Called by the vm when context_p->vm_profiler_countdown reaches zero.
+ *
+ * The byte_code_p member of the top frame must point to the current instruction.
+ */
+void
+vm_profiler_tick (jjs_context_t *context_p) /**< JJS context */
+{
+  vm_profiler_t *profiler_p = context_p->vm_profiler_p;
+
+  if (profiler_p == NULL)
+  {
+    context_p->vm_profiler_countdown = UINT32_MAX;
+    return;
+  }
+
+  double now = vm_profiler_now (context_p);
+
+  if (now < profiler_p->next_sample_time)
+  {
+    /* The clock is read too often. */
+    if (profiler_p->check_period < VM_PROFILER_MAX_CHECK_PERIOD)
+    {
+      profiler_p->check_period += (profiler_p->check_period >> 3) + 1;
+    }
+  }
+  else
+  {
+    if (now >= profiler_p->next_sample_time + profiler_p->interval && profiler_p->check_period > 1)
+    {
+      /* The sample is late by more than an interval. */
+      profiler_p->check_period >>= 1;
+    }
+
+    vm_profiler_record_sample (context_p, profiler_p, now);
+    profiler_p->next_sample_time = now + profiler_p->interval;
+  }
+
+  context_p->vm_profiler_countdown = vm_profiler_next_countdown (profiler_p);
+} /* vm_profiler_tick */
+
+/**
+ * Start the cpu profiler.
+ *
+ * @return true - if the profiler is started,
+ *         false - if there is not enough memory
+ */
+bool
+vm_profiler_start (jjs_context_t *context_p, /**< JJS context */
+                   uint32_t interval) /**< sampling interval in microseconds (0 selects the default) */
+{
+  JJS_ASSERT (context_p->vm_profiler_p == NULL);
+
+  vm_profiler_t *profiler_p = jjs_allocator_alloc (&context_p->context_allocator, sizeof (vm_profiler_t));
+
+  if (profiler_p == NULL)
+  {
+    return false;
+  }
+
+  memset (profiler_p, 0, sizeof (vm_profiler_t));
+
+  if (!vm_profiler_grow (context_p, (void **) &profiler_p->nodes_p, &profiler_p->node_capacity, sizeof (vm_profiler_node_t)))
+  {
+    jjs_allocator_free (&context_p->context_allocator, profiler_p, sizeof (vm_profiler_t));
+    return false;
+  }
+
+  /* Root node. */
+  vm_profiler_node_t *root_p = profiler_p->nodes_p;
+  root_p->bytecode_p = NULL;
+  root_p->function_name = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+  root_p->source_name = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+  root_p->line = 0;
+  root_p->column = 0;
+  root_p->hit_count = 0;
+  root_p->first_child = VM_PROFILER_NONE;
+  root_p->next_sibling = VM_PROFILER_NONE;
+  root_p->first_position = VM_PROFILER_NONE;
+  profiler_p->node_count = 1;
+
+  profiler_p->interval = (interval == 0) ? VM_PROFILER_DEFAULT_INTERVAL : interval;
+  profiler_p->check_period = 1;
+  profiler_p->random_state = 0x9e3779b9;
+  profiler_p->start_time = vm_profiler_now (context_p);
+  profiler_p->last_sample_time = profiler_p->start_time;
+  profiler_p->next_sample_time = profiler_p->start_time + profiler_p->interval;
+
+  context_p->vm_profiler_p = profiler_p;
+  context_p->vm_profiler_countdown = 1;
+  return true;
+} /* vm_profiler_start */
+
+/**
+ * Forget a byte code which is going to be freed, so a new byte code
+ * allocated at the same address is not mistaken for it.
+ */
+void
+vm_profiler_release_bytecode (jjs_context_t *context_p, /**< JJS context */
+                              const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  vm_profiler_t *profiler_p = context_p->vm_profiler_p;
+
+  JJS_ASSERT (profiler_p != NULL);
+
+  for (uint32_t i = 1; i < profiler_p->node_count; i++)
+  {
+    if (profiler_p->nodes_p[i].bytecode_p == bytecode_p)
+    {
+      profiler_p->nodes_p[i].bytecode_p = NULL;
+    }
+  }
+} /* vm_profiler_release_bytecode */
+
+/**
+ * Write a zero terminated ASCII string to a stream.
+ */
+static void
+vm_profiler_write (jjs_context_t *context_p, /**< JJS context */
+                   const jjs_wstream_t *wstream_p, /**< target stream */
+                   const char *str_p) /**< string */
+{
+  wstream_p->write (context_p, wstream_p, (const uint8_t *) str_p, (jjs_size_t) strlen (str_p));
+} /* vm_profiler_write */
+
+/**
+ * Write a number to a stream.
+ */
+static void
+vm_profiler_write_number (jjs_context_t *context_p, /**< JJS context */
+                          const jjs_wstream_t *wstream_p, /**< target stream */
+                          double value) /**< integer value */
+{
+  lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  lit_utf8_size_t size = ecma_number_to_utf8_string ((ecma_number_t) value, buffer, sizeof (buffer));
+
+  wstream_p->write (context_p, wstream_p, buffer, size);
+} /* vm_profiler_write_number */
+
+/**
+ * Write a string value to a stream as a JSON string literal.
+ *
+ * Non-ASCII characters are escaped, so the output is ASCII regardless of the stream encoding.
+ */
+static void
+vm_profiler_write_string (jjs_context_t *context_p, /**< JJS context */
+                          const jjs_wstream_t *wstream_p, /**< target stream */
+                          ecma_value_t value) /**< string value */
+{
+  static const char hex_digits[] = "0123456789abcdef";
+  ecma_string_t *string_p = ecma_get_string_from_value (context_p, value);
+
+  vm_profiler_write (context_p, wstream_p, "\"");
+
+  ECMA_STRING_TO_UTF8_STRING (context_p, string_p, string_buff, string_buff_size);
+
+  const lit_utf8_byte_t *current_p = string_buff;
+  const lit_utf8_byte_t *end_p = string_buff + string_buff_size;
+  const lit_utf8_byte_t *regular_start_p = current_p;
+
+  while (current_p < end_p)
+  {
+    const lit_utf8_byte_t *char_start_p = current_p;
+    ecma_char_t chr = lit_cesu8_read_next (&current_p);
+
+    if (chr >= LIT_CHAR_SP && chr < 0x7f && chr != LIT_CHAR_DOUBLE_QUOTE && chr != LIT_CHAR_BACKSLASH)
+    {
+      continue;
+    }
+
+    wstream_p->write (context_p, wstream_p, regular_start_p, (jjs_size_t) (char_start_p - regular_start_p));
+    regular_start_p = current_p;
+
+    uint8_t escape[6] = { LIT_CHAR_BACKSLASH, LIT_CHAR_LOWERCASE_U };
+
+    for (int i = 5; i >= 2; i--)
+    {
+      escape[i] = (uint8_t) hex_digits[chr & 0xf];
+      chr = (ecma_char_t) (chr >> 4);
+    }
+
+    wstream_p->write (context_p, wstream_p, escape, sizeof (escape));
+  }
+
+  wstream_p->write (context_p, wstream_p, regular_start_p, (jjs_size_t) (end_p - regular_start_p));
+
+  ECMA_FINALIZE_UTF8_STRING (context_p, string_buff, string_buff_size);
+
+  vm_profiler_write (context_p, wstream_p, "\"");
+} /* vm_profiler_write_string */
+
+/**
+ * Write the profile in the .cpuprofile format of Chrome DevTools.
+ */
+static void
+vm_profiler_write_profile (jjs_context_t *context_p, /**< JJS context */
+                           const jjs_wstream_t *wstream_p, /**< target stream */
+                           const vm_profiler_t *profiler_p, /**< profiler */
+                           double end_time) /**< end of profiling in microseconds */
+{
+  vm_profiler_write (context_p, wstream_p, "{\"nodes\":[");
+
+  for (uint32_t i = 0; i < profiler_p->node_count; i++)
+  {
+    const vm_profiler_node_t *node_p = profiler_p->nodes_p + i;
+
+    /* Nodes with the same source name share their script id. */
+    uint32_t script_id = 0;
+
+    if (i > 0)
+    {
+      ecma_string_t *source_name_p = ecma_get_string_from_value (context_p, node_p->source_name);
+
+      for (script_id = 1; script_id < i; script_id++)
+      {
+        ecma_string_t *other_p = ecma_get_string_from_value (context_p, profiler_p->nodes_p[script_id].source_name);
+
+        if (ecma_compare_ecma_strings (source_name_p, other_p))
+        {
+          break;
+        }
+      }
+    }
+
+    vm_profiler_write (context_p, wstream_p, (i == 0) ? "{\"id\":" : ",{\"id\":");
+    vm_profiler_write_number (context_p, wstream_p, i + 1);
+    vm_profiler_write (context_p, wstream_p, ",\"callFrame\":{\"functionName\":");
+
+    if (i == 0)
+    {
+      vm_profiler_write (context_p, wstream_p, "\"(root)\"");
+    }
+    else
+    {
+      vm_profiler_write_string (context_p, wstream_p, node_p->function_name);
+    }
+
+    vm_profiler_write (context_p, wstream_p, ",\"scriptId\":\"");
+    vm_profiler_write_number (context_p, wstream_p, script_id);
+    vm_profiler_write (context_p, wstream_p, "\",\"url\":");
+    vm_profiler_write_string (context_p, wstream_p, node_p->source_name);
+
+    /* Call frame positions are zero based. */
+    vm_profiler_write (context_p, wstream_p, ",\"lineNumber\":");
+    vm_profiler_write_number (context_p, wstream_p, (double) node_p->line - 1);
+    vm_profiler_write (context_p, wstream_p, ",\"columnNumber\":");
+    vm_profiler_write_number (context_p, wstream_p, (double) node_p->column - 1);
+
+    vm_profiler_write (context_p, wstream_p, "},\"hitCount\":");
+    vm_profiler_write_number (context_p, wstream_p, node_p->hit_count);
+    vm_profiler_write (context_p, wstream_p, ",\"children\":[");
+
+    for (uint32_t child = node_p->first_child; child != VM_PROFILER_NONE; child = profiler_p->nodes_p[child].next_sibling)
+    {
+      if (child != node_p->first_child)
+      {
+        vm_profiler_write (context_p, wstream_p, ",");
+      }
+
+      vm_profiler_write_number (context_p, wstream_p, child + 1);
+    }
+
+    vm_profiler_write (context_p, wstream_p, "]");
+
+    if (node_p->first_position != VM_PROFILER_NONE)
+    {
+      vm_profiler_write (context_p, wstream_p, ",\"positionTicks\":[");
+
+      for (uint32_t position = node_p->first_position; position != VM_PROFILER_NONE;
+           position = profiler_p->positions_p[position].next)
+      {
+        vm_profiler_write (context_p, wstream_p, (position == node_p->first_position) ? "{\"line\":" : ",{\"line\":");
+        vm_profiler_write_number (context_p, wstream_p, profiler_p->positions_p[position].line);
+        vm_profiler_write (context_p, wstream_p, ",\"ticks\":");
+        vm_profiler_write_number (context_p, wstream_p, profiler_p->positions_p[position].hit_count);
+        vm_profiler_write (context_p, wstream_p, "}");
+      }
+
+      vm_profiler_write (context_p, wstream_p, "]");
+    }
+
+    vm_profiler_write (context_p, wstream_p, "}");
+  }
+
+  vm_profiler_write (context_p, wstream_p, "],\"startTime\":");
+  vm_profiler_write_number (context_p, wstream_p, floor (profiler_p->start_time));
+  vm_profiler_write (context_p, wstream_p, ",\"endTime\":");
+  vm_profiler_write_number (context_p, wstream_p, floor (end_time));
+  vm_profiler_write (context_p, wstream_p, ",\"samples\":[");
+
+  for (uint32_t i = 0; i < profiler_p->sample_count; i++)
+  {
+    if (i > 0)
+    {
+      vm_profiler_write (context_p, wstream_p, ",");
+    }
+
+    vm_profiler_write_number (context_p, wstream_p, profiler_p->samples_p[i].node + 1);
+  }
+
+  vm_profiler_write (context_p, wstream_p, "],\"timeDeltas\":[");
+
+  for (uint32_t i = 0; i < profiler_p->sample_count; i++)
+  {
+    if (i > 0)
+    {
+      vm_profiler_write (context_p, wstream_p, ",");
+    }
+
+    vm_profiler_write_number (context_p, wstream_p, profiler_p->samples_p[i].time_delta);
+  }
+
+  vm_profiler_write (context_p, wstream_p, "]}");
+} /* vm_profiler_write_profile */
+
+/**
+ * Stop the cpu profiler and release its resources.
+ *
+ * The profile is written to the stream in the .cpuprofile format of
+ * Chrome DevTools, unless the stream is NULL.
+ */
+void
+vm_profiler_stop (jjs_context_t *context_p, /**< JJS context */
+                  const jjs_wstream_t *wstream_p) /**< target stream (can be NULL) */
+{
+  vm_profiler_t *profiler_p = context_p->vm_profiler_p;
+
+  JJS_ASSERT (profiler_p != NULL);
+
+  context_p->vm_profiler_p = NULL;
+  context_p->vm_profiler_countdown = UINT32_MAX;
+
+  if (wstream_p != NULL)
+  {
+    vm_profiler_write_profile (context_p, wstream_p, profiler_p, vm_profiler_now (context_p));
+  }
+
+  for (uint32_t i = 0; i < profiler_p->node_count; i++)
+  {
+    ecma_free_value (context_p, profiler_p->nodes_p[i].function_name);
+    ecma_free_value (context_p, profiler_p->nodes_p[i].source_name);
+  }
+
+  jjs_allocator_free (&context_p->context_allocator,
+                      profiler_p->nodes_p,
+                      (jjs_size_t) (profiler_p->node_capacity * sizeof (vm_profiler_node_t)));
+
+  if (profiler_p->position_capacity > 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        profiler_p->positions_p,
+                        (jjs_size_t) (profiler_p->position_capacity * sizeof (vm_profiler_position_t)));
+  }
+
+  if (profiler_p->sample_capacity > 0)
+  {
+    jjs_allocator_free (&context_p->context_allocator,
+                        profiler_p->samples_p,
+                        (jjs_size_t) (profiler_p->sample_capacity * sizeof (vm_profiler_sample_t)));
+  }
+
+  jjs_allocator_free (&context_p->context_allocator, profiler_p, sizeof (vm_profiler_t));
+} /* vm_profiler_stop */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JJS_CPU_PROFILER */
@@ -51,6 +51,169 @@
 JJS_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
                      sizeof_vm_frame_ctx_must_be_sizeof_ecma_value_t_aligned);
 
+#if JJS_VM_INLINE_CACHE
+
+/**
+ * Get the inline cache entry of a property access site.
+ *
+ * @return pointer to the entry
+ */
+static inline vm_inline_cache_entry_t *JJS_ATTR_ALWAYS_INLINE
+vm_inline_cache_get_entry (ecma_context_t *context_p, /**< JJS context */
+                           const uint8_t *site_p) /**< byte code of the access site */
+{
+  uintptr_t hash = (uintptr_t) site_p;
+
+  return context_p->vm_inline_cache + ((hash ^ (hash >> 8)) & (VM_INLINE_CACHE_SIZE - 1));
+} /* vm_inline_cache_get_entry */
+
+/**
+ * Get the named data property of an ordinary object from the position recorded by the access site.
+ *
+ * Note:
+ *   the name stored at the recorded position is compared to the property name,
+ *   so an outdated or shared entry results in a cache miss
+ *
+ * @return pointer to the property - if it is found at the recorded position
+ *         NULL - otherwise
+ */
+static inline ecma_property_t *JJS_ATTR_ALWAYS_INLINE
+vm_inline_cache_lookup (ecma_context_t *context_p, /**< JJS context */
+                        const uint8_t *site_p, /**< byte code of the access site */
+                        ecma_object_t *object_p, /**< ordinary object */
+                        ecma_string_t *property_name_p) /**< property name */
+{
+  JJS_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL);
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+
+  if (!ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p))
+  {
+    return NULL;
+  }
+
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_get_entry (context_p, site_p);
+
+  for (uint32_t i = entry_p->pair_index; i > 0; i--)
+  {
+    prop_iter_cp = prop_iter_p->next_property_cp;
+
+    if (prop_iter_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+  }
+
+  JJS_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+  ecma_property_t prop_name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t prop_name_cp;
+
+  if (ECMA_IS_DIRECT_STRING (property_name_p))
+  {
+    prop_name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (property_name_p);
+    prop_name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (property_name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (context_p, prop_name_cp, property_name_p);
+  }
+
+  ecma_property_t *property_p = prop_iter_p->types + entry_p->slot;
+
+  if (((ecma_property_pair_t *) prop_iter_p)->names_cp[entry_p->slot] == prop_name_cp
+      && ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == prop_name_type && (*property_p & ECMA_PROPERTY_FLAG_DATA))
+  {
+    return property_p;
+  }
+
+  return NULL;
+} /* vm_inline_cache_lookup */
+
+/**
+ * Record the position of an own property of an ordinary object for the access site.
+ */
+static void
+vm_inline_cache_update (ecma_context_t *context_p, /**< JJS context */
+                        const uint8_t *site_p, /**< byte code of the access site */
+                        ecma_object_t *object_p, /**< ordinary object */
+                        ecma_property_t *property_p) /**< own property of the object */
+{
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+  uint32_t pair_index = 0;
+
+  while (prop_iter_cp != JMEM_CP_NULL && pair_index <= UINT8_MAX)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_property_header_t, prop_iter_cp);
+
+    if (!ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p))
+    {
+      /* Objects with a property hashmap are not cached. */
+      return;
+    }
+
+    if (property_p >= prop_iter_p->types && property_p < prop_iter_p->types + ECMA_PROPERTY_PAIR_ITEM_COUNT)
+    {
+      vm_inline_cache_entry_t *entry_p = vm_inline_cache_get_entry (context_p, site_p);
+
+      entry_p->pair_index = (uint8_t) pair_index;
+      entry_p->slot = (uint8_t) (property_p - prop_iter_p->types);
+      return;
+    }
+
+    prop_iter_cp = prop_iter_p->next_property_cp;
+    pair_index++;
+  }
+} /* vm_inline_cache_update */
+
+/**
+ * Assign the value of a writable own data property of an ordinary object
+ * using the inline cache of the access site.
+ *
+ * @return true - if the value is assigned
+ *         false - otherwise
+ */
+static bool
+vm_inline_cache_put (ecma_context_t *context_p, /**< JJS context */
+                     const uint8_t *site_p, /**< byte code of the access site */
+                     ecma_object_t *object_p, /**< ordinary object */
+                     ecma_string_t *property_name_p, /**< property name */
+                     ecma_value_t value) /**< ecma value */
+{
+  ecma_property_t *property_p = vm_inline_cache_lookup (context_p, site_p, object_p, property_name_p);
+
+  if (property_p == NULL)
+  {
+    property_p = ecma_find_named_property (context_p, object_p, property_name_p);
+
+    if (property_p == NULL || !(*property_p & ECMA_PROPERTY_FLAG_DATA))
+    {
+      return false;
+    }
+
+    vm_inline_cache_update (context_p, site_p, object_p, property_p);
+  }
+
+  if (!ecma_is_property_writable (*property_p))
+  {
+    return false;
+  }
+
+  ecma_named_data_property_assign_value (context_p, object_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
+  return true;
+} /* vm_inline_cache_put */
+
+#endif /* JJS_VM_INLINE_CACHE */
+
 /**
  * Get the value of object[property].
  *
@@ -58,9 +221,14 @@ JJS_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
  */
 static ecma_value_t
 vm_op_get_value (ecma_context_t *context_p, /**< JJS context */
+                 const uint8_t *site_p, /**< byte code of the access site */
                  ecma_value_t object, /**< base object */
                  ecma_value_t property) /**< property name */
 {
+#if !JJS_VM_INLINE_CACHE
+  JJS_UNUSED (site_p);
+#endif /* !JJS_VM_INLINE_CACHE */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (context_p, object);
@@ -79,6 +247,13 @@ vm_op_get_value (ecma_context_t *context_p, /**< JJS context */
           if (JJS_LIKELY (ecma_op_array_is_fast_array (ext_object_p)
                             && (uint32_t) int_value < ext_object_p->u.array.length))
           {
+            if (ecma_fast_array_has_double_elements (object_p))
+            {
+              ecma_number_t *numbers_p =
+                ECMA_GET_NON_NULL_POINTER (context_p, ecma_number_t, object_p->u1.property_list_cp);
+              return ecma_make_number_value (context_p, numbers_p[int_value]);
+            }
+
             ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_value_t, object_p->u1.property_list_cp);
 
             if (JJS_LIKELY (!ecma_is_value_array_hole (values_p[int_value])))
@@ -103,6 +278,41 @@ vm_op_get_value (ecma_context_t *context_p, /**< JJS context */
 
     if (property_name_p != NULL)
     {
+#if JJS_VM_INLINE_CACHE
+      if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+      {
+        ecma_property_t *property_p = vm_inline_cache_lookup (context_p, site_p, object_p, property_name_p);
+
+        if (property_p == NULL)
+        {
+          property_p = ecma_find_named_property (context_p, object_p, property_name_p);
+
+          if (property_p == NULL)
+          {
+            /* Ordinary objects continue the lookup with their prototype. */
+            jmem_cpointer_t proto_cp = ecma_op_ordinary_object_get_prototype_of (context_p, object_p);
+
+            if (proto_cp == JMEM_CP_NULL)
+            {
+              return ECMA_VALUE_UNDEFINED;
+            }
+
+            ecma_object_t *proto_p = ECMA_GET_NON_NULL_POINTER (context_p, ecma_object_t, proto_cp);
+            return ecma_op_object_get_with_receiver (context_p, proto_p, property_name_p, object);
+          }
+
+          if (!(*property_p & ECMA_PROPERTY_FLAG_DATA))
+          {
+            return ecma_op_object_get (context_p, object_p, property_name_p);
+          }
+
+          vm_inline_cache_update (context_p, site_p, object_p, property_p);
+        }
+
+        return ecma_fast_copy_value (context_p, ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+      }
+#endif /* JJS_VM_INLINE_CACHE */
+
 #if JJS_LCACHE
       ecma_property_t *property_p = ecma_lcache_lookup (context_p, object_p, property_name_p);
 
@@ -153,11 +363,16 @@ vm_op_get_value (ecma_context_t *context_p, /**< JJS context */
  */
 static ecma_value_t
 vm_op_set_value (ecma_context_t *context_p, /**< JJS context */
+                 const uint8_t *site_p, /**< byte code of the access site */
                  ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+#if !JJS_VM_INLINE_CACHE
+  JJS_UNUSED (site_p);
+#endif /* !JJS_VM_INLINE_CACHE */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -221,13 +436,20 @@ vm_op_set_value (ecma_context_t *context_p, /**< JJS context */
       property_p = ecma_get_prop_name_from_value (context_p, property);
     }
 
-    if (!ecma_is_lexical_environment (object_p))
+    if (ecma_is_lexical_environment (object_p))
     {
-      result = ecma_op_object_put_with_receiver (context_p, object_p, property_p, value, base, is_strict);
+      result = ecma_op_set_mutable_binding (context_p, object_p, property_p, value, is_strict);
+    }
+#if JJS_VM_INLINE_CACHE
+    else if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+             && vm_inline_cache_put (context_p, site_p, object_p, property_p, value))
+    {
+      result = ECMA_VALUE_TRUE;
     }
+#endif /* JJS_VM_INLINE_CACHE */
     else
     {
-      result = ecma_op_set_mutable_binding (context_p, object_p, property_p, value, is_strict);
+      result = ecma_op_object_put_with_receiver (context_p, object_p, property_p, value, base, is_strict);
     }
   }
 
@@ -921,7 +1143,16 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       {                                                                                              \
         ecma_string_t *name_p = ecma_get_string_from_value ((ctx), literal_start_p[literal_index]);  \
                                                                                                      \
-        result = ecma_op_resolve_reference_value ((ctx), frame_ctx_p->lex_env_p, name_p);            \
+        if (slot_table_p != NULL)                                                                    \
+        {                                                                                            \
+          uint16_t slot_info = slot_table_p[(literal_index) - register_end];                         \
+          result =                                                                                   \
+            ecma_op_resolve_slot_reference_value ((ctx), frame_ctx_p->lex_env_p, slot_info, name_p); \
+        }                                                                                            \
+        else                                                                                         \
+        {                                                                                            \
+          result = ecma_op_resolve_reference_value ((ctx), frame_ctx_p->lex_env_p, name_p);          \
+        }                                                                                            \
                                                                                                      \
         if (ECMA_IS_VALUE_ERROR (result))                                                            \
         {                                                                                            \
@@ -979,6 +1210,48 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
  */
 #define VM_LAST_CONTEXT_END() (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth)
 
+#if JJS_VM_COMPUTED_GOTO
+
+/**
+ * Label of the vm_loop handler of an opcode group
+ */
+#define VM_LABEL(name) vm_label_##name
+
+/**
+ * Start the vm_loop handler of an opcode group
+ *
+ * Note:
+ *      the handler is reachable both as a switch case and as a computed goto target
+ */
+#define VM_CASE(name) \
+  case name:          \
+  VM_LABEL (name)
+
+/**
+ * Jump to the handler of the current opcode group
+ */
+#define VM_DISPATCH_GROUP() goto *vm_group_labels[VM_OC_GROUP_GET_INDEX (opcode_data)]
+
+#else /* !JJS_VM_COMPUTED_GOTO */
+
+/**
+ * Start the vm_loop handler of an opcode group
+ */
+#define VM_CASE(name) case name
+
+/**
+ * Leave the argument decoder switch and continue with the opcode group switch
+ */
+#define VM_DISPATCH_GROUP() break
+
+#endif /* JJS_VM_COMPUTED_GOTO */
+
+#if JJS_VM_COMPUTED_GOTO
+/* Labels as values are a GNU C extension, which is used only by vm_loop. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif /* JJS_VM_COMPUTED_GOTO */
+
 /**
  * Run generic byte code.
  *
@@ -998,6 +1271,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint16_t register_end;
   uint16_t ident_end;
   uint16_t const_literal_end;
+  const uint16_t *slot_table_p = NULL;
   int32_t branch_offset = 0;
   uint8_t branch_offset_length = 0;
   ecma_value_t left_value;
@@ -1005,6 +1279,197 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#if JJS_VM_COMPUTED_GOTO
+  /* Handlers of the opcode groups, indexed by VM_OC_GROUP_GET_INDEX. */
+  static const void *const vm_group_labels[] = {
+    &&VM_LABEL (VM_OC_POP),
+    &&VM_LABEL (VM_OC_POP_BLOCK),
+    &&VM_LABEL (VM_OC_PUSH),
+    &&VM_LABEL (VM_OC_PUSH_TWO),
+    &&VM_LABEL (VM_OC_PUSH_THREE),
+    &&VM_LABEL (VM_OC_PUSH_UNDEFINED),
+    &&VM_LABEL (VM_OC_PUSH_TRUE),
+    &&VM_LABEL (VM_OC_PUSH_FALSE),
+    &&VM_LABEL (VM_OC_PUSH_NULL),
+    &&VM_LABEL (VM_OC_PUSH_THIS),
+    &&VM_LABEL (VM_OC_PUSH_0),
+    &&VM_LABEL (VM_OC_PUSH_POS_BYTE),
+    &&VM_LABEL (VM_OC_PUSH_NEG_BYTE),
+    &&VM_LABEL (VM_OC_PUSH_LIT_0),
+    &&VM_LABEL (VM_OC_PUSH_LIT_POS_BYTE),
+    &&VM_LABEL (VM_OC_PUSH_LIT_NEG_BYTE),
+    &&VM_LABEL (VM_OC_PUSH_OBJECT),
+    &&VM_LABEL (VM_OC_PUSH_NAMED_FUNC_EXPR),
+    &&VM_LABEL (VM_OC_SET_PROPERTY),
+    &&VM_LABEL (VM_OC_SET_GETTER),
+    &&VM_LABEL (VM_OC_SET_SETTER),
+    &&VM_LABEL (VM_OC_PUSH_ARRAY),
+    &&VM_LABEL (VM_OC_PUSH_ELISON),
+    &&VM_LABEL (VM_OC_APPEND_ARRAY),
+    &&VM_LABEL (VM_OC_IDENT_REFERENCE),
+    &&VM_LABEL (VM_OC_PROP_REFERENCE),
+    &&VM_LABEL (VM_OC_PROP_GET),
+    &&VM_LABEL (VM_OC_PROP_PRE_INCR),
+    &&VM_LABEL (VM_OC_PROP_PRE_DECR),
+    &&VM_LABEL (VM_OC_PROP_POST_INCR),
+    &&VM_LABEL (VM_OC_PROP_POST_DECR),
+    &&VM_LABEL (VM_OC_PRE_INCR),
+    &&VM_LABEL (VM_OC_PRE_DECR),
+    &&VM_LABEL (VM_OC_POST_INCR),
+    &&VM_LABEL (VM_OC_POST_DECR),
+    &&VM_LABEL (VM_OC_PROP_DELETE),
+    &&VM_LABEL (VM_OC_DELETE),
+    &&VM_LABEL (VM_OC_MOV_IDENT),
+    &&VM_LABEL (VM_OC_ASSIGN),
+    &&VM_LABEL (VM_OC_ASSIGN_PROP),
+    &&VM_LABEL (VM_OC_ASSIGN_PROP_THIS),
+    &&VM_LABEL (VM_OC_RETURN),
+    &&VM_LABEL (VM_OC_RETURN_FUNCTION_END),
+    &&VM_LABEL (VM_OC_THROW),
+    &&VM_LABEL (VM_OC_THROW_REFERENCE_ERROR),
+    &&VM_LABEL (VM_OC_EVAL),
+    &&VM_LABEL (VM_OC_CALL),
+    &&VM_LABEL (VM_OC_NEW),
+    &&VM_LABEL (VM_OC_RESOLVE_BASE_FOR_CALL),
+    &&VM_LABEL (VM_OC_ERROR),
+    &&VM_LABEL (VM_OC_JUMP),
+    &&VM_LABEL (VM_OC_BRANCH_IF_NULLISH),
+    &&VM_LABEL (VM_OC_BRANCH_OPTIONAL_CHAIN),
+    &&VM_LABEL (VM_OC_POP_REFERENCE),
+    &&VM_LABEL (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    &&VM_LABEL (VM_OC_BRANCH_IF_TRUE),
+    &&VM_LABEL (VM_OC_BRANCH_IF_FALSE),
+    &&VM_LABEL (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    &&VM_LABEL (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+    &&VM_LABEL (VM_OC_PLUS),
+    &&VM_LABEL (VM_OC_MINUS),
+    &&VM_LABEL (VM_OC_NOT),
+    &&VM_LABEL (VM_OC_BIT_NOT),
+    &&VM_LABEL (VM_OC_VOID),
+    &&VM_LABEL (VM_OC_TYPEOF_IDENT),
+    &&VM_LABEL (VM_OC_TYPEOF),
+    &&VM_LABEL (VM_OC_ADD),
+    &&VM_LABEL (VM_OC_SUB),
+    &&VM_LABEL (VM_OC_MUL),
+    &&VM_LABEL (VM_OC_DIV),
+    &&VM_LABEL (VM_OC_MOD),
+    &&VM_LABEL (VM_OC_EXP),
+    &&VM_LABEL (VM_OC_EQUAL),
+    &&VM_LABEL (VM_OC_NOT_EQUAL),
+    &&VM_LABEL (VM_OC_STRICT_EQUAL),
+    &&VM_LABEL (VM_OC_STRICT_NOT_EQUAL),
+    &&VM_LABEL (VM_OC_LESS),
+    &&VM_LABEL (VM_OC_GREATER),
+    &&VM_LABEL (VM_OC_LESS_EQUAL),
+    &&VM_LABEL (VM_OC_GREATER_EQUAL),
+    &&VM_LABEL (VM_OC_IN),
+    &&VM_LABEL (VM_OC_INSTANCEOF),
+    &&VM_LABEL (VM_OC_BIT_OR),
+    &&VM_LABEL (VM_OC_BIT_XOR),
+    &&VM_LABEL (VM_OC_BIT_AND),
+    &&VM_LABEL (VM_OC_LEFT_SHIFT),
+    &&VM_LABEL (VM_OC_RIGHT_SHIFT),
+    &&VM_LABEL (VM_OC_UNS_RIGHT_SHIFT),
+    &&VM_LABEL (VM_OC_BLOCK_CREATE_CONTEXT),
+    &&VM_LABEL (VM_OC_WITH),
+    &&VM_LABEL (VM_OC_FOR_IN_INIT),
+    &&VM_LABEL (VM_OC_FOR_IN_GET_NEXT),
+    &&VM_LABEL (VM_OC_FOR_IN_HAS_NEXT),
+    &&VM_LABEL (VM_OC_TRY),
+    &&VM_LABEL (VM_OC_CATCH),
+    &&VM_LABEL (VM_OC_FINALLY),
+    &&VM_LABEL (VM_OC_CONTEXT_END),
+    &&VM_LABEL (VM_OC_JUMP_AND_EXIT_CONTEXT),
+    &&VM_LABEL (VM_OC_CREATE_BINDING),
+    &&VM_LABEL (VM_OC_CREATE_ARGUMENTS),
+    &&VM_LABEL (VM_OC_SET_BYTECODE_PTR),
+    &&VM_LABEL (VM_OC_VAR_EVAL),
+    &&VM_LABEL (VM_OC_EXT_VAR_EVAL),
+    &&VM_LABEL (VM_OC_INIT_ARG_OR_FUNC),
+#if JJS_DEBUGGER
+    &&VM_LABEL (VM_OC_BREAKPOINT_ENABLED),
+    &&VM_LABEL (VM_OC_BREAKPOINT_DISABLED),
+#endif /* JJS_DEBUGGER */
+    &&VM_LABEL (VM_OC_CLASS_CALL_STATIC_BLOCK),
+    &&VM_LABEL (VM_OC_DEFINE_FIELD),
+    &&VM_LABEL (VM_OC_PRIVATE_PROP_REFERENCE),
+    &&VM_LABEL (VM_OC_ASSIGN_PRIVATE),
+    &&VM_LABEL (VM_OC_PRIVATE_FIELD_ADD),
+    &&VM_LABEL (VM_OC_PRIVATE_PROP_GET),
+    &&VM_LABEL (VM_OC_PRIVATE_IN),
+    &&VM_LABEL (VM_OC_COLLECT_PRIVATE_PROPERTY),
+    &&VM_LABEL (VM_OC_CHECK_VAR),
+    &&VM_LABEL (VM_OC_CHECK_LET),
+    &&VM_LABEL (VM_OC_ASSIGN_LET_CONST),
+    &&VM_LABEL (VM_OC_INIT_BINDING),
+    &&VM_LABEL (VM_OC_THROW_CONST_ERROR),
+    &&VM_LABEL (VM_OC_COPY_TO_GLOBAL),
+    &&VM_LABEL (VM_OC_COPY_FROM_ARG),
+    &&VM_LABEL (VM_OC_CLONE_CONTEXT),
+    &&VM_LABEL (VM_OC_COPY_DATA_PROPERTIES),
+    &&VM_LABEL (VM_OC_SET_COMPUTED_PROPERTY),
+    &&VM_LABEL (VM_OC_FOR_OF_INIT),
+    &&VM_LABEL (VM_OC_FOR_OF_GET_NEXT),
+    &&VM_LABEL (VM_OC_FOR_OF_HAS_NEXT),
+    &&VM_LABEL (VM_OC_FOR_AWAIT_OF_INIT),
+    &&VM_LABEL (VM_OC_FOR_AWAIT_OF_HAS_NEXT),
+    &&VM_LABEL (VM_OC_LOCAL_EVAL),
+    &&VM_LABEL (VM_OC_SUPER_CALL),
+    &&VM_LABEL (VM_OC_PUSH_CLASS_ENVIRONMENT),
+    &&VM_LABEL (VM_OC_PUSH_IMPLICIT_CTOR),
+    &&VM_LABEL (VM_OC_INIT_CLASS),
+    &&VM_LABEL (VM_OC_FINALIZE_CLASS),
+    &&VM_LABEL (VM_OC_SET_FIELD_INIT),
+    &&VM_LABEL (VM_OC_NONE), /* VM_OC_SET_STATIC_FIELD_INIT has no handler */
+    &&VM_LABEL (VM_OC_RUN_FIELD_INIT),
+    &&VM_LABEL (VM_OC_RUN_STATIC_FIELD_INIT),
+    &&VM_LABEL (VM_OC_SET_NEXT_COMPUTED_FIELD),
+    &&VM_LABEL (VM_OC_PUSH_SUPER_CONSTRUCTOR),
+    &&VM_LABEL (VM_OC_RESOLVE_LEXICAL_THIS),
+    &&VM_LABEL (VM_OC_SUPER_REFERENCE),
+    &&VM_LABEL (VM_OC_SET_HOME_OBJECT),
+    &&VM_LABEL (VM_OC_OBJECT_LITERAL_HOME_ENV),
+    &&VM_LABEL (VM_OC_SET_FUNCTION_NAME),
+    &&VM_LABEL (VM_OC_PUSH_SPREAD_ELEMENT),
+    &&VM_LABEL (VM_OC_PUSH_REST_OBJECT),
+    &&VM_LABEL (VM_OC_ITERATOR_CONTEXT_CREATE),
+    &&VM_LABEL (VM_OC_ITERATOR_CONTEXT_END),
+    &&VM_LABEL (VM_OC_ITERATOR_STEP),
+    &&VM_LABEL (VM_OC_OBJ_INIT_CONTEXT_CREATE),
+    &&VM_LABEL (VM_OC_OBJ_INIT_CONTEXT_END),
+    &&VM_LABEL (VM_OC_OBJ_INIT_PUSH_REST),
+    &&VM_LABEL (VM_OC_INITIALIZER_PUSH_NAME),
+    &&VM_LABEL (VM_OC_DEFAULT_INITIALIZER),
+    &&VM_LABEL (VM_OC_REST_INITIALIZER),
+    &&VM_LABEL (VM_OC_INITIALIZER_PUSH_PROP),
+    &&VM_LABEL (VM_OC_SPREAD_ARGUMENTS),
+    &&VM_LABEL (VM_OC_CREATE_GENERATOR),
+    &&VM_LABEL (VM_OC_YIELD),
+    &&VM_LABEL (VM_OC_ASYNC_YIELD),
+    &&VM_LABEL (VM_OC_ASYNC_YIELD_ITERATOR),
+    &&VM_LABEL (VM_OC_AWAIT),
+    &&VM_LABEL (VM_OC_GENERATOR_AWAIT),
+    &&VM_LABEL (VM_OC_EXT_RETURN),
+    &&VM_LABEL (VM_OC_ASYNC_EXIT),
+    &&VM_LABEL (VM_OC_STRING_CONCAT),
+    &&VM_LABEL (VM_OC_GET_TEMPLATE_OBJECT),
+    &&VM_LABEL (VM_OC_PUSH_NEW_TARGET),
+    &&VM_LABEL (VM_OC_REQUIRE_OBJECT_COERCIBLE),
+    &&VM_LABEL (VM_OC_ASSIGN_SUPER),
+    &&VM_LABEL (VM_OC_SET__PROTO__),
+    &&VM_LABEL (VM_OC_PUSH_STATIC_FIELD_FUNC),
+    &&VM_LABEL (VM_OC_ADD_COMPUTED_FIELD),
+#if JJS_MODULE_SYSTEM
+    &&VM_LABEL (VM_OC_MODULE_IMPORT),
+    &&VM_LABEL (VM_OC_MODULE_IMPORT_META),
+#endif /* JJS_MODULE_SYSTEM */
+    &&VM_LABEL (VM_OC_NONE)
+  };
+
+  JJS_STATIC_ASSERT (sizeof (vm_group_labels) / sizeof (vm_group_labels[0]) == VM_OC_NONE + 1,
+                     vm_group_labels_must_cover_all_opcode_groups);
+#endif /* JJS_VM_COMPUTED_GOTO */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -1032,6 +1497,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     const_literal_end = args_p->const_literal_end;
   }
 
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_HAS_SLOT_TABLE)
+  {
+    /* The first item is the slot count of the lexical environment, which is followed by the slot infos. */
+    slot_table_p = ecma_compiled_code_resolve_slot_table (bytecode_header_p) + 1;
+  }
+
   stack_top_p = frame_ctx_p->stack_top_p;
 
   /* Outer loop for exception handling. */
@@ -1055,138 +1526,152 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       left_value = ECMA_VALUE_UNDEFINED;
       right_value = ECMA_VALUE_UNDEFINED;
 
-      uint32_t operands = VM_OC_GET_ARGS_INDEX (opcode_data);
-
-      if (operands >= VM_OC_GET_LITERAL)
+      switch (VM_OC_GET_ARGS_INDEX (opcode_data))
       {
-        uint16_t literal_index;
-        READ_LITERAL_INDEX (literal_index);
-        READ_LITERAL (context_p, literal_index, left_value);
-
-        if (operands != VM_OC_GET_LITERAL)
+        case VM_OC_GET_NONE:
         {
-          switch (operands)
-          {
-            case VM_OC_GET_LITERAL_LITERAL:
-            {
-              uint16_t second_literal_index;
-              READ_LITERAL_INDEX (second_literal_index);
-              READ_LITERAL (context_p, second_literal_index, right_value);
-              break;
-            }
-            case VM_OC_GET_STACK_LITERAL:
-            {
-              JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-              right_value = left_value;
-              left_value = *(--stack_top_p);
-              break;
-            }
-            default:
-            {
-              JJS_ASSERT (operands == VM_OC_GET_THIS_LITERAL);
-
-              right_value = left_value;
-              left_value = ecma_copy_value (context_p, frame_ctx_p->this_binding);
-              break;
-            }
-          }
+          VM_DISPATCH_GROUP ();
         }
-      }
-      else if (operands >= VM_OC_GET_STACK)
-      {
-        JJS_ASSERT (operands == VM_OC_GET_STACK || operands == VM_OC_GET_STACK_STACK);
+        case VM_OC_GET_LITERAL:
+        {
+          uint16_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (context_p, literal_index, left_value);
+          VM_DISPATCH_GROUP ();
+        }
+        case VM_OC_GET_LITERAL_LITERAL:
+        {
+          uint16_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (context_p, literal_index, left_value);
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (context_p, literal_index, right_value);
+          VM_DISPATCH_GROUP ();
+        }
+        case VM_OC_GET_STACK_LITERAL:
+        {
+          uint16_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (context_p, literal_index, right_value);
 
-        JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-        left_value = *(--stack_top_p);
+          JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
+          left_value = *(--stack_top_p);
+          VM_DISPATCH_GROUP ();
+        }
+        case VM_OC_GET_THIS_LITERAL:
+        {
+          uint16_t literal_index;
+          READ_LITERAL_INDEX (literal_index);
+          READ_LITERAL (context_p, literal_index, right_value);
 
-        if (operands == VM_OC_GET_STACK_STACK)
+          left_value = ecma_copy_value (context_p, frame_ctx_p->this_binding);
+          VM_DISPATCH_GROUP ();
+        }
+        case VM_OC_GET_STACK:
         {
           JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
-          right_value = left_value;
           left_value = *(--stack_top_p);
+          VM_DISPATCH_GROUP ();
         }
-      }
-      else if (operands == VM_OC_GET_BRANCH)
-      {
-        branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
-        JJS_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
-
-        branch_offset = *(byte_code_p++);
-
-        if (JJS_UNLIKELY (branch_offset_length != 1))
+        case VM_OC_GET_STACK_STACK:
         {
-          branch_offset <<= 8;
-          branch_offset |= *(byte_code_p++);
+          JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end + 1);
+          right_value = *(--stack_top_p);
+          left_value = *(--stack_top_p);
+          VM_DISPATCH_GROUP ();
+        }
+        case VM_OC_GET_BRANCH:
+        {
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+          JJS_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+          branch_offset = *(byte_code_p++);
 
-          if (JJS_UNLIKELY (branch_offset_length == 3))
+          if (JJS_UNLIKELY (branch_offset_length != 1))
           {
             branch_offset <<= 8;
             branch_offset |= *(byte_code_p++);
-          }
-        }
-
-        if (opcode_data & VM_OC_BACKWARD_BRANCH)
-        {
-#if JJS_VM_HALT
-          if (context_p->vm_exec_stop_cb != NULL && --context_p->vm_exec_stop_counter == 0)
-          {
-            result = context_p->vm_exec_stop_cb (context_p, context_p->vm_exec_stop_user_p);
 
-            if (ecma_is_value_undefined (result))
+            if (JJS_UNLIKELY (branch_offset_length == 3))
             {
-              context_p->vm_exec_stop_counter = context_p->vm_exec_stop_frequency;
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
             }
-            else
+          }
+
+          if (opcode_data & VM_OC_BACKWARD_BRANCH)
+          {
+#if JJS_VM_HALT
+            if (context_p->vm_exec_stop_cb != NULL && --context_p->vm_exec_stop_counter == 0)
             {
-              context_p->vm_exec_stop_counter = 1;
+              result = context_p->vm_exec_stop_cb (context_p, context_p->vm_exec_stop_user_p);
 
-              if (ecma_is_value_exception (result))
+              if (ecma_is_value_undefined (result))
               {
-                ecma_throw_exception (context_p, result);
+                context_p->vm_exec_stop_counter = context_p->vm_exec_stop_frequency;
               }
               else
               {
-                jcontext_raise_exception (context_p, result);
+                context_p->vm_exec_stop_counter = 1;
+
+                if (ecma_is_value_exception (result))
+                {
+                  ecma_throw_exception (context_p, result);
+                }
+                else
+                {
+                  jcontext_raise_exception (context_p, result);
+                }
+
+                JJS_ASSERT (jcontext_has_pending_exception (context_p));
+                jcontext_set_abort_flag (context_p, true);
+                result = ECMA_VALUE_ERROR;
+                goto error;
               }
+            }
+#endif /* JJS_VM_HALT */
 
-              JJS_ASSERT (jcontext_has_pending_exception (context_p));
-              jcontext_set_abort_flag (context_p, true);
-              result = ECMA_VALUE_ERROR;
-              goto error;
+#if JJS_CPU_PROFILER
+            if (JJS_UNLIKELY (--context_p->vm_profiler_countdown == 0))
+            {
+              frame_ctx_p->byte_code_p = (uint8_t *) byte_code_start_p;
+              vm_profiler_tick (context_p);
             }
+#endif /* JJS_CPU_PROFILER */
+
+            branch_offset = -branch_offset;
           }
-#endif /* JJS_VM_HALT */
 
-          branch_offset = -branch_offset;
+          VM_DISPATCH_GROUP ();
         }
       }
 
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (context_p, *(--stack_top_p));
           continue;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (context_p, VM_GET_REGISTER (frame_ctx_p, 0));
           VM_GET_REGISTERS (frame_ctx_p)[0] = *(--stack_top_p);
           continue;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1200,56 +1685,56 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
           continue;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
           continue;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
           continue;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (context_p, frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
           continue;
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
           continue;
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1257,7 +1742,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1265,7 +1750,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p =
             ecma_create_object (context_p, ecma_builtin_get (context_p, ECMA_BUILTIN_ID_OBJECT_PROTOTYPE), 0, ECMA_OBJECT_TYPE_GENERAL);
@@ -1273,7 +1758,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (context_p, obj_p);
           continue;
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (context_p, left_value);
 
@@ -1295,7 +1780,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
           uint32_t literal_index;
 
@@ -1327,7 +1812,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1419,7 +1904,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1490,7 +1975,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_object (ecma_get_object_from_value (context_p, lit_value));
           continue;
         }
-        case VM_OC_CREATE_ARGUMENTS:
+        VM_CASE (VM_OC_CREATE_ARGUMENTS):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1521,14 +2006,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if JJS_SNAPSHOT_EXEC
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uintptr_t));
           frame_ctx_p->byte_code_start_p = byte_code_p;
           continue;
         }
 #endif /* JJS_SNAPSHOT_EXEC */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1578,7 +2063,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JJS_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1602,7 +2087,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JJS_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1648,7 +2133,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1673,7 +2158,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1708,12 +2193,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_if_object (context_p, value);
           continue;
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (context_p, ECMA_ERR_CONSTANT_BINDINGS_CANNOT_BE_REASSIGNED);
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1767,7 +2252,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1792,7 +2277,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           property_value_p->value = ecma_copy_value_if_not_object (context_p, arg_prop_value_p->value);
           continue;
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JJS_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1800,7 +2285,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (context_p, frame_ctx_p->lex_env_p, copy_values);
           continue;
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (context_p, stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1809,7 +2294,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_CLASS_CALL_STATIC_BLOCK:
+        VM_CASE (VM_OC_CLASS_CALL_STATIC_BLOCK):
         {
           result = ecma_op_function_call (context_p, ecma_get_object_from_value (context_p, left_value), frame_ctx_p->this_binding, NULL, 0);
 
@@ -1819,7 +2304,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_PUSH_STATIC_FIELD_FUNC:
+        VM_CASE (VM_OC_PUSH_STATIC_FIELD_FUNC):
         {
           JJS_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_FIELD_FUNC
@@ -1848,7 +2333,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = value;
           /* FALLTHRU */
         }
-        case VM_OC_ADD_COMPUTED_FIELD:
+        VM_CASE (VM_OC_ADD_COMPUTED_FIELD):
         {
           JJS_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_COMPUTED_FIELD_FUNC
@@ -1864,7 +2349,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_COPY_DATA_PROPERTIES:
+        VM_CASE (VM_OC_COPY_DATA_PROPERTIES):
         {
           left_value = *(--stack_top_p);
 
@@ -1882,7 +2367,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1890,7 +2375,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value ^= right_value;
           /* FALLTHRU */
         }
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JJS_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1921,8 +2406,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JJS_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1952,20 +2437,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           /* Note: this operation cannot throw an exception */
           *stack_top_p++ = ecma_make_object_value (context_p, ecma_op_new_array_object (context_p, 0));
           continue;
         }
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS (context_p);
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (context_p, parse_opts);
           continue;
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1993,7 +2478,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           uint16_t literal_index;
 
@@ -2001,12 +2486,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, literal_start_p[literal_index]);
           continue;
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (context_p, opcode, frame_ctx_p->shared_p->bytecode_header_p);
           continue;
         }
-        case VM_OC_DEFINE_FIELD:
+        VM_CASE (VM_OC_DEFINE_FIELD):
         {
           result = opfunc_define_field (context_p, frame_ctx_p->this_binding, right_value, left_value);
 
@@ -2017,7 +2502,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_ASSIGN_PRIVATE:
+        VM_CASE (VM_OC_ASSIGN_PRIVATE):
         {
           result = opfunc_private_set (context_p, stack_top_p[-3], stack_top_p[-2], stack_top_p[-1]);
 
@@ -2047,7 +2532,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_FIELD_ADD:
+        VM_CASE (VM_OC_PRIVATE_FIELD_ADD):
         {
           result = opfunc_private_field_add (context_p, frame_ctx_p->this_binding, right_value, left_value);
 
@@ -2058,7 +2543,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_GET:
+        VM_CASE (VM_OC_PRIVATE_PROP_GET):
         {
           result = opfunc_private_get (context_p, left_value, right_value);
 
@@ -2070,7 +2555,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_REFERENCE:
+        VM_CASE (VM_OC_PRIVATE_PROP_REFERENCE):
         {
           result = opfunc_private_get (context_p, stack_top_p[-1], left_value);
 
@@ -2083,7 +2568,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_PRIVATE_IN:
+        VM_CASE (VM_OC_PRIVATE_IN):
         {
           result = opfunc_private_in (context_p, left_value, right_value);
 
@@ -2095,12 +2580,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_COLLECT_PRIVATE_PROPERTY:
+        VM_CASE (VM_OC_COLLECT_PRIVATE_PROPERTY):
         {
           opfunc_collect_private_properties (context_p, stack_top_p[-2], left_value, right_value, opcode);
           continue;
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -2110,7 +2595,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           JJS_ASSERT (opcode == CBC_EXT_FINALIZE_NAMED_CLASS || opcode == CBC_EXT_FINALIZE_ANONYMOUS_CLASS);
 
@@ -2124,7 +2609,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
           continue;
         }
-        case VM_OC_SET_FIELD_INIT:
+        VM_CASE (VM_OC_SET_FIELD_INIT):
         {
           ecma_string_t *property_name_p = ecma_get_magic_string (LIT_INTERNAL_MAGIC_STRING_CLASS_FIELD_INIT);
           ecma_object_t *proto_object_p = ecma_get_object_from_value (context_p, stack_top_p[-1]);
@@ -2151,7 +2636,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_RUN_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_FIELD_INIT):
         {
           JJS_ASSERT (frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_NON_ARROW_FUNC);
           result = opfunc_init_class_fields (context_p, frame_ctx_p->shared_p->function_object_p, frame_ctx_p->this_binding);
@@ -2162,7 +2647,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_RUN_STATIC_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_STATIC_FIELD_INIT):
         {
           left_value = stack_top_p[-2];
           stack_top_p[-2] = stack_top_p[-1];
@@ -2176,7 +2661,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_SET_NEXT_COMPUTED_FIELD:
+        VM_CASE (VM_OC_SET_NEXT_COMPUTED_FIELD):
         {
           ecma_integer_value_t next_index = ecma_get_integer_from_value (stack_top_p[-2]) + 1;
           stack_top_p[-2] = ecma_make_integer_value (next_index);
@@ -2217,7 +2702,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (context_p, *(--stack_top_p));
           continue;
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (context_p, vm_get_class_function (frame_ctx_p));
 
@@ -2229,7 +2714,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (context_p, frame_ctx_p->lex_env_p);
 
@@ -2241,7 +2726,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_OBJECT_LITERAL_HOME_ENV:
+        VM_CASE (VM_OC_OBJECT_LITERAL_HOME_ENV):
         {
           if (opcode == CBC_EXT_PUSH_OBJECT_SUPER_ENVIRONMENT)
           {
@@ -2261,7 +2746,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_SET_HOME_OBJECT:
+        VM_CASE (VM_OC_SET_HOME_OBJECT):
         {
           int offset = opcode == CBC_EXT_OBJECT_LITERAL_SET_HOME_OBJECT_COMPUTED ? -1 : 0;
           opfunc_set_home_object (context_p,
@@ -2269,7 +2754,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                   ecma_get_object_from_value (context_p, stack_top_p[-3 + offset]));
           continue;
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -2280,7 +2765,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_FUNCTION_NAME:
+        VM_CASE (VM_OC_SET_FUNCTION_NAME):
         {
           char *prefix_p = NULL;
           lit_utf8_size_t prefix_size = 0;
@@ -2349,12 +2834,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (context_p, left_value);
           continue;
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
           continue;
         }
-        case VM_OC_PUSH_REST_OBJECT:
+        VM_CASE (VM_OC_PUSH_REST_OBJECT):
         {
           vm_frame_ctx_shared_t *shared_p = frame_ctx_p->shared_p;
 
@@ -2384,7 +2869,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_ITERATOR_CONTEXT_CREATE:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_CREATE):
         {
           result = ecma_op_get_iterator (context_p, stack_top_p[-1], ECMA_VALUE_SYNC_ITERATOR, &left_value);
 
@@ -2404,7 +2889,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
 
@@ -2441,7 +2926,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = value;
           continue;
         }
-        case VM_OC_ITERATOR_CONTEXT_END:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_END):
         {
           JJS_ASSERT (VM_LAST_CONTEXT_END () == stack_top_p);
 
@@ -2460,7 +2945,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, PARSER_ITERATOR_CONTEXT_STACK_ALLOCATION);
           continue;
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JJS_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
@@ -2473,7 +2958,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p--;
           continue;
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           ecma_object_t *array_p = ecma_op_new_array_object (context_p, 0);
           JJS_ASSERT (ecma_op_object_is_fast_array (array_p));
@@ -2518,7 +3003,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (context_p, array_p);
           continue;
         }
-        case VM_OC_OBJ_INIT_CONTEXT_CREATE:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_CREATE):
         {
           left_value = stack_top_p[-1];
           vm_stack_context_type_t context_type = VM_CONTEXT_OBJ_INIT;
@@ -2543,7 +3028,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_OBJ_INIT_CONTEXT_END:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_END):
         {
           JJS_ASSERT (stack_top_p == VM_LAST_CONTEXT_END ());
 
@@ -2557,7 +3042,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p = vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, context_stack_allocation);
           continue;
         }
-        case VM_OC_OBJ_INIT_PUSH_REST:
+        VM_CASE (VM_OC_OBJ_INIT_PUSH_REST):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           if (!ecma_op_require_object_coercible (context_p, last_context_end_p[-2]))
@@ -2584,7 +3069,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_INITIALIZER_PUSH_NAME:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_NAME):
         {
           if (JJS_UNLIKELY (!ecma_is_value_prop_name (left_value)))
           {
@@ -2608,7 +3093,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_array_set_property (context_p, array_obj_p, ext_array_obj_p->u.array.length, left_value);
           /* FALLTHRU */
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           ecma_value_t base = last_context_end_p[-2];
@@ -2624,7 +3109,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p--;
           }
 
-          result = vm_op_get_value (context_p, base, left_value);
+          result = vm_op_get_value (context_p, byte_code_start_p, base, left_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2634,7 +3119,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2655,7 +3140,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2666,14 +3151,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return ecma_make_object_value (context_p, (ecma_object_t *) executable_object_p);
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_ASYNC_YIELD:
+        VM_CASE (VM_OC_ASYNC_YIELD):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2684,7 +3169,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = --stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ASYNC_YIELD_ITERATOR:
+        VM_CASE (VM_OC_ASYNC_YIELD_ITERATOR):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2724,7 +3209,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           if (JJS_UNLIKELY (!(frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_EXECUTABLE)))
           {
@@ -2742,7 +3227,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_GENERATOR_AWAIT:
+        VM_CASE (VM_OC_GENERATOR_AWAIT):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2758,7 +3243,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2772,7 +3257,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_ASYNC_EXIT:
+        VM_CASE (VM_OC_ASYNC_EXIT):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2815,7 +3300,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->call_operation = VM_NO_EXEC_OP;
           return result;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (context_p, left_value);
 
@@ -2839,7 +3324,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (context_p, result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (context_p, bytecode_header_p);
@@ -2848,7 +3333,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_copy_value (context_p, collection_p->buffer_p[tagged_idx]);
           continue;
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object_p = context_p->current_new_target_p;
           if (new_target_object_p == NULL)
@@ -2862,7 +3347,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           if (!ecma_op_require_object_coercible (context_p, stack_top_p[-1]))
           {
@@ -2871,7 +3356,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2881,12 +3366,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
           continue;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2904,7 +3389,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2939,9 +3424,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (context_p, left_value, right_value);
+          result = vm_op_get_value (context_p, byte_code_start_p, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2951,7 +3436,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2975,12 +3460,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (context_p, left_value, right_value);
+          result = vm_op_get_value (context_p, byte_code_start_p, left_value, right_value);
 
           if (opcode < CBC_PRE_INCR)
           {
@@ -3003,10 +3488,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t result_number;
@@ -3126,13 +3611,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -3145,14 +3630,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
           continue;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (context_p, frame_ctx_p->this_binding);
@@ -3160,7 +3645,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN_FUNCTION_END:
+        VM_CASE (VM_OC_RETURN_FUNCTION_END):
         {
           if (CBC_FUNCTION_GET_TYPE (bytecode_header_p->status_flags) == CBC_FUNCTION_SCRIPT)
           {
@@ -3174,7 +3659,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JJS_ASSERT (opcode == CBC_RETURN || opcode == CBC_RETURN_WITH_LITERAL);
 
@@ -3182,7 +3667,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (context_p, left_value);
 
@@ -3190,12 +3675,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (context_p, ECMA_ERR_UNDEFINED_REFERENCE);
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           context_p->status_flags |= ECMA_STATUS_DIRECT_EVAL;
           JJS_ASSERT ((*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK)
@@ -3203,21 +3688,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                             && byte_code_p[1] <= CBC_EXT_SPREAD_CALL_PROP_BLOCK));
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JJS_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if JJS_DEBUGGER
@@ -3227,7 +3712,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -3245,7 +3730,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (context_p, left_value, right_value, is_strict);
 
@@ -3259,7 +3744,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -3283,12 +3768,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3302,10 +3787,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (context_p, value);
           continue;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -3331,7 +3816,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_free_value (context_p, value);
           continue;
         }
-        case VM_OC_BRANCH_OPTIONAL_CHAIN:
+        VM_CASE (VM_OC_BRANCH_OPTIONAL_CHAIN):
         {
           left_value = stack_top_p[-1];
 
@@ -3356,7 +3841,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_POP_REFERENCE:
+        VM_CASE (VM_OC_POP_REFERENCE):
         {
           ecma_free_value (context_p, stack_top_p[-2]);
           ecma_free_value (context_p, stack_top_p[-3]);
@@ -3364,7 +3849,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p -= 2;
           continue;
         }
-        case VM_OC_BRANCH_IF_NULLISH:
+        VM_CASE (VM_OC_BRANCH_IF_NULLISH):
         {
           left_value = stack_top_p[-1];
 
@@ -3376,8 +3861,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           --stack_top_p;
           continue;
         }
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (context_p, left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -3389,13 +3874,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (context_p, left_value));
           JJS_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3416,12 +3901,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -3455,7 +3940,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (context_p, left_value);
 
@@ -3467,7 +3952,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3506,7 +3991,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JJS_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
                                doubled_ecma_numbers_must_fit_into_int32_range);
@@ -3550,7 +4035,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JJS_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3605,10 +4090,46 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JJS_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* Exact quotients stay integers, zero results are excluded because of negative zero. */
+            if (right_integer != 0 && left_integer != 0 && left_integer % right_integer == 0)
+            {
+              *stack_top_p++ = ecma_make_int32_value (context_p, (int32_t) (left_integer / right_integer));
+              continue;
+            }
+
+            ecma_number_t quotient = (ecma_number_t) left_integer / (ecma_number_t) right_integer;
+            *stack_top_p++ = ecma_make_number_value (context_p, quotient);
+            continue;
+          }
+
+          if (ecma_is_value_float_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t new_value =
+              (ecma_get_float_from_value (context_p, left_value) / ecma_get_number_from_value (context_p, right_value));
+
+            *stack_top_p++ = ecma_update_float_number (context_p, left_value, new_value);
+            ecma_free_number (context_p, right_value);
+            continue;
+          }
+
+          if (ecma_is_value_float_number (right_value) && ecma_is_value_integer_number (left_value))
+          {
+            ecma_number_t new_value =
+              ((ecma_number_t) ecma_get_integer_from_value (left_value) / ecma_get_float_from_value (context_p, right_value));
+
+            *stack_top_p++ = ecma_update_float_number (context_p, right_value, new_value);
+            continue;
+          }
+
           result = do_number_arithmetic (context_p, NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
@@ -3619,7 +4140,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JJS_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3650,7 +4171,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (context_p, NUMBER_ARITHMETIC_EXPONENTIATION, left_value, right_value);
 
@@ -3662,7 +4183,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (context_p, left_value, right_value);
 
@@ -3674,7 +4195,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (context_p, left_value, right_value);
 
@@ -3686,7 +4207,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_invert_boolean_value (result);
           goto free_both_values;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (context_p, left_value, right_value);
 
@@ -3695,7 +4216,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (context_p, left_value, right_value);
 
@@ -3704,7 +4225,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3725,7 +4246,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3746,7 +4267,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3767,7 +4288,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3791,7 +4312,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3814,7 +4335,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JJS_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3837,7 +4358,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3866,6 +4387,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                   }
                 }
 
+#if JJS_CPU_PROFILER
+                if (JJS_UNLIKELY (--context_p->vm_profiler_countdown == 0))
+                {
+                  frame_ctx_p->byte_code_p = (uint8_t *) byte_code_start_p;
+                  vm_profiler_tick (context_p);
+                }
+#endif /* JJS_CPU_PROFILER */
+
                 /* Note: The opcode is a backward branch. */
                 byte_code_p = byte_code_start_p - branch_offset;
               }
@@ -3900,7 +4429,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3930,7 +4459,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3960,7 +4489,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3990,7 +4519,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (context_p, left_value, right_value);
 
@@ -4002,7 +4531,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (context_p, left_value, right_value);
 
@@ -4014,7 +4543,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
           ecma_value_t *stack_context_top_p;
           stack_context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
@@ -4056,7 +4585,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -4088,7 +4617,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           continue;
         }
-        case VM_OC_FOR_IN_INIT:
+        VM_CASE (VM_OC_FOR_IN_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4128,7 +4657,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -4144,7 +4673,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-3]++;
           continue;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -4192,7 +4721,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_INIT:
+        VM_CASE (VM_OC_FOR_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4253,7 +4782,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JJS_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF
@@ -4264,7 +4793,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-2] = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JJS_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -4303,7 +4832,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FOR_AWAIT_OF_INIT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4374,7 +4903,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           return result;
         }
-        case VM_OC_FOR_AWAIT_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_HAS_NEXT):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JJS_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_AWAIT_OF);
@@ -4405,7 +4934,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4418,7 +4947,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           continue;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -4427,7 +4956,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -4451,7 +4980,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           continue;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JJS_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -4536,7 +5065,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           continue;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JJS_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JJS_ASSERT (!jcontext_has_pending_exception (context_p));
@@ -4579,7 +5108,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if JJS_MODULE_SYSTEM
-        case VM_OC_MODULE_IMPORT:
+        VM_CASE (VM_OC_MODULE_IMPORT):
         {
           left_value = *(--stack_top_p);
 
@@ -4611,7 +5140,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_MODULE_IMPORT_META:
+        VM_CASE (VM_OC_MODULE_IMPORT_META):
         {
           ecma_value_t script_value = ((cbc_uint8_arguments_t *) bytecode_header_p)->script_value;
           cbc_script_t *script_p = ECMA_GET_INTERNAL_VALUE_POINTER (context_p, cbc_script_t, script_value);
@@ -4647,7 +5176,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* JJS_MODULE_SYSTEM */
 #if JJS_DEBUGGER
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (context_p->debugger_flags & JJS_DEBUGGER_VM_IGNORE)
           {
@@ -4668,7 +5197,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (context_p->debugger_flags & JJS_DEBUGGER_VM_IGNORE)
           {
@@ -4721,7 +5250,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* JJS_DEBUGGER */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JJS_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -4752,8 +5281,19 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           ecma_string_t *var_name_str_p = ecma_get_string_from_value (context_p, literal_start_p[literal_index]);
 
-          ecma_value_t put_value_result =
-            ecma_op_put_value_lex_env_base (context_p, frame_ctx_p->lex_env_p, var_name_str_p, is_strict, result);
+          ecma_value_t put_value_result;
+
+          if (slot_table_p != NULL)
+          {
+            uint16_t slot_info = slot_table_p[literal_index - register_end];
+            put_value_result =
+              ecma_op_put_slot_value (context_p, frame_ctx_p->lex_env_p, slot_info, var_name_str_p, is_strict, result);
+          }
+          else
+          {
+            put_value_result =
+              ecma_op_put_value_lex_env_base (context_p, frame_ctx_p->lex_env_p, var_name_str_p, is_strict, result);
+          }
 
           if (ECMA_IS_VALUE_ERROR (put_value_result))
           {
@@ -4787,7 +5327,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (context_p, base, property, result, is_strict);
+          ecma_value_t set_value_result = vm_op_set_value (context_p, byte_code_start_p, base, property, result, is_strict);
 
           if (ECMA_IS_VALUE_ERROR (set_value_result))
           {
@@ -4992,6 +5532,10 @@ finish:
   }
 } /* vm_loop */
 
+#if JJS_VM_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif /* JJS_VM_COMPUTED_GOTO */
+
 #if JJS_MODULE_SYSTEM
 
 /**
@@ -5372,6 +5916,14 @@ vm_run (vm_frame_ctx_shared_t *shared_p, /**< shared data */
   frame_ctx_p->this_binding = this_binding_value;
 
   vm_init_exec (context_p, frame_ctx_p);
+
+#if JJS_CPU_PROFILER
+  if (JJS_UNLIKELY (--context_p->vm_profiler_countdown == 0))
+  {
+    vm_profiler_tick (context_p);
+  }
+#endif /* JJS_CPU_PROFILER */
+
   return vm_execute (frame_ctx_p);
 } /* vm_run */
 
@@ -427,6 +427,13 @@ bool vm_is_direct_eval_form_call (jjs_context_t* context_p);
 
 ecma_value_t vm_get_backtrace (jjs_context_t* context_p, uint32_t max_depth);
 
+#if JJS_CPU_PROFILER
+bool vm_profiler_start (jjs_context_t *context_p, uint32_t interval);
+void vm_profiler_stop (jjs_context_t *context_p, const jjs_wstream_t *wstream_p);
+void vm_profiler_tick (jjs_context_t *context_p);
+void vm_profiler_release_bytecode (jjs_context_t *context_p, const ecma_compiled_code_t *bytecode_p);
+#endif /* JJS_CPU_PROFILER */
+
 /**
  * @}
  * @}
@@ -46,6 +46,7 @@ typedef struct
   jjs_context_options_t context_options;
   const char *cwd;
   const char *pmap_filename;
+  const char *code_cache_dir;
   const char *cwd_filename;
   int32_t log_level;
   bool has_log_level;
@@ -304,6 +305,18 @@ jjs_cli_engine_init (const jjs_cli_config_t *config, jjs_context_t **out)
     jjs_value_free (context, result);
   }
 
+  if (config->code_cache_dir)
+  {
+    jjs_value_t result = jjs_code_cache_sz (context, config->code_cache_dir);
+
+    if (jjs_value_is_exception (context, result))
+    {
+      jjs_cli_fmt_info (context, "Code cache disabled: {}\n", 1, result);
+    }
+
+    jjs_value_free (context, result);
+  }
+
   jjs_value_t global = jjs_current_realm (context);
   jjs_value_t jjs = jjs_object_get_sz (context, global, "jjs");
   jjs_value_t argv = jjs_array (context, (jjs_size_t) config->argc);
@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #define IMCL_IMPLEMENTATION
 #include <imcl.h>
@@ -39,6 +40,9 @@ typedef struct
   const jjs_char_t **strings;
   jjs_size_t *strings_sizes;
   jjs_size_t strings_count;
+  bool cpu_prof;
+  const char *cpu_prof_name;
+  uint32_t cpu_prof_interval;
 } jjs_app_t;
 
 typedef enum
@@ -53,6 +57,7 @@ print_help_common_flags (void)
 {
   printf ("      --cwd DIR                  Set the process' cwd\n");
   printf ("      --pmap FILE                Set the pmap json file for loading esm and commonjs packages\n");
+  printf ("      --code-cache DIR           Cache compiled esm and commonjs modules in DIR\n");
   printf ("      --log-level LEVEL          Set the JJS log level. Value: [0,3] Default: 0\n");
   printf ("      --mem-stats                Dump vm heap mem stats at exit\n");
   printf ("      --show-opcodes             Dump parser byte code\n");
@@ -101,6 +106,9 @@ print_command_help (const char *name)
     printf ("      --preload-strict FILE    Preload a js file in strict mode\n");
     printf ("      --preload-sloppy FILE    Preload a js file in sloppy mode\n");
     printf ("      --preload-snapshot FILE  Preload a snapshot file\n");
+    printf ("      --cpu-prof               Write a .cpuprofile of the run to the cwd at exit\n");
+    printf ("      --cpu-prof-name FILE     Set the .cpuprofile filename. Implies --cpu-prof\n");
+    printf ("      --cpu-prof-interval US   Set the sampling interval in microseconds. Default: 1000\n");
   }
   else if (strcmp (name, "repl") == 0)
   {
@@ -181,6 +189,10 @@ jjs_app_shift_common_option (imcl_args_t *args, jjs_cli_config_t *config)
   {
     config->pmap_filename = imcl_args_shift (args);
   }
+  else if (imcl_args_shift_if_option (args, NULL, "--code-cache"))
+  {
+    config->code_cache_dir = imcl_args_shift (args);
+  }
   else if (imcl_args_shift_if_option (args, NULL, "--mem-stats"))
   {
     config->context_options.enable_mem_stats = true;
@@ -224,6 +236,16 @@ jjs_app_shift_common_option (imcl_args_t *args, jjs_cli_config_t *config)
     /* TODO: validate */
     config->context_options.gc_mark_limit = jjs_optional_u32 (imcl_args_shift_uint (args));
   }
+  else if (imcl_args_shift_if_option (args, NULL, "--gc-sweep-limit"))
+  {
+    /* TODO: validate */
+    config->context_options.gc_sweep_limit = jjs_optional_u32 (imcl_args_shift_uint (args));
+  }
+  else if (imcl_args_shift_if_option (args, NULL, "--regexp-cache-size"))
+  {
+    /* TODO: validate */
+    config->context_options.regexp_cache_size = jjs_optional_u32 (imcl_args_shift_uint (args));
+  }
   else if (imcl_args_shift_if_option (args, NULL, "--gc-limit"))
   {
     /* TODO: validate */
@@ -383,29 +405,18 @@ jjs_cli_run_module (jjs_context_t *context, jjs_cli_module_t *module)
     }
     case JJS_CLI_LOADER_SNAPSHOT:
     {
-      jjs_value_t snapshot = jjs_platform_read_file (context, filename, JJS_KEEP, NULL);
-
-      if (!jjs_value_is_exception (context, snapshot))
-      {
-        uint8_t *snapshot_buffer = jjs_arraybuffer_data (context, snapshot);
-        jjs_size_t snapshot_buffer_size = jjs_arraybuffer_size (context, snapshot);
-        jjs_exec_snapshot_option_values_t options = {
-          .source_name = filename,
-          .user_value = filename,
-        };
+      jjs_exec_snapshot_option_values_t options = {
+        .source_name = filename,
+        .user_value = filename,
+      };
 
-        result = jjs_exec_snapshot (context,
-                                    (const uint32_t *) snapshot_buffer,
-                                    snapshot_buffer_size,
-                                    module->snapshot_index,
-                                    JJS_SNAPSHOT_EXEC_HAS_SOURCE_NAME | JJS_SNAPSHOT_EXEC_COPY_DATA,
-                                    &options);
-        jjs_value_free (context, snapshot);
-      }
-      else
-      {
-        result = snapshot;
-      }
+      /* the snapshot is mapped and executed in place, so processes running the same file share its pages */
+      result = jjs_exec_snapshot_file (context,
+                                       filename,
+                                       JJS_KEEP,
+                                       module->snapshot_index,
+                                       JJS_SNAPSHOT_EXEC_HAS_SOURCE_NAME,
+                                       &options);
 
       jjs_value_free (context, filename);
 
@@ -603,6 +614,70 @@ done:
   return JJS_CLI_EXIT_SUCCESS;
 }
 
+static void
+jjs_app_file_wstream_write (jjs_context_t* context, const jjs_wstream_t *stream, const uint8_t *data, jjs_size_t size)
+{
+  (void) context;
+  fwrite (data, 1, size, (FILE *) stream->state_p);
+}
+
+static bool
+jjs_app_cpu_prof_start (jjs_context_t *context, jjs_app_t *app)
+{
+  jjs_value_t result = jjs_cpu_profiler_start (context, app->cpu_prof_interval);
+
+  if (jjs_value_is_exception (context, result))
+  {
+    jjs_cli_fmt_error (context, "{}\n", 1, result);
+    jjs_value_free (context, result);
+    return false;
+  }
+
+  jjs_value_free (context, result);
+  return true;
+}
+
+static int
+jjs_app_cpu_prof_stop (jjs_context_t *context, jjs_app_t *app)
+{
+  char default_name[64];
+  const char *filename = app->cpu_prof_name;
+
+  if (filename == NULL)
+  {
+    time_t now = time (NULL);
+    strftime (default_name, sizeof (default_name), "CPU.%Y%m%d.%H%M%S.cpuprofile", localtime (&now));
+    filename = default_name;
+  }
+
+  FILE *file_p = fopen (filename, "wb");
+
+  if (file_p == NULL)
+  {
+    printf ("Could not open file: %s\n", filename);
+    jjs_value_free (context, jjs_cpu_profiler_stop (context, NULL));
+    return JJS_CLI_EXIT_FAILURE;
+  }
+
+  jjs_wstream_t wstream = {
+    .write = jjs_app_file_wstream_write,
+    .state_p = file_p,
+    .encoding = JJS_ENCODING_UTF8,
+  };
+
+  jjs_value_free (context, jjs_cpu_profiler_stop (context, &wstream));
+
+  bool has_error = ferror (file_p) != 0;
+
+  if (fclose (file_p) != 0 || has_error)
+  {
+    printf ("Error writing file '%s' to disk\n", filename);
+    return JJS_CLI_EXIT_FAILURE;
+  }
+
+  return JJS_CLI_EXIT_SUCCESS;
+}
+
 static int
 jjs_app_command_run (jjs_app_t *app)
 {
@@ -611,7 +686,19 @@ jjs_app_command_run (jjs_app_t *app)
 
   if (jjs_cli_engine_init (&app->config, &context))
   {
+    if (app->cpu_prof && !jjs_app_cpu_prof_start (context, app))
+    {
+      jjs_cli_engine_drop (context);
+      return JJS_CLI_EXIT_FAILURE;
+    }
+
     exit_code = jjs_cli_run_entry_point (context, &app->includes, &app->entry_point);
+
+    if (app->cpu_prof && jjs_app_cpu_prof_stop (context, app) != JJS_CLI_EXIT_SUCCESS)
+    {
+      exit_code = JJS_CLI_EXIT_FAILURE;
+    }
+
     jjs_cli_engine_drop (context);
   }
   else
@@ -1064,6 +1151,19 @@ main (int argc, char **argv)
                                     JJS_CLI_LOADER_ESM,
                                     0);
       }
+      else if (imcl_args_shift_if_option (&args, NULL, "--cpu-prof"))
+      {
+        app.cpu_prof = true;
+      }
+      else if (imcl_args_shift_if_option (&args, NULL, "--cpu-prof-name"))
+      {
+        app.cpu_prof = true;
+        app.cpu_prof_name = imcl_args_shift (&args);
+      }
+      else if (imcl_args_shift_if_option (&args, NULL, "--cpu-prof-interval"))
+      {
+        app.cpu_prof_interval = imcl_args_shift_uint (&args);
+      }
       else if (jjs_app_shift_if_preload (&args, &preload_loader, &preload_index))
       {
         jjs_cli_module_list_append (&app.includes,
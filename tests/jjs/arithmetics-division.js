@@ -0,0 +1,55 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function div(a, b) {
+  return a / b;
+}
+
+// integer operands
+assert(div(12, 4) === 3);
+assert(div(-12, 4) === -3);
+assert(div(7, 2) === 3.5);
+assert(div(1, 3) === 1 / 3);
+assert(div(-134217728, -1) === 134217728);
+assert(div(1, 0) === Infinity);
+assert(div(-1, 0) === -Infinity);
+assert(isNaN(div(0, 0)));
+assert(1 / div(0, 5) === Infinity);
+assert(1 / div(0, -5) === -Infinity);
+assert(1 / div(-0, 5) === -Infinity);
+
+// float operands
+assert(div(7.5, 2.5) === 3);
+assert(div(7.5, 2) === 3.75);
+assert(div(3, 1.5) === 2);
+assert(div(1, 0.5) === 2);
+assert(div(0.1, 0.2) === 0.5);
+assert(div(1.5, 0) === Infinity);
+assert(1 / div(-0.5, Infinity) === -Infinity);
+assert(isNaN(div(NaN, 2)));
+
+// values reused across iterations keep their own boxes
+var x = 0.5;
+var y = x;
+
+for (var i = 0; i < 100; i++) {
+  x = x / 1.5 + 1.25;
+}
+
+assert(y === 0.5);
+assert(Math.abs(x - 3.75) < 1e-9);
+
+// non-number operands
+assert(div("9", 3) === 3);
+assert(div(9, { valueOf: function () { return 4.5 } }) === 2);
@@ -0,0 +1,112 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Storing non-integer numbers switches a fast array to unboxed double elements
+var arr = [];
+for (var i = 0; i < 40; i++) {
+  arr[i] = i + 0.5;
+}
+
+assert(arr.length === 40);
+assert(arr[0] === 0.5);
+assert(arr[39] === 39.5);
+assert(arr.indexOf(10.5) === 10);
+assert(arr.indexOf(10) === -1);
+assert(arr.indexOf("10.5") === -1);
+assert(arr.lastIndexOf(39.5) === 39);
+assert(arr.includes(20.5));
+assert(!arr.includes(NaN));
+assert(Object.keys(arr).length === 40);
+assert(arr.hasOwnProperty(5));
+
+// Integers and negative zero keep their value
+arr[1] = 7;
+assert(arr[1] === 7);
+arr[2] = -0;
+assert(1 / arr[2] === -Infinity);
+assert(arr.indexOf(0) === 2);
+arr[3] = NaN;
+assert(isNaN(arr[3]));
+assert(arr.includes(NaN));
+assert(arr.indexOf(NaN) === -1);
+
+// push / pop / shift / reverse
+assert(arr.push(1.25, 2) === 42);
+assert(arr[40] === 1.25 && arr[41] === 2);
+assert(arr.pop() === 2);
+assert(arr.pop() === 1.25);
+assert(arr.length === 40);
+assert(arr.shift() === 0.5);
+assert(arr.length === 39 && arr[0] === 7);
+arr.reverse();
+assert(arr[0] === 39.5 && arr[38] === 7);
+
+// slice and sort read the unboxed elements
+var part = arr.slice(0, 3);
+assert(part.length === 3 && part[0] === 39.5 && part[2] === 37.5);
+var nums = [3.5, 1.5, 2.5, -1.5];
+nums.sort(function (a, b) { return a - b; });
+assert(nums.join() === "-1.5,1.5,2.5,3.5");
+nums.sort();
+assert(nums.join() === "-1.5,1.5,2.5,3.5");
+
+// without a comparator the elements are ordered by their strings, and the sort is stable
+var strs = [10.5, 9.5, -0, 0, NaN, Infinity, 1e21, 1e-7, 100.5, -Infinity];
+strs.sort();
+assert(strs.join() === "-Infinity,0,0,10.5,100.5,1e+21,1e-7,9.5,Infinity,NaN");
+assert(Object.is(strs[1], -0) && Object.is(strs[2], 0));
+
+// fill
+var filled = new Array(10).fill(0.25);
+assert(filled.length === 10 && filled[9] === 0.25);
+filled.fill(3, 2, 4);
+assert(filled[1] === 0.25 && filled[2] === 3 && filled[3] === 3 && filled[4] === 0.25);
+
+// Transitions back to generic elements
+var mixed = [1.5, 2.5, 3.5];
+mixed[1] = 2.75;
+mixed[1] = "str";
+assert(mixed[1] === "str" && mixed[2] === 3.5);
+mixed[1] = 4.5;
+assert(mixed[1] === 4.5);
+
+var holey = [0.5, 1.5];
+holey[1] = 1.75;
+holey[5] = 5.5;
+assert(holey.length === 6 && holey[5] === 5.5 && !(3 in holey));
+
+var deleted = [0.5, 1.5, 2.5];
+deleted[0] = 0.25;
+delete deleted[1];
+assert(!(1 in deleted) && deleted[2] === 2.5);
+
+var grown = [0.5];
+grown[0] = 0.75;
+grown.length = 4;
+assert(grown.length === 4 && grown[0] === 0.75 && !(3 in grown));
+grown.length = 1;
+assert(grown.length === 1);
+
+var frozen = [1.5, 2.5];
+frozen[0] = 1.25;
+Object.freeze(frozen);
+assert(Object.isFrozen(frozen) && frozen[0] === 1.25);
+
+var copied = [1.5, 2.5, 3.5, 4.5];
+copied[0] = 0.5;
+copied.copyWithin(0, 2);
+assert(copied.join() === "3.5,4.5,3.5,4.5");
+copied.unshift(0.125);
+assert(copied[0] === 0.125 && copied.length === 5);
@@ -49,3 +49,70 @@ var f = function expr(i) {
 }
 
 f(10);
+
+/* The name binding is created only when the body may reference it. */
+var expr = "Outer value";
+
+f = function expr() {
+  return 5;
+}
+
+assert(f() === 5);
+assert(f.name === "expr");
+assert(expr === "Outer value");
+
+f = function expr() {
+  return function() { return () => expr; };
+}
+
+assert(f()()() === f);
+
+f = function expr(a = expr) {
+  return a;
+}
+
+assert(f() === f);
+
+f = function expr() {
+  return class { static get() { return expr; } };
+}
+
+assert(f().get() === f);
+
+f = function \u0065xpr() {
+  return expr;
+}
+
+assert(f() === f);
+
+f = function expr() {
+  return \u0065xpr;
+}
+
+assert(f() === f);
+
+f = function expr() {
+  return function() { return eval("expr"); };
+}
+
+assert(f()() === f);
+
+f = function expr() {
+  with ({}) {
+    return expr;
+  }
+}
+
+assert(f() === f);
+
+f = function expr() {
+  "use strict";
+  expr = 6;
+}
+
+try {
+  f();
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+}
@@ -0,0 +1,162 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Variables captured from enclosing functions are resolved to binding slots by the parser.
+
+function nested() {
+  var a = 1, b = 2;
+  let c = 3;
+  const d = 4;
+
+  function mid() {
+    var e = 5;
+    return function () {
+      a++;
+      return a + b + c + d + e;
+    };
+  }
+
+  var f = mid();
+  assert(f() === 16);
+  assert(f() === 17);
+  assert(a === 3);
+
+  return function () {
+    d = 5;
+  };
+}
+
+try {
+  nested()();
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+}
+
+function shadowed() {
+  var x = 'outer';
+  var result = [];
+
+  {
+    let x = 'block';
+    result.push(function () { return x; });
+  }
+
+  try {
+    throw 'catch';
+  } catch (x) {
+    result.push(function () { return x; });
+  }
+
+  result.push(function () { return x; });
+
+  with ({ x: 'with' }) {
+    result.push(function () { return x; });
+  }
+
+  var C = class x {
+    m() { return x; }
+  };
+  result.push(function () { return new C().m() === C; });
+
+  return result.map(function (f) { return f(); }).join();
+}
+
+assert(shadowed() === 'block,catch,outer,with,true');
+
+function namedExpression() {
+  var g = 'outer';
+  var h = function g() {
+    return function () { return typeof g; };
+  };
+  return h()();
+}
+
+assert(namedExpression() === 'function');
+
+function directEval() {
+  var y = 'outer';
+
+  function inner() {
+    var get = function () { return y; };
+    eval("var y = 'eval'");
+    return get();
+  }
+
+  return inner();
+}
+
+assert(directEval() === 'eval');
+
+function temporalDeadZone() {
+  var get = function () { return z; };
+
+  try {
+    get();
+    assert(false);
+  } catch (e) {
+    assert(e instanceof ReferenceError);
+  }
+
+  let z = 1;
+  return get();
+}
+
+assert(temporalDeadZone() === 1);
+
+function blockFunction() {
+  var x = 'outer';
+
+  function inner() {
+    {
+      function x() {}
+    }
+    return function () { return x; };
+  }
+
+  return inner()();
+}
+
+assert(typeof blockFunction() === 'function');
+
+function generator() {
+  var n = 0;
+
+  function* gen() {
+    while (true) {
+      yield ++n;
+    }
+  }
+
+  var it = gen();
+  it.next();
+  it.next();
+  return n;
+}
+
+assert(generator() === 2);
+
+function argumentsCapture(p) {
+  return function () {
+    p = p + 1;
+    return p + arguments.length;
+  };
+}
+
+var increment = argumentsCapture(1);
+assert(increment() === 2);
+assert(increment(0) === 4);
+
+var created = new Function('a', 'var q = a; return function () { return q + 1; }');
+assert(created(1)() === 2);
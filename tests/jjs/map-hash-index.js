@@ -0,0 +1,116 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Large containers are searched through a hash index. */
+var count = 300;
+var m = new Map();
+var objects = [];
+
+for (var i = 0; i < count; i++) {
+  objects.push({});
+  m.set(i, "i" + i);
+  m.set("s" + i, i);
+  m.set(objects[i], i);
+  m.set(i + 0.5, -i);
+}
+
+assert(m.size === count * 4);
+
+for (var i = 0; i < count; i++) {
+  assert(m.get(i) === "i" + i);
+  assert(m.get("s" + i) === i);
+  assert(m.get(objects[i]) === i);
+  assert(m.get(i + 0.5) === -i);
+  assert(!m.has({}));
+}
+
+/* Special number keys */
+m.set(NaN, "nan");
+m.set(-0, "zero");
+m.set(1e100, "big");
+m.set(Symbol.iterator, "symbol");
+m.set(12345678901234567890n, "bigint");
+assert(m.get(NaN) === "nan");
+assert(m.get(0 / 0) === "nan");
+assert(m.get(0) === "zero");
+assert(m.get(1e100) === "big");
+assert(m.get(Symbol.iterator) === "symbol");
+assert(m.get(12345678901234567890n) === "bigint");
+assert(m.get(BigInt("12345678901234567890")) === "bigint");
+assert(!m.has(12345678901234567891n));
+
+/* Float values equal to integers */
+assert(m.get(Math.sqrt(4)) === "i2");
+assert(m.get(100 / 1) === "i100");
+
+/* Delete and re-insert keeps insertion order */
+for (var i = 0; i < count; i += 2) {
+  assert(m.delete(i));
+  assert(!m.has(i));
+  assert(!m.delete(i));
+}
+
+m.set(0, "again");
+var keys = Array.from(m.keys());
+assert(keys[0] === "s0");
+assert(keys[keys.length - 1] === 0);
+assert(m.get(0) === "again");
+
+/* Clear drops every key */
+m.clear();
+assert(m.size === 0);
+assert(!m.has(1));
+m.set(1, 1);
+assert(m.get(1) === 1);
+
+/* Set with many string keys */
+var s = new Set();
+for (var i = 0; i < count; i++) {
+  s.add("k" + i);
+  s.add("k" + i);
+}
+assert(s.size === count);
+
+for (var i = 0; i < count; i++) {
+  assert(s.has("k" + i));
+  assert(s.delete("k" + i));
+}
+assert(s.size === 0);
+
+/* Iterators observe entries appended during iteration */
+var s2 = new Set();
+for (var i = 0; i < 20; i++) {
+  s2.add(i);
+}
+var seen = 0;
+for (var v of s2) {
+  if (v < 40) {
+    s2.delete(v);
+    s2.add(v + 20);
+  }
+  seen++;
+}
+assert(seen === 60);
+
+/* WeakMap with many object keys */
+var wm = new WeakMap();
+for (var i = 0; i < count; i++) {
+  wm.set(objects[i], i);
+}
+for (var i = 0; i < count; i++) {
+  assert(wm.get(objects[i]) === i);
+}
+assert(wm.delete(objects[5]));
+assert(!wm.has(objects[5]));
@@ -0,0 +1,51 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Functions with more literals than the linear search
+ * threshold of the parser use a literal hash index. */
+
+var source = "var sum = 0;\n";
+
+for (var i = 0; i < 80; i++) {
+  source += "var v" + i + " = " + i + "; sum += v" + i + "; var s" + i + " = 's" + i + "';\n";
+}
+
+source += "function inner (v0) {\n";
+for (var i = 0; i < 40; i++) {
+  source += "  var w" + i + " = v" + (79 - i) + " + s" + i + ";\n";
+}
+source += "  return v0 + w39 + s79;\n}\n";
+source += "return [sum, v79, s0, 's40' === s40, inner ('x')];";
+
+var result = new Function (source) ();
+
+assert (result[0] === 3160);
+assert (result[1] === 79);
+assert (result[2] === "s0");
+assert (result[3] === true);
+assert (result[4] === "x40s39s79");
+
+var names = [];
+var object = "({";
+for (var i = 0; i < 60; i++) {
+  names.push ("p" + i);
+  object += "p" + i + ": '" + "p" + (59 - i) + "', ";
+}
+object += "})";
+
+object = eval (object);
+for (var i = 0; i < 60; i++) {
+  assert (object[names[i]] === names[59 - i]);
+}
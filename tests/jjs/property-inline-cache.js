@@ -0,0 +1,120 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function getX (o) {
+  return o.x;
+}
+
+function setX (o, v) {
+  o.x = v;
+}
+
+var points = [];
+for (var i = 0; i < 20; i++) {
+  points.push (new Point (i, -i));
+}
+
+for (var i = 0; i < points.length; i++) {
+  assert (getX (points[i]) === i);
+  setX (points[i], i * 2);
+  assert (points[i].x === i * 2);
+  assert (points[i].y === -i);
+}
+
+/* Objects with a different property order share the access sites. */
+var a = { y: 1, x: 2 };
+var b = { z: 3, w: 4, x: 5 };
+var c = { x: 6 };
+var d = { y: 7 };
+assert (getX (a) === 2);
+assert (getX (b) === 5);
+assert (getX (c) === 6);
+assert (getX (d) === undefined);
+assert (getX (points[3]) === 6);
+
+/* Deleted and re-added properties. */
+var e = new Point (1, 2);
+assert (getX (e) === 1);
+delete e.x;
+assert (getX (e) === undefined);
+e.x = 10;
+assert (getX (e) === 10);
+delete e.y;
+assert (getX (e) === 10);
+
+/* Prototype properties are not cached as own properties. */
+Point.prototype.z = 42;
+function getZ (o) {
+  return o.z;
+}
+assert (getZ (e) === 42);
+e.z = 43;
+assert (getZ (e) === 43);
+assert (getZ (points[0]) === 42);
+
+/* Accessors and non-writable properties. */
+var log = [];
+var f = { x: 1 };
+setX (f, 2);
+assert (f.x === 2);
+Object.defineProperty (f, "x", { get: function () { return 3; }, set: function (v) { log.push (v); } });
+assert (getX (f) === 3);
+setX (f, 4);
+assert (log.length === 1 && log[0] === 4);
+
+var g = { x: 1 };
+setX (g, 2);
+Object.freeze (g);
+
+try {
+  setX (g, 5);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+assert (getX (g) === 2);
+
+function strictSetX (o, v) {
+  "use strict";
+  o.x = v;
+}
+
+try {
+  strictSetX (g, 6);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+/* Setters on the prototype are invoked for missing own properties. */
+var proto = { set x (v) { log.push ("proto " + v); } };
+var h = Object.create (proto);
+setX (h, 7);
+assert (log[1] === "proto 7");
+assert (!h.hasOwnProperty ("x"));
+
+/* Objects with many properties. */
+var big = {};
+for (var i = 0; i < 64; i++) {
+  big["p" + i] = i;
+}
+big.x = 100;
+assert (getX (big) === 100);
+setX (big, 101);
+assert (getX (big) === 101);
@@ -0,0 +1,89 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check(result, expected) {
+  if (expected === null) {
+    assert(result === null);
+    return;
+  }
+
+  assert(result !== null);
+  assert(result.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++) {
+    assert(result[i] === expected[i]);
+  }
+}
+
+// nested quantifiers which need exponential time with backtracking
+var long = "a".repeat(10000);
+assert(/(a+)+$/.exec(long + "!") === null);
+assert(/^(a|aa)+$/.test(long + "b") === false);
+assert(/^(\w+\s?)+$/.test("word ".repeat(2000) + "!") === false);
+check(/(a+)+$/.exec(long), [long, long]);
+check(/^(a|aa)+$/.exec("aaaa"), ["aaaa", "a"]);
+
+// captures of the last iteration, cleared between iterations
+check(/(?:(a)|(b))+/.exec("ab"), ["ab", undefined, "b"]);
+check(/((a)|b)+/.exec("ab"), ["ab", "b", undefined]);
+check(/(?:(x)|y){1,3}/.exec("xyy"), ["xyy", undefined]);
+check(/(z)((a+)?(b+)?(c))*/.exec("zaacbbbcac"), ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+
+// greedy, lazy and counted quantifiers
+check(/(a|ab)(c|bcd)(d*)/.exec("abcd"), ["abcd", "a", "bcd", ""]);
+check(/(a+?)+?b/.exec("xaaab"), ["aaab", "a"]);
+check(/(?:a+|b)*?c/.exec("ababc"), ["ababc"]);
+check(/(?:ab|a){2,3}b/.exec("aaabab"), ["aaab"]);
+check(/(?:a|b){2}c/.exec("abbc"), ["bbc"]);
+check(/(?:a+){2,}/.exec("a"), null);
+
+// assertions, character classes and flags
+check(/\b(\w+|\d+)+\b/.exec("  foo42 bar"), ["foo42", "foo42"]);
+check(/^(?:[a-c]+|x)+$/m.exec("zz\nabxc\nyy"), ["abxc"]);
+check(/(?:A+|b)+/i.exec("xaAbB"), ["aAbB"]);
+check(/(?:.|\n)+$/.exec("a\nb"), ["a\nb"]);
+check(/(?:é+|ű)+/.exec("árvíztűrő éé"), ["ű"]);
+check(/(?:😀|x)+/u.exec("a😀x😀b"), ["😀x😀"]);
+check(/(?:😀|x)+/.exec("a😀x😀b"), ["😀x😀"]);
+check(/(?:.|x)+/.exec("😀"), ["😀"]);
+assert(/^.$/.test("😀") === false);
+
+// lastIndex handling
+var sticky = /(?:a|b)+/y;
+sticky.lastIndex = 1;
+check(sticky.exec("acb"), null);
+assert(sticky.lastIndex === 0);
+sticky.lastIndex = 1;
+check(sticky.exec("abc"), ["b"]);
+assert(sticky.lastIndex === 2);
+
+var global = /(?:a|b)+/g;
+check(global.exec("xabyba"), ["ab"]);
+assert(global.lastIndex === 3);
+check(global.exec("xabyba"), ["ba"]);
+assert(global.lastIndex === 6);
+check(global.exec("xabyba"), null);
+assert(global.lastIndex === 0);
+
+// string methods
+assert("a1b22c333".replace(/(?:\d|x)+/g, "#") === "a#b#c#");
+assert("a1b22c333".replace(/((?:\d)+)+/g, "<$1>") === "a<1>b<22>c<333>");
+assert("a, b ,c".split(/(?:\s|,)+/).join("|") === "a|b|c");
+assert("aXbXXc".match(/(?:X|Y)+/g).join("|") === "X|XX");
+assert("xyz".search(/(?:y|z)+/) === 1);
+
+// backreferences and lookaheads are matched by backtracking
+check(/((a|b)+)\1/.exec("abab"), ["abab", "ab", "b"]);
+check(/(?:a|b)+(?=c)/.exec("abc"), ["ab"]);
+check(/(?:a|b)+(?!c)/.exec("abc"), ["a"]);
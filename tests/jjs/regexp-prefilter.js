@@ -0,0 +1,76 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+var log = ("INFO request served in 12ms\n".repeat(20) + "ERROR: 503 upstream timeout\n").repeat(10);
+
+// literal prefix
+var codes = log.match(/ERROR: (\d+)/g);
+assert(codes.length === 10);
+assert(codes[9] === "ERROR: 503");
+assert(log.replace(/ERROR: (\d+)/g, "E$1").indexOf("E503 upstream") === 560);
+assert(log.split(/ERROR: /).length === 11);
+assert(log.split(/ERROR: /, 3).length === 3);
+assert(/(?:ERROR): \d/.exec(log).index === 560);
+assert(/ERROR: 404/.exec(log) === null);
+
+var re = /ERROR/g;
+assert(re.test(log) && re.lastIndex === 565);
+assert(re.test(log) && re.lastIndex === 1153);
+re.lastIndex = log.length - 5;
+assert(!re.test(log) && re.lastIndex === 0);
+
+// sticky patterns only match at the last index
+var sticky = /ERROR/y;
+assert(!sticky.test(log) && sticky.lastIndex === 0);
+sticky.lastIndex = 560;
+assert(sticky.test(log) && sticky.lastIndex === 565);
+
+// anchored patterns
+assert(/^INFO/.exec(log).index === 0);
+assert(/^ERROR/.exec(log) === null);
+assert(/^ERROR/m.exec(log).index === 560);
+assert(log.replace(/^INFO/g, "-").indexOf("INFO") === 25);
+assert(log.split(/^I/).length === 2);
+
+// first byte sets
+assert(log.replace(/[0-9]+ms/g, "Xms").indexOf("12ms") === -1);
+assert(/(?:timeout|refused)$/.exec(log) === null);
+assert(/(?:timeout|refused)$/m.exec(log).index === 580);
+assert(/\d\d\d/.exec(log)[0] === "503");
+assert(/(?:a|b)?c/.exec("xxbcac")[0] === "bc");
+assert(/[^I]R/.exec(log).index === 560);
+assert(log.split(/[EI]\w+/).length === 211);
+assert("a1b22c333".split(/\d+/).join() === "a,b,c,");
+
+// case insensitive patterns
+assert(/error: (\d+)/i.exec(log).index === 560);
+assert(/[e]rror/gi.exec(log).index === 560);
+assert(/k/i.exec("K") === null);
+assert(/k/iu.exec("xK").index === 1);
+assert(/s/iu.exec("ſ").index === 0);
+assert(/K/iu.exec("xk").index === 1);
+assert(/été/i.exec("ÉTÉ").index === 0);
+
+// non-ascii input
+var u = "árvíztűrő 😀 tükörfúrógép";
+assert(/tük/.exec(u).index === 13);
+assert(/[öú]r/.exec(u).index === 16);
+assert(u.replace(/ő/g, "o") === "árvíztűro 😀 tükörfúrógép");
+assert(/\ude00/.exec(u).index === 11);
+assert(/\ude00/u.exec(u) === null);
+assert(/[\ude00]/u.exec(u) === null);
+assert(/[😀]/u.exec(u).index === 10);
+assert(/😀/u.exec(u).index === 10);
+assert(u.split(/r/).length === 5);
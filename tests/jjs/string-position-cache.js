@@ -0,0 +1,66 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var text = "日本語のテキスト😀 and ascii ".repeat(100);
+var unit = "日本語のテキスト😀 and ascii ";
+assert(text.length === unit.length * 100);
+
+// forward scan
+var sum = 0;
+for (var i = 0; i < text.length; i++) {
+  assert(text.charCodeAt(i) === unit.charCodeAt(i % unit.length));
+  sum += text.charCodeAt(i);
+}
+assert(sum > 0);
+
+// backward scan
+for (var i = text.length - 1; i >= 0; i -= 7) {
+  assert(text.charAt(i) === unit.charAt(i % unit.length));
+}
+
+// random access, surrogate halves
+var emoji = unit.indexOf("😀");
+for (var k = 99; k >= 0; k -= 3) {
+  var pos = k * unit.length + emoji;
+  assert(text.charCodeAt(pos) === 0xd83d);
+  assert(text.charCodeAt(pos + 1) === 0xde00);
+  assert(text.codePointAt(pos) === 0x1f600);
+}
+
+// slice / substring loops
+for (var k = 0; k < 100; k++) {
+  assert(text.slice(k * unit.length, (k + 1) * unit.length) === unit);
+  assert(text.substring((k + 1) * unit.length, k * unit.length) === unit);
+}
+assert(text.slice(-unit.length) === unit);
+assert(text.substring(emoji, emoji + 2) === "😀");
+
+// interleaved access to several strings
+var strings = [];
+for (var k = 0; k < 8; k++) {
+  strings.push(("é" + k).repeat(100 + k));
+}
+for (var i = 0; i < 100; i++) {
+  for (var k = 0; k < strings.length; k++) {
+    assert(strings[k].charAt(2 * i) === "é");
+    assert(strings[k].charAt(2 * i + 1) === String(k));
+  }
+}
+
+// strings freed and recreated at the same address
+for (var k = 0; k < 20; k++) {
+  var s = ("ő" + "x".repeat(k)).repeat(40);
+  assert(s.charAt((k + 1) * 39) === "ő");
+  assert(s.charAt(s.length - 1) === (k === 0 ? "ő" : "x"));
+}
@@ -0,0 +1,97 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function build(chunk, count) {
+  var s = "";
+  for (var i = 0; i < count; i++) {
+    s += chunk;
+  }
+  return s;
+}
+
+// small chunks, numbers and magic strings
+var s = "";
+for (var i = 0; i < 1000; i++) {
+  s += i;
+  s += "length";
+}
+assert(s.length === 2890 + 6000);
+assert(s.startsWith("0length1length"));
+assert(s.endsWith("998length999length"));
+assert(s.indexOf("500length") === s.lastIndexOf("500length"));
+
+// equality of ropes built with different chunks and of flat strings
+var a = build("abcdefgh", 512);
+var b = build("abcdefghabcdefgh", 256);
+var c = "abcdefgh".repeat(512);
+assert(a === b);
+assert(b === c);
+assert(a + "x" !== c + "y");
+assert(build("abcdefgh", 511) + "abcdefgi" !== c);
+assert(a.length === 4096);
+assert(a.charAt(4095) === "h");
+assert(a.charCodeAt(0) === 97);
+
+// ropes as property names and map keys
+var obj = {};
+obj[build("key-", 100)] = 1;
+assert(obj["key-".repeat(100)] === 1);
+
+var map = new Map();
+map.set(build("map-", 100), 2);
+assert(map.get("map-".repeat(100)) === 2);
+assert(map.has(build("map-", 50) + build("map-", 50)));
+
+// relational comparison
+assert(build("a", 300) < build("a", 300) + "b");
+assert(build("b", 300) > build("a", 301));
+
+// non-ascii characters
+var u = build("é😀x", 200);
+assert(u.length === 800);
+assert(u.charCodeAt(1) === 0xd83d);
+assert(u.codePointAt(1) === 0x1f600);
+assert(u === "é😀x".repeat(200));
+assert(u.substring(796) === "é😀x");
+
+// shared prefixes
+var prefix = build("p", 300);
+var left = prefix + "left";
+var right = prefix + "right";
+assert(left !== right);
+assert(left.slice(300) === "left");
+assert(right.slice(300) === "right");
+assert(prefix.length === 300);
+
+// String.prototype.concat
+var d = "";
+for (var i = 0; i < 200; i++) {
+  d = d.concat("ab", i % 10);
+}
+assert(d.length === 600);
+assert(d === build("ab0ab1ab2ab3ab4ab5ab6ab7ab8ab9", 20));
+
+// appending, prepending and doubling
+var e = build("0123456789", 30);
+e = "start" + e;
+e += e;
+assert(e.length === 610);
+assert(e.slice(300, 310) === "56789start");
+assert(e === ("start" + "0123456789".repeat(30)).repeat(2));
+
+// deep ropes with large chunks
+var chunk = "x".repeat(300);
+var deep = build(chunk, 300);
+assert(deep.length === 90000);
+assert(deep === "x".repeat(90000));
@@ -0,0 +1,82 @@
+// Copyright Light Source Software, LLC and other contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var log = "INFO start\n".repeat(1000) + "ERROR disk full\n" + "INFO retry\n".repeat(500) + "ERROR disk full\n";
+
+// indexOf / lastIndexOf / includes
+assert(log.indexOf("ERROR") === 11000);
+assert(log.indexOf("ERROR", 11001) === 11016 + 5500);
+assert(log.indexOf("ERROR", 16517) === -1);
+assert(log.indexOf("WARN") === -1);
+assert(log.lastIndexOf("ERROR") === 16516);
+assert(log.lastIndexOf("ERROR", 16515) === 11000);
+assert(log.lastIndexOf("ERROR", 10999) === -1);
+assert(log.lastIndexOf("INFO start") === 10989);
+assert(log.includes("disk full\nINFO retry"));
+assert(!log.includes("disk empty"));
+assert(log.includes("", log.length));
+
+// needles sharing the first and the last byte
+var s = "abababac" + "ab".repeat(100) + "abc";
+assert(s.indexOf("abac") === 4);
+assert(s.indexOf("abc") === 208);
+assert(s.lastIndexOf("abab") === 206);
+assert(s.indexOf("c", 8) === 210);
+assert("aaaaab".indexOf("aab") === 3);
+assert("baaaaa".lastIndexOf("baa") === 0);
+
+// non-ascii strings
+var u = "árvíztűrő tükörfúrógép " + "😀".repeat(10) + " ütvefúrógép";
+assert(u.indexOf("tükör") === 10);
+assert(u.indexOf("ütve") === 44);
+assert(u.lastIndexOf("fúrógép") === 48);
+assert(u.lastIndexOf("fúrógép", 47) === 15);
+assert(u.indexOf("😀") === 23);
+assert(u.indexOf("😀", 24) === 25);
+assert(u.lastIndexOf("😀") === 41);
+assert(u.indexOf("\ude00") === 24);
+assert(u.indexOf("ő", 9) === -1);
+
+// startsWith / endsWith
+assert(log.startsWith("INFO"));
+assert(log.startsWith("ERROR", 11000));
+assert(!log.startsWith("ERROR", 11001));
+assert(log.endsWith("full\n"));
+assert(log.endsWith("ERROR", 11005));
+assert(!log.endsWith("ERROR", 11006));
+assert(u.startsWith("tükör", 10));
+assert(u.endsWith("😀", 43));
+assert(!"abc".startsWith("abcd"));
+assert("abc".startsWith(""));
+
+// split with a string separator
+var lines = log.split("\n");
+assert(lines.length === 1503);
+assert(lines[1000] === "ERROR disk full");
+assert(lines[1502] === "");
+assert(u.split("😀").length === 11);
+assert(u.split("ú").join("u") === "árvíztűrő tükörfurógép " + "😀".repeat(10) + " ütvefurógép");
+assert("a,b,,c".split(",").join("|") === "a|b||c");
+assert("abc".split("").join("|") === "a|b|c");
+assert("a--b--c".split("--", 2).join("|") === "a|b");
+
+// replace and replaceAll with a string pattern
+assert(log.replace("ERROR", "WARN").indexOf("WARN") === 11000);
+assert(log.replaceAll("ERROR", "WARN").lastIndexOf("WARN") === 16515);
+assert(u.replace("ütve", "X") === "árvíztűrő tükörfúrógép " + "😀".repeat(10) + " Xfúrógép");
+assert(u.replaceAll("ó", "o").indexOf("ó") === -1);
+assert("xaxbx".replaceAll("x", function (match, pos) { return pos; }) === "0a2b4");
+assert("ébéc".replaceAll("é", function (match, pos) { return pos; }) === "0b2c");
+assert("abc".replaceAll("", "-") === "-a-b-c-");
+assert("abc".replace("d", "e") === "abc");
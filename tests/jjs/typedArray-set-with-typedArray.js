@@ -92,3 +92,17 @@ f.set(e);
 assert(f.join() === '3');
 e.set(f);
 assert(e.join() === '3');
+
+var g = new Uint8Array([1, 2, 3, 4, 5, 6]);
+g.set(new Int8Array(g.buffer, 0, 4), 2);
+assert(g.join() === '1,2,1,2,3,4');
+
+var h = new Uint8ClampedArray(3);
+h.set(new Int8Array([-1, 1, 127]));
+assert(h.join() === '0,1,127');
+h.set(new Uint8Array([255, 7]));
+assert(h.join() === '255,7,127');
+
+var k = new Uint16Array(2);
+k.set(new Int16Array([-1, -32768]));
+assert(k.join() === '65535,32768');
@@ -72,3 +72,53 @@ i.sort(function (lhs, rhs) {
   return { valueOf: function() { return rhs - lhs; } };
 });
 assert(i.toString() === '3,2,1');
+
+// Default sorting of larger arrays matches sorting with an equivalent comparator.
+function defaultCompare(lhs, rhs) {
+  if (lhs !== lhs) {
+    return rhs !== rhs ? 0 : 1;
+  }
+  if (rhs !== rhs || lhs < rhs || (lhs === 0 && rhs === 0 && 1 / lhs < 1 / rhs)) {
+    return -1;
+  }
+  return lhs > rhs || (lhs === 0 && rhs === 0 && 1 / lhs > 1 / rhs) ? 1 : 0;
+}
+
+function sameValue(lhs, rhs) {
+  return lhs === rhs ? lhs !== 0 || 1 / lhs === 1 / rhs : lhs !== lhs && rhs !== rhs;
+}
+
+var seed = 42;
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+var specials = [NaN, -0, 0, Infinity, -Infinity, 5e-324, -5e-324, 3.4e38, -3.4e38, 0.5, -0.5];
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array,
+             Float32Array, Float64Array];
+
+types.forEach(function (TypedArray) {
+  [31, 32, 33, 300, 3000].forEach(function (length) {
+    var array = new TypedArray(length);
+
+    for (var idx = 0; idx < length; idx++) {
+      var r = random();
+      array[idx] = r < 0.2 ? specials[(r * 1000) % specials.length | 0]
+                           : (random() - 0.5) * Math.pow(2, random() * 40 | 0);
+    }
+
+    var expected = Array.prototype.slice.call(array).sort(defaultCompare);
+    array.sort();
+
+    for (var idx = 0; idx < length; idx++) {
+      assert(sameValue(array[idx], expected[idx]));
+    }
+  });
+});
+
+var bigints = BigInt64Array.from([5n, -3n, 0n, -9223372036854775808n, 9223372036854775807n, 2n, -1n]);
+assert(bigints.sort().toString() === '-9223372036854775808,-3,-1,0,2,5,9223372036854775807');
+
+var biguints = BigUint64Array.from([5n, 18446744073709551615n, 0n, 9223372036854775808n]);
+assert(biguints.sort().toString() === '0,5,9223372036854775808,18446744073709551615');
@@ -102,3 +102,34 @@ var empty_typedarrays = [
 empty_typedarrays.forEach(function(e){
   assert(e.indexOf(0) === -1);
 });
+
+// Checking values which are not representable by the element type
+var values = [0, -0, 1, -1, 1.5, 127, 128, 255, 256, -129, 65535, 65536, 4294967295, NaN, Infinity, 0.1, 16777217, 1e300];
+var kinds = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+             Int32Array, Uint32Array, Float32Array, Float64Array];
+
+kinds.forEach(function(kind) {
+  var ta = new kind(values.length * 2);
+
+  for (var i = 0; i < ta.length; i++) {
+    ta[i] = values[(i * 7) % values.length];
+  }
+
+  var array = Array.prototype.slice.call(ta);
+
+  values.concat(["1", undefined, null, 1n]).forEach(function(value) {
+    [undefined, 0, 5, -3, 100].forEach(function(from) {
+      assert(ta.indexOf(value, from) === array.indexOf(value, from));
+      assert(ta.lastIndexOf(value, from === undefined ? Infinity : from) ===
+             array.lastIndexOf(value, from === undefined ? Infinity : from));
+      assert(ta.includes(value, from) === array.includes(value, from));
+    });
+  });
+});
+
+var big = new BigInt64Array([1n, -1n, 5n, -9223372036854775808n, 0n]);
+assert(big.indexOf(-1n) === 1);
+assert(big.indexOf(18446744073709551615n) === -1);
+assert(big.indexOf(1) === -1);
+assert(big.lastIndexOf(-9223372036854775808n) === 3);
+assert(big.includes(0n) && !big.includes(0));
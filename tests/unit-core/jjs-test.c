@@ -154,6 +154,28 @@ ctx_bootstrap_cleanup (jjs_context_t *context_p)
   jjs_context_cleanup (context_p);
 }
 
+void
+buffer_wstream_write (jjs_context_t *context_p, /**< JJS context */
+                      const jjs_wstream_t *wstream_p, /**< stream */
+                      const uint8_t *data_p, /**< bytes to write */
+                      jjs_size_t size) /**< number of bytes */
+{
+  JJS_UNUSED (context_p);
+  buffer_wstream_state_t *state_p = (buffer_wstream_state_t *) wstream_p->state_p;
+
+  state_p->writes++;
+
+  if (state_p->size + size > state_p->capacity)
+  {
+    state_p->capacity = (state_p->size + size) * 2;
+    state_p->buffer_p = realloc (state_p->buffer_p, state_p->capacity);
+    TEST_ASSERT (state_p->buffer_p != NULL);
+  }
+
+  memcpy (state_p->buffer_p + state_p->size, data_p, size);
+  state_p->size += size;
+} /* buffer_wstream_write */
+
 void
 ctx_assert_strict_equals (jjs_value_t actual, jjs_value_t expected)
 {
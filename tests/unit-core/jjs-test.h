@@ -155,6 +155,25 @@ jjs_value_t ctx_array (jjs_length_t len);
 jjs_value_t ctx_boolean (bool value);
 jjs_value_t ctx_symbol (const char *description);
 
+/**
+ * State of a write stream, which collects the written bytes in a growing buffer.
+ *
+ * The buffer is allocated with malloc and must be freed by the caller.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< collected bytes */
+  jjs_size_t size; /**< number of collected bytes */
+  jjs_size_t capacity; /**< size of the buffer */
+  uint32_t writes; /**< number of write calls */
+} buffer_wstream_state_t;
+
+/**
+ * Write callback of jjs_wstream_t, which appends the bytes to the buffer_wstream_state_t
+ * stored in the state_p of the stream.
+ */
+void buffer_wstream_write (jjs_context_t *context_p, const jjs_wstream_t *wstream_p, const uint8_t *data_p, jjs_size_t size);
+
 /* assert helpers that work on the current context */
 
 void ctx_assert_strict_equals (jjs_value_t expected, jjs_value_t actual);
@@ -174,6 +174,117 @@ test_context_allocator (void)
   TEST_ASSERT (stdlib_free_called == true);
 }
 
+static void
+test_context_vm_heap_growable (void)
+{
+  jjs_context_options_t options = {
+    .vm_heap_size_kb = jjs_optional_u32 (256),
+    .vm_heap_max_size_kb = jjs_optional_u32 (4096),
+    .vm_heap_step_size_kb = jjs_optional_u32 (128),
+  };
+
+  if (!jjs_feature_enabled (JJS_FEATURE_VM_HEAP_GROWABLE))
+  {
+    jjs_context_t *context_p;
+    TEST_ASSERT (jjs_context_new (&options, &context_p) == JJS_STATUS_CONTEXT_VM_HEAP_GROWABLE_DISABLED);
+    return;
+  }
+
+  ctx_open (&options);
+
+  /* allocate well past the initial heap size, release it and allocate again */
+  const char *source_p = "var a = []; for (var i = 0; i < 20000; i++) a.push({ i: i, s: 'x' + i }); a.length";
+
+  for (int i = 0; i < 2; i++)
+  {
+    jjs_value_t result = ctx_defer_free (jjs_eval_sz (ctx (), source_p, JJS_PARSE_NO_OPTS));
+    TEST_ASSERT (jjs_value_as_number (ctx (), result) == 20000);
+
+    ctx_defer_free (jjs_eval_sz (ctx (), "a = null", JJS_PARSE_NO_OPTS));
+    jjs_heap_gc (ctx (), JJS_GC_PRESSURE_HIGH);
+  }
+
+  ctx_close ();
+}
+
+static uint32_t gc_sweep_free_count = 0;
+
+static void
+gc_sweep_free_cb (jjs_context_t *context_p, void *native_p, const jjs_object_native_info_t *info_p)
+{
+  JJS_UNUSED (context_p);
+  JJS_UNUSED (native_p);
+  JJS_UNUSED (info_p);
+  gc_sweep_free_count++;
+}
+
+static const jjs_object_native_info_t gc_sweep_native_info = {
+  .free_cb = gc_sweep_free_cb,
+};
+
+static void
+test_context_gc_sweep_limit (void)
+{
+  const uint32_t object_count = 1000;
+  const uint32_t sweep_limit = 100;
+  jjs_context_options_t options = {
+    .gc_sweep_limit = jjs_optional_u32 (sweep_limit),
+  };
+
+  ctx_open (&options);
+
+  /* deep object graphs are marked without running out of the gc mark limit */
+  const char *list_source_p = "var l = null; for (var i = 0; i < 2000; i++) l = { next: l, i: i }; l";
+  ctx_defer_free (jjs_eval_sz (ctx (), list_source_p, JJS_PARSE_NO_OPTS));
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_HIGH);
+  jjs_value_t list_length = ctx_defer_free (
+    jjs_eval_sz (ctx (), "var n = 0; for (var p = l; p; p = p.next) n++; n", JJS_PARSE_NO_OPTS));
+  TEST_ASSERT (jjs_value_as_number (ctx (), list_length) == 2000);
+
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_LOW);
+  gc_sweep_free_count = 0;
+
+  /* keep the objects reachable until all of them are created */
+  jjs_value_t array = jjs_array (ctx (), 0);
+
+  for (uint32_t i = 0; i < object_count; i++)
+  {
+    jjs_value_t object = jjs_object (ctx ());
+    jjs_object_set_native_ptr (ctx (), object, &gc_sweep_native_info, NULL);
+    jjs_value_free (ctx (), jjs_object_set_index (ctx (), array, i, object, JJS_MOVE));
+  }
+
+  /* finish the sweep of collections triggered by the allocations */
+  TEST_ASSERT (!jjs_heap_gc_step (ctx (), 0));
+  TEST_ASSERT (gc_sweep_free_count == 0);
+  jjs_value_free (ctx (), array);
+
+  /* each step frees at most sweep_limit unreachable objects */
+  uint32_t steps = 0;
+
+  while (jjs_heap_gc_step (ctx (), sweep_limit))
+  {
+    TEST_ASSERT (gc_sweep_free_count <= ++steps * sweep_limit);
+  }
+
+  TEST_ASSERT (steps >= object_count / sweep_limit - 1);
+  TEST_ASSERT (gc_sweep_free_count == object_count);
+
+  if (jjs_feature_enabled (JJS_FEATURE_WEAKREF))
+  {
+    /* a weak ref must not return a target which is waiting to be freed */
+    ctx_defer_free (
+      jjs_eval_sz (ctx (), "var w = []; for (var i = 0; i < 500; i++) w.push (new WeakRef ({}))", JJS_PARSE_NO_OPTS));
+    TEST_ASSERT (jjs_heap_gc_step (ctx (), 1));
+
+    jjs_value_t result = ctx_defer_free (
+      jjs_eval_sz (ctx (), "w.every (function (r) { return r.deref () === undefined })", JJS_PARSE_NO_OPTS));
+    TEST_ASSERT (jjs_value_is_true (ctx (), result));
+  }
+
+  ctx_close ();
+}
+
 static void
 test_context_data_init (void)
 {
@@ -270,6 +381,92 @@ test_context_data_set (void)
   ctx_close ();
 }
 
+static double
+regexp_cache_eval_count (const char *source_p)
+{
+  jjs_value_t result = jjs_eval_sz (ctx (), source_p, JJS_PARSE_NO_OPTS);
+  TEST_ASSERT (jjs_value_is_number (ctx (), result));
+  double count = jjs_value_as_number (ctx (), result);
+  jjs_value_free (ctx (), result);
+  return count;
+}
+
+static void
+test_context_regexp_cache (void)
+{
+  jjs_regexp_cache_stats_t stats;
+
+  if (!jjs_feature_enabled (JJS_FEATURE_REGEXP))
+  {
+    ctx_open (NULL);
+    TEST_ASSERT (!jjs_regexp_cache_stats (ctx (), &stats));
+    ctx_close ();
+    return;
+  }
+
+  const uint32_t cache_size = 16;
+  jjs_context_options_t options = {
+    .regexp_cache_size = jjs_optional_u32 (cache_size),
+  };
+
+  ctx_open (&options);
+
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.size == cache_size && stats.count == 0 && stats.hits == 0 && stats.misses == 0);
+
+  /* every pattern is compiled once while the working set fits into the cache */
+  const char *fits_source_p = "var n = 0;"
+                              "for (var r = 0; r < 10; r++)"
+                              "  for (var i = 0; i < 16; i++)"
+                              "    if (new RegExp ('^id' + i + '$').test ('id' + i)) n++;"
+                              "n";
+  TEST_ASSERT (regexp_cache_eval_count (fits_source_p) == 160);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.count == cache_size);
+  TEST_ASSERT (stats.misses == 16);
+  TEST_ASSERT (stats.hits == 144);
+
+  /* flags are part of the key */
+  TEST_ASSERT (regexp_cache_eval_count ("new RegExp ('^id1$', 'i').test ('ID1') ? 1 : 0") == 1);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.misses == 17);
+  TEST_ASSERT (stats.count == cache_size);
+
+  /* frequently used patterns survive the eviction of the least recently used ones */
+  const char *lru_source_p = "var n = 0;"
+                             "for (var i = 0; i < 100; i++) {"
+                             "  if (/^hot$/.source === new RegExp ('^hot$').source) n++;"
+                             "  new RegExp ('cold' + i);"
+                             "}"
+                             "n";
+  size_t misses = stats.misses;
+  TEST_ASSERT (regexp_cache_eval_count (lru_source_p) == 100);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.misses - misses <= 101);
+  TEST_ASSERT (stats.count == cache_size);
+
+  /* a low pressure gc keeps the cache, a high pressure gc releases it */
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_LOW);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.count == cache_size);
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_HIGH);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.count == 0);
+
+  ctx_close ();
+
+  /* size of 0 disables the cache */
+  options.regexp_cache_size = jjs_optional_u32 (0);
+  ctx_open (&options);
+
+  TEST_ASSERT (regexp_cache_eval_count ("var n = 0; for (var i = 0; i < 10; i++) if (/a/.test ('a')) n++; n") == 10);
+  TEST_ASSERT (jjs_regexp_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.count == 0);
+  TEST_ASSERT (stats.hits == 0);
+
+  ctx_close ();
+}
+
 int
 main (void)
 {
@@ -283,6 +480,9 @@ main (void)
   test_init_options_stack_limit_when_stack_static ();
 
   test_context_allocator ();
+  test_context_vm_heap_growable ();
+  test_context_gc_sweep_limit ();
+  test_context_regexp_cache ();
 
   test_context_data_init ();
   test_context_data_key ();
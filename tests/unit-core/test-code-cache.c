@@ -0,0 +1,211 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-test.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#include <windows.h>
+#else /* !_WIN32 */
+#include <dirent.h>
+#include <unistd.h>
+#endif /* _WIN32 */
+
+static const char* TEST_MODULE_MAIN = "./unit-fixtures/code-cache/main.mjs";
+static const char* TEST_MODULE_TAGGED = "./unit-fixtures/code-cache/tagged.mjs";
+static const char* TEST_COMMONJS_MATH = "./unit-fixtures/code-cache/math.cjs";
+
+/**
+ * Empty cache directory, created for each run of the test.
+ */
+static char cache_dir[512];
+
+static void
+cache_dir_create (void)
+{
+#ifdef _WIN32
+  TEST_ASSERT (GetTempPathA ((DWORD) sizeof (cache_dir), cache_dir) != 0);
+  strncat (cache_dir, "jjs-code-cache-XXXXXX", sizeof (cache_dir) - strlen (cache_dir) - 1);
+  TEST_ASSERT (_mktemp (cache_dir) != NULL);
+  TEST_ASSERT (_mkdir (cache_dir) == 0);
+#else /* !_WIN32 */
+  const char *tmp_dir_p = getenv ("TMPDIR");
+
+  snprintf (cache_dir, sizeof (cache_dir), "%s/jjs-code-cache-XXXXXX", tmp_dir_p ? tmp_dir_p : "/tmp");
+  TEST_ASSERT (mkdtemp (cache_dir) != NULL);
+#endif /* _WIN32 */
+} /* cache_dir_create */
+
+static void
+cache_dir_remove (void)
+{
+  char path[sizeof (cache_dir) + 260];
+
+#ifdef _WIN32
+  WIN32_FIND_DATAA data;
+
+  snprintf (path, sizeof (path), "%s\\*.jjsc", cache_dir);
+  HANDLE find = FindFirstFileA (path, &data);
+
+  if (find != INVALID_HANDLE_VALUE)
+  {
+    do
+    {
+      snprintf (path, sizeof (path), "%s\\%s", cache_dir, data.cFileName);
+      remove (path);
+    } while (FindNextFileA (find, &data));
+
+    FindClose (find);
+  }
+
+  TEST_ASSERT (_rmdir (cache_dir) == 0);
+#else /* !_WIN32 */
+  DIR *dir_p = opendir (cache_dir);
+  struct dirent *entry_p;
+
+  TEST_ASSERT (dir_p != NULL);
+
+  while ((entry_p = readdir (dir_p)) != NULL)
+  {
+    if (strcmp (entry_p->d_name, ".") != 0 && strcmp (entry_p->d_name, "..") != 0)
+    {
+      snprintf (path, sizeof (path), "%s/%s", cache_dir, entry_p->d_name);
+      remove (path);
+    }
+  }
+
+  closedir (dir_p);
+  TEST_ASSERT (rmdir (cache_dir) == 0);
+#endif /* _WIN32 */
+} /* cache_dir_remove */
+
+static jjs_code_cache_stats_t
+get_stats (void)
+{
+  jjs_code_cache_stats_t stats;
+
+  TEST_ASSERT (jjs_code_cache_stats (ctx (), &stats));
+  TEST_ASSERT (stats.version == 1);
+
+  return stats;
+} /* get_stats */
+
+static jjs_value_t
+get_property (jjs_value_t object, const char* key)
+{
+  TEST_ASSERT (!jjs_value_is_exception (ctx (), object));
+  return ctx_defer_free (jjs_object_get_sz (ctx (), object, key));
+} /* get_property */
+
+static void
+load_modules (void)
+{
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_code_cache_sz (ctx (), cache_dir));
+
+  jjs_value_t ns = ctx_defer_free (jjs_esm_import_sz (ctx (), TEST_MODULE_MAIN));
+
+  TEST_ASSERT (strict_equals_int32 (ctx (), get_property (ns, "default"), 5));
+  TEST_ASSERT (strict_equals_cstr (ctx (), get_property (ns, "label"), "lib"));
+  TEST_ASSERT (jjs_value_is_function (ctx (), get_property (ns, "add")));
+  TEST_ASSERT (jjs_value_is_function (ctx (), get_property (ns, "sum")));
+  TEST_ASSERT (jjs_value_is_string (ctx (), get_property (ns, "url")));
+
+  ns = ctx_defer_free (jjs_esm_import_sz (ctx (), TEST_MODULE_TAGGED));
+  TEST_ASSERT (strict_equals_cstr (ctx (), get_property (ns, "default"), "cached"));
+
+  jjs_value_t exports = ctx_defer_free (jjs_commonjs_require_sz (ctx (), TEST_COMMONJS_MATH));
+
+  TEST_ASSERT (strict_equals_int32 (ctx (), get_property (exports, "answer"), 42));
+  TEST_ASSERT (jjs_value_is_string (ctx (), get_property (exports, "filename")));
+} /* load_modules */
+
+static void
+test_code_cache_invalid_args (void)
+{
+  ctx_open (NULL);
+
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_code_cache (ctx (), jjs_number (ctx (), 1), JJS_MOVE));
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_code_cache (ctx (), jjs_object (ctx ()), JJS_MOVE));
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_code_cache_sz (ctx (), "./unit-fixtures/code-cache/does-not-exist"));
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_code_cache (ctx (), jjs_undefined (ctx ()), JJS_MOVE));
+
+  ctx_close ();
+} /* test_code_cache_invalid_args */
+
+static void
+test_code_cache_disabled (void)
+{
+  ctx_open (NULL);
+
+  jjs_value_t ns = ctx_defer_free (jjs_esm_import_sz (ctx (), TEST_MODULE_MAIN));
+  TEST_ASSERT (strict_equals_int32 (ctx (), get_property (ns, "default"), 5));
+
+  jjs_code_cache_stats_t stats = get_stats ();
+  TEST_ASSERT (stats.hits == 0 && stats.misses == 0 && stats.writes == 0);
+
+  ctx_close ();
+} /* test_code_cache_disabled */
+
+static void
+test_code_cache_load (void)
+{
+  cache_dir_create ();
+
+  /* first load populates the empty cache, the tagged template module is recorded as uncacheable */
+  ctx_open (NULL);
+  load_modules ();
+
+  jjs_code_cache_stats_t stats = get_stats ();
+  TEST_ASSERT (stats.hits == 0);
+  TEST_ASSERT (stats.misses == 4);
+  TEST_ASSERT (stats.writes == 4);
+  ctx_close ();
+
+  /* second load is served from the cache, except the uncacheable tagged template module */
+  ctx_open (NULL);
+  load_modules ();
+
+  stats = get_stats ();
+  TEST_ASSERT (stats.hits == 3);
+  TEST_ASSERT (stats.misses == 0);
+  TEST_ASSERT (stats.writes == 0);
+  ctx_close ();
+
+  cache_dir_remove ();
+} /* test_code_cache_load */
+
+int
+main (void)
+{
+  if (!jjs_feature_enabled (JJS_FEATURE_CODE_CACHE))
+  {
+    ctx_open (NULL);
+
+    jjs_code_cache_stats_t stats;
+
+    JJS_EXPECT_EXCEPTION_MOVE (jjs_code_cache_sz (ctx (), "./unit-fixtures/code-cache"));
+    TEST_ASSERT (!jjs_code_cache_stats (ctx (), &stats));
+
+    ctx_close ();
+    return 0;
+  }
+
+  test_code_cache_invalid_args ();
+  test_code_cache_disabled ();
+  test_code_cache_load ();
+
+  return 0;
+} /* main */
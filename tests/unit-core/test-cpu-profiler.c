@@ -0,0 +1,121 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-test.h"
+
+static void
+run_script (const char *source_p)
+{
+  jjs_parse_options_t options = {
+    .source_name = jjs_optional_value (jjs_string_sz (ctx (), "profiled.js")),
+    .source_name_o = JJS_MOVE,
+  };
+
+  jjs_value_t script = jjs_parse_sz (ctx (), source_p, &options);
+  JJS_EXPECT_NOT_EXCEPTION (script);
+  JJS_EXPECT_NOT_EXCEPTION (ctx_defer_free (jjs_run (ctx (), script, JJS_MOVE)));
+} /* run_script */
+
+static void
+test_errors (void)
+{
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_cpu_profiler_stop (ctx (), NULL));
+
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_cpu_profiler_start (ctx (), 0));
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_cpu_profiler_start (ctx (), 0));
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_cpu_profiler_stop (ctx (), NULL));
+
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_cpu_profiler_stop (ctx (), NULL));
+} /* test_errors */
+
+static void
+test_profile (void)
+{
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_cpu_profiler_start (ctx (), 100));
+
+  /* The functions run long enough to be sampled several times. The anonymous
+   * function is garbage collected before the profile is written. */
+  run_script (TEST_STRING_LITERAL ("function hotFunction (ms) {\n"
+                                   "  var end = Date.now () + ms, n = 0;\n"
+                                   "  while (Date.now () < end) { n++; }\n"
+                                   "  return n;\n"
+                                   "}\n"
+                                   "hotFunction (20);\n"
+                                   "(function () { hotFunction (20); }) ();\n"));
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_HIGH);
+
+  buffer_wstream_state_t state = { 0 };
+  jjs_wstream_t wstream = {
+    .write = buffer_wstream_write,
+    .state_p = &state,
+    .encoding = JJS_ENCODING_UTF8,
+  };
+
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_cpu_profiler_stop (ctx (), &wstream));
+  TEST_ASSERT (state.writes > 0);
+
+  jjs_value_t profile = jjs_json_parse (ctx (), state.buffer_p, state.size);
+  free (state.buffer_p);
+
+  JJS_EXPECT_NOT_EXCEPTION (profile);
+  jjs_value_free (ctx (), jjs_object_set_sz (ctx (), ctx_global (), "profile", profile, JJS_MOVE));
+
+  const char *check_p = TEST_STRING_LITERAL ("var nodes = profile.nodes;\n"
+                                             "var ids = nodes.map (function (node) { return node.id; });\n"
+                                             "var hot = nodes.filter (function (node) {\n"
+                                             "  return node.callFrame.functionName === 'hotFunction';\n"
+                                             "});\n"
+                                             "nodes[0].callFrame.functionName === '(root)'\n"
+                                             "&& profile.samples.length > 0\n"
+                                             "&& profile.samples.length === profile.timeDeltas.length\n"
+                                             "&& profile.samples.every (function (id) { return ids.indexOf (id) >= 0; })\n"
+                                             "&& profile.endTime >= profile.startTime\n"
+                                             "&& hot.length === 2\n"
+                                             "&& hot.every (function (node) {\n"
+                                             "  return node.callFrame.url === 'profiled.js'\n"
+                                             "         && node.callFrame.lineNumber >= 0\n"
+                                             "         && node.hitCount > 0\n"
+                                             "         && node.positionTicks.length > 0;\n"
+                                             "});\n");
+
+  JJS_EXPECT_TRUE_MOVE (jjs_eval_sz (ctx (), check_p, JJS_PARSE_NO_OPTS));
+} /* test_profile */
+
+int
+main (void)
+{
+  ctx_open (NULL);
+
+  if (!jjs_feature_enabled (JJS_FEATURE_CPU_PROFILER))
+  {
+    JJS_EXPECT_EXCEPTION_MOVE (jjs_cpu_profiler_start (ctx (), 0));
+    JJS_EXPECT_EXCEPTION_MOVE (jjs_cpu_profiler_stop (ctx (), NULL));
+    ctx_close ();
+    return 0;
+  }
+
+  test_errors ();
+
+  if (jjs_feature_enabled (JJS_FEATURE_JS_PARSER) && jjs_feature_enabled (JJS_FEATURE_LINE_INFO))
+  {
+    test_profile ();
+  }
+
+  /* A running profiler is released with the context. */
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_cpu_profiler_start (ctx (), 0));
+
+  ctx_close ();
+  return 0;
+} /* main */
@@ -0,0 +1,84 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-test.h"
+
+/*
+ * Compares the time zone offsets computed through the cache with the offsets computed after
+ * the cache was dropped by jjs_time_zone_changed. The test is meaningful when TZ selects a
+ * time zone with daylight saving time, but it must pass in any time zone. The scans fill the
+ * cache with consecutive time values, which extend the cached ranges across the transitions.
+ */
+static const char* TEST_SCRIPT =
+  "function check (time) {\n"
+  "  var cached = new Date (time).getTimezoneOffset ();\n"
+  "  timeZoneChanged ();\n"
+  "  var fresh = new Date (time).getTimezoneOffset ();\n"
+  "  if (cached !== fresh) throw new Error ('offset mismatch at ' + time);\n"
+  "}\n"
+  "var start = Date.UTC (2021, 0, 1), end = Date.UTC (2023, 0, 1), hour = 3600000, t;\n"
+  "for (t = start; t < end; t += hour) { new Date (t).getTimezoneOffset (); check (t); }\n"
+  "for (t = end; t > start; t -= 7 * hour + 1) { new Date (t).getTimezoneOffset (); check (t); }\n"
+  "for (t = start; t < end; t += 37 * 24 * hour + 13) { new Date (t).getTimezoneOffset (); check (t); }\n"
+  "function scan (from, to, step) {\n"
+  "  var offsets = [], i = 0, t;\n"
+  "  timeZoneChanged ();\n"
+  "  for (t = from; step > 0 ? t < to : t > to; t += step) offsets.push (new Date (t).getTimezoneOffset ());\n"
+  "  for (t = from; step > 0 ? t < to : t > to; t += step) {\n"
+  "    timeZoneChanged ();\n"
+  "    if (offsets[i++] !== new Date (t).getTimezoneOffset ()) throw new Error ('scan mismatch at ' + t);\n"
+  "  }\n"
+  "}\n"
+  "scan (start, end, 5 * hour + 7);\n"
+  "scan (end, start, -(5 * hour + 7));\n"
+  "true;\n";
+
+static jjs_value_t
+time_zone_changed_handler (const jjs_call_info_t *call_info_p, /**< call info */
+                           const jjs_value_t args_p[], /**< arguments */
+                           const jjs_length_t args_count) /**< arguments length */
+{
+  JJS_UNUSED (args_p);
+  JJS_UNUSED (args_count);
+
+  jjs_time_zone_changed (call_info_p->context_p);
+  return jjs_undefined (call_info_p->context_p);
+} /* time_zone_changed_handler */
+
+int
+main (void)
+{
+  ctx_open (NULL);
+
+  /* must be callable without Date support and on an empty cache */
+  jjs_time_zone_changed (ctx ());
+
+  if (jjs_feature_enabled (JJS_FEATURE_DATE))
+  {
+    jjs_value_t global = ctx_defer_free (jjs_current_realm (ctx ()));
+
+    jjs_value_free (ctx (),
+                    jjs_object_set_sz (ctx (),
+                                       global,
+                                       "timeZoneChanged",
+                                       jjs_function_external (ctx (), time_zone_changed_handler),
+                                       JJS_MOVE));
+
+    JJS_EXPECT_TRUE_MOVE (jjs_eval_sz (ctx (), TEST_SCRIPT, JJS_PARSE_NO_OPTS));
+  }
+
+  ctx_close ();
+  return 0;
+} /* main */
@@ -0,0 +1,133 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-test.h"
+
+static const jjs_object_native_info_t native_info = { 0 };
+
+static int native_data = 0;
+
+static void
+test_snapshot (void)
+{
+  const char *source_p = TEST_STRING_LITERAL ("class Leaky {\n"
+                                              "  constructor (id) {\n"
+                                              "    this.payload = 'payload-' + id;\n"
+                                              "    this.self = this;\n"
+                                              "  }\n"
+                                              "}\n"
+                                              "var leaks = [new Leaky ('first'), new Leaky ('second')];\n"
+                                              "function makeClosure () {\n"
+                                              "  var captured = { tag: 'captured' };\n"
+                                              "  return function closureFn () { return captured; };\n"
+                                              "}\n"
+                                              "var keep = makeClosure ();\n");
+  JJS_EXPECT_NOT_EXCEPTION (ctx_defer_free (jjs_eval_sz (ctx (), source_p, JJS_PARSE_NO_OPTS)));
+
+  jjs_value_t holder = jjs_object (ctx ());
+  jjs_object_set_native_ptr (ctx (), holder, &native_info, &native_data);
+  jjs_value_free (ctx (), jjs_object_set_sz (ctx (), ctx_global (), "holder", holder, JJS_MOVE));
+
+  buffer_wstream_state_t state = { 0 };
+  jjs_wstream_t wstream = {
+    .write = buffer_wstream_write,
+    .state_p = &state,
+    .encoding = JJS_ENCODING_UTF8,
+  };
+
+  JJS_EXPECT_UNDEFINED_MOVE (jjs_heap_snapshot (ctx (), &wstream));
+  TEST_ASSERT (state.size > 0);
+
+  jjs_value_t snapshot = jjs_json_parse (ctx (), state.buffer_p, state.size);
+  free (state.buffer_p);
+
+  JJS_EXPECT_NOT_EXCEPTION (snapshot);
+  jjs_value_free (ctx (), jjs_object_set_sz (ctx (), ctx_global (), "snapshot", snapshot, JJS_MOVE));
+
+  /* Decode the flat node and edge arrays, then check the structure and a few retainer paths. */
+  const char *check_p = TEST_STRING_LITERAL (
+    "var meta = snapshot.snapshot.meta, strings = snapshot.strings;\n"
+    "var nodeFields = meta.node_fields.length, edgeFields = meta.edge_fields.length;\n"
+    "var nodes = [], edgeCount = 0, valid = true;\n"
+    "for (var i = 0; i < snapshot.nodes.length; i += nodeFields) {\n"
+    "  nodes.push ({ type: meta.node_types[0][snapshot.nodes[i]], name: strings[snapshot.nodes[i + 1]],\n"
+    "                edges: [], edgeCount: snapshot.nodes[i + 4] });\n"
+    "  edgeCount += snapshot.nodes[i + 4];\n"
+    "}\n"
+    "var edgeIndex = 0;\n"
+    "nodes.forEach (function (node) {\n"
+    "  for (var j = 0; j < node.edgeCount; j++, edgeIndex += edgeFields) {\n"
+    "    var type = meta.edge_types[0][snapshot.edges[edgeIndex]];\n"
+    "    var to = snapshot.edges[edgeIndex + 2];\n"
+    "    valid = valid && to % nodeFields === 0 && to < snapshot.nodes.length;\n"
+    "    node.edges.push ({ type: type, name: type === 'element' ? snapshot.edges[edgeIndex + 1]\n"
+    "                                                          : strings[snapshot.edges[edgeIndex + 1]],\n"
+    "                       to: nodes[to / nodeFields] || to / nodeFields });\n"
+    "  }\n"
+    "});\n"
+    "nodes.forEach (function (node) {\n"
+    "  node.edges.forEach (function (edge) { if (typeof edge.to === 'number') edge.to = nodes[edge.to]; });\n"
+    "});\n"
+    "function edge (node, name) {\n"
+    "  return node.edges.filter (function (e) { return e.name === name; })[0];\n"
+    "}\n"
+    "var leaky = nodes.filter (function (n) { return n.type === 'object' && n.name === 'Leaky'; });\n"
+    "var closure = nodes.filter (function (n) { return n.type === 'closure' && n.name === 'closureFn'; })[0];\n"
+    "var scope = closure && edge (closure, 'context').to;\n"
+    "var global = nodes.filter (function (n) { return edge (n, 'leaks') && edge (n, 'holder'); })[0];\n"
+    "valid\n"
+    "&& nodes.length === snapshot.snapshot.node_count\n"
+    "&& edgeCount === snapshot.snapshot.edge_count\n"
+    "&& snapshot.edges.length === edgeCount * edgeFields\n"
+    "&& nodes[0].type === 'synthetic'\n"
+    "&& leaky.length === 2\n"
+    "&& leaky.every (function (n) {\n"
+    "  var payload = edge (n, 'payload');\n"
+    "  return payload.type === 'property' && payload.to.type === 'string'\n"
+    "         && /^payload-(first|second)$/.test (payload.to.name)\n"
+    "         && edge (n, 'self').to === n && edge (edge (n, '__proto__').to, 'constructor').to.name === 'Leaky';\n"
+    "})\n"
+    "&& edge (closure, 'code').to.type === 'code'\n"
+    "&& scope.name === 'system / Context'\n"
+    "&& edge (scope, 'captured').type === 'context'\n"
+    "&& edge (edge (scope, 'captured').to, 'tag').to.name === 'captured'\n"
+    "&& edge (edge (global, 'holder').to, 'native').to.type === 'native';\n");
+
+  JJS_EXPECT_TRUE_MOVE (jjs_eval_sz (ctx (), check_p, JJS_PARSE_NO_OPTS));
+} /* test_snapshot */
+
+int
+main (void)
+{
+  ctx_open (NULL);
+
+  if (!jjs_feature_enabled (JJS_FEATURE_HEAP_SNAPSHOT))
+  {
+    jjs_wstream_t wstream = { 0 };
+    JJS_EXPECT_EXCEPTION_MOVE (jjs_heap_snapshot (ctx (), &wstream));
+    ctx_close ();
+    return 0;
+  }
+
+  JJS_EXPECT_EXCEPTION_MOVE (jjs_heap_snapshot (ctx (), NULL));
+
+  if (jjs_feature_enabled (JJS_FEATURE_JS_PARSER))
+  {
+    test_snapshot ();
+  }
+
+  ctx_close ();
+  return 0;
+} /* main */
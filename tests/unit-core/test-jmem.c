@@ -16,13 +16,31 @@
 #include "jjs-test.h"
 
 #include "ecma-init-finalize.h"
+#include "jcontext.h"
 
 #define BASIC_SIZE (64)
 
+#define CELL_PAGE_SIZE (16)
+#define CELL_COUNT (CELL_PAGE_SIZE * 8)
+
+static uint32_t
+count_cell_pages (jjs_context_t *context_p)
+{
+  uint32_t count = 0;
+
+  for (jmem_cellocator_page_t *page_p = context_p->jmem_cellocator_32.pages; page_p != NULL; page_p = page_p->next_p)
+  {
+    count++;
+  }
+
+  return count;
+} /* count_cell_pages */
+
 int
 main (void)
 {
-  jjs_context_t *context_p = ctx_bootstrap (NULL);
+  jjs_context_options_t options = { .vm_cell_count = jjs_optional_u32 (CELL_PAGE_SIZE) };
+  jjs_context_t *context_p = ctx_bootstrap (&options);
 
   jmem_init (context_p);
   ecma_init (context_p);
@@ -102,6 +120,46 @@ main (void)
     jmem_heap_free_block (context_p, block4_p, BASIC_SIZE * 2);
   }
 
+  {
+    jmem_cellocator_t *cellocator_p = &context_p->jmem_cellocator_32;
+    uint8_t *cells_p[CELL_COUNT];
+    uint32_t page_count = count_cell_pages (context_p);
+
+    for (uint32_t i = 0; i < CELL_COUNT; i++)
+    {
+      cells_p[i] = (uint8_t *) jmem_heap_alloc_block (context_p, JMEM_CELLOCATOR_CELL_SIZE / 2);
+      memset (cells_p[i], (int) i, JMEM_CELLOCATOR_CELL_SIZE / 2);
+
+      /* Interleave main heap blocks with the cell pages */
+      if (i % CELL_PAGE_SIZE == 0)
+      {
+        uint8_t *block_p = (uint8_t *) jmem_heap_alloc_block (context_p, BASIC_SIZE);
+        TEST_ASSERT (jmem_cellocator_find (context_p, cellocator_p, block_p) == NULL);
+        jmem_heap_free_block (context_p, block_p, BASIC_SIZE);
+      }
+    }
+
+    TEST_ASSERT (count_cell_pages (context_p) >= page_count + (CELL_COUNT / CELL_PAGE_SIZE));
+
+    for (uint32_t i = 0; i < CELL_COUNT; i++)
+    {
+      jmem_cellocator_page_t *page_p = jmem_cellocator_find (context_p, cellocator_p, cells_p[i]);
+
+      TEST_ASSERT (page_p != NULL);
+      TEST_ASSERT (cells_p[i] >= page_p->start_p && cells_p[i] <= page_p->end_p);
+      TEST_ASSERT (cells_p[i][0] == (uint8_t) i);
+    }
+
+    for (uint32_t i = 0; i < CELL_COUNT; i++)
+    {
+      jmem_heap_free_block (context_p, cells_p[i], JMEM_CELLOCATOR_CELL_SIZE / 2);
+    }
+
+    /* All pages used by the test are empty, only one of them is kept */
+    jmem_cellocator_release_empty_pages (context_p, cellocator_p);
+    TEST_ASSERT (count_cell_pages (context_p) <= page_count + 1);
+  }
+
   ecma_finalize (context_p);
   jmem_finalize (context_p);
   ctx_bootstrap_cleanup (context_p);
@@ -0,0 +1,78 @@
+/* Copyright Light Source Software, LLC and other contributors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jjs-test.h"
+
+#include "ecma-gc.h"
+#include "ecma-helpers.h"
+#include "ecma-init-finalize.h"
+#include "ecma-lcache.h"
+
+/**
+ * Number of properties, which is well below the number of LCache entries.
+ */
+#define PROPERTY_COUNT 32
+
+int
+main (void)
+{
+  jjs_context_t *context_p = ctx_bootstrap (NULL);
+
+  jmem_init (context_p);
+  ecma_init (context_p);
+
+#if JJS_LCACHE
+  /* The names are allocated next to each other, like the variables of a scope. After a lookup
+   * of each name, most of the properties must still be cached, because the names do not share
+   * the same LCache row. */
+  ecma_object_t *object_p = ecma_create_object (context_p, NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_string_t *names_p[PROPERTY_COUNT];
+
+  for (uint32_t i = 0; i < PROPERTY_COUNT; i++)
+  {
+    lit_utf8_byte_t name[] = { 'v', 'a', 'r', 'i', 'a', 'b', 'l', 'e', (lit_utf8_byte_t) ('A' + i) };
+
+    names_p[i] = ecma_new_ecma_string_from_ascii (context_p, name, sizeof (name));
+    ecma_create_named_data_property (context_p, object_p, names_p[i], ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE, NULL);
+  }
+
+  for (uint32_t i = 0; i < PROPERTY_COUNT; i++)
+  {
+    TEST_ASSERT (ecma_find_named_property (context_p, object_p, names_p[i]) != NULL);
+  }
+
+  uint32_t cached_count = 0;
+
+  for (uint32_t i = 0; i < PROPERTY_COUNT; i++)
+  {
+    if (ecma_lcache_lookup (context_p, object_p, names_p[i]) != NULL)
+    {
+      cached_count++;
+    }
+
+    ecma_deref_ecma_string (context_p, names_p[i]);
+  }
+
+  TEST_ASSERT (cached_count >= PROPERTY_COUNT * 3 / 4);
+
+  ecma_deref_object (object_p);
+#endif /* JJS_LCACHE */
+
+  ecma_finalize (context_p);
+  jmem_finalize (context_p);
+  ctx_bootstrap_cleanup (context_p);
+
+  return 0;
+} /* main */
@@ -239,6 +239,112 @@ test_snapshot_with_user (void)
   }
 } /* test_snapshot_with_user */
 
+/**
+ * Snapshot file used by the jjs_exec_snapshot_file tests
+ */
+#define SNAPSHOT_FILE_PATH "test-snapshot-file.snapshot"
+
+static void
+write_snapshot_file (const uint32_t *snapshot_p, size_t snapshot_size)
+{
+  FILE *file_p = fopen (SNAPSHOT_FILE_PATH, "wb");
+  TEST_ASSERT (file_p != NULL);
+  TEST_ASSERT (fwrite (snapshot_p, snapshot_size, 1, file_p) == 1);
+  TEST_ASSERT (fclose (file_p) == 0);
+} /* write_snapshot_file */
+
+static void
+test_snapshot_file_exec (uint32_t exec_snapshot_flags)
+{
+  ctx_open (NULL);
+
+  jjs_value_t functions[2];
+
+  /* every call maps the file again, the functions keep their own mapping alive */
+  for (int i = 0; i < 2; i++)
+  {
+    functions[i] = jjs_exec_snapshot_file_sz (ctx (), SNAPSHOT_FILE_PATH, 0, exec_snapshot_flags, NULL);
+    TEST_ASSERT (!jjs_value_is_exception (ctx (), functions[i]) && jjs_value_is_function (ctx (), functions[i]));
+  }
+
+  jjs_heap_gc (ctx (), JJS_GC_PRESSURE_HIGH);
+
+  for (int i = 0; i < 2; i++)
+  {
+    jjs_value_t args[] = { jjs_number (ctx (), 3), jjs_number (ctx (), 4) };
+    jjs_value_t result = jjs_call (ctx (), functions[i], args, 2, JJS_MOVE);
+
+    TEST_ASSERT (strict_equals_int32 (ctx (), result, 17));
+
+    jjs_value_free (ctx (), result);
+    jjs_value_free (ctx (), functions[i]);
+  }
+
+  ctx_close ();
+} /* test_snapshot_file_exec */
+
+static void
+test_snapshot_file (void)
+{
+  if (!jjs_feature_enabled (JJS_FEATURE_SNAPSHOT_SAVE) || !jjs_feature_enabled (JJS_FEATURE_SNAPSHOT_EXEC))
+  {
+    ctx_open (NULL);
+    jjs_value_t result = jjs_exec_snapshot_file_sz (ctx (), SNAPSHOT_FILE_PATH, 0, 0, NULL);
+    TEST_ASSERT (jjs_value_is_exception (ctx (), result));
+    jjs_value_free (ctx (), result);
+    ctx_close ();
+    return;
+  }
+
+  static uint32_t snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+
+  /* the body is large enough to be executed from the file instead of being copied */
+  const jjs_char_t code_to_snapshot[] = TEST_STRING_LITERAL ("function calc(a, b) {"
+                                                               "  var x = a * b;"
+                                                               "  for (var i = 0; i < 3; i++) { x = x - 1; }"
+                                                               "  return x + a + b + 1;"
+                                                               "}"
+                                                               "calc");
+  ctx_open (NULL);
+
+  jjs_value_t parse_result = jjs_parse (ctx (), code_to_snapshot, sizeof (code_to_snapshot) - 1, NULL);
+  TEST_ASSERT (!jjs_value_is_exception (ctx (), parse_result));
+
+  jjs_value_t generate_result = jjs_generate_snapshot (ctx (), parse_result, 0, snapshot_buffer, SNAPSHOT_BUFFER_SIZE);
+  jjs_value_free (ctx (), parse_result);
+
+  TEST_ASSERT (!jjs_value_is_exception (ctx (), generate_result) && jjs_value_is_number (ctx (), generate_result));
+
+  size_t snapshot_size = (size_t) jjs_value_as_number (ctx (), generate_result);
+  jjs_value_free (ctx (), generate_result);
+
+  ctx_close ();
+
+  write_snapshot_file (snapshot_buffer, snapshot_size);
+
+  test_snapshot_file_exec (0);
+  test_snapshot_file_exec (JJS_SNAPSHOT_EXEC_COPY_DATA);
+
+  ctx_open (NULL);
+
+  jjs_value_t result = jjs_exec_snapshot_file_sz (ctx (), "does-not-exist.snapshot", 0, 0, NULL);
+  TEST_ASSERT (jjs_value_is_exception (ctx (), result));
+  jjs_value_free (ctx (), result);
+
+  result = jjs_exec_snapshot_file (ctx (), jjs_number (ctx (), 1), JJS_MOVE, 0, 0, NULL);
+  TEST_ASSERT (jjs_value_is_exception (ctx (), result));
+  jjs_value_free (ctx (), result);
+
+  /* the mapping is released when loading fails */
+  result = jjs_exec_snapshot_file_sz (ctx (), SNAPSHOT_FILE_PATH, 1, 0, NULL);
+  TEST_ASSERT (jjs_value_is_exception (ctx (), result));
+  jjs_value_free (ctx (), result);
+
+  ctx_close ();
+
+  remove (SNAPSHOT_FILE_PATH);
+} /* test_snapshot_file */
+
 int
 main (void)
 {
@@ -277,6 +383,21 @@ main (void)
     ctx_close ();
 
     test_exec_snapshot (snapshot_buffer, snapshot_size, JJS_SNAPSHOT_EXEC_ALLOW_STATIC);
+
+    /* Static snapshot functions keep the mapped file until the context is freed. */
+    write_snapshot_file (snapshot_buffer, snapshot_size);
+
+    ctx_open (NULL);
+    jjs_register_magic_strings (ctx (), magic_strings,
+                                  sizeof (magic_string_lengths) / sizeof (jjs_length_t),
+                                  magic_string_lengths);
+
+    exec_result = jjs_exec_snapshot_file_sz (ctx (), SNAPSHOT_FILE_PATH, 0, JJS_SNAPSHOT_EXEC_ALLOW_STATIC, NULL);
+    TEST_ASSERT (strict_equals_cstr (ctx (), exec_result, "string from snapshot"));
+    jjs_value_free (ctx (), exec_result);
+
+    ctx_close ();
+    remove (SNAPSHOT_FILE_PATH);
   }
 
   /* Merge snapshot */
@@ -433,5 +554,7 @@ main (void)
 
   test_snapshot_with_user ();
 
+  test_snapshot_file ();
+
   return 0;
 } /* main */
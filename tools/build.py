@@ -108,8 +108,12 @@ def get_arguments():
     coregrp = parser.add_argument_group('jjs-core options')
     coregrp.add_argument('--cpointer-32bit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable 32 bit compressed pointers (%(choices)s)')
+    coregrp.add_argument('--cpu-profiler', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable sampling cpu profiler (%(choices)s)')
     coregrp.add_argument('--error-messages', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable error messages (%(choices)s)')
+    coregrp.add_argument('--heap-snapshot', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable heap snapshot export (%(choices)s)')
     coregrp.add_argument('--jjs-debugger', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable the JJS debugger (%(choices)s)')
     coregrp.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -124,12 +128,18 @@ def get_arguments():
                          help='default size of memory heap (in kilobytes)')
     coregrp.add_argument('--default-vm-cell-count', metavar='SIZE', type=int,
                          help='number of cells per vm cell allocator page')
+    coregrp.add_argument('--default-vm-heap-max-size-kb', metavar='SIZE', type=int,
+                         help='default maximum size of a growable memory heap (in kilobytes)')
+    coregrp.add_argument('--default-vm-heap-step-size-kb', metavar='SIZE', type=int,
+                         help='default minimum size of a growable memory heap segment (in kilobytes)')
     coregrp.add_argument('--default-vm-stack-limit-kb', metavar='SIZE', type=int,
                          help='default maximum stack usage (in kilobytes)')
     coregrp.add_argument('--default-scratch-size-kb', metavar='SIZE', type=int,
                          help='default size of scratch buffer (in kilobytes)')
     coregrp.add_argument('--vm-stack-limit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable stack usage limit checks')
+    coregrp.add_argument('--vm-heap-growable', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable growable vm heap (%(choices)s)')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -154,6 +164,8 @@ def get_arguments():
                          help='enable VM execution stop callback (%(choices)s)')
     coregrp.add_argument('--vm-throw', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM throw callback (%(choices)s)')
+    coregrp.add_argument('--vm-computed-goto', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable computed goto dispatch in the VM loop (%(choices)s)')
 
     coregrp.add_argument('--platform-api-io-write', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable default implementation of platform.io.write (%(choices)s)')
@@ -161,6 +173,10 @@ def get_arguments():
                          help='enable default implementation of platform.io.flush (%(choices)s)')
     coregrp.add_argument('--platform-api-fs-read-file', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable default implementation of platform.fs.read_file (%(choices)s)')
+    coregrp.add_argument('--platform-api-fs-write-file', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable default implementation of platform.fs.write_file (%(choices)s)')
+    coregrp.add_argument('--platform-api-fs-map-file', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable default implementation of platform.fs.map_file (%(choices)s)')
     coregrp.add_argument('--platform-api-path-cwd', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable default implementation of platform.path.cwd (%(choices)s)')
     coregrp.add_argument('--platform-api-path-realpath', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -214,7 +230,9 @@ def generate_build_options(arguments):
 
     # jjs-core options
     build_options_append('JJS_CPOINTER_32_BIT', arguments.cpointer_32bit)
+    build_options_append('JJS_CPU_PROFILER', arguments.cpu_profiler)
     build_options_append('JJS_ERROR_MESSAGES', arguments.error_messages)
+    build_options_append('JJS_HEAP_SNAPSHOT', arguments.heap_snapshot)
     build_options_append('JJS_DEBUGGER', arguments.jjs_debugger)
     build_options_append('JJS_PARSER', arguments.js_parser)
     build_options_append('JJS_FUNCTION_TO_STRING', arguments.function_to_string)
@@ -222,6 +240,8 @@ def generate_build_options(arguments):
     build_options_append('JJS_LOGGING', arguments.logging)
     build_options_append('JJS_DEFAULT_VM_HEAP_SIZE_KB', arguments.default_vm_heap_size_kb)
     build_options_append('JJS_DEFAULT_VM_CELL_COUNT', arguments.default_vm_cell_count)
+    build_options_append('JJS_DEFAULT_VM_HEAP_MAX_SIZE_KB', arguments.default_vm_heap_max_size_kb)
+    build_options_append('JJS_DEFAULT_VM_HEAP_STEP_SIZE_KB', arguments.default_vm_heap_step_size_kb)
     build_options_append('JJS_DEFAULT_VM_STACK_LIMIT_KB', arguments.default_vm_stack_limit_kb)
     build_options_append('JJS_DEFAULT_SCRATCH_SIZE_KB', arguments.default_scratch_size_kb)
     build_options_append('JJS_MEM_STATS', arguments.mem_stats)
@@ -236,12 +256,16 @@ def generate_build_options(arguments):
     build_options_append('JJS_VALGRIND', arguments.valgrind)
     build_options_append('JJS_VM_HALT', arguments.vm_exec_stop)
     build_options_append('JJS_VM_THROW', arguments.vm_throw)
+    build_options_append('JJS_VM_COMPUTED_GOTO', arguments.vm_computed_goto)
     build_options_append('JJS_VM_STACK_LIMIT', arguments.vm_stack_limit)
+    build_options_append('JJS_VM_HEAP_GROWABLE', arguments.vm_heap_growable)
 
     # platform api options
     build_options_append('JJS_PLATFORM_API_IO_WRITE', arguments.platform_api_io_write)
     build_options_append('JJS_PLATFORM_API_IO_FLUSH', arguments.platform_api_io_flush)
     build_options_append('JJS_PLATFORM_API_FS_READ_FILE', arguments.platform_api_fs_read_file)
+    build_options_append('JJS_PLATFORM_API_FS_WRITE_FILE', arguments.platform_api_fs_write_file)
+    build_options_append('JJS_PLATFORM_API_FS_MAP_FILE', arguments.platform_api_fs_map_file)
     build_options_append('JJS_PLATFORM_API_PATH_CWD', arguments.platform_api_path_cwd)
     build_options_append('JJS_PLATFORM_API_PATH_REALPATH', arguments.platform_api_path_realpath)
     build_options_append('JJS_PLATFORM_API_TIME_NOW_MS', arguments.platform_api_time_now_ms)